@@ -0,0 +1,1884 @@
+/** @file *************************************************************************************************************
+  *
+  *
+  * Component   Fixed Point Arithmetic
+  *
+  * Filename    Benchmark.c
+  *
+  * @brief      Benchmark suite of the test application.
+  *
+  *            The benchmarks are executed after the test report when the application is started
+  *            with the command line option --bench. Timing uses the high resolution performance
+  *            counter. Results are printed to the console.
+  *
+  *            Benchmarks:
+  *            - Job queue: submit-to-complete latency per job size and throughput of coalesced small jobs.
+  *            - File pipeline: throughput of a recording replayed per sample, per block through the
+  *              streaming pipeline (read only and read-transform-write, synchronous I/O without overlap),
+  *              from a read-only memory mapping of the file and from memory.
+  *            - Trace: cost of one recorded trace event (FIXEDPOINT_TRACE_ENABLE only).
+  *            - Non-temporal stores: producer throughput of a large batch kernel and the time of a
+  *              following coefficient table lookup stage, with regular and non-temporal stores.
+  *            - Layout: deinterleave of 2, 3, 4, 8 and 16 channels and a 2048 x 2048 transpose against
+  *              the plain scalar loops.
+  *            - Convolution: direct form FIR against the convolution engine across filter lengths,
+  *              with the largest and RMS deviation of the FFT path from the exact direct form.
+  *            - Correlation: time per call of a scalar 64-bit loop, the direct path, the FFT path and
+  *              the path chosen by the default FFT cost over the number of lags, up to all lags.
+  *            - Adaptive filter: time per sample of a scalar LMS loop with 64-bit coefficients and of
+  *              the LMS and NLMS kernels over the number of taps.
+  *            - Interpolation: time per curve and map lookup of random and slowly moving inputs over
+  *              the number of sample points.
+  *            - Control blocks: time per instance and step of single instances against the banks.
+  *            - Target DSP emulation: time per element of the scalar emulation against the array kernels
+  *              for each emulated instruction set.
+  *            - Simulation: time per instance and step of many controller instances, instance by instance
+  *              against the SIMD lane runtime with 1, 2 and 4 threads.
+  *            - Integration: time per system and RK4 step of many first-order systems, one call per system
+  *              against one batched call, in 16 and 32 bit.
+  *
+  *            Roofline (command line option --roofline <file>): in-cache 16-bit multiply-add throughput
+  *            (compute roof), copy and triad bandwidth over buffers larger than the last level cache
+  *            (memory roof) and the achieved throughput of the batch kernels across problem sizes,
+  *            written as CSV for Tools/plot_roofline.py.
+  *
+  * @author     agent
+  *
+  * @verbatim
+  ***********************************************************************************************************************
+  * Changes                                                                                                             *
+  ***********************************************************************************************************************
+  *
+  * Version   Date        Sign  Description
+  * --------  ----------  ----  -----------
+  * 01.00.00  2026-10-18  AGT    Initial check in
+  * 01.01.00  2026-10-18  AGT    Added file pipeline benchmark.
+  * 01.02.00  2026-10-18  AGT    Added trace event overhead benchmark.
+  * 01.03.00  2026-10-18  AGT    Added roofline measurement.
+  * 01.04.00  2026-10-18  AGT    Added non-temporal store benchmark.
+  * 01.05.00  2026-10-18  AGT    Added layout transform benchmark.
+  * 01.06.00  2026-10-18  AGT    Added convolution benchmark.
+  * 01.07.00  2026-10-18  AGT    Added correlation benchmark.
+  * 01.08.00  2026-10-18  AGT    Added adaptive filter benchmark.
+  * 01.09.00  2026-10-18  AGT    Added interpolation benchmark.
+  * 01.10.00  2026-10-18  AGT    Added control block benchmark.
+  * 01.11.00  2026-10-18  AGT    Added target DSP emulation benchmark.
+  * 01.12.00  2026-10-18  AGT    Added simulation runtime benchmark.
+  * 01.13.00  2026-10-18  AGT    Added ODE integration benchmark.
+  * 01.14.00  2026-10-18  AGT    Noted the synchronous I/O of the file pipeline.
+  * 01.15.00  2026-10-18  AGT    Correlation over all lags and with the default FFT cost.
+  * 01.16.00  2026-10-18  AGT    Added memory-mapped replay to the file pipeline benchmark.
+  *
+  * @endverbatim
+  **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ INCLUDES
+**********************************************************************************************************************/
+#include <Windows.h>
+#include <stdio.h>
+#include <math.h>
+#include "Global_Types.h"
+#include "FixedPoint.h"
+#include "FixedPoint_Job.h"
+#include "FixedPoint_Stream.h"
+#include "FixedPoint_Trace.h"
+#include "FixedPoint_Layout.h"
+#include "FixedPoint_Conv.h"
+#include "FixedPoint_Corr.h"
+#include "FixedPoint_Lms.h"
+#include "FixedPoint_Interp.h"
+#include "FixedPoint_Ctrl.h"
+#include "FixedPoint_Dsp.h"
+#include "FixedPoint_Sim.h"
+#include "FixedPoint_Integ.h"
+#include "Benchmark.h"
+
+/** @addtogroup g_TestHarness
+ *  @{
+ */
+
+/***********************************************************************************************************************
+ MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of elements of the benchmark buffers. */
+#define BENCH_BUFFER_LEN        (65536U)
+
+/** @brief Number of repetitions of a latency measurement. */
+#define BENCH_LATENCY_RUNS      (1000U)
+
+/** @brief Number of elements of one small job in the coalescing benchmark. */
+#define BENCH_SMALL_JOB_LEN     (64U)
+
+/** @brief Number of benchmark buffers written to the recording of the file pipeline benchmark (16 MiB). */
+#define BENCH_FILE_BUFFERS      (128U)
+
+/** @brief Block length of the file pipeline benchmark. */
+#define BENCH_FILE_BLOCK_LEN    (4096U)
+
+/** @brief Recording written and removed by the file pipeline benchmark. */
+#define BENCH_FILE_IN           "FixedPoint_BenchIn.bin"
+
+/** @brief Output file written and removed by the file pipeline benchmark. */
+#define BENCH_FILE_OUT          "FixedPoint_BenchOut.bin"
+
+/** @brief Largest problem size of the roofline sweep in elements (three 8 MiB buffers, beyond the last level cache). */
+#define BENCH_ROOF_MAX_LEN      (4194304U)
+
+/** @brief Number of problem sizes of the roofline sweep (1 Ki .. 4 Mi elements, factor 4). */
+#define BENCH_ROOF_SIZES        (7U)
+
+/** @brief Elements processed by one roofline pass, as repetitions of the current problem size. */
+#define BENCH_ROOF_WORK         (16777216U)
+
+/** @brief Timed passes per roofline measurement, the fastest one is reported. */
+#define BENCH_ROOF_PASSES       (3U)
+
+/** @brief Elements of the in-cache buffers of the compute roof (3 x 4 KiB, fits in L1). */
+#define BENCH_ROOF_PEAK_LEN     (2048U)
+
+/** @brief Number of taps of the FIR filter in the roofline sweep. */
+#define BENCH_ROOF_FIR_TAPS     (16U)
+
+/** @brief Number of kernels of the roofline sweep. */
+#define BENCH_ROOF_KERNELS      (6U)
+
+/** @brief Number of entries of the coefficient table of the downstream stage (1 MiB). */
+#define BENCH_NT_COEFFS         (524288U)
+
+/** @brief Number of table lookups of one run of the downstream stage. */
+#define BENCH_NT_LOOKUPS        (65536U)
+
+/** @brief Number of producer and downstream stage runs per store mode. */
+#define BENCH_NT_RUNS           (10U)
+
+/** @brief Largest filter length of the convolution benchmark. */
+#define BENCH_CONV_MAX_TAPS     (4096U)
+
+/** @brief Block length (latency) of the FFT path in the convolution benchmark. */
+#define BENCH_CONV_BLOCK_LEN    (256U)
+
+/** @brief Signal length of the correlation benchmark. */
+#define BENCH_CORR_LEN          (2048U)
+
+/** @brief Transform length of the FFT path in the correlation benchmark (>= 2 * BENCH_CORR_LEN - 1). */
+#define BENCH_CORR_FFT_LEN      (4096U)
+
+/** @brief Calls per measurement of the correlation benchmark. */
+#define BENCH_CORR_RUNS         (20U)
+
+/** @brief Largest number of taps of the adaptive filter benchmark. */
+#define BENCH_LMS_MAX_TAPS      (1024U)
+
+/** @brief Samples per measurement of the adaptive filter benchmark. */
+#define BENCH_LMS_LEN           (8192U)
+
+/** @brief Block length of the adaptive filter kernels in the benchmark. */
+#define BENCH_LMS_BLOCK_LEN     (256U)
+
+/** @brief Largest number of sample points per axis of the interpolation benchmark. */
+#define BENCH_INTERP_MAX_POINTS (128U)
+
+/** @brief Instances of the control block benchmark. */
+#define BENCH_CTRL_INSTANCES    (4096U)
+
+/** @brief Steps per measurement of the control block benchmark. */
+#define BENCH_CTRL_STEPS        (64U)
+
+/** @brief Instances of the simulation benchmark. */
+#define BENCH_SIM_INSTANCES     (16384U)
+
+/** @brief Registers per instance of the simulated PI controller. */
+#define BENCH_SIM_REGS          (14U)
+
+/** @brief Steps of the simulated PI controller. */
+#define BENCH_SIM_STEPS         (12U)
+
+/** @brief Executions of the algorithm per measurement of the simulation benchmark. */
+#define BENCH_SIM_ITERATIONS    (16U)
+
+/** @brief Largest number of threads of the simulation benchmark. */
+#define BENCH_SIM_MAX_THREADS   (4U)
+
+/** @brief Systems of the ODE integration benchmark. */
+#define BENCH_INTEG_SYSTEMS     (4096U)
+
+/** @brief RK4 steps per measurement of the ODE integration benchmark. */
+#define BENCH_INTEG_STEPS       (16U)
+
+/***********************************************************************************************************************
+ TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Kernel of the roofline sweep with its work and traffic per element. */
+typedef struct
+{
+    const char* name;   /**< Kernel name in the CSV output */
+    double      ops;    /**< Integer operations per element */
+    double      bytes;  /**< Bytes moved from and to memory per element */
+} BenchRoofKernel_t;
+
+/***********************************************************************************************************************
+ LOCAL VARIABLES
+**********************************************************************************************************************/
+
+static t_Fixed16 BenchBufA[BENCH_BUFFER_LEN];       /**< First input buffer */
+static t_Fixed16 BenchBufB[BENCH_BUFFER_LEN];       /**< Second input buffer */
+static t_Fixed16 BenchBufR[BENCH_BUFFER_LEN];       /**< Result buffer */
+static FixedPoint_JobQueue_t BenchQueue;            /**< Job queue under test */
+static double BenchCompletionTime;                  /**< Completion time stamp set by the job callback */
+
+static t_Fixed16 BenchRoofA[BENCH_ROOF_MAX_LEN];    /**< First roofline input buffer */
+static t_Fixed16 BenchRoofB[BENCH_ROOF_MAX_LEN];    /**< Second roofline input buffer */
+static t_Fixed16 BenchRoofR[BENCH_ROOF_MAX_LEN];    /**< Roofline result buffer */
+static float BenchRoofF[BENCH_ROOF_MAX_LEN];        /**< Roofline input of the float conversion */
+static t_Fixed16 BenchRoofDelay[BENCH_ROOF_FIR_TAPS - 1U];  /**< Delay line of the roofline FIR filter */
+static volatile t_Fixed16 BenchRoofSink;            /**< Keeps otherwise unused results alive */
+static t_Fixed16 BenchCoeffs[BENCH_NT_COEFFS];      /**< Coefficient table of the downstream stage */
+
+static t_Fixed16 BenchConvCoeffs[BENCH_CONV_MAX_TAPS];                  /**< Filter of the convolution benchmark */
+static t_Fixed16 BenchConvDelayFir[BENCH_CONV_MAX_TAPS - 1U];           /**< Delay line of the direct form */
+static t_Fixed16 BenchConvDelay[BENCH_CONV_MAX_TAPS - 1U];              /**< Delay line of the convolution engine */
+static FixedPoint_Complex32_t BenchConvWork[FIXEDPOINT_CONV_WORKSPACE_LEN(BENCH_CONV_MAX_TAPS, BENCH_CONV_BLOCK_LEN)];
+                                                                        /**< Workspace of the FFT path */
+static FixedPoint_Complex32_t BenchCorrWork[FIXEDPOINT_CORR_WORKSPACE_LEN(BENCH_CORR_FFT_LEN)];
+                                                                        /**< Workspace of the correlation FFT path */
+/** @brief Coefficients and state of the adaptive filter kernels and coefficients of the scalar loop. */
+static sint16 BenchLmsCoeffs[FIXEDPOINT_LMS_COEFF_LEN(BENCH_LMS_MAX_TAPS)];
+static t_Fixed16 BenchLmsState[FIXEDPOINT_LMS_STATE_LEN(BENCH_LMS_MAX_TAPS, BENCH_LMS_BLOCK_LEN)];
+static sint64 BenchLmsRef[BENCH_LMS_MAX_TAPS];
+/** @brief Axis and values of the interpolation benchmark. */
+static t_Fixed16 BenchInterpAxis[BENCH_INTERP_MAX_POINTS];
+static t_Fixed16 BenchInterpValues[BENCH_INTERP_MAX_POINTS * BENCH_INTERP_MAX_POINTS];
+/** @brief Single instances, bank states and parameters of the control block benchmark. */
+static FixedPoint_RateLimit16_t BenchCtrlRl[BENCH_CTRL_INSTANCES];
+static FixedPoint_LowPass16_t BenchCtrlLp[BENCH_CTRL_INSTANCES];
+static FixedPoint_Debounce_t BenchCtrlDb[BENCH_CTRL_INSTANCES];
+static t_Fixed16 BenchCtrlY[BENCH_CTRL_INSTANCES];
+static uint16 BenchCtrlFrac[BENCH_CTRL_INSTANCES];
+static uint16 BenchCtrlTimes[BENCH_CTRL_INSTANCES];
+static uint16 BenchCtrlCount[BENCH_CTRL_INSTANCES];
+static boolean BenchCtrlIn[BENCH_CTRL_INSTANCES + BENCH_CTRL_STEPS];
+static boolean BenchCtrlState[BENCH_CTRL_INSTANCES];
+
+static FixedPoint_Sim_t BenchSimState;
+static t_Fixed16 BenchSimRegs[FIXEDPOINT_SIM_REGS_LEN(BENCH_SIM_REGS, BENCH_SIM_INSTANCES)];
+static uint8 BenchSimStatus[FIXEDPOINT_SIM_STATUS_LEN(BENCH_SIM_INSTANCES)];
+static t_Fixed16 BenchSimScalar[BENCH_SIM_INSTANCES * BENCH_SIM_REGS];
+
+static t_Fixed16 BenchIntegGain16[BENCH_INTEG_SYSTEMS];
+static t_Fixed16 BenchIntegX16[BENCH_INTEG_SYSTEMS];
+static t_Fixed16 BenchIntegStage16[FIXEDPOINT_ODE_STAGE_LEN(1U, BENCH_INTEG_SYSTEMS)];
+static t_Fixed32 BenchIntegGain32[BENCH_INTEG_SYSTEMS];
+static t_Fixed32 BenchIntegX32[BENCH_INTEG_SYSTEMS];
+static t_Fixed32 BenchIntegStage32[FIXEDPOINT_ODE_STAGE_LEN(1U, BENCH_INTEG_SYSTEMS)];
+static sint64 BenchIntegAcc[FIXEDPOINT_ODE_ACC_LEN(1U, BENCH_INTEG_SYSTEMS)];
+
+/** @brief PI controller with anti-windup and first-order plant. Registers: 0 w, 1 y, 2 kp, 3 ki, 4 integral,
+ *         5 umin, 6 umax, 7 alpha, 8 e, 9 ki * e, 10 u, 11 dy, 12 gain, 13 last u. */
+static const FixedPoint_SimStep_t BenchSimSteps[BENCH_SIM_STEPS] =
+{
+    { FIXEDPOINT_SIM_SUB,  8U,  0U,  1U },
+    { FIXEDPOINT_SIM_MULT, 9U,  3U,  8U },
+    { FIXEDPOINT_SIM_ADD,  4U,  4U,  9U },
+    { FIXEDPOINT_SIM_MAX,  4U,  4U,  5U },
+    { FIXEDPOINT_SIM_MIN,  4U,  4U,  6U },
+    { FIXEDPOINT_SIM_MULT, 10U, 2U,  8U },
+    { FIXEDPOINT_SIM_ADD,  10U, 10U, 4U },
+    { FIXEDPOINT_SIM_DIV,  10U, 10U, 12U },
+    { FIXEDPOINT_SIM_SUB,  11U, 10U, 1U },
+    { FIXEDPOINT_SIM_MULT, 11U, 7U,  11U },
+    { FIXEDPOINT_SIM_ADD,  1U,  1U,  11U },
+    { FIXEDPOINT_SIM_MOV,  13U, 10U, 0U }
+};
+
+/** @brief Kernels of the roofline sweep. Operations count one multiply-accumulate as two. The FIR
+ *         coefficients and delay line stay in cache, so only input and output are memory traffic. */
+static const BenchRoofKernel_t BenchRoofKernels[BENCH_ROOF_KERNELS] =
+{
+    { "add16_array",        1.0,                               6.0 },
+    { "mult16_array",       1.0,                               6.0 },
+    { "div16_array",        1.0,                               6.0 },
+    { "float_to_fix16",     1.0,                               6.0 },
+    { "dot16",              2.0,                               4.0 },
+    { "fir16",              2.0 * (double)BENCH_ROOF_FIR_TAPS, 4.0 }
+};
+
+/***********************************************************************************************************************
+ LOCAL FUNCTION PROTOTYPES
+ **********************************************************************************************************************/
+static double BenchNow(void);
+static void BenchFill(void);
+static void BenchJobDone(FixedPoint_JobHandle_t handle, Std_ReturnType status, void* context);
+static void BenchJobLatency(void);
+static void BenchJobCoalescing(void);
+static Std_ReturnType BenchDiscard(void* context, const FixedPoint_Block16_t* in, FixedPoint_Block16_t* out,
+                                   boolean* end);
+static double BenchFilePipeline(boolean writeOutput);
+static double BenchFileMapped(void);
+static void BenchFileThroughput(void);
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+static uint64 BenchTraceClock(void);
+static void BenchTraceOverhead(void);
+#endif
+static void BenchRoofFill(void);
+static double BenchRoofPeak(void);
+static double BenchRoofStream(boolean triad);
+static double BenchRoofKernel(uint32 kernel, uint32 len);
+static double BenchCoeffStage(void);
+static void BenchNonTemporal(void);
+static void BenchLayout(void);
+static void BenchConv(void);
+static void BenchCorr(void);
+static void BenchLms(void);
+static void BenchInterp(void);
+static void BenchCtrl(void);
+static void BenchDsp(void);
+static DWORD WINAPI BenchSimWorker(LPVOID arg);
+static void BenchSim(void);
+static Std_ReturnType BenchIntegRhs16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num);
+static Std_ReturnType BenchIntegRhs32(void* context, const t_Fixed32* x, t_Fixed32* dxdt, uint32 num);
+static void BenchInteg(void);
+
+/***********************************************************************************************************************
+ LOCAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Current time of the performance counter in microseconds.
+ *
+ *  @return     double
+ *  @retval     Time stamp in microseconds.
+ */
+static double BenchNow(void)
+{
+    LARGE_INTEGER count;
+    LARGE_INTEGER freq;
+
+    (void)QueryPerformanceCounter(&count);
+    (void)QueryPerformanceFrequency(&freq);
+
+    return ((double)count.QuadPart * 1.0e6) / (double)freq.QuadPart;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Fill the input buffers with a deterministic pattern within the typical range.
+ */
+static void BenchFill(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+    {
+        BenchBufA[i] = (t_Fixed16)((sint32)(i % 2048U) - 1024);
+        BenchBufB[i] = (t_Fixed16)((sint32)((i * 7U) % 512U) + 1);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Job completion callback recording the completion time.
+ *
+ *  @param[in]  handle      Handle of the completed job (unused).
+ *  @param[in]  status      Job status (unused).
+ *  @param[in]  context     Application context (unused).
+ */
+static void BenchJobDone(FixedPoint_JobHandle_t handle, Std_ReturnType status, void* context)
+{
+    (void)handle;
+    (void)status;
+    (void)context;
+
+    BenchCompletionTime = BenchNow();
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Submit-to-complete latency of single multiplication jobs of different sizes.
+ *
+ *  Each run submits one job and processes the queue immediately, so the measured latency is the
+ *  queue overhead plus the kernel time, without any scheduling delay of a worker.
+ */
+static void BenchJobLatency(void)
+{
+    static const uint32 sizes[4] = { 64U, 1024U, 16384U, BENCH_BUFFER_LEN };
+    uint32 s;
+
+    printf("\n[BENCH] Job queue submit-to-complete latency (us)\n");
+    printf("%8s %10s %10s %10s\n", "size", "mean", "min", "max");
+
+    for (s = 0U; s < 4U; s++)
+    {
+        FixedPoint_JobDesc_t desc;
+        double sum = 0.0;
+        double minLat = 1.0e30;
+        double maxLat = 0.0;
+        uint32 run;
+
+        desc.kind = FIXEDPOINT_JOB_OP16;
+        desc.op = FIXEDPOINT_OP_MULT;
+        desc.in1 = BenchBufA;
+        desc.in2 = BenchBufB;
+        desc.out = BenchBufR;
+        desc.len = sizes[s];
+        desc.fir = NULL;
+        desc.callback = &BenchJobDone;
+        desc.context = NULL;
+
+        for (run = 0U; run < BENCH_LATENCY_RUNS; run++)
+        {
+            FixedPoint_JobHandle_t handle = FIXEDPOINT_JOB_INVALID_HANDLE;
+            const double start = BenchNow();
+            double latency;
+
+            (void)FixedPoint_Job_Submit(&BenchQueue, &desc, &handle);
+            (void)FixedPoint_Job_Process(&BenchQueue, 1U, NULL);
+
+            latency = BenchCompletionTime - start;
+            sum += latency;
+            minLat = (latency < minLat) ? latency : minLat;
+            maxLat = (latency > maxLat) ? latency : maxLat;
+        }
+
+        printf("%8lu %10.3f %10.3f %10.3f\n", (unsigned long)sizes[s], sum / (double)BENCH_LATENCY_RUNS, minLat, maxLat);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Throughput of many small jobs with and without coalescing.
+ *
+ *  The same set of small jobs is submitted once in buffer order (adjacent, coalesced) and once in
+ *  reverse order (not adjacent, executed one by one).
+ */
+static void BenchJobCoalescing(void)
+{
+    const uint32 jobs = FIXEDPOINT_JOB_QUEUE_SIZE;
+    uint32 pass;
+
+    printf("\n[BENCH] Job queue: %lu jobs of %lu elements\n", (unsigned long)jobs, (unsigned long)BENCH_SMALL_JOB_LEN);
+
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        double start;
+        double elapsed;
+        uint32 coalescedBefore = BenchQueue.coalesced;
+        uint32 rep;
+        uint32 j;
+
+        start = BenchNow();
+
+        for (rep = 0U; rep < BENCH_LATENCY_RUNS; rep++)
+        {
+            for (j = 0U; j < jobs; j++)
+            {
+                FixedPoint_JobDesc_t desc;
+                FixedPoint_JobHandle_t handle = FIXEDPOINT_JOB_INVALID_HANDLE;
+                const uint32 block = (pass == 0U) ? j : ((jobs - 1U) - j);
+
+                desc.kind = FIXEDPOINT_JOB_OP16;
+                desc.op = FIXEDPOINT_OP_ADD;
+                desc.in1 = &BenchBufA[block * BENCH_SMALL_JOB_LEN];
+                desc.in2 = &BenchBufB[block * BENCH_SMALL_JOB_LEN];
+                desc.out = &BenchBufR[block * BENCH_SMALL_JOB_LEN];
+                desc.len = BENCH_SMALL_JOB_LEN;
+                desc.fir = NULL;
+                desc.callback = &BenchJobDone;
+                desc.context = NULL;
+
+                (void)FixedPoint_Job_Submit(&BenchQueue, &desc, &handle);
+            }
+
+            (void)FixedPoint_Job_Process(&BenchQueue, jobs, NULL);
+        }
+
+        elapsed = BenchNow() - start;
+
+        printf("%-14s %10.4f us/job  coalesced=%lu\n", (pass == 0U) ? "adjacent" : "non-adjacent",
+               elapsed / ((double)BENCH_LATENCY_RUNS * (double)jobs),
+               (unsigned long)(BenchQueue.coalesced - coalescedBefore));
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Sink stage counting the samples of each block without storing them.
+ *
+ *  @param[in,out]  context     uint32 sample counter.
+ *  @param[in]      in          Block to consume.
+ *  @param[out]     out         Unused (sink).
+ *  @param[out]     end         Unused.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Always.
+ */
+static Std_ReturnType BenchDiscard(void* context, const FixedPoint_Block16_t* in, FixedPoint_Block16_t* out,
+                                   boolean* end)
+{
+    (void)out;
+    (void)end;
+
+    *(uint32*)context += in->len;
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Replay the recording through source -> gain -> sink once.
+ *
+ *  @param[in]  writeOutput     1 to write the result to BENCH_FILE_OUT, 0 to discard it.
+ *
+ *  @return     double
+ *  @retval     Elapsed time in microseconds (negative if a file could not be opened).
+ */
+static double BenchFilePipeline(boolean writeOutput)
+{
+    FixedPoint_Stream_t stream;
+    FixedPoint_StreamFile_t source;
+    FixedPoint_StreamFile_t sink;
+    FixedPoint_StreamScalarOp_t gain;
+    uint32 discarded = 0U;
+    double elapsed = -1.0;
+    double start;
+
+    start = BenchNow();
+    source.file = fopen(BENCH_FILE_IN, "rb");
+    source.samples = 0U;
+    sink.file = (writeOutput != 0U) ? fopen(BENCH_FILE_OUT, "wb") : NULL;
+    sink.samples = 0U;
+    gain.op = FIXEDPOINT_OP_MULT;
+    gain.operand = (t_Fixed16)(SCALE_16 / 2U);
+
+    if ((source.file != NULL) && ((writeOutput == 0U) || (sink.file != NULL)))
+    {
+        (void)FixedPoint_Stream_Init(&stream, &BenchBufR[0], &BenchBufR[BENCH_FILE_BLOCK_LEN], BENCH_FILE_BLOCK_LEN);
+        (void)FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_FileSource, &source);
+        (void)FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ScalarOp, &gain);
+
+        if (writeOutput != 0U)
+        {
+            (void)FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_FileSink, &sink);
+        }
+        else
+        {
+            (void)FixedPoint_Stream_AddStage(&stream, &BenchDiscard, &discarded);
+        }
+
+        (void)FixedPoint_Stream_Run(&stream);
+    }
+
+    if (sink.file != NULL)
+    {
+        (void)fclose(sink.file);
+    }
+
+    if (source.file != NULL)
+    {
+        (void)fclose(source.file);
+        elapsed = BenchNow() - start;
+    }
+
+    return elapsed;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Replay the recording through the gain kernel directly from a read-only mapping of the file.
+ *
+ *  The kernel reads the mapped pages, so the samples are not copied into a buffer first. Opening,
+ *  mapping and the page faults of the first access are part of the measured time.
+ *
+ *  @return     double
+ *  @retval     Elapsed time in microseconds (negative if the file could not be mapped).
+ */
+static double BenchFileMapped(void)
+{
+    const t_Fixed16 gain = (t_Fixed16)(SCALE_16 / 2U);
+    const double start = BenchNow();
+    double elapsed = -1.0;
+    HANDLE file;
+
+    file = CreateFileA(BENCH_FILE_IN, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file != INVALID_HANDLE_VALUE)
+    {
+        const HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0U, 0U, NULL);
+
+        if (mapping != NULL)
+        {
+            const t_Fixed16* const view = (const t_Fixed16*)MapViewOfFile(mapping, FILE_MAP_READ, 0U, 0U, 0U);
+
+            if (view != NULL)
+            {
+                uint32 i;
+
+                for (i = 0U; i < BENCH_FILE_BUFFERS; i++)
+                {
+                    (void)FixedPoint_Op16_Strided(FIXEDPOINT_OP_MULT, &view[i * BENCH_BUFFER_LEN], 1, &gain, 0,
+                                                  BenchBufR, 1, BENCH_BUFFER_LEN);
+                }
+                (void)UnmapViewOfFile(view);
+                elapsed = BenchNow() - start;
+            }
+            (void)CloseHandle(mapping);
+        }
+        (void)CloseHandle(file);
+    }
+
+    return elapsed;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Throughput of replaying a recording through a gain stage.
+ *
+ *  Compares one fread() per sample, the block-based pipeline (read only and read-transform-write),
+ *  the kernel on a memory mapping of the file and the same kernel on data already in memory, which
+ *  is the upper bound for any I/O path.
+ */
+static void BenchFileThroughput(void)
+{
+    const double mib = ((double)BENCH_FILE_BUFFERS * (double)BENCH_BUFFER_LEN * (double)sizeof(t_Fixed16))
+                       / (1024.0 * 1024.0);
+    const t_Fixed16 gain = (t_Fixed16)(SCALE_16 / 2U);
+    FILE* file;
+    double start;
+    double elapsed;
+    uint32 i;
+
+    printf("\n[BENCH] File pipeline: %.0f MiB recording, block %lu samples (MiB/s)\n", mib,
+           (unsigned long)BENCH_FILE_BLOCK_LEN);
+
+    file = fopen(BENCH_FILE_IN, "wb");
+    if (file == NULL)
+    {
+        printf("recording could not be created, skipped\n");
+    }
+    else
+    {
+        for (i = 0U; i < BENCH_FILE_BUFFERS; i++)
+        {
+            (void)fwrite(BenchBufA, sizeof(t_Fixed16), BENCH_BUFFER_LEN, file);
+        }
+        (void)fclose(file);
+
+        /* One fread() and one kernel call per sample */
+        file = fopen(BENCH_FILE_IN, "rb");
+        if (file != NULL)
+        {
+            t_Fixed16 sample;
+
+            start = BenchNow();
+            while (fread(&sample, sizeof(t_Fixed16), 1U, file) == 1U)
+            {
+                (void)FixedPoint_Mult16_Array(&sample, &gain, &sample, 1U);
+            }
+            elapsed = BenchNow() - start;
+            (void)fclose(file);
+            printf("%-22s %10.1f\n", "per-sample read", mib / (elapsed * 1.0e-6));
+        }
+
+        elapsed = BenchFilePipeline(0U);
+        printf("%-22s %10.1f\n", "block pipeline", mib / (elapsed * 1.0e-6));
+
+        elapsed = BenchFilePipeline(1U);
+        printf("%-22s %10.1f\n", "block pipeline + write", mib / (elapsed * 1.0e-6));
+
+        elapsed = BenchFileMapped();
+        if (elapsed < 0.0)
+        {
+            printf("%-22s %10s\n", "memory-mapped", "n/a");
+        }
+        else
+        {
+            printf("%-22s %10.1f\n", "memory-mapped", mib / (elapsed * 1.0e-6));
+        }
+
+        /* Same kernel without I/O */
+        start = BenchNow();
+        for (i = 0U; i < BENCH_FILE_BUFFERS; i++)
+        {
+            (void)FixedPoint_Op16_Strided(FIXEDPOINT_OP_MULT, BenchBufA, 1, &gain, 0, BenchBufR, 1, BENCH_BUFFER_LEN);
+        }
+        elapsed = BenchNow() - start;
+        printf("%-22s %10.1f\n", "in memory", mib / (elapsed * 1.0e-6));
+
+        (void)remove(BENCH_FILE_IN);
+        (void)remove(BENCH_FILE_OUT);
+    }
+}
+
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Time source of the trace: performance counter ticks.
+ *
+ *  @return     uint64
+ *  @retval     Current counter value.
+ */
+static uint64 BenchTraceClock(void)
+{
+    LARGE_INTEGER count;
+
+    (void)QueryPerformanceCounter(&count);
+
+    return (uint64)count.QuadPart;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Cost of one recorded trace event.
+ *
+ *  Fills the event buffer of the calling thread with begin/end pairs, flushing (not timed) whenever
+ *  it is full, so that only recorded events are measured.
+ */
+static void BenchTraceOverhead(void)
+{
+    const uint32 pairs = FIXEDPOINT_TRACE_BUFFER_SIZE / 2U;
+    LARGE_INTEGER freq;
+    FILE* file = tmpfile();
+    double elapsed = 0.0;
+    uint32 rep;
+    uint32 i;
+
+    (void)QueryPerformanceFrequency(&freq);
+    (void)FixedPoint_Trace_Init(&BenchTraceClock, (double)freq.QuadPart / 1.0e6);
+    (void)FixedPoint_Trace_Flush(file, NULL);
+
+    for (rep = 0U; rep < 100U; rep++)
+    {
+        const double start = BenchNow();
+
+        for (i = 0U; i < pairs; i++)
+        {
+            FIXEDPOINT_TRACE_BEGIN("Bench");
+            FIXEDPOINT_TRACE_END("Bench");
+        }
+
+        elapsed += BenchNow() - start;
+        (void)FixedPoint_Trace_Flush(file, NULL);
+    }
+
+    if (file != NULL)
+    {
+        (void)fclose(file);
+    }
+
+    printf("\n[BENCH] Trace: %.1f ns per event\n", (elapsed * 1.0e3) / (100.0 * 2.0 * (double)pairs));
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Fill the roofline buffers with the pattern of BenchFill().
+ */
+static void BenchRoofFill(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < BENCH_ROOF_MAX_LEN; i++)
+    {
+        BenchRoofA[i] = (t_Fixed16)((sint32)(i % 2048U) - 1024);
+        BenchRoofB[i] = (t_Fixed16)((sint32)((i * 7U) % 512U) + 1);
+        BenchRoofR[i] = 0;
+        BenchRoofF[i] = (float)BenchRoofA[i] / (float)SCALE_16;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Compute roof: 16-bit multiply-add throughput on data in L1.
+ *
+ *  The loop has no dependency between elements and is vectorized by the compiler, so it measures
+ *  the integer SIMD throughput reachable by the kernels of this build rather than a theoretical peak.
+ *
+ *  @return     double
+ *  @retval     Operations per second (multiply and add counted separately).
+ */
+static double BenchRoofPeak(void)
+{
+    const uint32 reps = BENCH_ROOF_WORK / BENCH_ROOF_PEAK_LEN;
+    t_Fixed16* const x = BenchRoofA;
+    t_Fixed16* const y = BenchRoofB;
+    t_Fixed16* const acc = BenchRoofR;
+    double best = 1.0e30;
+    uint32 pass;
+
+    for (pass = 0U; pass < BENCH_ROOF_PASSES; pass++)
+    {
+        const double start = BenchNow();
+        double elapsed;
+        uint32 rep;
+        uint32 i;
+
+        for (rep = 0U; rep < reps; rep++)
+        {
+            for (i = 0U; i < BENCH_ROOF_PEAK_LEN; i++)
+            {
+                acc[i] = (t_Fixed16)(acc[i] + (x[i] * y[i]));
+            }
+        }
+
+        elapsed = BenchNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+
+    BenchRoofSink = acc[reps % BENCH_ROOF_PEAK_LEN];
+
+    return (2.0 * (double)BENCH_ROOF_WORK) / (best * 1.0e-6);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Memory roof: STREAM-like copy or triad over the full roofline buffers.
+ *
+ *  @param[in]  triad   1 for r = a + k * b (6 bytes per element), 0 for r = a (4 bytes per element).
+ *
+ *  @return     double
+ *  @retval     Bytes per second.
+ */
+static double BenchRoofStream(boolean triad)
+{
+    const t_Fixed16 k = 3;
+    double best = 1.0e30;
+    uint32 pass;
+    uint32 i;
+
+    for (pass = 0U; pass < BENCH_ROOF_PASSES; pass++)
+    {
+        const double start = BenchNow();
+        double elapsed;
+
+        if (triad != 0U)
+        {
+            for (i = 0U; i < BENCH_ROOF_MAX_LEN; i++)
+            {
+                BenchRoofR[i] = (t_Fixed16)(BenchRoofA[i] + (k * BenchRoofB[i]));
+            }
+        }
+        else
+        {
+            for (i = 0U; i < BENCH_ROOF_MAX_LEN; i++)
+            {
+                BenchRoofR[i] = BenchRoofA[i];
+            }
+        }
+
+        elapsed = BenchNow() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+
+    BenchRoofSink = BenchRoofR[BENCH_ROOF_MAX_LEN - 1U];
+
+    return ((double)BENCH_ROOF_MAX_LEN * ((triad != 0U) ? 6.0 : 4.0)) / (best * 1.0e-6);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time of one call of a roofline kernel.
+ *
+ *  Each pass repeats the kernel on the same len elements until BENCH_ROOF_WORK elements are
+ *  processed, so small sizes run from cache and large sizes stream from memory.
+ *
+ *  @param[in]  kernel  Index into BenchRoofKernels.
+ *  @param[in]  len     Problem size in elements (<= BENCH_ROOF_MAX_LEN).
+ *
+ *  @return     double
+ *  @retval     Fastest time of one call in microseconds.
+ */
+static double BenchRoofKernel(uint32 kernel, uint32 len)
+{
+    const uint32 reps = (len < BENCH_ROOF_WORK) ? (BENCH_ROOF_WORK / len) : 1U;
+    t_Fixed16 coeffs[BENCH_ROOF_FIR_TAPS];
+    FixedPoint_Fir16_t fir;
+    t_Fixed16 dot = 0;
+    double best = 1.0e30;
+    uint32 pass;
+    uint32 i;
+
+    for (i = 0U; i < BENCH_ROOF_FIR_TAPS; i++)
+    {
+        coeffs[i] = (t_Fixed16)(SCALE_16 / BENCH_ROOF_FIR_TAPS);
+    }
+    (void)FixedPoint_Fir16_Init(&fir, coeffs, BENCH_ROOF_FIR_TAPS, BenchRoofDelay);
+
+    for (pass = 0U; pass < BENCH_ROOF_PASSES; pass++)
+    {
+        const double start = BenchNow();
+        double elapsed;
+        uint32 rep;
+
+        for (rep = 0U; rep < reps; rep++)
+        {
+            switch (kernel)
+            {
+            case 0U:
+                (void)FixedPoint_Add16_Array(BenchRoofA, BenchRoofB, BenchRoofR, len);
+                break;
+            case 1U:
+                (void)FixedPoint_Mult16_Array(BenchRoofA, BenchRoofB, BenchRoofR, len);
+                break;
+            case 2U:
+                (void)FixedPoint_Div16_Array(BenchRoofA, BenchRoofB, BenchRoofR, len);
+                break;
+            case 3U:
+                (void)FixedPoint_FloatToFix16_Array(BenchRoofF, BenchRoofR, len);
+                break;
+            case 4U:
+                (void)FixedPoint_Dot16(BenchRoofA, BenchRoofB, len, &dot);
+                break;
+            default:
+                (void)FixedPoint_Fir16(&fir, BenchRoofA, BenchRoofR, len);
+                break;
+            }
+        }
+
+        elapsed = (BenchNow() - start) / (double)reps;
+        best = (elapsed < best) ? elapsed : best;
+    }
+
+    BenchRoofSink = dot;
+
+    return best;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Downstream stage: pseudo-random lookups in the coefficient table.
+ *
+ *  Stands for a stage whose working set (gain or correction tables) must stay in the cache.
+ *
+ *  @return     double
+ *  @retval     Elapsed time in microseconds.
+ */
+static double BenchCoeffStage(void)
+{
+    const double start = BenchNow();
+    uint32 state = 12345U;
+    sint32 sum = 0;
+    uint32 i;
+
+    for (i = 0U; i < BENCH_NT_LOOKUPS; i++)
+    {
+        state = (state * 1664525U) + 1013904223U;
+        sum += BenchCoeffs[(state >> 8) & (BENCH_NT_COEFFS - 1U)];
+    }
+
+    BenchRoofSink = (t_Fixed16)sum;
+
+    return BenchNow() - start;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Effect of non-temporal stores on the producer and on a cache-sensitive downstream stage.
+ *
+ *  Each run warms the coefficient table, multiplies two arrays of BENCH_ROOF_MAX_LEN elements
+ *  (8 MiB result) and then runs the downstream stage. With regular stores the result and the
+ *  inputs evict the table; with non-temporal stores the table stays in the cache.
+ */
+static void BenchNonTemporal(void)
+{
+    const uint32 threshold = FixedPoint_GetNonTemporalThreshold();
+    const double mib = ((double)BENCH_ROOF_MAX_LEN * 3.0 * (double)sizeof(t_Fixed16)) / (1024.0 * 1024.0);
+    uint32 mode;
+    uint32 i;
+
+    for (i = 0U; i < BENCH_NT_COEFFS; i++)
+    {
+        BenchCoeffs[i] = (t_Fixed16)(i & 0x7FFFU);
+    }
+    BenchRoofFill();
+
+    printf("\n[BENCH] Non-temporal stores: Mult16_Array over %lu elements, then %lu table lookups (threshold %lu)\n",
+           (unsigned long)BENCH_ROOF_MAX_LEN, (unsigned long)BENCH_NT_LOOKUPS, (unsigned long)threshold);
+    printf("%-14s %14s %14s %14s\n", "stores", "producer MiB/s", "stage cold us", "stage warm us");
+
+    for (mode = 0U; mode < 2U; mode++)
+    {
+        double producer = 0.0;
+        double stageAfter = 0.0;
+        double stageWarm = 0.0;
+        uint32 run;
+
+        FixedPoint_SetNonTemporalThreshold((mode == 0U) ? 0U : 1U);
+
+        for (run = 0U; run < BENCH_NT_RUNS; run++)
+        {
+            double start;
+
+            (void)BenchCoeffStage();
+            stageWarm += BenchCoeffStage();
+
+            start = BenchNow();
+            (void)FixedPoint_Mult16_Array(BenchRoofA, BenchRoofB, BenchRoofR, BENCH_ROOF_MAX_LEN);
+            producer += BenchNow() - start;
+
+            stageAfter += BenchCoeffStage();
+        }
+
+        printf("%-14s %14.1f %14.1f %14.1f\n", (mode == 0U) ? "regular" : "non-temporal",
+               mib / ((producer * 1.0e-6) / (double)BENCH_NT_RUNS), stageAfter / (double)BENCH_NT_RUNS,
+               stageWarm / (double)BENCH_NT_RUNS);
+    }
+
+    FixedPoint_SetNonTemporalThreshold(threshold);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Layout kernels against the plain scalar loops (MiB/s of moved samples).
+ *
+ *  Deinterleaves BENCH_ROOF_MAX_LEN interleaved samples into the channel arrays and transposes a
+ *  2048 x 2048 matrix (8 MiB each way).
+ */
+static void BenchLayout(void)
+{
+    static const uint32 channelCounts[5] = { 2U, 3U, 4U, 8U, 16U };
+    const double mib = ((double)BENCH_ROOF_MAX_LEN * (double)sizeof(t_Fixed16)) / (1024.0 * 1024.0);
+    const uint32 dim = 2048U;
+    t_Fixed16* planes[FIXEDPOINT_LAYOUT_MAX_CHANNELS];
+    double start;
+    double kernel;
+    double scalar;
+    uint32 n;
+    uint32 i;
+    uint32 c;
+
+    printf("\n[BENCH] Layout transforms (MiB/s)\n");
+    printf("%-22s %10s %10s\n", "", "kernel", "scalar");
+
+    for (n = 0U; n < 5U; n++)
+    {
+        const uint32 channels = channelCounts[n];
+        const uint32 frames = BENCH_ROOF_MAX_LEN / channels;
+
+        for (c = 0U; c < channels; c++)
+        {
+            planes[c] = &BenchRoofR[c * frames];
+        }
+
+        start = BenchNow();
+        (void)FixedPoint_Deinterleave16(BenchRoofA, channels, frames, planes, 0);
+        kernel = BenchNow() - start;
+
+        start = BenchNow();
+        for (i = 0U; i < frames; i++)
+        {
+            for (c = 0U; c < channels; c++)
+            {
+                planes[c][i] = BenchRoofA[(i * channels) + c];
+            }
+        }
+        scalar = BenchNow() - start;
+
+        printf("deinterleave %2lu ch     %10.1f %10.1f\n", (unsigned long)channels, mib / (kernel * 1.0e-6),
+               mib / (scalar * 1.0e-6));
+    }
+
+    start = BenchNow();
+    (void)FixedPoint_Transpose16(BenchRoofA, dim, dim, BenchRoofR, 0);
+    kernel = BenchNow() - start;
+
+    start = BenchNow();
+    for (i = 0U; i < dim; i++)
+    {
+        for (c = 0U; c < dim; c++)
+        {
+            BenchRoofR[(c * dim) + i] = BenchRoofA[(i * dim) + c];
+        }
+    }
+    scalar = BenchNow() - start;
+
+    printf("%-22s %10.1f %10.1f\n", "transpose 2048x2048", mib / (kernel * 1.0e-6), mib / (scalar * 1.0e-6));
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Throughput of the direct form FIR and of the convolution engine across filter lengths.
+ *
+ *  Both filter the same BENCH_BUFFER_LEN samples in blocks of BENCH_CONV_BLOCK_LEN. Up to
+ *  FIXEDPOINT_CONV_DIRECT_MAX_TAPS taps the engine uses the direct form itself (deviation 0).
+ */
+static void BenchConv(void)
+{
+    static const uint32 tapCounts[6] = { 32U, 128U, 256U, 512U, 1024U, BENCH_CONV_MAX_TAPS };
+    FixedPoint_Fir16_t fir;
+    FixedPoint_Conv16_t conv;
+    uint32 t;
+    uint32 i;
+
+    /* Noise input of +-4.0 and coefficients of +-0.0625 keep the outputs of all lengths in range */
+    for (i = 0U; i < BENCH_CONV_MAX_TAPS; i++)
+    {
+        BenchConvCoeffs[i] = (t_Fixed16)((sint32)(((i * 2654435761U) >> 8) & 0x1FU) - 16);
+    }
+    for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+    {
+        BenchRoofA[i] = (t_Fixed16)((sint32)(((i * 2654435761U) >> 12) & 0x7FFU) - 1024);
+    }
+
+    printf("\n[BENCH] Convolution (Msamples/s, block length %lu)\n", (unsigned long)BENCH_CONV_BLOCK_LEN);
+    printf("%8s %6s %10s %10s %8s %10s %10s\n", "taps", "path", "direct", "engine", "speedup", "max_lsb", "rms_lsb");
+
+    for (t = 0U; t < 6U; t++)
+    {
+        const uint32 taps = tapCounts[t];
+        double start;
+        double direct;
+        double engine;
+        double sumSq = 0.0;
+        sint32 maxDiff = 0;
+
+        (void)FixedPoint_Fir16_Init(&fir, BenchConvCoeffs, taps, BenchConvDelayFir);
+        (void)FixedPoint_Conv16_Init(&conv, BenchConvCoeffs, taps, BENCH_CONV_BLOCK_LEN, BenchConvWork,
+                                     (uint32)(sizeof(BenchConvWork) / sizeof(BenchConvWork[0])), BenchConvDelay);
+
+        start = BenchNow();
+        for (i = 0U; i < BENCH_BUFFER_LEN; i += BENCH_CONV_BLOCK_LEN)
+        {
+            (void)FixedPoint_Fir16(&fir, &BenchRoofA[i], &BenchBufR[i], BENCH_CONV_BLOCK_LEN);
+        }
+        direct = BenchNow() - start;
+
+        start = BenchNow();
+        for (i = 0U; i < BENCH_BUFFER_LEN; i += BENCH_CONV_BLOCK_LEN)
+        {
+            (void)FixedPoint_Conv16_Process(&conv, &BenchRoofA[i], &BenchRoofR[i], BENCH_CONV_BLOCK_LEN);
+        }
+        engine = BenchNow() - start;
+
+        for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+        {
+            const sint32 diff = (sint32)BenchRoofR[i] - (sint32)BenchBufR[i];
+            const sint32 mag = (diff < 0) ? -diff : diff;
+
+            maxDiff = (mag > maxDiff) ? mag : maxDiff;
+            sumSq += (double)diff * (double)diff;
+        }
+
+        printf("%8lu %6s %10.2f %10.2f %8.1f %10ld %10.4f\n", (unsigned long)taps, conv.direct ? "direct" : "fft",
+               (double)BENCH_BUFFER_LEN / direct, (double)BENCH_BUFFER_LEN / engine, direct / engine,
+               (long)maxDiff, sqrt(sumSq / (double)BENCH_BUFFER_LEN));
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per call of the correlation of two BENCH_CORR_LEN signals over the lags 0..L-1.
+ *
+ *  The scalar column is the plain 64-bit multiply-accumulate loop per lag, the direct column the
+ *  kernel without FFT path, the fft column the kernel with the FFT path forced for all lag counts
+ *  and the auto column the kernel with the default FIXEDPOINT_CORR_FFT_COST. The last row is the
+ *  full correlation over the lags -(BENCH_CORR_LEN - 1)..BENCH_CORR_LEN - 1.
+ */
+static void BenchCorr(void)
+{
+    static const uint32 lagCounts[6] = { 8U, 32U, 128U, 512U, BENCH_CORR_LEN, (2U * BENCH_CORR_LEN) - 1U };
+    FixedPoint_Corr16_t corr;
+    FixedPoint_Corr16_t corrAuto;
+    uint32 l;
+
+    (void)FixedPoint_Corr16_Init(&corr, BENCH_CORR_FFT_LEN, BenchCorrWork,
+                                 (uint32)(sizeof(BenchCorrWork) / sizeof(BenchCorrWork[0])));
+    corrAuto = corr;
+    corr.fftCost = 0U;
+
+    printf("\n[BENCH] Correlation of %lu samples (us per call, FFT cost %lu)\n", (unsigned long)BENCH_CORR_LEN,
+           (unsigned long)corrAuto.fftCost);
+    printf("%8s %10s %10s %10s %10s\n", "lags", "scalar", "direct", "fft", "auto");
+
+    for (l = 0U; l < 6U; l++)
+    {
+        const uint32 lags = lagCounts[l];
+        const sint32 firstLag = (lags > BENCH_CORR_LEN) ? -(sint32)(BENCH_CORR_LEN - 1U) : 0;
+        double start;
+        double scalar;
+        double direct;
+        double viaFft;
+        double viaAuto;
+        uint32 run;
+        uint32 lag;
+        uint32 n;
+
+        start = BenchNow();
+        for (run = 0U; run < BENCH_CORR_RUNS; run++)
+        {
+            for (lag = 0U; lag < lags; lag++)
+            {
+                const sint32 shift = firstLag + (sint32)lag;
+                const uint32 skip = (shift < 0) ? (uint32)(-shift) : 0U;
+                const uint32 end = (shift > 0) ? (BENCH_CORR_LEN - (uint32)shift) : BENCH_CORR_LEN;
+                sint64 acc = 0;
+
+                for (n = skip; n < end; n++)
+                {
+                    acc += (sint64)BenchRoofA[(sint32)n + shift] * (sint64)BenchRoofB[n];
+                }
+                BenchRoofSink = (t_Fixed16)acc;
+            }
+        }
+        scalar = (BenchNow() - start) / (double)BENCH_CORR_RUNS;
+
+        start = BenchNow();
+        for (run = 0U; run < BENCH_CORR_RUNS; run++)
+        {
+            (void)FixedPoint_Xcorr16(NULL, BenchRoofA, BENCH_CORR_LEN, BenchRoofB, BENCH_CORR_LEN, firstLag, lags,
+                                     FIXEDPOINT_CORR_RAW, BenchRoofR);
+        }
+        direct = (BenchNow() - start) / (double)BENCH_CORR_RUNS;
+
+        start = BenchNow();
+        for (run = 0U; run < BENCH_CORR_RUNS; run++)
+        {
+            (void)FixedPoint_Xcorr16(&corr, BenchRoofA, BENCH_CORR_LEN, BenchRoofB, BENCH_CORR_LEN, firstLag, lags,
+                                     FIXEDPOINT_CORR_RAW, BenchRoofR);
+        }
+        viaFft = (BenchNow() - start) / (double)BENCH_CORR_RUNS;
+
+        start = BenchNow();
+        for (run = 0U; run < BENCH_CORR_RUNS; run++)
+        {
+            (void)FixedPoint_Xcorr16(&corrAuto, BenchRoofA, BENCH_CORR_LEN, BenchRoofB, BENCH_CORR_LEN, firstLag,
+                                     lags, FIXEDPOINT_CORR_RAW, BenchRoofR);
+        }
+        viaAuto = (BenchNow() - start) / (double)BENCH_CORR_RUNS;
+
+        printf("%8lu %10.1f %10.1f %10.1f %10.1f\n", (unsigned long)lags, scalar, direct, viaFft, viaAuto);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per sample of the adaptive filters over the number of taps.
+ *
+ *  The scalar column is the plain loop with 64-bit coefficients (filter, error, update with the
+ *  same step size), the lms and nlms columns the kernel. The step size is small, so that no
+ *  saturation path is taken.
+ */
+static void BenchLms(void)
+{
+    static const uint32 tapCounts[4] = { 16U, 64U, 256U, BENCH_LMS_MAX_TAPS };
+    FixedPoint_Lms16_t lms;
+    uint32 t;
+
+    printf("\n[BENCH] Adaptive filter over %lu samples (ns per sample)\n", (unsigned long)BENCH_LMS_LEN);
+    printf("%8s %10s %10s %10s\n", "taps", "scalar", "lms", "nlms");
+
+    for (t = 0U; t < 4U; t++)
+    {
+        const uint32 taps = tapCounts[t];
+        double start;
+        double scalar;
+        double viaLms;
+        double viaNlms;
+        uint32 n;
+        uint32 k;
+
+        for (k = 0U; k < taps; k++)
+        {
+            BenchLmsRef[k] = 0;
+        }
+
+        start = BenchNow();
+        for (n = taps; n < (taps + BENCH_LMS_LEN); n++)
+        {
+            sint64 acc = 0;
+            sint64 e;
+
+            for (k = 0U; k < taps; k++)
+            {
+                acc += BenchLmsRef[k] * (sint64)BenchRoofA[n - k];
+            }
+            e = (sint64)BenchRoofB[n] - (acc / (sint64)FIXEDPOINT_LMS_COEFF_ONE);
+            for (k = 0U; k < taps; k++)
+            {
+                BenchLmsRef[k] += (e * (sint64)BenchRoofA[n - k]) / 65536;
+            }
+        }
+        scalar = (BenchNow() - start) * 1000.0 / (double)BENCH_LMS_LEN;
+        BenchRoofSink = (t_Fixed16)BenchLmsRef[0];
+
+        (void)FixedPoint_Lms16_Init(&lms, FIXEDPOINT_LMS, taps, BenchLmsCoeffs, BenchLmsState, BENCH_LMS_BLOCK_LEN,
+                                    FIXEDPOINT_LMS_COEFF_SHIFT, 0U);
+        start = BenchNow();
+        (void)FixedPoint_Lms16(&lms, BenchRoofA, BenchRoofB, BenchRoofR, &BenchRoofR[BENCH_LMS_LEN], BENCH_LMS_LEN);
+        viaLms = (BenchNow() - start) * 1000.0 / (double)BENCH_LMS_LEN;
+
+        (void)FixedPoint_Lms16_Init(&lms, FIXEDPOINT_NLMS, taps, BenchLmsCoeffs, BenchLmsState, BENCH_LMS_BLOCK_LEN,
+                                    8U, 0U);
+        start = BenchNow();
+        (void)FixedPoint_Lms16(&lms, BenchRoofA, BenchRoofB, BenchRoofR, &BenchRoofR[BENCH_LMS_LEN], BENCH_LMS_LEN);
+        viaNlms = (BenchNow() - start) * 1000.0 / (double)BENCH_LMS_LEN;
+
+        printf("%8lu %10.1f %10.1f %10.1f\n", (unsigned long)taps, scalar, viaLms, viaNlms);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per lookup of the curve and map interpolation over the number of sample points.
+ *
+ *  The map has the same number of sample points on both axes. The rand columns use uniformly
+ *  distributed inputs (binary search), the ramp columns slowly moving inputs (cached search).
+ */
+static void BenchInterp(void)
+{
+    static const uint32 pointCounts[3] = { 8U, 32U, BENCH_INTERP_MAX_POINTS };
+    FixedPoint_Curve16_t curve;
+    FixedPoint_Map16_t map;
+    uint32 seed = 1U;
+    uint32 p;
+    uint32 i;
+
+    printf("\n[BENCH] Interpolation of %lu inputs (ns per lookup)\n", (unsigned long)BENCH_BUFFER_LEN);
+    printf("%8s %10s %10s %10s %10s\n", "points", "curve rand", "curve ramp", "map rand", "map ramp");
+
+    for (i = 0U; i < (BENCH_INTERP_MAX_POINTS * BENCH_INTERP_MAX_POINTS); i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        BenchInterpValues[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+    }
+
+    for (p = 0U; p < 3U; p++)
+    {
+        const uint32 points = pointCounts[p];
+        double timing[4];
+        uint32 pass;
+
+        for (i = 0U; i < points; i++)
+        {
+            BenchInterpAxis[i] = (t_Fixed16)(-32000 + (sint32)((i * 64000U) / (points - 1U)));
+        }
+        (void)FixedPoint_Curve16_Init(&curve, BenchInterpAxis, BenchInterpValues, points);
+        (void)FixedPoint_Map16_Init(&map, BenchInterpAxis, points, BenchInterpAxis, points, BenchInterpValues);
+
+        for (pass = 0U; pass < 2U; pass++)
+        {
+            double start;
+
+            for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+            {
+                if (pass == 0U)
+                {
+                    seed = (seed * 1103515245U) + 12345U;
+                    BenchBufA[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+                    seed = (seed * 1103515245U) + 12345U;
+                    BenchBufB[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+                }
+                else
+                {
+                    BenchBufA[i] = (t_Fixed16)((sint32)i - 32768);
+                    BenchBufB[i] = (t_Fixed16)(32767 - (sint32)i);
+                }
+            }
+
+            start = BenchNow();
+            (void)FixedPoint_Curve16_Array(&curve, BenchBufA, BenchBufR, BENCH_BUFFER_LEN);
+            timing[pass] = (BenchNow() - start) * 1000.0 / (double)BENCH_BUFFER_LEN;
+
+            start = BenchNow();
+            (void)FixedPoint_Map16_Array(&map, BenchBufA, BenchBufB, BenchBufR, BENCH_BUFFER_LEN);
+            timing[2U + pass] = (BenchNow() - start) * 1000.0 / (double)BENCH_BUFFER_LEN;
+        }
+
+        printf("%8lu %10.1f %10.1f %10.1f %10.1f\n", (unsigned long)points, timing[0], timing[1], timing[2],
+               timing[3]);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per instance and step of the control blocks, single instances against the banks.
+ *
+ *  The single column calls the single instance step for each instance, the bank column updates all
+ *  instances with one bank call. Inputs change every step.
+ */
+static void BenchCtrl(void)
+{
+    FixedPoint_RateLimitBank16_t rlBank;
+    FixedPoint_LowPassBank16_t lpBank;
+    FixedPoint_DebounceBank_t dbBank;
+    const double perStep = 1000.0 / ((double)BENCH_CTRL_INSTANCES * (double)BENCH_CTRL_STEPS);
+    double start;
+    double single;
+    double bank;
+    t_Fixed16 out;
+    boolean flag;
+    uint32 step;
+    uint32 i;
+
+    printf("\n[BENCH] Control blocks, %lu instances (ns per instance and step)\n",
+           (unsigned long)BENCH_CTRL_INSTANCES);
+    printf("%12s %10s %10s\n", "block", "single", "bank");
+
+    for (i = 0U; i < (BENCH_CTRL_INSTANCES + BENCH_CTRL_STEPS); i++)
+    {
+        BenchCtrlIn[i] = (boolean)((i / 3U) & 1U);
+    }
+    for (i = 0U; i < BENCH_CTRL_INSTANCES; i++)
+    {
+        BenchCtrlTimes[i] = (uint16)(i % 5U);
+        BenchCtrlY[i] = 0;
+        (void)FixedPoint_RateLimit16_Init(&BenchCtrlRl[i], BenchRoofB[i], BenchRoofB[i], 0);
+        (void)FixedPoint_LowPass16_Init(&BenchCtrlLp[i], 4U, 0);
+        (void)FixedPoint_Debounce_Init(&BenchCtrlDb[i], BenchCtrlTimes[i], BenchCtrlTimes[i], 0U);
+    }
+
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        for (i = 0U; i < BENCH_CTRL_INSTANCES; i++)
+        {
+            (void)FixedPoint_RateLimit16(&BenchCtrlRl[i], BenchRoofA[i + step], &out);
+        }
+    }
+    single = (BenchNow() - start) * perStep;
+    (void)FixedPoint_RateLimitBank16_Init(&rlBank, BenchRoofB, BenchRoofB, BenchCtrlY, BENCH_CTRL_INSTANCES);
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        (void)FixedPoint_RateLimitBank16(&rlBank, &BenchRoofA[step]);
+    }
+    bank = (BenchNow() - start) * perStep;
+    printf("%12s %10.2f %10.2f\n", "rate limit", single, bank);
+
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        for (i = 0U; i < BENCH_CTRL_INSTANCES; i++)
+        {
+            (void)FixedPoint_LowPass16(&BenchCtrlLp[i], BenchRoofA[i + step], &out);
+        }
+    }
+    single = (BenchNow() - start) * perStep;
+    (void)FixedPoint_LowPassBank16_Init(&lpBank, 4U, BenchCtrlY, BenchCtrlFrac, BENCH_CTRL_INSTANCES);
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        (void)FixedPoint_LowPassBank16(&lpBank, &BenchRoofA[step], BenchRoofR);
+    }
+    bank = (BenchNow() - start) * perStep;
+    printf("%12s %10.2f %10.2f\n", "low-pass", single, bank);
+
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        for (i = 0U; i < BENCH_CTRL_INSTANCES; i++)
+        {
+            (void)FixedPoint_Debounce(&BenchCtrlDb[i], BenchCtrlIn[i + step], &flag);
+        }
+    }
+    single = (BenchNow() - start) * perStep;
+    (void)FixedPoint_DebounceBank_Init(&dbBank, BenchCtrlTimes, BenchCtrlTimes, BenchCtrlCount, BenchCtrlState,
+                                       BENCH_CTRL_INSTANCES);
+    start = BenchNow();
+    for (step = 0U; step < BENCH_CTRL_STEPS; step++)
+    {
+        (void)FixedPoint_DebounceBank(&dbBank, &BenchCtrlIn[step]);
+    }
+    bank = (BenchNow() - start) * perStep;
+    printf("%12s %10.2f %10.2f\n", "debounce", single, bank);
+    BenchRoofSink = (t_Fixed16)(out + (t_Fixed16)flag);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per element of the target DSP emulation, scalar per-element calls against the array kernels.
+ *
+ *  Random Q15 operands in [-0.5, 0.5), so that neither the products nor the sums saturate.
+ */
+static void BenchDsp(void)
+{
+    static const char* const names[FIXEDPOINT_DSP_MODES] = { "SQRDMULH", "SQDMULH", "C55x", "TI Q15" };
+    const double perElem = 1000.0 / (double)BENCH_BUFFER_LEN;
+    uint32 seed = 5U;
+    uint32 mode;
+    uint32 i;
+    sint16 v = 0;
+
+    printf("\n[BENCH] Target DSP emulation of %lu elements (ns per element)\n", (unsigned long)BENCH_BUFFER_LEN);
+    printf("%10s %10s %10s %10s %10s\n", "mode", "mult", "mult array", "add", "add array");
+
+    for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        BenchBufA[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x7FFFU) - 16384);
+        seed = (seed * 1103515245U) + 12345U;
+        BenchBufB[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x7FFFU) - 16384);
+    }
+
+    for (mode = 0U; mode < (uint32)FIXEDPOINT_DSP_MODES; mode++)
+    {
+        const FixedPoint_DspMode_t m = (FixedPoint_DspMode_t)mode;
+        double timing[4];
+        double start;
+
+        start = BenchNow();
+        for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+        {
+            (void)FixedPoint_Dsp_Mult16(m, BenchBufA[i], BenchBufB[i], &BenchBufR[i]);
+        }
+        timing[0] = (BenchNow() - start) * perElem;
+        start = BenchNow();
+        (void)FixedPoint_Dsp_Mult16_Array(m, BenchBufA, BenchBufB, BenchBufR, BENCH_BUFFER_LEN);
+        timing[1] = (BenchNow() - start) * perElem;
+        v += BenchBufR[0];
+
+        start = BenchNow();
+        for (i = 0U; i < BENCH_BUFFER_LEN; i++)
+        {
+            (void)FixedPoint_Dsp_Add16(m, BenchBufA[i], BenchBufB[i], &BenchBufR[i]);
+        }
+        timing[2] = (BenchNow() - start) * perElem;
+        start = BenchNow();
+        (void)FixedPoint_Dsp_Add16_Array(m, BenchBufA, BenchBufB, BenchBufR, BENCH_BUFFER_LEN);
+        timing[3] = (BenchNow() - start) * perElem;
+        v += BenchBufR[0];
+
+        printf("%10s %10.2f %10.2f %10.2f %10.2f\n", names[mode], timing[0], timing[1], timing[2], timing[3]);
+    }
+    BenchRoofSink = v;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Worker thread of the simulation benchmark.
+ *
+ *  @param[in]  arg     Unused.
+ *
+ *  @return     0.
+ */
+static DWORD WINAPI BenchSimWorker(LPVOID arg)
+{
+    (void)arg;
+    (void)FixedPoint_Sim_Work(&BenchSimState, BENCH_SIM_ITERATIONS);
+
+    return 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per instance and algorithm step of many instances of a PI controller with plant model.
+ *
+ *  The scalar column executes the steps instance by instance with FixedPoint_Op16_Strided() on a
+ *  per-instance register array, the other columns run the simulation runtime with 1 to
+ *  BENCH_SIM_MAX_THREADS threads claiming groups.
+ */
+static void BenchSim(void)
+{
+    const double perStep = 1000.0 / ((double)BENCH_SIM_INSTANCES * (double)BENCH_SIM_ITERATIONS *
+                                     (double)BENCH_SIM_STEPS);
+    HANDLE threads[BENCH_SIM_MAX_THREADS];
+    double start;
+    double scalar;
+    uint32 numThreads;
+    uint32 n;
+    uint32 it;
+    uint32 s;
+
+    printf("\n[BENCH] Simulation of %lu PI controller instances, %lu steps (ns per instance and step)\n",
+           (unsigned long)BENCH_SIM_INSTANCES, (unsigned long)BENCH_SIM_STEPS);
+
+    (void)FixedPoint_Sim_Init(&BenchSimState, BenchSimSteps, BENCH_SIM_STEPS, BenchSimRegs, BENCH_SIM_REGS,
+                              BenchSimStatus, BENCH_SIM_INSTANCES);
+    for (n = 0U; n < BENCH_SIM_INSTANCES; n++)
+    {
+        const t_Fixed16 init[BENCH_SIM_REGS] =
+        {
+            BenchRoofA[n], 0, 256, 16, 0, -8192, 8192, 64, 0, 0, 0, 0, 256, 0
+        };
+
+        for (s = 0U; s < BENCH_SIM_REGS; s++)
+        {
+            (void)FixedPoint_Sim_Set(&BenchSimState, s, n, init[s]);
+            BenchSimScalar[(n * BENCH_SIM_REGS) + s] = init[s];
+        }
+    }
+
+    start = BenchNow();
+    for (n = 0U; n < BENCH_SIM_INSTANCES; n++)
+    {
+        t_Fixed16* r = &BenchSimScalar[n * BENCH_SIM_REGS];
+
+        for (it = 0U; it < BENCH_SIM_ITERATIONS; it++)
+        {
+            for (s = 0U; s < BENCH_SIM_STEPS; s++)
+            {
+                const FixedPoint_SimStep_t* step = &BenchSimSteps[s];
+
+                if (step->op <= FIXEDPOINT_SIM_DIV)
+                {
+                    (void)FixedPoint_Op16_Strided((FixedPoint_Operation_t)step->op, &r[step->src1], 1,
+                                                  &r[step->src2], 1, &r[step->dst], 1, 1U);
+                }
+                else if (step->op == FIXEDPOINT_SIM_MIN)
+                {
+                    r[step->dst] = (r[step->src1] < r[step->src2]) ? r[step->src1] : r[step->src2];
+                }
+                else if (step->op == FIXEDPOINT_SIM_MAX)
+                {
+                    r[step->dst] = (r[step->src1] > r[step->src2]) ? r[step->src1] : r[step->src2];
+                }
+                else
+                {
+                    r[step->dst] = r[step->src1];
+                }
+            }
+        }
+    }
+    scalar = (BenchNow() - start) * perStep;
+    printf("%10s %10.2f\n", "scalar", scalar);
+
+    for (numThreads = 1U; numThreads <= BENCH_SIM_MAX_THREADS; numThreads *= 2U)
+    {
+        double sim;
+        uint32 t;
+
+        (void)FixedPoint_Sim_Begin(&BenchSimState);
+        start = BenchNow();
+        for (t = 1U; t < numThreads; t++)
+        {
+            threads[t] = CreateThread(NULL, 0U, BenchSimWorker, NULL, 0U, NULL);
+        }
+        (void)BenchSimWorker(NULL);
+        if (numThreads > 1U)
+        {
+            (void)WaitForMultipleObjects((DWORD)(numThreads - 1U), &threads[1], TRUE, INFINITE);
+        }
+        sim = (BenchNow() - start) * perStep;
+        for (t = 1U; t < numThreads; t++)
+        {
+            (void)CloseHandle(threads[t]);
+        }
+        printf("%7lu th %10.2f  (x%.1f)\n", (unsigned long)numThreads, sim, scalar / sim);
+    }
+    BenchRoofSink = BenchSimScalar[1];
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Right-hand side dx/dt = a x of the ODE integration benchmark, 16-bit.
+ *
+ *  @param[in]  context     Gains of the systems (t_Fixed16).
+ *  @param[in]  x           States.
+ *  @param[out] dxdt        Derivatives.
+ *  @param[in]  num         Number of systems.
+ *
+ *  @return     E_OK.
+ */
+static Std_ReturnType BenchIntegRhs16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num)
+{
+    const t_Fixed16* a = (const t_Fixed16*)context;
+    uint32 s;
+
+    for (s = 0U; s < num; s++)
+    {
+        dxdt[s] = (t_Fixed16)(((sint32)a[s] * (sint32)x[s]) >> SHIFT_16);
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Right-hand side dx/dt = a x of the ODE integration benchmark, 32-bit.
+ *
+ *  @param[in]  context     Gains of the systems (t_Fixed32).
+ *  @param[in]  x           States.
+ *  @param[out] dxdt        Derivatives.
+ *  @param[in]  num         Number of systems.
+ *
+ *  @return     E_OK.
+ */
+static Std_ReturnType BenchIntegRhs32(void* context, const t_Fixed32* x, t_Fixed32* dxdt, uint32 num)
+{
+    const t_Fixed32* a = (const t_Fixed32*)context;
+    uint32 s;
+
+    for (s = 0U; s < num; s++)
+    {
+        dxdt[s] = (t_Fixed32)(((sint64)a[s] * (sint64)x[s]) >> SHIFT_32);
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time per system and RK4 step of many decaying first-order systems with different gains.
+ *
+ *  The per-system column sets up and steps an integrator of one system at a time, the batched column
+ *  steps all BENCH_INTEG_SYSTEMS systems with one call.
+ */
+static void BenchInteg(void)
+{
+    const double perStep = 1000.0 / ((double)BENCH_INTEG_SYSTEMS * (double)BENCH_INTEG_STEPS);
+    FixedPoint_Ode16_t ode16;
+    FixedPoint_Ode32_t ode32;
+    double start;
+    double single16;
+    double batch16;
+    double single32;
+    double batch32;
+    uint32 n;
+    uint32 it;
+
+    printf("\n[BENCH] RK4 integration of %lu first-order systems (ns per system and step)\n",
+           (unsigned long)BENCH_INTEG_SYSTEMS);
+
+    for (n = 0U; n < BENCH_INTEG_SYSTEMS; n++)
+    {
+        BenchIntegGain16[n] = (t_Fixed16)(-(sint32)(SCALE_16 / 4U) - (sint32)(n % SCALE_16));
+        BenchIntegGain32[n] = (t_Fixed32)BenchIntegGain16[n] * (t_Fixed32)(SCALE_32 / SCALE_16);
+        BenchIntegX16[n] = (t_Fixed16)SCALE_16;
+        BenchIntegX32[n] = (t_Fixed32)SCALE_32;
+    }
+
+    start = BenchNow();
+    for (n = 0U; n < BENCH_INTEG_SYSTEMS; n++)
+    {
+        (void)FixedPoint_Ode16_Init(&ode16, FIXEDPOINT_ODE_RK4, BenchIntegRhs16, &BenchIntegGain16[n], 1U, 1U,
+                                    (t_Fixed16)(SCALE_16 / 16U), FIXEDPOINT_ROUND_NEAREST, BenchIntegStage16,
+                                    BenchIntegAcc);
+        for (it = 0U; it < BENCH_INTEG_STEPS; it++)
+        {
+            (void)FixedPoint_Ode16_Step(&ode16, &BenchIntegX16[n]);
+        }
+    }
+    single16 = (BenchNow() - start) * perStep;
+
+    (void)FixedPoint_Ode16_Init(&ode16, FIXEDPOINT_ODE_RK4, BenchIntegRhs16, BenchIntegGain16, 1U,
+                                BENCH_INTEG_SYSTEMS, (t_Fixed16)(SCALE_16 / 16U), FIXEDPOINT_ROUND_NEAREST,
+                                BenchIntegStage16, BenchIntegAcc);
+    start = BenchNow();
+    for (it = 0U; it < BENCH_INTEG_STEPS; it++)
+    {
+        (void)FixedPoint_Ode16_Step(&ode16, BenchIntegX16);
+    }
+    batch16 = (BenchNow() - start) * perStep;
+
+    start = BenchNow();
+    for (n = 0U; n < BENCH_INTEG_SYSTEMS; n++)
+    {
+        (void)FixedPoint_Ode32_Init(&ode32, FIXEDPOINT_ODE_RK4, BenchIntegRhs32, &BenchIntegGain32[n], 1U, 1U,
+                                    (t_Fixed32)(SCALE_32 / 16U), FIXEDPOINT_ROUND_NEAREST, BenchIntegStage32,
+                                    BenchIntegAcc);
+        for (it = 0U; it < BENCH_INTEG_STEPS; it++)
+        {
+            (void)FixedPoint_Ode32_Step(&ode32, &BenchIntegX32[n]);
+        }
+    }
+    single32 = (BenchNow() - start) * perStep;
+
+    (void)FixedPoint_Ode32_Init(&ode32, FIXEDPOINT_ODE_RK4, BenchIntegRhs32, BenchIntegGain32, 1U,
+                                BENCH_INTEG_SYSTEMS, (t_Fixed32)(SCALE_32 / 16U), FIXEDPOINT_ROUND_NEAREST,
+                                BenchIntegStage32, BenchIntegAcc);
+    start = BenchNow();
+    for (it = 0U; it < BENCH_INTEG_STEPS; it++)
+    {
+        (void)FixedPoint_Ode32_Step(&ode32, BenchIntegX32);
+    }
+    batch32 = (BenchNow() - start) * perStep;
+
+    printf("%10s %12s %12s\n", "format", "per system", "batched");
+    printf("%10s %12.2f %12.2f  (x%.1f)\n", "16-bit", single16, batch16, single16 / batch16);
+    printf("%10s %12.2f %12.2f  (x%.1f)\n", "32-bit", single32, batch32, single32 / batch32);
+    BenchRoofSink = BenchIntegX16[1];
+}
+
+/***********************************************************************************************************************
+ GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Execute all benchmarks and print the results.
+ */
+void RunBenchmarks(void)
+{
+    printf("\n--- FIXED POINT ARITHMETIC BENCHMARKS ---\n");
+
+    BenchFill();
+    (void)FixedPoint_Job_Init(&BenchQueue);
+
+    BenchJobLatency();
+    BenchJobCoalescing();
+    BenchFileThroughput();
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+    BenchTraceOverhead();
+#endif
+    BenchNonTemporal();
+    BenchLayout();
+    BenchConv();
+    BenchCorr();
+    BenchLms();
+    BenchInterp();
+    BenchCtrl();
+    BenchDsp();
+    BenchSim();
+    BenchInteg();
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Measure the roofline of this host and write it as CSV.
+ *
+ *  Columns: kind (peak, bandwidth, kernel), name, elements, ops_per_byte, gops (10^9 operations
+ *  per second), gbytes (10^9 bytes per second). Kernel points at sizes that fit in a cache can lie
+ *  above the memory roof, which is measured beyond the last level cache.
+ *
+ *  @param[in]  path    Output CSV file.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Measured and written.
+ *  @retval     E_NOT_OK    File could not be written.
+ */
+Std_ReturnType RunRoofline(const char* path)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FILE* file;
+    double peak;
+    double copy;
+    double triad;
+
+    BenchRoofFill();
+
+    printf("\n[BENCH] Roofline\n");
+
+    peak = BenchRoofPeak();
+    copy = BenchRoofStream(0U);
+    triad = BenchRoofStream(1U);
+    printf("compute roof %10.2f Gop/s, copy %8.2f GB/s, triad %8.2f GB/s\n", peak * 1.0e-9, copy * 1.0e-9,
+           triad * 1.0e-9);
+
+    file = fopen(path, "w");
+    if (file != NULL)
+    {
+        uint32 k;
+
+        ret = E_OK;
+        if (fprintf(file, "kind,name,elements,ops_per_byte,gops,gbytes\n"
+                          "peak,mac16,%lu,,%.4f,\n"
+                          "bandwidth,copy,%lu,,,%.4f\n"
+                          "bandwidth,triad,%lu,,,%.4f\n",
+                    (unsigned long)BENCH_ROOF_PEAK_LEN, peak * 1.0e-9, (unsigned long)BENCH_ROOF_MAX_LEN,
+                    copy * 1.0e-9, (unsigned long)BENCH_ROOF_MAX_LEN, triad * 1.0e-9) < 0)
+        {
+            ret = E_NOT_OK;
+        }
+
+        printf("%-16s %8s %8s %10s %10s\n", "kernel", "size", "op/B", "Gop/s", "GB/s");
+
+        for (k = 0U; k < BENCH_ROOF_KERNELS; k++)
+        {
+            const BenchRoofKernel_t* const kernel = &BenchRoofKernels[k];
+            uint32 len = 1024U;
+            uint32 s;
+
+            for (s = 0U; s < BENCH_ROOF_SIZES; s++)
+            {
+                const double seconds = BenchRoofKernel(k, len) * 1.0e-6;
+                const double gops = (kernel->ops * (double)len) / (seconds * 1.0e9);
+                const double gbytes = (kernel->bytes * (double)len) / (seconds * 1.0e9);
+
+                printf("%-16s %8lu %8.3f %10.3f %10.3f\n", kernel->name, (unsigned long)len,
+                       kernel->ops / kernel->bytes, gops, gbytes);
+                if (fprintf(file, "kernel,%s,%lu,%.4f,%.4f,%.4f\n", kernel->name, (unsigned long)len,
+                            kernel->ops / kernel->bytes, gops, gbytes) < 0)
+                {
+                    ret = E_NOT_OK;
+                }
+
+                len *= 4U;
+            }
+        }
+
+        if (fclose(file) != 0)
+        {
+            ret = E_NOT_OK;
+        }
+    }
+
+    printf("Roofline data %s: %s\n", path, (ret == E_OK) ? "written" : "FAILED");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+
+/***********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
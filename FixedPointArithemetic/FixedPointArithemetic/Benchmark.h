@@ -0,0 +1,48 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    Benchmark.h
+
+@brief      Interface of the benchmark suite of the test application.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Roofline measurement added
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+
+/** @addtogroup g_TestHarness
+ *  @{
+ */
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern void RunBenchmarks(void);
+extern Std_ReturnType RunRoofline(const char* path);
+
+/** @} end addtogroup */
+
+#endif /* BENCHMARK_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
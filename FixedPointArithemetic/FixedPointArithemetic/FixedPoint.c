@@ -13,6 +13,10 @@ Filename    FixedPoint.c
  * - 16-bit: The fractional bit positions (SHIFT_16 in FixedPoint_cfg.h) define the Q format used internally.
  * - 8-bit:  The fractional bit positions (SHIFT_8 in FixedPoint_cfg.h) define the Q format used internally.
  * - Public API: Accepts/returns float values
+ * - Batch API: Operates on arrays already in the configured 16-bit Q-format (no float conversion)
+ * - Results of the 16-bit element-wise batch kernels from FixedPoint_GetNonTemporalThreshold() elements on
+ *   are written with non-temporal stores (SSE2) and the inputs are prefetched, so that large results
+ *   do not evict the working set of the following stage from the cache. Off by default (threshold 0).
  * - Implements round-to-nearest (symmetric rounding), saturation at format boundaries and status reporting.
 
 @author     Harikrishnan Haridas
@@ -28,6 +32,19 @@ Version   Date        Sign  Description
 01.01.00  2025-12-21  Hari   Updated to fixed-point core and wrapper functions
 01.02.00  2025-12-22  Hari   Updated rounding, saturation and error handling
 01.03.00  2026-01-07  Hari   Updated and added detailed comments.
+01.04.00  2026-10-18  AGT    Added 16-bit batch kernels on fixed-point arrays.
+01.05.00  2026-10-18  AGT    Added optional thread-local result cache for Mult16/Div16.
+01.06.00  2026-10-18  AGT    Added batch conversion, dot product and FIR kernels.
+01.07.00  2026-10-18  AGT    Added 8-bit multiplication and division batch kernels.
+01.08.00  2026-10-18  AGT    Added trace points to the strided, dot product and FIR kernels.
+01.09.00  2026-10-18  AGT    Added USDT probes at the saturation and division by zero paths.
+01.10.00  2026-10-18  AGT    Saturation hooks also feed the saturation log.
+01.11.00  2026-10-18  AGT    Added sampled shadow checks to the float interface and batch kernels.
+01.12.00  2026-10-18  AGT    Added runtime counters to the float interface and batch kernels.
+01.13.00  2026-10-18  AGT    Added non-temporal stores and prefetch for large 16-bit batch kernels.
+01.14.00  2026-10-18  AGT    SSE2 detection moved to the configuration header.
+01.15.00  2026-10-18  AGT    Batch kernel calls counted once (strided operation no longer counted twice).
+01.16.00  2026-10-18  AGT    Non-temporal stores off by default.
 
 @endverbatim
 **********************************************************************************************************************/
@@ -38,6 +55,14 @@ INCLUDES
 #include <stddef.h>            /* for NULL */
 #include "FixedPoint.h"
 #include "FixedPoint_cfg.h"
+#include "FixedPoint_Trace.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Shadow.h"
+#include "FixedPoint_Metrics.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for _mm_stream_si128, _mm_prefetch */
+#endif
 
 /** @addtogroup g_FixedPoint
 @{ */
@@ -47,6 +72,96 @@ INCLUDES
  MACROS
  **********************************************************************************************************************/
 
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+/** @brief Check a sampled call of the float interface against the double reference (FixedPoint_Shadow). */
+#define FIXEDPOINT_SHADOW_SCALAR(op, width, a, b, result, status) \
+    do { \
+        if (--FixedPoint_ShadowCountdown == 0U) \
+        { \
+            FixedPoint_ShadowCountdown = FixedPoint_Shadow_Reload(); \
+            if ((result) != NULL) \
+            { \
+                FixedPoint_Shadow_Check((op), (width), (double)(a), (double)(b), (double)*(result), (status)); \
+            } \
+        } \
+    } while (0)
+
+/** @brief Declare the sample of a batch kernel call and capture its operands if the call is sampled. */
+#define FIXEDPOINT_SHADOW_ARRAY_BEGIN(width, a, b, len) \
+    FixedPoint_ShadowSample_t shadowSample; \
+    shadowSample.count = 0U; \
+    if (--FixedPoint_ShadowCountdown == 0U) \
+    { \
+        FixedPoint_ShadowCountdown = FixedPoint_Shadow_Reload(); \
+        FixedPoint_Shadow_Capture##width(&shadowSample, (a), (b), (len)); \
+    }
+
+/** @brief Check the captured elements of a sampled batch kernel call. */
+#define FIXEDPOINT_SHADOW_ARRAY_END(width, op, r) \
+    do { \
+        if (shadowSample.count != 0U) \
+        { \
+            FixedPoint_Shadow_CheckArray##width((op), &shadowSample, (r)); \
+        } \
+    } while (0)
+#else
+/** @brief Shadow execution disabled: no code is generated. */
+#define FIXEDPOINT_SHADOW_SCALAR(op, width, a, b, result, status)  do { } while (0)
+
+/** @brief Shadow execution disabled: no code is generated. */
+#define FIXEDPOINT_SHADOW_ARRAY_BEGIN(width, a, b, len)
+
+/** @brief Shadow execution disabled: no code is generated. */
+#define FIXEDPOINT_SHADOW_ARRAY_END(width, op, r)                   do { } while (0)
+#endif
+
+/** @brief Elements computed into a stack block before they are streamed to the result (multiple of a cache line). */
+#define FIXEDPOINT_NT_BLOCK_LEN     (FIXEDPOINT_CACHE_LINE_SIZE)
+
+#if (FIXEDPOINT_SSE2 == 1U)
+/** @brief Prefetch a read-once input line without allocating it in the outer cache levels. */
+#define FIXEDPOINT_PREFETCH(p)      _mm_prefetch((const char*)(const void*)(p), _MM_HINT_NTA)
+#elif defined(__GNUC__)
+/** @brief Prefetch a read-once input line with no temporal locality. */
+#define FIXEDPOINT_PREFETCH(p)      __builtin_prefetch((p), 0, 0)
+#else
+/** @brief No prefetch instruction available: no code is generated. */
+#define FIXEDPOINT_PREFETCH(p)      do { } while (0)
+#endif
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Entry of the direct-mapped result cache, keyed on the quantized operand pair. */
+typedef struct
+{
+    uint32         key;     /**< Operand pair: (uint16)a in the upper half, (uint16)b in the lower half */
+    t_Fixed16      result;  /**< Core result for the operand pair */
+    Std_ReturnType status;  /**< Core status for the operand pair */
+    boolean        valid;   /**< Entry holds a result */
+} FixedPoint_CacheEntry_t;
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/* One cache and one statistic per thread: no locking or atomic access is required. */
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_CacheEntry_t FixedPoint_CacheMult16[FIXEDPOINT_RESULT_CACHE_SIZE];
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_CacheEntry_t FixedPoint_CacheDiv16[FIXEDPOINT_RESULT_CACHE_SIZE];
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_CacheStats_t FixedPoint_CacheStatsMult16;
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_CacheStats_t FixedPoint_CacheStatsDiv16;
+#endif
+
+/** @brief Result length from which the 16-bit element-wise batch kernels use non-temporal stores, 0 = never. */
+static uint32 FixedPoint_NtThreshold = FIXEDPOINT_NT_THRESHOLD;
+
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+/** @brief Calls of the calling thread until the next shadow check. */
+static FIXEDPOINT_THREAD_LOCAL uint32 FixedPoint_ShadowCountdown = 1U;
+#endif
+
  /**********************************************************************************************************************
  LOCAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
@@ -74,6 +189,22 @@ static Std_ReturnType FixedPoint_Sub8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r);
 static Std_ReturnType FixedPoint_Mult8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r);
 static Std_ReturnType FixedPoint_Div8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r);
 
+/* Narrowing of wide accumulators used by the reduction and filter kernels. */
+static Std_ReturnType FixedPoint_Narrow16(sint64 acc, t_Fixed16* r);
+
+/* Element-wise 16-bit kernel body and its cache bypassing variant for large results. */
+static Std_ReturnType FixedPoint_Block16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                         t_Fixed16* r, uint32 len);
+static Std_ReturnType FixedPoint_Array16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                         t_Fixed16* r, uint32 len);
+static Std_ReturnType FixedPoint_NonTemporal16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                               t_Fixed16* r, uint32 len);
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/* Result cache in front of the 16-bit multiplication and division cores. */
+static Std_ReturnType FixedPoint_Cached16_Core(FixedPoint_Operation_t op, t_Fixed16 a, t_Fixed16 b, t_Fixed16* r);
+#endif
+
 /**********************************************************************************************************************
 LOCAL FUNCTIONS
 **********************************************************************************************************************/
@@ -125,6 +256,7 @@ static Std_ReturnType FixedPoint_FloatToFix16(float val, t_Fixed16* outVal)
         if (scaled_i > (sint32)FIX16_MAX)
             /* Check if the rounded value exceeds the maximum fixed-point limit */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 16, scaled_i, 0, FIX16_MAX);
             scaled_i = (sint32)FIX16_MAX;
             /* Saturate the value to the maximum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -133,6 +265,7 @@ static Std_ReturnType FixedPoint_FloatToFix16(float val, t_Fixed16* outVal)
         else if (scaled_i < (sint32)FIX16_MIN)
             /* Check if the rounded value is below the minimum fixed-point limit */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 16, scaled_i, 0, FIX16_MIN);
             scaled_i = (sint32)FIX16_MIN;
             /* Saturate the value to the minimum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -220,6 +353,7 @@ static Std_ReturnType FixedPoint_FloatToFix8(float val, t_Fixed8* outVal)
         if (scaled_i > (sint16)FIX8_MAX)
             /* Check if the result exceeds the maximum fixed-point range */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 8, scaled_i, 0, FIX8_MAX);
             scaled_i = (sint16)FIX8_MAX;
             /* Saturate the value to the maximum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -228,6 +362,7 @@ static Std_ReturnType FixedPoint_FloatToFix8(float val, t_Fixed8* outVal)
         else if (scaled_i < (sint16)FIX8_MIN)
             /* Check if the result is below the minimum fixed-point range */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 8, scaled_i, 0, FIX8_MIN);
             scaled_i = (sint16)FIX8_MIN;
             /* Saturate the value to the minimum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -298,6 +433,7 @@ static Std_ReturnType FixedPoint_Add16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         if (tmp > (sint32)FIX16_MAX)
             /* Check if the addition result exceeds the maximum fixed-point value */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_ADD, 16, a, b, FIX16_MAX);
             tmp = (sint32)FIX16_MAX;
             /* Saturate the result to the maximum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -306,6 +442,7 @@ static Std_ReturnType FixedPoint_Add16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         else if (tmp < (sint32)FIX16_MIN)
             /* Check if the addition result is below the minimum fixed-point value */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_ADD, 16, a, b, FIX16_MIN);
             tmp = (sint32)FIX16_MIN;
             /* Saturate the result to the minimum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -355,6 +492,7 @@ static Std_ReturnType FixedPoint_Sub16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         if (tmp > (sint32)FIX16_MAX)
             /* Check if the subtraction result exceeds the maximum fixed-point limit */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 16, a, b, FIX16_MAX);
             tmp = (sint32)FIX16_MAX;
             /* Saturate the result to the maximum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -363,6 +501,7 @@ static Std_ReturnType FixedPoint_Sub16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         else if (tmp < (sint32)FIX16_MIN)
             /* Check if the subtraction result is below the minimum fixed-point limit */
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 16, a, b, FIX16_MIN);
             tmp = (sint32)FIX16_MIN;
             /* Saturate the result to the minimum allowed fixed-point value */
             ret = E_NOT_OK;
@@ -443,6 +582,7 @@ static Std_ReturnType FixedPoint_Mult16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16
         if (tmp > (sint64)FIX16_MAX)
         {
             /* saturates the result if out of range */
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_MULT, 16, a, b, FIX16_MAX);
             tmp = (sint64)FIX16_MAX;
             /* ret is assigned failure code*/
             ret = E_NOT_OK;
@@ -450,6 +590,7 @@ static Std_ReturnType FixedPoint_Mult16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16
         else if (tmp < (sint64)FIX16_MIN)
         {
             /* saturates the result if out of range */
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_MULT, 16, a, b, FIX16_MIN);
             tmp = (sint64)FIX16_MIN;
             /* ret is assigned failure code*/
             ret = E_NOT_OK;
@@ -524,6 +665,7 @@ static Std_ReturnType FixedPoint_Div16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         if (tmp > (sint64)FIX16_MAX)
         {
             /* saturates the result if out of range */
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_DIV, 16, a, b, FIX16_MAX);
             tmp = (sint64)FIX16_MAX;
             /* ret is assigned failure code*/
             ret = E_NOT_OK;
@@ -531,6 +673,7 @@ static Std_ReturnType FixedPoint_Div16_Core(t_Fixed16 a, t_Fixed16 b, t_Fixed16*
         else if (tmp < (sint64)FIX16_MIN)
         {
             /* saturates the result if out of range */
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_DIV, 16, a, b, FIX16_MIN);
             tmp = (sint64)FIX16_MIN;
             /* ret is assigned failure code*/
             ret = E_NOT_OK;
@@ -574,11 +717,13 @@ static Std_ReturnType FixedPoint_Add8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r)
 
         if (tmp > (sint16)FIX8_MAX)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_ADD, 8, a, b, FIX8_MAX);
             tmp = (sint16)FIX8_MAX;
             ret = E_NOT_OK;
         }
         else if (tmp < (sint16)FIX8_MIN)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_ADD, 8, a, b, FIX8_MIN);
             tmp = (sint16)FIX8_MIN;
             ret = E_NOT_OK;
         }
@@ -618,11 +763,13 @@ static Std_ReturnType FixedPoint_Sub8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r)
 
         if (tmp > (sint16)FIX8_MAX)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 8, a, b, FIX8_MAX);
             tmp = (sint16)FIX8_MAX;
             ret = E_NOT_OK;
         }
         else if (tmp < (sint16)FIX8_MIN)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 8, a, b, FIX8_MIN);
             tmp = (sint16)FIX8_MIN;
             ret = E_NOT_OK;
         }
@@ -691,12 +838,14 @@ static Std_ReturnType FixedPoint_Mult8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r)
         if (tmp > (sint32)FIX8_MAX)
         {
             /* saturates the result if out of range */
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_MULT, 8, a, b, FIX8_MAX);
             tmp = (sint32)FIX8_MAX;
             /* returns failure code*/
             ret = E_NOT_OK;
         }
         else if (tmp < (sint32)FIX8_MIN)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_MULT, 8, a, b, FIX8_MIN);
             tmp = (sint32)FIX8_MIN;
             ret = E_NOT_OK;
         }
@@ -756,11 +905,13 @@ static Std_ReturnType FixedPoint_Div8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r)
 
         if (tmp > (sint32)FIX8_MAX)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_DIV, 8, a, b, FIX8_MAX);
             tmp = (sint32)FIX8_MAX;
             ret = E_NOT_OK;
         }
         else if (tmp < (sint32)FIX8_MIN)
         {
+            FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_DIV, 8, a, b, FIX8_MIN);
             tmp = (sint32)FIX8_MIN;
             ret = E_NOT_OK;
         }
@@ -775,6 +926,297 @@ static Std_ReturnType FixedPoint_Div8_Core(t_Fixed8 a, t_Fixed8 b, t_Fixed8* r)
     return ret;
 }
 
+/*********************************************************************************************************************/
+/*! @brief     Narrow a 64-bit accumulator with 2*SHIFT_16 fractional bits to 16-bit fixed-point.
+ *
+ *  Uses the same symmetric round-to-nearest and saturation as FixedPoint_Mult16_Core(), so that
+ *  reductions over many products are rounded once instead of per term.
+ *
+ *  @param[in]  acc     Accumulator with 2*SHIFT_16 fractional bits.
+ *  @param[out] r       Pointer to store the result in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result within range.
+ *  @retval     E_NOT_OK    Saturation occurred.
+ */
+static Std_ReturnType FixedPoint_Narrow16(sint64 acc, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    sint64 tmp = acc;
+
+#if (SHIFT_16 > 0U)
+    {
+        const sint64 half = ((sint64)1 << (SHIFT_16 - 1U));
+        const boolean neg = (tmp < 0) ? 1U : 0U;
+        sint64 mag = neg ? -tmp : tmp;
+
+        mag = (mag + half) >> SHIFT_16;
+        tmp = neg ? -mag : mag;
+    }
+#endif
+
+    if (tmp > (sint64)FIX16_MAX)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, acc, 0, FIX16_MAX);
+        tmp = (sint64)FIX16_MAX;
+        ret = E_NOT_OK;
+    }
+    else if (tmp < (sint64)FIX16_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, acc, 0, FIX16_MIN);
+        tmp = (sint64)FIX16_MIN;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        ret = E_OK;
+    }
+
+    *r = (t_Fixed16)tmp;
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise 16-bit operation over a block of arrays.
+ *
+ *  Same element behaviour as the batch kernel of the operation, including the saturation of a
+ *  division by zero towards the sign of the dividend.
+ *
+ *  @param[in]  op      Operation to perform.
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid operation, division by zero or saturation of at least one element.
+ */
+static Std_ReturnType FixedPoint_Block16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                         t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 i;
+
+    switch (op)
+    {
+    case FIXEDPOINT_OP_ADD:
+        for (i = 0U; i < len; i++)
+        {
+            ret |= FixedPoint_Add16_Core(a[i], b[i], &r[i]);
+        }
+        break;
+    case FIXEDPOINT_OP_SUB:
+        for (i = 0U; i < len; i++)
+        {
+            ret |= FixedPoint_Sub16_Core(a[i], b[i], &r[i]);
+        }
+        break;
+    case FIXEDPOINT_OP_MULT:
+        for (i = 0U; i < len; i++)
+        {
+            ret |= FixedPoint_Mult16_Core(a[i], b[i], &r[i]);
+        }
+        break;
+    case FIXEDPOINT_OP_DIV:
+        for (i = 0U; i < len; i++)
+        {
+            if (b[i] != 0)
+            {
+                ret |= FixedPoint_Div16_Core(a[i], b[i], &r[i]);
+            }
+            else
+            {
+                r[i] = (a[i] > 0) ? FIX16_MAX : ((a[i] < 0) ? FIX16_MIN : (t_Fixed16)0);
+                FIXEDPOINT_PROBE_DIV_ZERO(16, a[i], r[i]);
+                ret = E_NOT_OK;
+            }
+        }
+        break;
+    default:
+        ret = E_NOT_OK;
+        break;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise 16-bit operation over large arrays, bypassing the cache for the result.
+ *
+ *  The result is computed block by block into a stack buffer that stays in L1 and then written
+ *  with non-temporal stores, which go to memory without reading the destination lines into the
+ *  cache and without evicting other data. Elements up to the first 16-byte aligned result
+ *  element and the last partial block use regular stores. The inputs are prefetched
+ *  FIXEDPOINT_PREFETCH_DISTANCE bytes ahead. Without SSE2 the blocks are written directly and
+ *  only the prefetch is applied. The results are identical to FixedPoint_Block16().
+ *
+ *  @param[in]  op      Operation to perform.
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format, may alias a or b.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid operation, division by zero or saturation of at least one element.
+ */
+static Std_ReturnType FixedPoint_NonTemporal16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                               t_Fixed16* r, uint32 len)
+{
+    const uint32 distance = FIXEDPOINT_PREFETCH_DISTANCE / sizeof(t_Fixed16);
+    const uint32 lineLen = FIXEDPOINT_CACHE_LINE_SIZE / sizeof(t_Fixed16);
+    uint32 head = (uint32)(((16U - ((size_t)r % 16U)) % 16U) / sizeof(t_Fixed16));
+    Std_ReturnType ret;
+    uint32 i;
+
+    head = (head < len) ? head : len;
+    ret = FixedPoint_Block16(op, a, b, r, head);
+
+    for (i = head; (len - i) >= FIXEDPOINT_NT_BLOCK_LEN; i += FIXEDPOINT_NT_BLOCK_LEN)
+    {
+        uint32 k;
+
+        if ((len - i) > (distance + FIXEDPOINT_NT_BLOCK_LEN))
+        {
+            for (k = 0U; k < FIXEDPOINT_NT_BLOCK_LEN; k += lineLen)
+            {
+                FIXEDPOINT_PREFETCH(&a[i + distance + k]);
+                FIXEDPOINT_PREFETCH(&b[i + distance + k]);
+            }
+        }
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        {
+            t_Fixed16 block[FIXEDPOINT_NT_BLOCK_LEN];
+
+            ret |= FixedPoint_Block16(op, &a[i], &b[i], block, FIXEDPOINT_NT_BLOCK_LEN);
+
+            for (k = 0U; k < FIXEDPOINT_NT_BLOCK_LEN; k += 8U)
+            {
+                _mm_stream_si128((__m128i*)(void*)&r[i + k], _mm_loadu_si128((const __m128i*)(const void*)&block[k]));
+            }
+        }
+#else
+        ret |= FixedPoint_Block16(op, &a[i], &b[i], &r[i], FIXEDPOINT_NT_BLOCK_LEN);
+        (void)k;
+#endif
+    }
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    /* Non-temporal stores are weakly ordered: make them visible before the caller continues */
+    _mm_sfence();
+#endif
+
+    ret |= FixedPoint_Block16(op, &a[i], &b[i], &r[i], len - i);
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise 16-bit operation over contiguous arrays without instrumentation.
+ *
+ *  Common body of the 16-bit batch kernels and of the contiguous path of FixedPoint_Op16_Strided():
+ *  large arrays go through FixedPoint_NonTemporal16(), others through FixedPoint_Block16(). The
+ *  callers count the call in the metrics and sample it for shadow execution, so a call is counted
+ *  once, by the interface the application called.
+ *
+ *  @param[in]  op      Operation to perform.
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format, may alias a or b.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid operation, division by zero or saturation of at least one element.
+ */
+static Std_ReturnType FixedPoint_Array16(FixedPoint_Operation_t op, const t_Fixed16* a, const t_Fixed16* b,
+                                         t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret;
+
+    if ((FixedPoint_NtThreshold != 0U) && (len >= FixedPoint_NtThreshold))
+    {
+        ret = FixedPoint_NonTemporal16(op, a, b, r, len);
+    }
+    else
+    {
+        ret = FixedPoint_Block16(op, a, b, r, len);
+    }
+
+    return ret;
+}
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Direct-mapped result cache in front of the 16-bit multiplication and division cores.
+ *
+ *  The cache is indexed by a hash of the quantized operand pair. On a hit the stored result and
+ *  status are returned without calling the core. On a miss the core is executed and its result
+ *  replaces the entry. Cache and statistics are thread-local, so concurrent callers never share
+ *  an entry. Only FIXEDPOINT_OP_MULT and FIXEDPOINT_OP_DIV are cached; the divisor must not be zero.
+ *
+ *  @param[in]  op      FIXEDPOINT_OP_MULT or FIXEDPOINT_OP_DIV.
+ *  @param[in]  a       First operand in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand in configured 16-bit Q-format.
+ *  @param[out] r       Pointer to store the result in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Calculation successful without saturation.
+ *  @retval     E_NOT_OK    Saturation occurred, null pointer passed or operation not cached.
+ */
+static Std_ReturnType FixedPoint_Cached16_Core(FixedPoint_Operation_t op, t_Fixed16 a, t_Fixed16 b, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((r != NULL) && ((op == FIXEDPOINT_OP_MULT) || (op == FIXEDPOINT_OP_DIV)))
+    {
+        const uint32 key = (((uint32)(uint16)a) << 16) | (uint32)(uint16)b;
+        /* Fold the operand pair so that neighbouring setpoints spread over the cache */
+        const uint32 index = (key ^ (key >> 7) ^ (key >> 17)) & (FIXEDPOINT_RESULT_CACHE_SIZE - 1U);
+        FixedPoint_CacheEntry_t* entry;
+        FixedPoint_CacheStats_t* stats;
+
+        if (op == FIXEDPOINT_OP_MULT)
+        {
+            entry = &FixedPoint_CacheMult16[index];
+            stats = &FixedPoint_CacheStatsMult16;
+        }
+        else
+        {
+            entry = &FixedPoint_CacheDiv16[index];
+            stats = &FixedPoint_CacheStatsDiv16;
+        }
+
+        if ((entry->valid != 0U) && (entry->key == key))
+        {
+            /* Hit: skip the core, the saturation is still reported to an attached tracer */
+            stats->hits++;
+            if (entry->status != E_OK)
+            {
+                FIXEDPOINT_PROBE_SATURATE(op, 16, a, b, entry->result);
+            }
+        }
+        else
+        {
+            /* Miss: compute and replace the entry */
+            stats->misses++;
+            entry->status = (op == FIXEDPOINT_OP_MULT) ? FixedPoint_Mult16_Core(a, b, &entry->result)
+                                                       : FixedPoint_Div16_Core(a, b, &entry->result);
+            entry->key = key;
+            entry->valid = 1U;
+        }
+
+        *r = entry->result;
+        ret = entry->status;
+    }
+
+    return ret;
+}
+#endif
+
 /**********************************************************************************************************************
 GLOBAL FUNCTIONS
 **********************************************************************************************************************/
@@ -838,6 +1280,9 @@ Std_ReturnType FixedPoint_Add16(float val1, float val2, float* result)
         *result = FixedPoint_Fix16ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_ADD, 16U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_ADD, 16U, val1, val2, result, ret);
+
     /* Return overall status of the operation */
     return ret;
 }
@@ -902,6 +1347,9 @@ Std_ReturnType FixedPoint_Sub16(float val1, float val2, float* result)
         *result = FixedPoint_Fix16ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_SUB, 16U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_SUB, 16U, val1, val2, result, ret);
+
     /* Return overall status of the operation */
     return ret;
 }
@@ -950,7 +1398,11 @@ Std_ReturnType FixedPoint_Mult16(float val1, float val2, float* result)
         Std_ReturnType conv2 = FixedPoint_FloatToFix16(val2, &b);
 
         /* Perform fixed-point multiplication using the core integer arithmetic function */
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+        Std_ReturnType core = FixedPoint_Cached16_Core(FIXEDPOINT_OP_MULT, a, b, &rFixed);
+#else
         Std_ReturnType core = FixedPoint_Mult16_Core(a, b, &rFixed);
+#endif
 
         /* Check whether both conversions and the core multiplication completed without saturation */
         if ((conv1 == E_OK) && (conv2 == E_OK) && (core == E_OK))
@@ -968,6 +1420,9 @@ Std_ReturnType FixedPoint_Mult16(float val1, float val2, float* result)
         *result = FixedPoint_Fix16ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_MULT, 16U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_MULT, 16U, val1, val2, result, ret);
+
     /* Return overall status of the operation */
     return ret;
 }
@@ -1000,23 +1455,27 @@ Std_ReturnType FixedPoint_Div16(float val1, float val2, float* result)
         /* Fixed-point representation of the divisor */
         t_Fixed16 b;
 
+        /* Fixed-point representation of the dividend */
+        t_Fixed16 a;
+
         /* Convert second floating-point input to fixed-point to check for division by zero */
         Std_ReturnType conv2 = FixedPoint_FloatToFix16(val2, &b);
 
+        /* Convert first floating-point input to 16-bit fixed-point with rounding/saturation */
+        Std_ReturnType conv1 = FixedPoint_FloatToFix16(val1, &a);
+
         /* Proceed only if the converted divisor is non-zero */
         if (b != 0)
         {
-            /* Fixed-point representation of the dividend */
-            t_Fixed16 a;
-
             /* Fixed-point variable to store the division result */
             t_Fixed16 rFixed = 0;
 
-            /* Convert first floating-point input to 16-bit fixed-point with rounding/saturation */
-            Std_ReturnType conv1 = FixedPoint_FloatToFix16(val1, &a);
-
             /* Perform fixed-point division using the core integer arithmetic function */
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+            Std_ReturnType core = FixedPoint_Cached16_Core(FIXEDPOINT_OP_DIV, a, b, &rFixed);
+#else
             Std_ReturnType core = FixedPoint_Div16_Core(a, b, &rFixed);
+#endif
 
             /* Check whether both conversions and the core division completed without saturation */
             if ((conv1 == E_OK) && (conv2 == E_OK) && (core == E_OK))
@@ -1036,10 +1495,14 @@ Std_ReturnType FixedPoint_Div16(float val1, float val2, float* result)
         else
         {
             /* Division by zero detected after conversion: report error and leave *result unchanged */
+            FIXEDPOINT_PROBE_DIV_ZERO(16, a, 0);
             ret = E_NOT_OK;
         }
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_DIV, 16U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_DIV, 16U, val1, val2, result, ret);
+
     /* Return overall status of the operation */
     return ret;
 }
@@ -1088,6 +1551,9 @@ Std_ReturnType FixedPoint_Add8(float val1, float val2, float* result)
         *result = FixedPoint_Fix8ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_ADD, 8U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_ADD, 8U, val1, val2, result, ret);
+
     return ret;
 }
 
@@ -1134,6 +1600,9 @@ Std_ReturnType FixedPoint_Sub8(float val1, float val2, float* result)
         *result = FixedPoint_Fix8ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_SUB, 8U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_SUB, 8U, val1, val2, result, ret);
+
     return ret;
 }
 
@@ -1182,6 +1651,9 @@ Std_ReturnType FixedPoint_Mult8(float val1, float val2, float* result)
         *result = FixedPoint_Fix8ToFloat(rFixed);
     }
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_MULT, 8U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_MULT, 8U, val1, val2, result, ret);
+
     return ret;
 }
 
@@ -1210,12 +1682,12 @@ Std_ReturnType FixedPoint_Div8(float val1, float val2, float* result)
     {
         /* Converting val2 to fixed point and to check if its 0 */
         t_Fixed8 b; 
+        t_Fixed8 a;
         Std_ReturnType conv2 = FixedPoint_FloatToFix8(val2, &b);
+        Std_ReturnType conv1 = FixedPoint_FloatToFix8(val1, &a);
         if (b != 0)
         {
-            t_Fixed8 a;
             t_Fixed8 rFixed = 0;
-            Std_ReturnType conv1 = FixedPoint_FloatToFix8(val1, &a);
             Std_ReturnType core = FixedPoint_Div8_Core(a, b, &rFixed);
 
             if ((conv1 == E_OK) && (conv2 == E_OK) && (core == E_OK))
@@ -1232,14 +1704,638 @@ Std_ReturnType FixedPoint_Div8(float val1, float val2, float* result)
         else
         {
             /* Division by zero: report error, here *result is not modified to avoid the undefined or misleading numerical result*/
+            FIXEDPOINT_PROBE_DIV_ZERO(8, a, 0);
             ret = E_NOT_OK;
         }
     }
 
 
+    FIXEDPOINT_METRICS_CALL(FIXEDPOINT_OP_DIV, 8U);
+    FIXEDPOINT_SHADOW_SCALAR(FIXEDPOINT_OP_DIV, 8U, val1, val2, result, ret);
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point element-wise addition over arrays (batch kernel).
+ *
+ *  Operates directly on values in the configured 16-bit Q-format, no float conversion is involved.
+ *  Every element is computed with the same saturation rules as the scalar API. All elements are
+ *  always written; the status reports whether any element saturated. The result array may alias
+ *  one of the input arrays. From FixedPoint_GetNonTemporalThreshold() elements on the result is
+ *  written with non-temporal stores.
+ *
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Add16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(16, a, b, len);
+
+        ret = FixedPoint_Array16(FIXEDPOINT_OP_ADD, a, b, r, len);
+
+        FIXEDPOINT_SHADOW_ARRAY_END(16, FIXEDPOINT_OP_ADD, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_ADD16_ARRAY, (uint64)len * 3U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point element-wise subtraction over arrays (batch kernel).
+ *
+ *  Same behaviour as FixedPoint_Add16_Array() with the subtraction core (r[i] = a[i] - b[i]).
+ *
+ *  @param[in]  a       Minuend array in configured 16-bit Q-format.
+ *  @param[in]  b       Subtrahend array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Sub16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(16, a, b, len);
+
+        ret = FixedPoint_Array16(FIXEDPOINT_OP_SUB, a, b, r, len);
+
+        FIXEDPOINT_SHADOW_ARRAY_END(16, FIXEDPOINT_OP_SUB, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_SUB16_ARRAY, (uint64)len * 3U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point element-wise multiplication over arrays (batch kernel).
+ *
+ *  Same behaviour as FixedPoint_Add16_Array() with the multiplication core, i.e. symmetric
+ *  round-to-nearest of the widened product and saturation.
+ *
+ *  @param[in]  a       Multiplicand array in configured 16-bit Q-format.
+ *  @param[in]  b       Multiplier array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Mult16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(16, a, b, len);
+
+        ret = FixedPoint_Array16(FIXEDPOINT_OP_MULT, a, b, r, len);
+
+        FIXEDPOINT_SHADOW_ARRAY_END(16, FIXEDPOINT_OP_MULT, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_MULT16_ARRAY, (uint64)len * 3U * sizeof(t_Fixed16));
+
     return ret;
 }
 
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point element-wise division over arrays (batch kernel).
+ *
+ *  Same behaviour as FixedPoint_Add16_Array() with the division core. Unlike the scalar API the
+ *  result element cannot be left unmodified on division by zero, so it is saturated towards the
+ *  sign of the dividend (FIX16_MAX, FIX16_MIN, or 0 for 0/0) and E_NOT_OK is returned.
+ *
+ *  @param[in]  a       Dividend array in configured 16-bit Q-format.
+ *  @param[in]  b       Divisor array in configured 16-bit Q-format.
+ *  @param[out] r       Result array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Div16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(16, a, b, len);
+
+        ret = FixedPoint_Array16(FIXEDPOINT_OP_DIV, a, b, r, len);
+
+        FIXEDPOINT_SHADOW_ARRAY_END(16, FIXEDPOINT_OP_DIV, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_DIV16_ARRAY, (uint64)len * 3U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit fixed-point element-wise multiplication over arrays (batch kernel).
+ *
+ *  Same behaviour as FixedPoint_Mult16_Array() for the configured 8-bit Q-format.
+ *
+ *  @param[in]  a       First operand array in configured 8-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        uint32 i;
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(8, a, b, len);
+
+        ret = E_OK;
+
+        for (i = 0U; i < len; i++)
+        {
+            ret |= FixedPoint_Mult8_Core(a[i], b[i], &r[i]);
+        }
+
+        FIXEDPOINT_SHADOW_ARRAY_END(8, FIXEDPOINT_OP_MULT, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_MULT8_ARRAY, (uint64)len * 3U * sizeof(t_Fixed8));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit fixed-point element-wise division over arrays (batch kernel).
+ *
+ *  Same behaviour as FixedPoint_Div16_Array() for the configured 8-bit Q-format, including the
+ *  saturation towards the sign of the dividend on division by zero.
+ *
+ *  @param[in]  a       Dividend array in configured 8-bit Q-format.
+ *  @param[in]  b       Divisor array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        uint32 i;
+        FIXEDPOINT_SHADOW_ARRAY_BEGIN(8, a, b, len);
+
+        ret = E_OK;
+
+        for (i = 0U; i < len; i++)
+        {
+            if (b[i] != 0)
+            {
+                ret |= FixedPoint_Div8_Core(a[i], b[i], &r[i]);
+            }
+            else
+            {
+                /* Division by zero: saturate towards the sign of the dividend */
+                r[i] = (a[i] > 0) ? FIX8_MAX : ((a[i] < 0) ? FIX8_MIN : (t_Fixed8)0);
+                FIXEDPOINT_PROBE_DIV_ZERO(8, a[i], r[i]);
+                ret = E_NOT_OK;
+            }
+        }
+
+        FIXEDPOINT_SHADOW_ARRAY_END(8, FIXEDPOINT_OP_DIV, r);
+    }
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_DIV8_ARRAY, (uint64)len * 3U * sizeof(t_Fixed8));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point element-wise operation over strided arrays.
+ *
+ *  Generic form of the batch kernels where each operand is addressed with its own element stride.
+ *  A stride of 0 repeats the same element for the whole run, which is used to broadcast a scalar
+ *  (e.g. a per-channel gain) over an array. If all strides are 1 the contiguous body of the batch
+ *  kernels is used. The call is counted in the metrics only as FIXEDPOINT_KERNEL_OP16_STRIDED.
+ *
+ *  @param[in]  op      Operation to perform.
+ *  @param[in]  a       First operand in configured 16-bit Q-format.
+ *  @param[in]  strideA Element stride of a.
+ *  @param[in]  b       Second operand in configured 16-bit Q-format.
+ *  @param[in]  strideB Element stride of b.
+ *  @param[out] r       Result in configured 16-bit Q-format.
+ *  @param[in]  strideR Element stride of r.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, invalid operation, division by zero or saturation.
+ */
+Std_ReturnType FixedPoint_Op16_Strided(FixedPoint_Operation_t op,
+                                       const t_Fixed16* a, sint32 strideA,
+                                       const t_Fixed16* b, sint32 strideB,
+                                       t_Fixed16* r, sint32 strideR, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    FIXEDPOINT_TRACE_BEGIN("Op16_Strided");
+
+    if ((strideA == 1) && (strideB == 1) && (strideR == 1))
+    {
+        /* Contiguous run: body of the batch kernels, counted once as this kernel */
+        if ((a != NULL) && (b != NULL) && (r != NULL) && ((uint32)op <= (uint32)FIXEDPOINT_OP_DIV))
+        {
+            FIXEDPOINT_SHADOW_ARRAY_BEGIN(16, a, b, len);
+
+            ret = FixedPoint_Array16(op, a, b, r, len);
+
+            FIXEDPOINT_SHADOW_ARRAY_END(16, op, r);
+        }
+    }
+    else if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        uint32 i;
+
+        ret = E_OK;
+
+        for (i = 0U; i < len; i++)
+        {
+            const t_Fixed16 va = *a;
+            const t_Fixed16 vb = *b;
+
+            switch (op)
+            {
+            case FIXEDPOINT_OP_ADD:
+                ret |= FixedPoint_Add16_Core(va, vb, r);
+                break;
+            case FIXEDPOINT_OP_SUB:
+                ret |= FixedPoint_Sub16_Core(va, vb, r);
+                break;
+            case FIXEDPOINT_OP_MULT:
+                ret |= FixedPoint_Mult16_Core(va, vb, r);
+                break;
+            case FIXEDPOINT_OP_DIV:
+                /* Scalar division through the block helper to keep the division by zero handling in one place */
+                ret |= FixedPoint_Block16(FIXEDPOINT_OP_DIV, &va, &vb, r, 1U);
+                break;
+            default:
+                ret = E_NOT_OK;
+                break;
+            }
+
+            a += strideA;
+            b += strideB;
+            r += strideR;
+        }
+    }
+    else
+    {
+        /* Null pointer: ret remains E_NOT_OK */
+    }
+
+    FIXEDPOINT_TRACE_END("Op16_Strided");
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_OP16_STRIDED, (uint64)len * 3U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Convert an array of float values to 16-bit fixed-point (batch conversion).
+ *
+ *  Every element is converted with FixedPoint_FloatToFix16(), i.e. round-to-nearest (ties away
+ *  from zero) and saturation. All elements are always written.
+ *
+ *  @param[in]  in      Input values in floating-point representation.
+ *  @param[out] out     Output values in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements converted without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_FloatToFix16_Array(const float* in, t_Fixed16* out, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL))
+    {
+        uint32 i;
+
+        ret = E_OK;
+
+        for (i = 0U; i < len; i++)
+        {
+            ret |= FixedPoint_FloatToFix16(in[i], &out[i]);
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Convert an array of 16-bit fixed-point values to float (batch conversion).
+ *
+ *  @param[in]  in      Input values in configured 16-bit Q-format.
+ *  @param[out] out     Output values in floating-point representation.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements converted.
+ *  @retval     E_NOT_OK    Null pointer passed.
+ */
+Std_ReturnType FixedPoint_Fix16ToFloat_Array(const t_Fixed16* in, float* out, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL))
+    {
+        uint32 i;
+
+        for (i = 0U; i < len; i++)
+        {
+            out[i] = FixedPoint_Fix16ToFloat(in[i]);
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point dot product with wide accumulation (reduction kernel).
+ *
+ *  The products are accumulated exactly in 64 bit with 2*SHIFT_16 fractional bits. Rounding and
+ *  saturation are applied once to the final sum, not to every term.
+ *
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *  @param[out] r       Pointer to store the dot product in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Dot product calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of the result.
+ */
+Std_ReturnType FixedPoint_Dot16(const t_Fixed16* a, const t_Fixed16* b, uint32 len, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    FIXEDPOINT_TRACE_BEGIN("Dot16");
+
+    if ((a != NULL) && (b != NULL) && (r != NULL))
+    {
+        sint64 acc = 0;
+        uint32 i;
+
+        for (i = 0U; i < len; i++)
+        {
+            acc += (sint64)a[i] * (sint64)b[i];
+        }
+
+        ret = FixedPoint_Narrow16(acc, r);
+    }
+
+    FIXEDPOINT_TRACE_END("Dot16");
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_DOT16, (uint64)len * 2U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise a 16-bit FIR filter and clear its delay line.
+ *
+ *  @param[out] fir         Filter state to initialise.
+ *  @param[in]  coeffs      Filter coefficients h[0..numTaps-1] in configured 16-bit Q-format.
+ *  @param[in]  numTaps     Number of coefficients (>= 1).
+ *  @param[in]  delay       Delay line storage with numTaps-1 entries (may be NULL for numTaps == 1).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Filter initialised.
+ *  @retval     E_NOT_OK    Null pointer or zero taps.
+ */
+Std_ReturnType FixedPoint_Fir16_Init(FixedPoint_Fir16_t* fir, const t_Fixed16* coeffs, uint32 numTaps, t_Fixed16* delay)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((fir != NULL) && (coeffs != NULL) && (numTaps >= 1U) && ((delay != NULL) || (numTaps == 1U)))
+    {
+        uint32 i;
+
+        for (i = 0U; i < (numTaps - 1U); i++)
+        {
+            delay[i] = 0;
+        }
+
+        fir->coeffs = coeffs;
+        fir->delay = delay;
+        fir->numTaps = numTaps;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     16-bit fixed-point FIR filter over a block of samples (filter kernel).
+ *
+ *  Computes out[n] = sum(h[k] * x[n-k]) in direct form. Samples before the block are taken from
+ *  the delay line, which is updated with the last numTaps-1 input samples afterwards, so
+ *  consecutive blocks form a continuous stream. Every output is accumulated in 64 bit and rounded
+ *  and saturated once. Input and output must not overlap.
+ *
+ *  @param[in,out]  fir     Filter state.
+ *  @param[in]      in      Input block in configured 16-bit Q-format.
+ *  @param[out]     out     Output block in configured 16-bit Q-format.
+ *  @param[in]      len     Number of samples.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All samples filtered without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one output sample.
+ */
+Std_ReturnType FixedPoint_Fir16(FixedPoint_Fir16_t* fir, const t_Fixed16* in, t_Fixed16* out, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FIXEDPOINT_METRICS_KERNEL_BEGIN();
+
+    FIXEDPOINT_TRACE_BEGIN("Fir16");
+
+    if ((fir != NULL) && (in != NULL) && (out != NULL))
+    {
+        const uint32 taps = fir->numTaps;
+        const t_Fixed16* h = fir->coeffs;
+        uint32 n;
+        uint32 k;
+
+        ret = E_OK;
+
+        for (n = 0U; n < len; n++)
+        {
+            const uint32 kMax = (n < (taps - 1U)) ? n : (taps - 1U);
+            sint64 acc = 0;
+
+            /* Taps reaching into the current block */
+            for (k = 0U; k <= kMax; k++)
+            {
+                acc += (sint64)h[k] * (sint64)in[n - k];
+            }
+
+            /* Taps reaching into the delay line (oldest sample at index 0) */
+            for (k = kMax + 1U; k < taps; k++)
+            {
+                acc += (sint64)h[k] * (sint64)fir->delay[(taps - 1U) + n - k];
+            }
+
+            ret |= FixedPoint_Narrow16(acc, &out[n]);
+        }
+
+        /* Keep the last numTaps-1 input samples for the next block */
+        if (len >= (taps - 1U))
+        {
+            for (k = 0U; k < (taps - 1U); k++)
+            {
+                fir->delay[k] = in[(len - (taps - 1U)) + k];
+            }
+        }
+        else
+        {
+            for (k = 0U; k < ((taps - 1U) - len); k++)
+            {
+                fir->delay[k] = fir->delay[k + len];
+            }
+            for (k = 0U; k < len; k++)
+            {
+                fir->delay[((taps - 1U) - len) + k] = in[k];
+            }
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Fir16");
+
+    FIXEDPOINT_METRICS_KERNEL_END(FIXEDPOINT_KERNEL_FIR16, (uint64)len * 2U * sizeof(t_Fixed16));
+
+    return ret;
+}
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Read the result cache statistics of the calling thread.
+ *
+ *  @param[in]  op      FIXEDPOINT_OP_MULT or FIXEDPOINT_OP_DIV.
+ *  @param[out] stats   Pointer to store the hit and miss counters.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Statistics copied.
+ *  @retval     E_NOT_OK    Null pointer or operation not cached.
+ */
+Std_ReturnType FixedPoint_GetCacheStats(FixedPoint_Operation_t op, FixedPoint_CacheStats_t* stats)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (stats != NULL)
+    {
+        if (op == FIXEDPOINT_OP_MULT)
+        {
+            *stats = FixedPoint_CacheStatsMult16;
+            ret = E_OK;
+        }
+        else if (op == FIXEDPOINT_OP_DIV)
+        {
+            *stats = FixedPoint_CacheStatsDiv16;
+            ret = E_OK;
+        }
+        else
+        {
+            /* Operation is not cached */
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Invalidate all result cache entries and clear the statistics of the calling thread.
+ */
+void FixedPoint_ResetCache(void)
+{
+    uint32 i;
+
+    for (i = 0U; i < FIXEDPOINT_RESULT_CACHE_SIZE; i++)
+    {
+        FixedPoint_CacheMult16[i].valid = 0U;
+        FixedPoint_CacheDiv16[i].valid = 0U;
+    }
+
+    FixedPoint_CacheStatsMult16.hits = 0U;
+    FixedPoint_CacheStatsMult16.misses = 0U;
+    FixedPoint_CacheStatsDiv16.hits = 0U;
+    FixedPoint_CacheStatsDiv16.misses = 0U;
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Set the result length from which the 16-bit element-wise batch kernels bypass the cache.
+ *
+ *  Tune the value with the non-temporal benchmark of the target: roughly the size from which the
+ *  result no longer fits into the last level cache next to the working set of the following stage.
+ *  Set it once at init, before the kernels are called from several threads.
+ *
+ *  @param[in]  len     Threshold in elements, 0 to always use regular stores.
+ */
+void FixedPoint_SetNonTemporalThreshold(uint32 len)
+{
+    FixedPoint_NtThreshold = len;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Result length from which the 16-bit element-wise batch kernels bypass the cache.
+ *
+ *  @return     uint32
+ *  @retval     Threshold in elements, 0 = never.
+ */
+uint32 FixedPoint_GetNonTemporalThreshold(void)
+{
+    return FixedPoint_NtThreshold;
+}
+
 /** @} end addtogroup */
 /**********************************************************************************************************************
 EOF
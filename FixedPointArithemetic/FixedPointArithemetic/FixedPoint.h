@@ -18,6 +18,11 @@ Version   Date        Sign  Description
 --------  ----------  ----  -----------
 01.00.00  2025-12-09  Hari   Initial check in
 01.01.00  2025-12-29  Hari  Configuration header added
+01.02.00  2026-10-18  AGT   Batch kernels on fixed-point arrays added
+01.03.00  2026-10-18  AGT   Result cache statistics interface added
+01.04.00  2026-10-18  AGT   Batch conversion, dot product and FIR kernels added
+01.05.00  2026-10-18  AGT   8-bit multiplication and division batch kernels added
+01.06.00  2026-10-18  AGT   Non-temporal store threshold added
 
 @endverbatim
 **********************************************************************************************************************/
@@ -42,6 +47,34 @@ INCLUDES
 
 
 
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Arithmetic operation selector for the generic (op-parameterised) fixed-point interfaces. */
+typedef enum
+{
+    FIXEDPOINT_OP_ADD = 0,
+    FIXEDPOINT_OP_SUB,
+    FIXEDPOINT_OP_MULT,
+    FIXEDPOINT_OP_DIV
+} FixedPoint_Operation_t;
+
+/** @brief   Hit and miss counters of the result cache (per thread). */
+typedef struct
+{
+    uint64 hits;    /**< Calls answered from the cache */
+    uint64 misses;  /**< Calls that executed the core */
+} FixedPoint_CacheStats_t;
+
+/** @brief   State of a 16-bit direct form FIR filter processed block by block. */
+typedef struct
+{
+    const t_Fixed16* coeffs;    /**< Coefficients h[0..numTaps-1] in configured 16-bit Q-format */
+    t_Fixed16*       delay;     /**< Last numTaps-1 input samples, oldest first */
+    uint32           numTaps;   /**< Number of coefficients */
+} FixedPoint_Fir16_t;
+
 /**********************************************************************************************************************
 EXTERNAL FUNCTIONS
 **********************************************************************************************************************/
@@ -55,6 +88,37 @@ extern Std_ReturnType FixedPoint_Sub8(float val1, float val2, float* result);
 extern Std_ReturnType FixedPoint_Mult8(float val1, float val2, float* result);
 extern Std_ReturnType FixedPoint_Div8(float val1, float val2, float* result);
 
+/* Batch kernels: element-wise operations on arrays in configured 16-bit Q-format */
+extern Std_ReturnType FixedPoint_Add16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Sub16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Mult16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Div16_Array(const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Op16_Strided(FixedPoint_Operation_t op,
+                                              const t_Fixed16* a, sint32 strideA,
+                                              const t_Fixed16* b, sint32 strideB,
+                                              t_Fixed16* r, sint32 strideR, uint32 len);
+
+/* Batch kernels: element-wise operations on arrays in configured 8-bit Q-format */
+extern Std_ReturnType FixedPoint_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+extern Std_ReturnType FixedPoint_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+
+/* Batch conversion, reduction and filter kernels */
+extern Std_ReturnType FixedPoint_FloatToFix16_Array(const float* in, t_Fixed16* out, uint32 len);
+extern Std_ReturnType FixedPoint_Fix16ToFloat_Array(const t_Fixed16* in, float* out, uint32 len);
+extern Std_ReturnType FixedPoint_Dot16(const t_Fixed16* a, const t_Fixed16* b, uint32 len, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Fir16_Init(FixedPoint_Fir16_t* fir, const t_Fixed16* coeffs, uint32 numTaps, t_Fixed16* delay);
+extern Std_ReturnType FixedPoint_Fir16(FixedPoint_Fir16_t* fir, const t_Fixed16* in, t_Fixed16* out, uint32 len);
+
+/* Result length from which the 16-bit element-wise batch kernels use non-temporal stores, 0 = never */
+extern void FixedPoint_SetNonTemporalThreshold(uint32 len);
+extern uint32 FixedPoint_GetNonTemporalThreshold(void);
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/* Result cache of the float interface (FixedPoint_Mult16 / FixedPoint_Div16), per calling thread */
+extern Std_ReturnType FixedPoint_GetCacheStats(FixedPoint_Operation_t op, FixedPoint_CacheStats_t* stats);
+extern void FixedPoint_ResetCache(void);
+#endif
+
 /** @} end addtogroup */
 
 #endif /* FIXED_POINT_H */
@@ -0,0 +1,466 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Conv.c
+
+@brief      16-bit FIR convolution engine (direct form or partitioned overlap-save FFT).
+ *
+ * Detailed Description:
+ * - FixedPoint_Conv16_Init() selects the algorithm from the filter length: filters with up to
+ *   FIXEDPOINT_CONV_DIRECT_MAX_TAPS taps run in direct form (FixedPoint_Fir16(), exact), longer
+ *   filters with the uniformly partitioned overlap-save convolution below. Both produce
+ *   out[n] = sum(h[k] * x[n-k]) with the same alignment and the same Q-format handling.
+ * - The filter is split into partitions of blockLen (B) taps. Each partition is zero padded to
+ *   N = 2 * B and transformed once at initialisation with the block floating point FFT
+ *   (FixedPoint_Fft.c). All filter spectra share one exponent.
+ * - Per input block the last two blocks [x(k-1), x(k)] are transformed into a ring holding the
+ *   spectra of the latest numParts blocks. The output spectrum is sum(X(k-p) * H(p)) over all
+ *   partitions, accumulated in 64 bits after aligning the block exponents of the input spectra;
+ *   its inverse transform holds the linear convolution of the current block in the upper B
+ *   samples (overlap-save), which are rounded and saturated to the 16-bit output.
+ * - The latency is one block of B samples instead of the filter length of a single large
+ *   transform, and the cost per sample is about 2 * log2(N) + numParts complex operations instead
+ *   of numTaps multiply-accumulates.
+ * - The FFT path rounds inside the transforms, so its output may differ from the direct form by
+ *   a few LSB (about 29 significant bits are kept through the transforms).
+ * - All buffers are provided by the caller (FIXEDPOINT_CONV_WORKSPACE_LEN, FIXEDPOINT_CONV_DELAY_LEN).
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Explicit comparison of the direct form flag
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Conv.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Block exponent of an all-zero spectrum (lower than any exponent of a non-zero block). */
+#define FIXEDPOINT_CONV_EXP_ZERO        (-4096)
+
+/** @brief Fractional bits of a product of two spectra that are removed when accumulating (twiddle format). */
+#define FIXEDPOINT_CONV_PRODUCT_SHIFT   (30)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+
+/* Rounding and output conversion. */
+static sint64 FixedPoint_Conv_Round(sint64 v, uint32 shift);
+static Std_ReturnType FixedPoint_Conv_Output(sint32 mant, sint32 exponent, t_Fixed16* r);
+
+/* Spectrum of a frame of two blocks. */
+static sint32 FixedPoint_Conv_Spectrum(const FixedPoint_Conv16_t* conv, const t_Fixed16* lo, uint32 loLen,
+                                       const t_Fixed16* hi, FixedPoint_Complex32_t* x);
+
+/* One block of the FFT path. */
+static Std_ReturnType FixedPoint_Conv_Block(FixedPoint_Conv16_t* conv, const t_Fixed16* in, t_Fixed16* out);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Shift right with round-to-nearest (ties towards +infinity), branch free as in the FFT.
+ *
+ *  @param[in]  v       Value, |v| < 2^61.
+ *  @param[in]  shift   Number of bits (0..61).
+ *
+ *  @return     Rounded v / 2^shift.
+ */
+static sint64 FixedPoint_Conv_Round(sint64 v, uint32 shift)
+{
+    const sint64 offset = ((sint64)1 << 61);
+
+    return ((v + offset + (((sint64)1 << shift) >> 1U)) >> shift) - (offset >> shift);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Convert a block floating point sample to the 16-bit output with rounding and saturation.
+ *
+ *  The sample mant * 2^exponent carries 2 * SHIFT_16 fractional bits (product of input and coefficient).
+ *
+ *  @param[in]  mant        Mantissa.
+ *  @param[in]  exponent    Block exponent.
+ *  @param[out] r           Output sample in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Converted without saturation.
+ *  @retval     E_NOT_OK    Saturated.
+ */
+static Std_ReturnType FixedPoint_Conv_Output(sint32 mant, sint32 exponent, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_OK;
+    const sint32 shift = exponent - (sint32)SHIFT_16;
+    sint64 v;
+
+    if (shift >= 0)
+    {
+        /* Any non-zero mantissa scaled by 2^16 or more is out of range */
+        v = (shift >= 16) ? ((sint64)mant * ((sint64)1 << 16)) : ((sint64)mant * ((sint64)1 << (uint32)shift));
+    }
+    else if (shift > -32)
+    {
+        /* Symmetric rounding as FixedPoint_Fir16() */
+        const sint64 half = ((sint64)1 << (uint32)(-shift - 1));
+        const sint64 mag = (mant < 0) ? -(sint64)mant : (sint64)mant;
+
+        v = (mag + half) >> (uint32)(-shift);
+        v = (mant < 0) ? -v : v;
+    }
+    else
+    {
+        v = 0;
+    }
+
+    if (v > (sint64)FIX16_MAX)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, v, 0, FIX16_MAX);
+        v = (sint64)FIX16_MAX;
+        ret = E_NOT_OK;
+    }
+    else if (v < (sint64)FIX16_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, v, 0, FIX16_MIN);
+        v = (sint64)FIX16_MIN;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    *r = (t_Fixed16)v;
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Forward transform of the frame [lo, hi] of two blocks.
+ *
+ *  @param[in]  conv    Convolution state (FFT path).
+ *  @param[in]  lo      First block, loLen samples followed by zeros.
+ *  @param[in]  loLen   Number of samples of lo (<= blockLen).
+ *  @param[in]  hi      Second block of blockLen samples, NULL for zeros.
+ *  @param[out] x       Spectrum of 2 * blockLen elements.
+ *
+ *  @return     Block exponent of the spectrum, FIXEDPOINT_CONV_EXP_ZERO for a frame of zeros.
+ */
+static sint32 FixedPoint_Conv_Spectrum(const FixedPoint_Conv16_t* conv, const t_Fixed16* lo, uint32 loLen,
+                                       const t_Fixed16* hi, FixedPoint_Complex32_t* x)
+{
+    const uint32 blockLen = conv->blockLen;
+    sint32 exponent = 0;
+    sint32 any = 0;
+    uint32 i;
+
+    for (i = 0U; i < blockLen; i++)
+    {
+        const sint32 v = (i < loLen) ? (sint32)lo[i] : 0;
+
+        x[i].re = v;
+        x[i].im = 0;
+        any |= v;
+    }
+
+    for (i = 0U; i < blockLen; i++)
+    {
+        const sint32 v = (hi != NULL) ? (sint32)hi[i] : 0;
+
+        x[blockLen + i].re = v;
+        x[blockLen + i].im = 0;
+        any |= v;
+    }
+
+    if (any != 0)
+    {
+        (void)FixedPoint_Fft_Forward(&conv->fft, x, &exponent);
+    }
+    else
+    {
+        exponent = FIXEDPOINT_CONV_EXP_ZERO;
+    }
+
+    return exponent;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Filter one block of blockLen samples on the FFT path.
+ *
+ *  @param[in,out] conv     Convolution state (FFT path).
+ *  @param[in]     in       Input block.
+ *  @param[out]    out      Output block.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block filtered without saturation.
+ *  @retval     E_NOT_OK    At least one output sample saturated.
+ */
+static Std_ReturnType FixedPoint_Conv_Block(FixedPoint_Conv16_t* conv, const t_Fixed16* in, t_Fixed16* out)
+{
+    Std_ReturnType ret = E_OK;
+    const uint32 blockLen = conv->blockLen;
+    const uint32 n = 2U * blockLen;
+    const uint32 parts = conv->numParts;
+    FixedPoint_Complex32_t* const work = conv->work;
+    sint32 maxExp = FIXEDPOINT_CONV_EXP_ZERO;
+    sint32 exponent;
+    uint32 shift[FIXEDPOINT_CONV_MAX_PARTS];
+    uint32 slot[FIXEDPOINT_CONV_MAX_PARTS];
+    uint32 p;
+    uint32 i;
+
+    /* Spectrum of [x(k-1), x(k)] into the ring slot of the oldest spectrum */
+    conv->head = (conv->head + 1U) % parts;
+    conv->inputExp[conv->head] = FixedPoint_Conv_Spectrum(conv, conv->history, blockLen, in,
+                                                          &conv->inputSpectra[conv->head * n]);
+
+    for (i = 0U; i < blockLen; i++)
+    {
+        conv->history[i] = in[i];
+    }
+
+    /* Slot of X(k-p) and its alignment to the largest exponent (0: nothing to add) */
+    for (p = 0U; p < parts; p++)
+    {
+        slot[p] = ((conv->head + parts) - p) % parts;
+        maxExp = (conv->inputExp[slot[p]] > maxExp) ? conv->inputExp[slot[p]] : maxExp;
+    }
+
+    for (p = 0U; p < parts; p++)
+    {
+        const sint32 s = (FIXEDPOINT_CONV_PRODUCT_SHIFT + (sint32)conv->partsLog2) + (maxExp - conv->inputExp[slot[p]]);
+
+        shift[p] = (s > 61) ? 0U : (uint32)s;
+    }
+
+    /* Each rounded product is below 2^(29 - partsLog2), so the sum fits the 32-bit transform buffer */
+    for (i = 0U; i < n; i++)
+    {
+        work[i].re = 0;
+        work[i].im = 0;
+    }
+
+    for (p = 0U; p < parts; p++)
+    {
+        const FixedPoint_Complex32_t* const xs = &conv->inputSpectra[slot[p] * n];
+        const FixedPoint_Complex32_t* const hs = &conv->filterSpectra[p * n];
+        const uint32 s = shift[p];
+
+        for (i = 0U; (s != 0U) && (i < n); i++)
+        {
+            const sint64 xr = (sint64)xs[i].re;
+            const sint64 xi = (sint64)xs[i].im;
+            const sint64 hr = (sint64)hs[i].re;
+            const sint64 hi = (sint64)hs[i].im;
+
+            work[i].re += (sint32)FixedPoint_Conv_Round((xr * hr) - (xi * hi), s);
+            work[i].im += (sint32)FixedPoint_Conv_Round((xr * hi) + (xi * hr), s);
+        }
+    }
+
+    exponent = maxExp + conv->filterExp + FIXEDPOINT_CONV_PRODUCT_SHIFT + (sint32)conv->partsLog2;
+    (void)FixedPoint_Fft_Inverse(&conv->fft, work, &exponent);
+
+    /* The upper half is the linear convolution of the current block (overlap-save) */
+    for (i = 0U; i < blockLen; i++)
+    {
+        ret |= FixedPoint_Conv_Output(work[blockLen + i].re, exponent, &out[i]);
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise a convolution and select direct form or the FFT path from the filter length.
+ *
+ *  Filters with up to FIXEDPOINT_CONV_DIRECT_MAX_TAPS taps use the direct form, which accepts any
+ *  block length and needs no workspace (blockLen and workspace are ignored). Longer filters use
+ *  the partitioned overlap-save FFT with blocks of blockLen samples; the filter spectra are
+ *  computed here, so coeffs is not referenced afterwards on this path.
+ *
+ *  @param[out] conv            Convolution state.
+ *  @param[in]  coeffs          Filter coefficients h[0..numTaps-1] in configured 16-bit Q-format.
+ *  @param[in]  numTaps         Number of coefficients (>= 1).
+ *  @param[in]  blockLen        Block length of the FFT path: power of 2 with 2 * blockLen <= FIXEDPOINT_FFT_MAX_LEN
+ *                              and at most FIXEDPOINT_CONV_MAX_PARTS partitions. It is also the latency.
+ *  @param[in]  workspace       FFT path workspace of FIXEDPOINT_CONV_WORKSPACE_LEN(numTaps, blockLen) elements.
+ *  @param[in]  workspaceLen    Number of elements of workspace.
+ *  @param[in]  delay           Delay line of FIXEDPOINT_CONV_DELAY_LEN(numTaps, blockLen) samples.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Convolution initialised.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or workspace too small.
+ */
+Std_ReturnType FixedPoint_Conv16_Init(FixedPoint_Conv16_t* conv, const t_Fixed16* coeffs, uint32 numTaps,
+                                      uint32 blockLen, FixedPoint_Complex32_t* workspace,
+                                      uint32 workspaceLen, t_Fixed16* delay)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((conv != NULL) && (coeffs != NULL) && (numTaps >= 1U) && (numTaps <= FIXEDPOINT_CONV_DIRECT_MAX_TAPS))
+    {
+        conv->direct = 1U;
+        conv->numTaps = numTaps;
+        conv->blockLen = 0U;
+        conv->numParts = 0U;
+        ret = FixedPoint_Fir16_Init(&conv->fir, coeffs, numTaps, delay);
+    }
+    else if ((conv != NULL) && (coeffs != NULL) && (workspace != NULL) && (delay != NULL) &&
+             (numTaps > FIXEDPOINT_CONV_DIRECT_MAX_TAPS) && (blockLen >= 2U) &&
+             ((blockLen & (blockLen - 1U)) == 0U) && (blockLen <= (FIXEDPOINT_FFT_MAX_LEN / 2U)) &&
+             (FIXEDPOINT_CONV_PARTS(numTaps, blockLen) <= FIXEDPOINT_CONV_MAX_PARTS) &&
+             (workspaceLen >= FIXEDPOINT_CONV_WORKSPACE_LEN(numTaps, blockLen)))
+    {
+        const uint32 n = 2U * blockLen;
+        const uint32 parts = FIXEDPOINT_CONV_PARTS(numTaps, blockLen);
+        uint32 p;
+        uint32 i;
+
+        conv->direct = 0U;
+        conv->numTaps = numTaps;
+        conv->blockLen = blockLen;
+        conv->numParts = parts;
+        conv->partsLog2 = 0U;
+        conv->head = 0U;
+        conv->history = delay;
+        conv->work = &workspace[blockLen];
+        conv->filterSpectra = &workspace[3U * blockLen];
+        conv->inputSpectra = &workspace[(3U * blockLen) + (parts * n)];
+
+        while ((1UL << conv->partsLog2) < parts)
+        {
+            conv->partsLog2++;
+        }
+
+        ret = FixedPoint_Fft_Init(&conv->fft, n, workspace);
+
+        /* Filter spectra, then aligned to their largest exponent */
+        conv->filterExp = FIXEDPOINT_CONV_EXP_ZERO;
+
+        for (p = 0U; p < parts; p++)
+        {
+            const uint32 first = p * blockLen;
+            const uint32 count = ((numTaps - first) < blockLen) ? (numTaps - first) : blockLen;
+
+            conv->inputExp[p] = FixedPoint_Conv_Spectrum(conv, &coeffs[first], count, NULL,
+                                                         &conv->filterSpectra[p * n]);
+            conv->filterExp = (conv->inputExp[p] > conv->filterExp) ? conv->inputExp[p] : conv->filterExp;
+        }
+
+        for (p = 0U; p < parts; p++)
+        {
+            const sint32 s = conv->filterExp - conv->inputExp[p];
+            FixedPoint_Complex32_t* const h = &conv->filterSpectra[p * n];
+
+            for (i = 0U; (s > 0) && (i < n); i++)
+            {
+                /* Mantissas are below 2^31, so shifts of 32 and more leave zero */
+                h[i].re = (s >= 32) ? 0 : (sint32)FixedPoint_Conv_Round((sint64)h[i].re, (uint32)s);
+                h[i].im = (s >= 32) ? 0 : (sint32)FixedPoint_Conv_Round((sint64)h[i].im, (uint32)s);
+            }
+        }
+
+        /* Empty input history */
+        for (i = 0U; i < (parts * n); i++)
+        {
+            conv->inputSpectra[i].re = 0;
+            conv->inputSpectra[i].im = 0;
+        }
+
+        for (p = 0U; p < parts; p++)
+        {
+            conv->inputExp[p] = FIXEDPOINT_CONV_EXP_ZERO;
+        }
+
+        for (i = 0U; i < blockLen; i++)
+        {
+            delay[i] = 0;
+        }
+    }
+    else
+    {
+        /* Invalid configuration */
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Filter a block of samples, out[n] = sum(h[k] * x[n-k]) (convolution kernel).
+ *
+ *  Samples before the block are taken from the state of the previous call, as FixedPoint_Fir16().
+ *  On the FFT path len must be a multiple of the block length given at initialisation.
+ *
+ *  @param[in,out] conv     Convolution state.
+ *  @param[in]     in       Input samples in configured 16-bit Q-format.
+ *  @param[out]    out      Output samples in configured 16-bit Q-format (must not overlap in).
+ *  @param[in]     len      Number of samples.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block filtered without saturation.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or at least one output sample saturated.
+ */
+Std_ReturnType FixedPoint_Conv16_Process(FixedPoint_Conv16_t* conv, const t_Fixed16* in, t_Fixed16* out,
+                                         uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Conv16");
+
+    if ((conv != NULL) && (in != NULL) && (out != NULL))
+    {
+        if (conv->direct != 0U)
+        {
+            ret = FixedPoint_Fir16(&conv->fir, in, out, len);
+        }
+        else if ((len % conv->blockLen) == 0U)
+        {
+            uint32 i;
+
+            ret = E_OK;
+
+            for (i = 0U; i < len; i += conv->blockLen)
+            {
+                ret |= FixedPoint_Conv_Block(conv, &in[i], &out[i]);
+            }
+        }
+        else
+        {
+            /* Partial block */
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Conv16");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
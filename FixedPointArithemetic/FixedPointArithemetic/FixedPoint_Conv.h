@@ -0,0 +1,90 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Conv.h
+
+@brief      Interface for the 16-bit FIR convolution engine (direct form or partitioned overlap-save FFT).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_CONV_H
+#define FIXED_POINT_CONV_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+#include "FixedPoint_Fft.h" /**< Fixed-point FFT interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of filter partitions of blockLen taps. */
+#define FIXEDPOINT_CONV_PARTS(numTaps, blockLen)            (((numTaps) + (blockLen) - 1U) / (blockLen))
+
+/** @brief Complex elements of the workspace of the FFT path: twiddles, transform buffer, filter and input spectra. */
+#define FIXEDPOINT_CONV_WORKSPACE_LEN(numTaps, blockLen) \
+    ((3U * (blockLen)) + (4U * (blockLen) * FIXEDPOINT_CONV_PARTS((numTaps), (blockLen))))
+
+/** @brief Samples of the delay line: numTaps - 1 in direct form, blockLen for the FFT path. */
+#define FIXEDPOINT_CONV_DELAY_LEN(numTaps, blockLen) \
+    ((((numTaps) - 1U) > (blockLen)) ? ((numTaps) - 1U) : (blockLen))
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   State of a 16-bit FIR filter processed block by block, in direct form or with the FFT. */
+typedef struct
+{
+    FixedPoint_Fir16_t      fir;                                    /**< Direct form filter (short filters) */
+    FixedPoint_Fft_t        fft;                                    /**< Transform of length 2 * blockLen */
+    FixedPoint_Complex32_t* work;                                   /**< Transform buffer */
+    FixedPoint_Complex32_t* filterSpectra;                          /**< Spectra of the filter partitions */
+    FixedPoint_Complex32_t* inputSpectra;                           /**< Ring of the latest input block spectra */
+    t_Fixed16*              history;                                /**< Previous input block */
+    sint32                  filterExp;                              /**< Common exponent of the filter spectra */
+    sint32                  inputExp[FIXEDPOINT_CONV_MAX_PARTS];    /**< Exponents of the input spectra */
+    uint32                  numTaps;                                /**< Number of coefficients */
+    uint32                  blockLen;                               /**< Block length B of the FFT path */
+    uint32                  numParts;                               /**< Number of filter partitions */
+    uint32                  partsLog2;                              /**< ceil(log2(numParts)) */
+    uint32                  head;                                   /**< Ring slot of the latest input spectrum */
+    boolean                 direct;                                 /**< 1: direct form, 0: FFT path */
+} FixedPoint_Conv16_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Conv16_Init(FixedPoint_Conv16_t* conv, const t_Fixed16* coeffs, uint32 numTaps,
+                                             uint32 blockLen, FixedPoint_Complex32_t* workspace,
+                                             uint32 workspaceLen, t_Fixed16* delay);
+extern Std_ReturnType FixedPoint_Conv16_Process(FixedPoint_Conv16_t* conv, const t_Fixed16* in, t_Fixed16* out,
+                                                uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_CONV_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
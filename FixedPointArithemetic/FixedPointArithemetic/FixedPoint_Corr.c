@@ -0,0 +1,706 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Corr.c
+
+@brief      16-bit cross-correlation and autocorrelation kernels.
+ *
+ * Detailed Description:
+ * - FixedPoint_Xcorr16() computes r[i] = sum(x[n + lag] * y[n]) for lag = firstLag + i over all n
+ *   where both samples exist, e.g. firstLag = -(yLen - 1) and numLags = xLen + yLen - 1 for the full
+ *   correlation. FixedPoint_Autocorr16() is the special case y = x for the lags 0..numLags-1.
+ * - The products are exact and accumulated in 64 bits; the result is rounded once (symmetric
+ *   round-to-nearest as FixedPoint_Dot16()) and saturated to the configured 16-bit Q-format.
+ * - The direct path processes 8 consecutive lags at once. With SSE2 one multiply-add instruction
+ *   forms the products of two samples for 4 lags, which are widened to 64-bit lane accumulators;
+ *   the samples at the edges, where not all 8 lags overlap, are added in scalar code.
+ * - FIXEDPOINT_CORR_COEFF scales by 1 / sqrt(sum(x^2) * sum(y^2)), so that the result is the
+ *   correlation coefficient within [-1, 1] (Cauchy-Schwarz) independent of the signal level. The
+ *   reciprocal square roots of the energies are computed once per call in integer arithmetic
+ *   (table estimate and three Newton steps) and applied to each lag with two multiplications.
+ * - With an FFT path set up by FixedPoint_Corr16_Init(), calls with many lags of long signals are
+ *   computed as IFFT(FFT(x) * conj(FFT(y))) with the block floating point FFT (one transform less
+ *   for the autocorrelation). Its cost does not depend on the number of lags; the path is chosen
+ *   when the direct path would need more than FIXEDPOINT_CORR_FFT_COST multiply-accumulates per
+ *   fftLen * log2(fftLen). The rounding inside the transforms is relative to the largest lag, so
+ *   small lags may differ from the direct path by about 1 LSB.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Explicit comparisons of the boolean flags
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Corr.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 multiply-add intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of lags processed together by the direct path. */
+#define FIXEDPOINT_CORR_LAGS            (8U)
+
+/** @brief Fractional bits removed from a product of two spectra (twiddle format of the FFT). */
+#define FIXEDPOINT_CORR_PRODUCT_SHIFT   (30)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Scaling applied to the 64-bit sums of one call. */
+typedef struct
+{
+    FixedPoint_CorrNorm_t norm;     /**< Requested scaling */
+    uint32                rsqrtX;   /**< 1 / sqrt(sum(x^2)) = rsqrtX * 2^(expX - 62) */
+    uint32                rsqrtY;   /**< 1 / sqrt(sum(y^2)) = rsqrtY * 2^(expY - 62) */
+    sint32                expX;     /**< Exponent of rsqrtX */
+    sint32                expY;     /**< Exponent of rsqrtY */
+} FixedPoint_CorrScale_t;
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Estimates of 1 / sqrt(u) in Q2.30 at the centres of u = 4/16 .. 16/16 in steps of 1/16. */
+static const uint32 FixedPoint_CorrRsqrtTable[12] =
+{
+    2024667000UL, 1831380208UL, 1684624773UL, 1568300315UL, 1473161629UL, 1393471397UL,
+    1325455684UL, 1266516759UL, 1214800200UL, 1168942037UL, 1127913670UL, 1090922784UL
+};
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+
+/* Scaling of the results. */
+static uint32 FixedPoint_Corr_Rsqrt(uint64 v, sint32* exponent);
+static sint64 FixedPoint_Corr_Round(sint64 v, uint32 shift);
+static Std_ReturnType FixedPoint_Corr_Finish(const FixedPoint_CorrScale_t* scale, sint64 sum, t_Fixed16* r);
+
+/* Direct path. */
+static void FixedPoint_Corr_Range(sint32 lag, uint32 xLen, uint32 yLen, uint32* from, uint32* to);
+static sint64 FixedPoint_Corr_Sum(const t_Fixed16* x, const t_Fixed16* y, sint32 lag, uint32 from, uint32 to);
+static void FixedPoint_Corr_Block(const t_Fixed16* xs, const t_Fixed16* ys, uint32 count, sint64* acc);
+static Std_ReturnType FixedPoint_Corr_Direct(const t_Fixed16* x, uint32 xLen, const t_Fixed16* y, uint32 yLen,
+                                             sint32 firstLag, uint32 numLags, const FixedPoint_CorrScale_t* scale,
+                                             t_Fixed16* r);
+
+/* FFT path. */
+static sint32 FixedPoint_Corr_Spectrum(const FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 len,
+                                       FixedPoint_Complex32_t* s);
+static Std_ReturnType FixedPoint_Corr_Fft(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 xLen,
+                                          const t_Fixed16* y, uint32 yLen, sint32 firstLag, uint32 numLags,
+                                          const FixedPoint_CorrScale_t* scale, t_Fixed16* r);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Reciprocal square root of a 64-bit value.
+ *
+ *  v is normalized by an even shift to u = v * 2^s / 2^64 within [1/4, 1). A table gives 1/sqrt(u)
+ *  to about 6 %, three Newton steps y = y * (3 - u * y^2) / 2 refine it to the 30 fractional bits.
+ *
+ *  @param[in]  v           Value (> 0).
+ *  @param[out] exponent    Exponent of the result.
+ *
+ *  @return     Mantissa y in Q2.30, 1 / sqrt(v) = y * 2^(exponent - 62).
+ */
+static uint32 FixedPoint_Corr_Rsqrt(uint64 v, sint32* exponent)
+{
+    uint64 m = v;
+    uint32 s = 0U;
+    uint64 y;
+    uint32 u;
+    uint32 i;
+
+    while ((m & 0xC000000000000000ULL) == 0U)
+    {
+        m <<= 2U;
+        s += 2U;
+    }
+
+    u = (uint32)(m >> 32U);
+    y = (uint64)FixedPoint_CorrRsqrtTable[(u >> 28U) - 4U];
+
+    for (i = 0U; i < 3U; i++)
+    {
+        const uint64 y2 = (y * y) >> 30U;
+        const uint64 uy2 = ((uint64)u * y2) >> 32U;
+
+        y = (y * ((3ULL << 30U) - uy2)) >> 31U;
+    }
+
+    /* 1 / sqrt(v) = 2^(s/2 - 32) / sqrt(u) = y * 2^(s/2 - 62) */
+    *exponent = (sint32)(s / 2U);
+
+    return (uint32)y;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Shift right with symmetric round-to-nearest (ties away from zero).
+ *
+ *  @param[in]  v       Value.
+ *  @param[in]  shift   Number of bits (1..62).
+ *
+ *  @return     Rounded v / 2^shift.
+ */
+static sint64 FixedPoint_Corr_Round(sint64 v, uint32 shift)
+{
+    const sint64 half = ((sint64)1 << (shift - 1U));
+    const sint64 mag = (((v < 0) ? -v : v) + half) >> shift;
+
+    return (v < 0) ? -mag : mag;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Scale, round and saturate the 64-bit sum of one lag.
+ *
+ *  @param[in]  scale   Scaling of the call.
+ *  @param[in]  sum     sum(x * y) with 2 * SHIFT_16 fractional bits.
+ *  @param[out] r       Result in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result in range.
+ *  @retval     E_NOT_OK    Result saturated.
+ */
+static Std_ReturnType FixedPoint_Corr_Finish(const FixedPoint_CorrScale_t* scale, sint64 sum, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_OK;
+    sint64 v;
+
+    if (scale->norm == FIXEDPOINT_CORR_COEFF)
+    {
+        /* |sum| * rsqrtX * rsqrtY * 2^SHIFT_16 with every intermediate product below 2^62 */
+        uint64 mag = (sum < 0) ? (uint64)(-sum) : (uint64)sum;
+        sint32 e = (sint32)SHIFT_16 + scale->expX + scale->expY - 124;
+        uint64 p;
+
+        while (mag >= (1ULL << 31U))
+        {
+            mag = (mag + 1U) >> 1U;
+            e++;
+        }
+
+        p = (((mag * scale->rsqrtX) + (1ULL << 30U)) >> 31U) * scale->rsqrtY;
+        e += 31;
+
+        if (e >= 0)
+        {
+            v = (sint64)(p << (uint32)e);
+        }
+        else if (e > -63)
+        {
+            v = FixedPoint_Corr_Round((sint64)p, (uint32)(-e));
+        }
+        else
+        {
+            v = 0;
+        }
+
+        v = (sum < 0) ? -v : v;
+    }
+    else
+    {
+#if (SHIFT_16 > 0U)
+        v = FixedPoint_Corr_Round(sum, SHIFT_16);
+#else
+        v = sum;
+#endif
+    }
+
+    if (v > (sint64)FIX16_MAX)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, sum, 0, FIX16_MAX);
+        v = (sint64)FIX16_MAX;
+        ret = E_NOT_OK;
+    }
+    else if (v < (sint64)FIX16_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, sum, 0, FIX16_MIN);
+        v = (sint64)FIX16_MIN;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    *r = (t_Fixed16)v;
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Range of y indices n for which x[n + lag] exists.
+ *
+ *  @param[in]  lag     Lag.
+ *  @param[in]  xLen    Length of x.
+ *  @param[in]  yLen    Length of y.
+ *  @param[out] from    First index.
+ *  @param[out] to      End index (exclusive), equal to from for an empty range.
+ */
+static void FixedPoint_Corr_Range(sint32 lag, uint32 xLen, uint32 yLen, uint32* from, uint32* to)
+{
+    const sint64 first = (lag < 0) ? -(sint64)lag : 0;
+    sint64 last = (sint64)xLen - (sint64)lag;
+
+    last = (last < (sint64)yLen) ? last : (sint64)yLen;
+    last = (last > first) ? last : first;
+
+    *from = (first < (sint64)yLen) ? (uint32)first : yLen;
+    *to = (last > (sint64)*from) ? (uint32)last : *from;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     sum(x[n + lag] * y[n]) for n in [from, to).
+ *
+ *  @param[in]  x       First signal.
+ *  @param[in]  y       Second signal.
+ *  @param[in]  lag     Lag.
+ *  @param[in]  from    First index of y.
+ *  @param[in]  to      End index of y (exclusive).
+ *
+ *  @return     Exact sum.
+ */
+static sint64 FixedPoint_Corr_Sum(const t_Fixed16* x, const t_Fixed16* y, sint32 lag, uint32 from, uint32 to)
+{
+    sint64 acc = 0;
+    uint32 n;
+
+    for (n = from; n < to; n++)
+    {
+        acc += (sint64)x[(sint64)n + lag] * (sint64)y[n];
+    }
+
+    return acc;
+}
+
+#if (FIXEDPOINT_SSE2 == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Add sum(xs[m + j] * ys[m]) over m in [0, count) to acc[j] for the 8 lags j = 0..7 (SSE2).
+ *
+ *  _mm_madd_epi16 adds the products of two samples into a 32-bit lane. The only sum that does not
+ *  fit is 2 * (-32768 * -32768) = 2^31, which wraps to INT32_MIN; the sign extension to 64 bits
+ *  treats this pattern as positive, so the accumulation stays exact.
+ *
+ *  @param[in]     xs       x from the first common index of lag 0 (count + 7 samples).
+ *  @param[in]     ys       y from the first common index (count samples).
+ *  @param[in]     count    Number of y samples.
+ *  @param[in,out] acc      Sums of the 8 lags.
+ */
+static void FixedPoint_Corr_Block(const t_Fixed16* xs, const t_Fixed16* ys, uint32 count, sint64* acc)
+{
+    const __m128i wrapped = _mm_set1_epi32(-2147483647 - 1);
+    __m128i acc01 = _mm_setzero_si128();
+    __m128i acc23 = _mm_setzero_si128();
+    __m128i acc45 = _mm_setzero_si128();
+    __m128i acc67 = _mm_setzero_si128();
+    sint64 lanes[FIXEDPOINT_CORR_LAGS];
+    uint32 m;
+    uint32 j;
+
+    for (m = 0U; (m + 1U) < count; m += 2U)
+    {
+        const __m128i a = _mm_loadu_si128((const __m128i*)(const void*)&xs[m]);
+        const __m128i b = _mm_loadu_si128((const __m128i*)(const void*)&xs[m + 1U]);
+        const __m128i coef = _mm_unpacklo_epi16(_mm_set1_epi16(ys[m]), _mm_set1_epi16(ys[m + 1U]));
+        const __m128i lo = _mm_madd_epi16(_mm_unpacklo_epi16(a, b), coef);
+        const __m128i hi = _mm_madd_epi16(_mm_unpackhi_epi16(a, b), coef);
+        const __m128i signLo = _mm_andnot_si128(_mm_cmpeq_epi32(lo, wrapped), _mm_srai_epi32(lo, 31));
+        const __m128i signHi = _mm_andnot_si128(_mm_cmpeq_epi32(hi, wrapped), _mm_srai_epi32(hi, 31));
+
+        acc01 = _mm_add_epi64(acc01, _mm_unpacklo_epi32(lo, signLo));
+        acc23 = _mm_add_epi64(acc23, _mm_unpackhi_epi32(lo, signLo));
+        acc45 = _mm_add_epi64(acc45, _mm_unpacklo_epi32(hi, signHi));
+        acc67 = _mm_add_epi64(acc67, _mm_unpackhi_epi32(hi, signHi));
+    }
+
+    _mm_storeu_si128((__m128i*)(void*)&lanes[0], acc01);
+    _mm_storeu_si128((__m128i*)(void*)&lanes[2], acc23);
+    _mm_storeu_si128((__m128i*)(void*)&lanes[4], acc45);
+    _mm_storeu_si128((__m128i*)(void*)&lanes[6], acc67);
+
+    for (j = 0U; j < FIXEDPOINT_CORR_LAGS; j++)
+    {
+        acc[j] += lanes[j];
+
+        /* Odd number of samples */
+        if (m < count)
+        {
+            acc[j] += (sint64)xs[m + j] * (sint64)ys[m];
+        }
+    }
+}
+#else
+/*********************************************************************************************************************/
+/*! @brief     Add sum(xs[m + j] * ys[m]) over m in [0, count) to acc[j] for the 8 lags j = 0..7 (portable C).
+ *
+ *  @param[in]     xs       x from the first common index of lag 0 (count + 7 samples).
+ *  @param[in]     ys       y from the first common index (count samples).
+ *  @param[in]     count    Number of y samples.
+ *  @param[in,out] acc      Sums of the 8 lags.
+ */
+static void FixedPoint_Corr_Block(const t_Fixed16* xs, const t_Fixed16* ys, uint32 count, sint64* acc)
+{
+    uint32 m;
+    uint32 j;
+
+    for (m = 0U; m < count; m++)
+    {
+        const sint64 yv = (sint64)ys[m];
+
+        for (j = 0U; j < FIXEDPOINT_CORR_LAGS; j++)
+        {
+            acc[j] += (sint64)xs[m + j] * yv;
+        }
+    }
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Correlation over all requested lags by direct summation, 8 lags at a time.
+ *
+ *  @param[in]  x           First signal.
+ *  @param[in]  xLen        Length of x.
+ *  @param[in]  y           Second signal.
+ *  @param[in]  yLen        Length of y.
+ *  @param[in]  firstLag    Lag of r[0].
+ *  @param[in]  numLags     Number of lags.
+ *  @param[in]  scale       Scaling of the results.
+ *  @param[out] r           Results.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All results in range.
+ *  @retval     E_NOT_OK    At least one result saturated.
+ */
+static Std_ReturnType FixedPoint_Corr_Direct(const t_Fixed16* x, uint32 xLen, const t_Fixed16* y, uint32 yLen,
+                                             sint32 firstLag, uint32 numLags, const FixedPoint_CorrScale_t* scale,
+                                             t_Fixed16* r)
+{
+    Std_ReturnType ret = E_OK;
+    sint64 acc[FIXEDPOINT_CORR_LAGS];
+    uint32 i;
+    uint32 j;
+
+    for (i = 0U; i < numLags; i += FIXEDPOINT_CORR_LAGS)
+    {
+        const sint32 lag0 = firstLag + (sint32)i;
+        const uint32 count = ((numLags - i) < FIXEDPOINT_CORR_LAGS) ? (numLags - i) : FIXEDPOINT_CORR_LAGS;
+        uint32 common = 0U;
+        uint32 commonEnd = 0U;
+        uint32 from;
+        uint32 to;
+
+        for (j = 0U; j < FIXEDPOINT_CORR_LAGS; j++)
+        {
+            acc[j] = 0;
+        }
+
+        /* Indices where all 8 lags overlap: from the start of the first lag to the end of the last */
+        if (count == FIXEDPOINT_CORR_LAGS)
+        {
+            FixedPoint_Corr_Range(lag0, xLen, yLen, &common, &to);
+            FixedPoint_Corr_Range(lag0 + (sint32)(FIXEDPOINT_CORR_LAGS - 1U), xLen, yLen, &from, &commonEnd);
+
+            if (commonEnd > common)
+            {
+                FixedPoint_Corr_Block(&x[(sint64)common + lag0], &y[common], commonEnd - common, acc);
+            }
+            else
+            {
+                commonEnd = common;
+            }
+        }
+
+        for (j = 0U; j < count; j++)
+        {
+            const sint32 lag = lag0 + (sint32)j;
+
+            FixedPoint_Corr_Range(lag, xLen, yLen, &from, &to);
+
+            if (commonEnd > common)
+            {
+                acc[j] += FixedPoint_Corr_Sum(x, y, lag, from, common);
+                acc[j] += FixedPoint_Corr_Sum(x, y, lag, commonEnd, to);
+            }
+            else
+            {
+                acc[j] += FixedPoint_Corr_Sum(x, y, lag, from, to);
+            }
+
+            ret |= FixedPoint_Corr_Finish(scale, acc[j], &r[i + j]);
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Zero padded spectrum of a signal.
+ *
+ *  @param[in]  corr    FFT path.
+ *  @param[in]  x       Signal.
+ *  @param[in]  len     Length of x (<= transform length).
+ *  @param[out] s       Spectrum.
+ *
+ *  @return     Block exponent of the spectrum.
+ */
+static sint32 FixedPoint_Corr_Spectrum(const FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 len,
+                                       FixedPoint_Complex32_t* s)
+{
+    sint32 exponent = 0;
+    uint32 i;
+
+    for (i = 0U; i < corr->fft.len; i++)
+    {
+        s[i].re = (i < len) ? (sint32)x[i] : 0;
+        s[i].im = 0;
+    }
+
+    (void)FixedPoint_Fft_Forward(&corr->fft, s, &exponent);
+
+    return exponent;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Correlation over all requested lags with the FFT.
+ *
+ *  @param[in,out] corr         FFT path, transform length >= xLen + yLen - 1.
+ *  @param[in]     x            First signal.
+ *  @param[in]     xLen         Length of x.
+ *  @param[in]     y            Second signal.
+ *  @param[in]     yLen         Length of y.
+ *  @param[in]     firstLag     Lag of r[0].
+ *  @param[in]     numLags      Number of lags.
+ *  @param[in]     scale        Scaling of the results.
+ *  @param[out]    r            Results.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All results in range.
+ *  @retval     E_NOT_OK    At least one result saturated.
+ */
+static Std_ReturnType FixedPoint_Corr_Fft(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 xLen,
+                                          const t_Fixed16* y, uint32 yLen, sint32 firstLag, uint32 numLags,
+                                          const FixedPoint_CorrScale_t* scale, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_OK;
+    const uint32 n = corr->fft.len;
+    FixedPoint_Complex32_t* const sx = corr->work;
+    FixedPoint_Complex32_t* const sy = &corr->work[n];
+    const boolean autocorr = ((x == y) && (xLen == yLen)) ? 1U : 0U;
+    const sint32 expX = FixedPoint_Corr_Spectrum(corr, x, xLen, sx);
+    const sint32 expY = (autocorr != 0U) ? expX : FixedPoint_Corr_Spectrum(corr, y, yLen, sy);
+    const FixedPoint_Complex32_t* const other = (autocorr != 0U) ? sx : sy;
+    sint32 exponent = expX + expY + FIXEDPOINT_CORR_PRODUCT_SHIFT;
+    uint32 i;
+
+    /* X * conj(Y); mantissas are below 2^29, so each part stays below 2^29 after the shift */
+    for (i = 0U; i < n; i++)
+    {
+        const sint64 xr = (sint64)sx[i].re;
+        const sint64 xi = (sint64)sx[i].im;
+        const sint64 yr = (sint64)other[i].re;
+        const sint64 yi = (sint64)other[i].im;
+        const sint64 re = (xr * yr) + (xi * yi);
+        const sint64 im = (xi * yr) - (xr * yi);
+
+        sx[i].re = (sint32)FixedPoint_Corr_Round(re, (uint32)FIXEDPOINT_CORR_PRODUCT_SHIFT);
+        sx[i].im = (sint32)FixedPoint_Corr_Round(im, (uint32)FIXEDPOINT_CORR_PRODUCT_SHIFT);
+    }
+
+    (void)FixedPoint_Fft_Inverse(&corr->fft, sx, &exponent);
+
+    /* Lag l is at index l mod n; lags without overlap are 0 */
+    for (i = 0U; i < numLags; i++)
+    {
+        const sint32 lag = firstLag + (sint32)i;
+        sint64 sum = 0;
+
+        if ((lag > -(sint32)yLen) && (lag < (sint32)xLen))
+        {
+            const sint64 mant = (sint64)sx[(lag < 0) ? (uint32)((sint32)n + lag) : (uint32)lag].re;
+
+            if (exponent >= 0)
+            {
+                sum = mant * ((sint64)1 << (uint32)exponent);
+            }
+            else if (exponent > -63)
+            {
+                sum = FixedPoint_Corr_Round(mant, (uint32)(-exponent));
+            }
+            else
+            {
+                /* Below the resolution */
+            }
+        }
+
+        ret |= FixedPoint_Corr_Finish(scale, sum, &r[i]);
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up the FFT path of the correlation kernels.
+ *
+ *  Calls with xLen + yLen - 1 <= fftLen then use the FFT when it is cheaper than the direct path
+ *  (corr->fftCost, may be changed after init). The workspace is used by every call, so a set up
+ *  FFT path must not be shared between concurrent calls.
+ *
+ *  @param[out] corr            FFT path.
+ *  @param[in]  fftLen          Transform length, power of 2 within 4..FIXEDPOINT_FFT_MAX_LEN.
+ *  @param[in]  workspace       Workspace of FIXEDPOINT_CORR_WORKSPACE_LEN(fftLen) elements.
+ *  @param[in]  workspaceLen    Number of elements of workspace.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        FFT path ready.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or workspace too small.
+ */
+Std_ReturnType FixedPoint_Corr16_Init(FixedPoint_Corr16_t* corr, uint32 fftLen,
+                                      FixedPoint_Complex32_t* workspace, uint32 workspaceLen)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((corr != NULL) && (workspace != NULL) && (fftLen <= FIXEDPOINT_FFT_MAX_LEN) &&
+        (workspaceLen >= FIXEDPOINT_CORR_WORKSPACE_LEN(fftLen)))
+    {
+        ret = FixedPoint_Fft_Init(&corr->fft, fftLen, workspace);
+        corr->work = &workspace[FIXEDPOINT_FFT_TWIDDLES(fftLen)];
+        corr->fftCost = FIXEDPOINT_CORR_FFT_COST;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Cross-correlation r[i] = sum(x[n + lag] * y[n]), lag = firstLag + i (correlation kernel).
+ *
+ *  @param[in,out] corr         FFT path set up with FixedPoint_Corr16_Init(), NULL for the direct path only.
+ *  @param[in]     x            First signal in configured 16-bit Q-format.
+ *  @param[in]     xLen         Length of x (>= 1).
+ *  @param[in]     y            Second signal in configured 16-bit Q-format.
+ *  @param[in]     yLen         Length of y (>= 1).
+ *  @param[in]     firstLag     Lag of r[0]; lags without overlapping samples give 0.
+ *  @param[in]     numLags      Number of lags.
+ *  @param[in]     norm         Scaling of the results.
+ *  @param[out]    r            numLags results in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All results in range.
+ *  @retval     E_NOT_OK    Null pointer, zero length, zero energy with FIXEDPOINT_CORR_COEFF (results 0)
+ *                          or at least one result saturated.
+ */
+Std_ReturnType FixedPoint_Xcorr16(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 xLen,
+                                  const t_Fixed16* y, uint32 yLen, sint32 firstLag, uint32 numLags,
+                                  FixedPoint_CorrNorm_t norm, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Xcorr16");
+
+    if ((x != NULL) && (y != NULL) && (r != NULL) && (xLen >= 1U) && (yLen >= 1U))
+    {
+        FixedPoint_CorrScale_t scale;
+        boolean valid = 1U;
+        uint32 i;
+
+        scale.norm = norm;
+        scale.rsqrtX = 0U;
+        scale.rsqrtY = 0U;
+        scale.expX = 0;
+        scale.expY = 0;
+
+        if (norm == FIXEDPOINT_CORR_COEFF)
+        {
+            const uint64 energyX = (uint64)FixedPoint_Corr_Sum(x, x, 0, 0U, xLen);
+            const uint64 energyY = (uint64)FixedPoint_Corr_Sum(y, y, 0, 0U, yLen);
+
+            valid = ((energyX != 0U) && (energyY != 0U)) ? 1U : 0U;
+
+            if (valid != 0U)
+            {
+                scale.rsqrtX = FixedPoint_Corr_Rsqrt(energyX, &scale.expX);
+                scale.rsqrtY = FixedPoint_Corr_Rsqrt(energyY, &scale.expY);
+            }
+        }
+
+        if (valid == 0U)
+        {
+            for (i = 0U; i < numLags; i++)
+            {
+                r[i] = 0;
+            }
+        }
+        else if ((corr != NULL) && (((uint64)xLen + (uint64)yLen - 1U) <= (uint64)corr->fft.len) &&
+                 (((uint64)numLags * (uint64)((xLen < yLen) ? xLen : yLen)) >
+                  ((uint64)corr->fftCost * corr->fft.len * corr->fft.log2Len)))
+        {
+            ret = FixedPoint_Corr_Fft(corr, x, xLen, y, yLen, firstLag, numLags, &scale, r);
+        }
+        else
+        {
+            ret = FixedPoint_Corr_Direct(x, xLen, y, yLen, firstLag, numLags, &scale, r);
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Xcorr16");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Autocorrelation r[l] = sum(x[n + l] * x[n]) for the lags l = 0..numLags-1 (correlation kernel).
+ *
+ *  With FIXEDPOINT_CORR_COEFF the result is r[l] / r[0].
+ *
+ *  @param[in,out] corr         FFT path set up with FixedPoint_Corr16_Init(), NULL for the direct path only.
+ *  @param[in]     x            Signal in configured 16-bit Q-format.
+ *  @param[in]     len          Length of x (>= 1).
+ *  @param[in]     numLags      Number of lags.
+ *  @param[in]     norm         Scaling of the results.
+ *  @param[out]    r            numLags results in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All results in range.
+ *  @retval     E_NOT_OK    Null pointer, zero length, zero energy with FIXEDPOINT_CORR_COEFF (results 0)
+ *                          or at least one result saturated.
+ */
+Std_ReturnType FixedPoint_Autocorr16(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 len,
+                                     uint32 numLags, FixedPoint_CorrNorm_t norm, t_Fixed16* r)
+{
+    return FixedPoint_Xcorr16(corr, x, len, x, len, 0, numLags, norm, r);
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
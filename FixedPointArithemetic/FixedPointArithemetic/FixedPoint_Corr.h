@@ -0,0 +1,80 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Corr.h
+
+@brief      Interface for the 16-bit cross-correlation and autocorrelation kernels.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_CORR_H
+#define FIXED_POINT_CORR_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+#include "FixedPoint_Fft.h" /**< Fixed-point FFT interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Complex elements of the workspace of the FFT path for transforms of length fftLen. */
+#define FIXEDPOINT_CORR_WORKSPACE_LEN(fftLen)   (FIXEDPOINT_FFT_TWIDDLES(fftLen) + (2U * (fftLen)))
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Scaling of the correlation results. */
+typedef enum
+{
+    FIXEDPOINT_CORR_RAW = 0,    /**< sum(x * y) in configured 16-bit Q-format, saturated */
+    FIXEDPOINT_CORR_COEFF       /**< sum(x * y) / sqrt(sum(x^2) * sum(y^2)), within [-1, 1] */
+} FixedPoint_CorrNorm_t;
+
+/** @brief   FFT path of the correlation kernels (optional). */
+typedef struct
+{
+    FixedPoint_Fft_t        fft;        /**< Transform, at least xLen + yLen - 1 long */
+    FixedPoint_Complex32_t* work;       /**< Two transform buffers */
+    uint32                  fftCost;    /**< FIXEDPOINT_CORR_FFT_COST after init, 0 = FFT whenever the signals fit */
+} FixedPoint_Corr16_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Corr16_Init(FixedPoint_Corr16_t* corr, uint32 fftLen,
+                                             FixedPoint_Complex32_t* workspace, uint32 workspaceLen);
+extern Std_ReturnType FixedPoint_Xcorr16(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 xLen,
+                                         const t_Fixed16* y, uint32 yLen, sint32 firstLag, uint32 numLags,
+                                         FixedPoint_CorrNorm_t norm, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Autocorr16(FixedPoint_Corr16_t* corr, const t_Fixed16* x, uint32 len,
+                                            uint32 numLags, FixedPoint_CorrNorm_t norm, t_Fixed16* r);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_CORR_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
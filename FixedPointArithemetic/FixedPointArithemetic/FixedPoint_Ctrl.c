@@ -0,0 +1,937 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Ctrl.c
+
+@brief      16-bit control blocks: rate limiter, hysteresis, dead zone, first-order low-pass and debounce.
+ *
+ * Detailed Description:
+ * - Each block has a state struct for a single instance and a bank for N instances per call. The
+ *   bank keeps states and parameters as structure of arrays, so that SSE2 updates 8 instances
+ *   with a few instructions; the remaining instances, and builds without SSE2, use the scalar step
+ *   of the single instance. Both paths give identical results.
+ * - Rate limiter: y = y + max(-fall, min(x - y, rise)). The output lies between the previous output
+ *   and the input and cannot saturate; SSE2 forms it as max(y -sat fall, min(x, y +sat rise)).
+ * - Hysteresis: on = (x >= upper) or (on and x > lower).
+ * - Dead zone: r = x - upper above upper, x - lower below lower, 0 in between, saturated to 16 bits
+ *   (E_NOT_OK, probe FIXEDPOINT_OP_SUB) if the zone lies far off centre.
+ * - Low-pass: acc = acc + x * 2^(16 - shift) - floor(acc * 2^-shift) with acc = y * 2^16. The extra
+ *   16 fractional bits remove the dead band of a plain shift filter, so a constant input is reached
+ *   exactly. The output is acc rounded to the configured Q-format.
+ * - Debounce: the output takes over the input once the input has differed from it for onTime
+ *   (switch on) or offTime (switch off) consecutive calls.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint.h"
+#include "FixedPoint_Ctrl.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 saturating arithmetic and compare intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of instances updated together by the SSE2 bank paths. */
+#define FIXEDPOINT_CTRL_LANES           (8U)
+
+/** @brief Offset that makes the low-pass state non-negative, so that a right shift rounds towards minus infinity. */
+#define FIXEDPOINT_CTRL_OFFSET          (1LL << 40U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static t_Fixed16 FixedPoint_Ctrl_RateLimit(t_Fixed16 x, t_Fixed16 y, t_Fixed16 rise, t_Fixed16 fall);
+static boolean FixedPoint_Ctrl_Hyst(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, boolean on);
+static Std_ReturnType FixedPoint_Ctrl_DeadZone(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, t_Fixed16* r);
+static sint32 FixedPoint_Ctrl_LowPass(sint32 acc, t_Fixed16 x, uint32 shift);
+static t_Fixed16 FixedPoint_Ctrl_LowPassOut(sint32 acc);
+static boolean FixedPoint_Ctrl_Debounce(boolean in, uint16 onTime, uint16 offTime, uint16* count, boolean state);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     One rate limiter step.
+ *
+ *  @param[in]  x       Input.
+ *  @param[in]  y       Previous output.
+ *  @param[in]  rise    Largest increase (>= 0).
+ *  @param[in]  fall    Largest decrease (>= 0).
+ *
+ *  @return     New output.
+ */
+static t_Fixed16 FixedPoint_Ctrl_RateLimit(t_Fixed16 x, t_Fixed16 y, t_Fixed16 rise, t_Fixed16 fall)
+{
+    sint32 d = (sint32)x - (sint32)y;
+
+    if (d > (sint32)rise)
+    {
+        d = (sint32)rise;
+    }
+    else if (d < -(sint32)fall)
+    {
+        d = -(sint32)fall;
+    }
+    else
+    {
+        /* Within the limits */
+    }
+
+    return (t_Fixed16)((sint32)y + d);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     One hysteresis step.
+ *
+ *  @param[in]  x       Input.
+ *  @param[in]  lower   Switch-off threshold.
+ *  @param[in]  upper   Switch-on threshold.
+ *  @param[in]  on      Previous output.
+ *
+ *  @return     New output.
+ */
+static boolean FixedPoint_Ctrl_Hyst(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, boolean on)
+{
+    return ((x >= upper) || ((on != 0U) && (x > lower))) ? 1U : 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Dead zone of one input.
+ *
+ *  @param[in]  x       Input.
+ *  @param[in]  lower   Lower end of the zone.
+ *  @param[in]  upper   Upper end of the zone (>= lower).
+ *  @param[out] r       Distance of x from the zone, saturated.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result in range.
+ *  @retval     E_NOT_OK    Result saturated.
+ */
+static Std_ReturnType FixedPoint_Ctrl_DeadZone(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_OK;
+    /* Inside the zone x is its own bound and the result 0 */
+    const t_Fixed16 bound = (x > upper) ? upper : ((x < lower) ? lower : x);
+    sint32 v = (sint32)x - (sint32)bound;
+
+    if (v > (sint32)FIX16_MAX)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 16, x, bound, FIX16_MAX);
+        v = (sint32)FIX16_MAX;
+        ret = E_NOT_OK;
+    }
+    else if (v < (sint32)FIX16_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_SUB, 16, x, bound, FIX16_MIN);
+        v = (sint32)FIX16_MIN;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    *r = (t_Fixed16)v;
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     One low-pass step on the state with 16 extra fractional bits.
+ *
+ *  The state stays within the range of the previous state and x * 2^16, so it fits 32 bits.
+ *
+ *  @param[in]  acc     Previous state.
+ *  @param[in]  x       Input.
+ *  @param[in]  shift   Time constant shift (0..FIXEDPOINT_LOWPASS_MAX_SHIFT).
+ *
+ *  @return     New state acc + x * 2^(16 - shift) - floor(acc * 2^-shift).
+ */
+static sint32 FixedPoint_Ctrl_LowPass(sint32 acc, t_Fixed16 x, uint32 shift)
+{
+    const sint64 decay = (((sint64)acc + FIXEDPOINT_CTRL_OFFSET) >> shift) - (FIXEDPOINT_CTRL_OFFSET >> shift);
+
+    return (sint32)((sint64)acc + ((sint64)x * (sint64)(1L << (16U - shift))) - decay);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Output of a low-pass state.
+ *
+ *  @param[in]  acc     State with 16 extra fractional bits.
+ *
+ *  @return     acc * 2^-16 rounded half up, limited to FIX16_MAX.
+ */
+static t_Fixed16 FixedPoint_Ctrl_LowPassOut(sint32 acc)
+{
+    const sint64 v = ((sint64)acc + FIXEDPOINT_CTRL_OFFSET + 0x8000LL) >> 16U;
+    sint64 y = v - (FIXEDPOINT_CTRL_OFFSET >> 16U);
+
+    if (y > (sint64)FIX16_MAX)
+    {
+        y = (sint64)FIX16_MAX;
+    }
+
+    return (t_Fixed16)y;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     One debounce step.
+ *
+ *  @param[in]     in       Input.
+ *  @param[in]     onTime   Switch-on time.
+ *  @param[in]     offTime  Switch-off time.
+ *  @param[in,out] count    Consecutive calls with the input different from the output.
+ *  @param[in]     state    Previous output.
+ *
+ *  @return     New output.
+ */
+static boolean FixedPoint_Ctrl_Debounce(boolean in, uint16 onTime, uint16 offTime, uint16* count, boolean state)
+{
+    const boolean level = (in != 0U) ? 1U : 0U;
+    boolean out = state;
+
+    if (level == state)
+    {
+        *count = 0U;
+    }
+    else
+    {
+        if (*count < 0xFFFFU)
+        {
+            (*count)++;
+        }
+
+        if (*count >= ((state != 0U) ? offTime : onTime))
+        {
+            out = level;
+            *count = 0U;
+        }
+    }
+
+    return out;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a rate limiter.
+ *
+ *  @param[out] rl      Rate limiter.
+ *  @param[in]  rise    Largest increase per call in configured 16-bit Q-format (>= 0).
+ *  @param[in]  fall    Largest decrease per call in configured 16-bit Q-format (>= 0).
+ *  @param[in]  y0      Initial output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Rate limiter ready.
+ *  @retval     E_NOT_OK    Null pointer or negative limit.
+ */
+Std_ReturnType FixedPoint_RateLimit16_Init(FixedPoint_RateLimit16_t* rl, t_Fixed16 rise, t_Fixed16 fall,
+                                           t_Fixed16 y0)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((rl != NULL) && (rise >= 0) && (fall >= 0))
+    {
+        rl->rise = rise;
+        rl->fall = fall;
+        rl->y = y0;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Rate limiter step.
+ *
+ *  @param[in,out] rl   Rate limiter set up with FixedPoint_RateLimit16_Init().
+ *  @param[in]     x    Input in configured 16-bit Q-format.
+ *  @param[out]    y    Output in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Output computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_RateLimit16(FixedPoint_RateLimit16_t* rl, t_Fixed16 x, t_Fixed16* y)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((rl != NULL) && (y != NULL))
+    {
+        rl->y = FixedPoint_Ctrl_RateLimit(x, rl->y, rl->rise, rl->fall);
+        *y = rl->y;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a hysteresis.
+ *
+ *  @param[out] hyst    Hysteresis.
+ *  @param[in]  lower   Switch-off threshold in configured 16-bit Q-format.
+ *  @param[in]  upper   Switch-on threshold in configured 16-bit Q-format (>= lower).
+ *  @param[in]  on0     Initial output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Hysteresis ready.
+ *  @retval     E_NOT_OK    Null pointer or upper below lower.
+ */
+Std_ReturnType FixedPoint_Hyst16_Init(FixedPoint_Hyst16_t* hyst, t_Fixed16 lower, t_Fixed16 upper, boolean on0)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((hyst != NULL) && (lower <= upper))
+    {
+        hyst->lower = lower;
+        hyst->upper = upper;
+        hyst->on = (on0 != 0U) ? 1U : 0U;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Hysteresis step.
+ *
+ *  @param[in,out] hyst     Hysteresis set up with FixedPoint_Hyst16_Init().
+ *  @param[in]     x        Input in configured 16-bit Q-format.
+ *  @param[out]    on       Output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Output computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Hyst16(FixedPoint_Hyst16_t* hyst, t_Fixed16 x, boolean* on)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((hyst != NULL) && (on != NULL))
+    {
+        hyst->on = FixedPoint_Ctrl_Hyst(x, hyst->lower, hyst->upper, hyst->on);
+        *on = hyst->on;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Dead zone: distance of x from the zone lower..upper, 0 inside.
+ *
+ *  @param[in]  x       Input in configured 16-bit Q-format.
+ *  @param[in]  lower   Lower end of the zone in configured 16-bit Q-format.
+ *  @param[in]  upper   Upper end of the zone in configured 16-bit Q-format (>= lower).
+ *  @param[out] r       Result in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result in range.
+ *  @retval     E_NOT_OK    Null pointer, upper below lower or result saturated.
+ */
+Std_ReturnType FixedPoint_DeadZone16(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((r != NULL) && (lower <= upper))
+    {
+        ret = FixedPoint_Ctrl_DeadZone(x, lower, upper, r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a first-order low-pass filter.
+ *
+ *  The time constant is about 2^shift calls (step response 63 % after 2^shift calls).
+ *
+ *  @param[out] lp      Low-pass filter.
+ *  @param[in]  shift   Time constant shift, 0..FIXEDPOINT_LOWPASS_MAX_SHIFT.
+ *  @param[in]  y0      Initial output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Filter ready.
+ *  @retval     E_NOT_OK    Null pointer or shift out of range.
+ */
+Std_ReturnType FixedPoint_LowPass16_Init(FixedPoint_LowPass16_t* lp, uint32 shift, t_Fixed16 y0)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((lp != NULL) && (shift <= FIXEDPOINT_LOWPASS_MAX_SHIFT))
+    {
+        lp->acc = (sint32)y0 * 65536L;
+        lp->shift = shift;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Low-pass filter step.
+ *
+ *  @param[in,out] lp   Filter set up with FixedPoint_LowPass16_Init().
+ *  @param[in]     x    Input in configured 16-bit Q-format.
+ *  @param[out]    y    Output in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Output computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_LowPass16(FixedPoint_LowPass16_t* lp, t_Fixed16 x, t_Fixed16* y)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((lp != NULL) && (y != NULL))
+    {
+        lp->acc = FixedPoint_Ctrl_LowPass(lp->acc, x, lp->shift);
+        *y = FixedPoint_Ctrl_LowPassOut(lp->acc);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a debounce counter.
+ *
+ *  @param[out] db          Debounce counter.
+ *  @param[in]  onTime      Consecutive calls with input TRUE until the output switches on.
+ *  @param[in]  offTime     Consecutive calls with input FALSE until the output switches off.
+ *  @param[in]  state0      Initial output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Debounce counter ready.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Debounce_Init(FixedPoint_Debounce_t* db, uint16 onTime, uint16 offTime, boolean state0)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (db != NULL)
+    {
+        db->onTime = onTime;
+        db->offTime = offTime;
+        db->count = 0U;
+        db->state = (state0 != 0U) ? 1U : 0U;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Debounce step.
+ *
+ *  @param[in,out] db   Debounce counter set up with FixedPoint_Debounce_Init().
+ *  @param[in]     in   Input (any non-zero value is TRUE).
+ *  @param[out]    out  Output.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Output computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Debounce(FixedPoint_Debounce_t* db, boolean in, boolean* out)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((db != NULL) && (out != NULL))
+    {
+        db->state = FixedPoint_Ctrl_Debounce(in, db->onTime, db->offTime, &db->count, db->state);
+        *out = db->state;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a bank of rate limiters.
+ *
+ *  @param[out] bank    Bank.
+ *  @param[in]  rise    Largest increase per call of each instance (>= 0).
+ *  @param[in]  fall    Largest decrease per call of each instance (>= 0).
+ *  @param[in]  y       Outputs, holding the initial outputs.
+ *  @param[in]  num     Number of instances.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Bank ready.
+ *  @retval     E_NOT_OK    Null pointer or negative limit.
+ */
+Std_ReturnType FixedPoint_RateLimitBank16_Init(FixedPoint_RateLimitBank16_t* bank, const t_Fixed16* rise,
+                                               const t_Fixed16* fall, t_Fixed16* y, uint32 num)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((bank != NULL) && (rise != NULL) && (fall != NULL) && (y != NULL))
+    {
+        uint32 i;
+
+        ret = E_OK;
+        for (i = 0U; i < num; i++)
+        {
+            if ((rise[i] < 0) || (fall[i] < 0))
+            {
+                ret = E_NOT_OK;
+            }
+        }
+
+        bank->rise = rise;
+        bank->fall = fall;
+        bank->y = y;
+        bank->num = num;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Rate limiter step of all instances of a bank.
+ *
+ *  @param[in,out] bank     Bank set up with FixedPoint_RateLimitBank16_Init(); outputs in bank->y.
+ *  @param[in]     x        Input of each instance in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Outputs computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_RateLimitBank16(FixedPoint_RateLimitBank16_t* bank, const t_Fixed16* x)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("RateLimitBank16");
+
+    if ((bank != NULL) && (x != NULL))
+    {
+        t_Fixed16* y = bank->y;
+        uint32 i = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        for (; (i + FIXEDPOINT_CTRL_LANES) <= bank->num; i += FIXEDPOINT_CTRL_LANES)
+        {
+            const __m128i yv = _mm_loadu_si128((const __m128i*)(const void*)&y[i]);
+            const __m128i hi = _mm_adds_epi16(yv, _mm_loadu_si128((const __m128i*)(const void*)&bank->rise[i]));
+            const __m128i lo = _mm_subs_epi16(yv, _mm_loadu_si128((const __m128i*)(const void*)&bank->fall[i]));
+            const __m128i xv = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+
+            /* Saturated bounds are exact here: an input beyond them does not exist */
+            _mm_storeu_si128((__m128i*)(void*)&y[i], _mm_max_epi16(lo, _mm_min_epi16(xv, hi)));
+        }
+#endif
+
+        for (; i < bank->num; i++)
+        {
+            y[i] = FixedPoint_Ctrl_RateLimit(x[i], y[i], bank->rise[i], bank->fall[i]);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("RateLimitBank16");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a bank of hysteresis blocks.
+ *
+ *  @param[out] bank    Bank.
+ *  @param[in]  lower   Switch-off threshold of each instance.
+ *  @param[in]  upper   Switch-on threshold of each instance (>= lower).
+ *  @param[in]  on      Outputs, holding the initial outputs (normalized to 0 / 1).
+ *  @param[in]  num     Number of instances.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Bank ready.
+ *  @retval     E_NOT_OK    Null pointer or an upper threshold below its lower threshold.
+ */
+Std_ReturnType FixedPoint_HystBank16_Init(FixedPoint_HystBank16_t* bank, const t_Fixed16* lower,
+                                          const t_Fixed16* upper, boolean* on, uint32 num)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((bank != NULL) && (lower != NULL) && (upper != NULL) && (on != NULL))
+    {
+        uint32 i;
+
+        ret = E_OK;
+        for (i = 0U; i < num; i++)
+        {
+            if (lower[i] > upper[i])
+            {
+                ret = E_NOT_OK;
+            }
+            on[i] = (on[i] != 0U) ? 1U : 0U;
+        }
+
+        bank->lower = lower;
+        bank->upper = upper;
+        bank->on = on;
+        bank->num = num;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Hysteresis step of all instances of a bank.
+ *
+ *  @param[in,out] bank     Bank set up with FixedPoint_HystBank16_Init(); outputs in bank->on.
+ *  @param[in]     x        Input of each instance in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Outputs computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_HystBank16(FixedPoint_HystBank16_t* bank, const t_Fixed16* x)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("HystBank16");
+
+    if ((bank != NULL) && (x != NULL))
+    {
+        boolean* on = bank->on;
+        uint32 i = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+
+        for (; (i + FIXEDPOINT_CTRL_LANES) <= bank->num; i += FIXEDPOINT_CTRL_LANES)
+        {
+            const __m128i xv = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+            const __m128i below = _mm_cmpgt_epi16(_mm_loadu_si128((const __m128i*)(const void*)&bank->upper[i]), xv);
+            const __m128i above = _mm_cmpgt_epi16(xv, _mm_loadu_si128((const __m128i*)(const void*)&bank->lower[i]));
+            const __m128i state = _mm_cmpgt_epi16(
+                _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(const void*)&on[i]), zero), zero);
+            /* on = (x >= upper) | (on & x > lower), as 0 / 1 */
+            const __m128i next = _mm_and_si128(_mm_or_si128(_mm_andnot_si128(below, _mm_cmpeq_epi16(zero, zero)),
+                                                            _mm_and_si128(state, above)), one);
+
+            _mm_storel_epi64((__m128i*)(void*)&on[i], _mm_packus_epi16(next, zero));
+        }
+#endif
+
+        for (; i < bank->num; i++)
+        {
+            on[i] = FixedPoint_Ctrl_Hyst(x[i], bank->lower[i], bank->upper[i], on[i]);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("HystBank16");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Dead zone of an array of inputs with per-element zones.
+ *
+ *  @param[in]  x       Inputs in configured 16-bit Q-format.
+ *  @param[in]  lower   Lower end of the zone of each element.
+ *  @param[in]  upper   Upper end of the zone of each element (>= lower).
+ *  @param[out] r       Results in configured 16-bit Q-format (may alias x).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All results in range.
+ *  @retval     E_NOT_OK    Null pointer or at least one result saturated.
+ */
+Std_ReturnType FixedPoint_DeadZone16_Array(const t_Fixed16* x, const t_Fixed16* lower,
+                                           const t_Fixed16* upper, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("DeadZone16_Array");
+
+    if ((x != NULL) && (lower != NULL) && (upper != NULL) && (r != NULL))
+    {
+        uint32 i = 0U;
+
+        ret = E_OK;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        for (; (i + FIXEDPOINT_CTRL_LANES) <= len; i += FIXEDPOINT_CTRL_LANES)
+        {
+            const __m128i xv = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+            const __m128i lo = _mm_loadu_si128((const __m128i*)(const void*)&lower[i]);
+            const __m128i hi = _mm_loadu_si128((const __m128i*)(const void*)&upper[i]);
+            const __m128i above = _mm_cmpgt_epi16(xv, hi);
+            const __m128i below = _mm_cmpgt_epi16(lo, xv);
+            const __m128i bound = _mm_or_si128(_mm_and_si128(above, hi), _mm_and_si128(below, lo));
+            const __m128i active = _mm_or_si128(above, below);
+            const __m128i sat = _mm_and_si128(active, _mm_subs_epi16(xv, bound));
+
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(sat, _mm_and_si128(active, _mm_sub_epi16(xv, bound)))) == 0xFFFF)
+            {
+                _mm_storeu_si128((__m128i*)(void*)&r[i], sat);
+            }
+            else
+            {
+                /* A difference saturated: report it per element */
+                uint32 k;
+
+                for (k = i; k < (i + FIXEDPOINT_CTRL_LANES); k++)
+                {
+                    ret |= FixedPoint_Ctrl_DeadZone(x[k], lower[k], upper[k], &r[k]);
+                }
+            }
+        }
+#endif
+
+        for (; i < len; i++)
+        {
+            ret |= FixedPoint_Ctrl_DeadZone(x[i], lower[i], upper[i], &r[i]);
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("DeadZone16_Array");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a bank of low-pass filters with a common time constant.
+ *
+ *  @param[out] bank    Bank.
+ *  @param[in]  shift   Time constant shift, 0..FIXEDPOINT_LOWPASS_MAX_SHIFT.
+ *  @param[in]  hi      Integer parts of the states, holding the initial outputs.
+ *  @param[out] lo      Fractional parts of the states, cleared.
+ *  @param[in]  num     Number of instances.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Bank ready.
+ *  @retval     E_NOT_OK    Null pointer or shift out of range.
+ */
+Std_ReturnType FixedPoint_LowPassBank16_Init(FixedPoint_LowPassBank16_t* bank, uint32 shift, t_Fixed16* hi,
+                                             uint16* lo, uint32 num)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((bank != NULL) && (hi != NULL) && (lo != NULL) && (shift <= FIXEDPOINT_LOWPASS_MAX_SHIFT))
+    {
+        uint32 i;
+
+        for (i = 0U; i < num; i++)
+        {
+            lo[i] = 0U;
+        }
+
+        bank->hi = hi;
+        bank->lo = lo;
+        bank->shift = shift;
+        bank->num = num;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Low-pass step of all instances of a bank.
+ *
+ *  @param[in,out] bank     Bank set up with FixedPoint_LowPassBank16_Init().
+ *  @param[in]     x        Input of each instance in configured 16-bit Q-format.
+ *  @param[out]    y        Output of each instance in configured 16-bit Q-format (may alias x).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Outputs computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_LowPassBank16(FixedPoint_LowPassBank16_t* bank, const t_Fixed16* x, t_Fixed16* y)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("LowPassBank16");
+
+    if ((bank != NULL) && (x != NULL) && (y != NULL))
+    {
+        t_Fixed16* hi = bank->hi;
+        uint16* lo = bank->lo;
+        uint32 i = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i shift = _mm_cvtsi32_si128((int)bank->shift);
+
+        for (; (i + FIXEDPOINT_CTRL_LANES) <= bank->num; i += FIXEDPOINT_CTRL_LANES)
+        {
+            const __m128i h = _mm_loadu_si128((const __m128i*)(const void*)&hi[i]);
+            const __m128i l = _mm_loadu_si128((const __m128i*)(const void*)&lo[i]);
+            const __m128i xv = _mm_loadu_si128((const __m128i*)(const void*)&x[i]);
+            __m128i acc0 = _mm_unpacklo_epi16(l, h);
+            __m128i acc1 = _mm_unpackhi_epi16(l, h);
+            __m128i nh;
+            __m128i nl;
+
+            /* acc + x * 2^(16 - shift) - floor(acc * 2^-shift) in 32-bit lanes */
+            acc0 = _mm_add_epi32(acc0, _mm_sub_epi32(_mm_sra_epi32(_mm_unpacklo_epi16(zero, xv), shift),
+                                                     _mm_sra_epi32(acc0, shift)));
+            acc1 = _mm_add_epi32(acc1, _mm_sub_epi32(_mm_sra_epi32(_mm_unpackhi_epi16(zero, xv), shift),
+                                                     _mm_sra_epi32(acc1, shift)));
+
+            /* Split into integer and fractional halves; the output rounds half up with saturation */
+            nh = _mm_packs_epi32(_mm_srai_epi32(acc0, 16), _mm_srai_epi32(acc1, 16));
+            nl = _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(acc0, 16), 16),
+                                 _mm_srai_epi32(_mm_slli_epi32(acc1, 16), 16));
+            _mm_storeu_si128((__m128i*)(void*)&hi[i], nh);
+            _mm_storeu_si128((__m128i*)(void*)&lo[i], nl);
+            _mm_storeu_si128((__m128i*)(void*)&y[i], _mm_adds_epi16(nh, _mm_srli_epi16(nl, 15)));
+        }
+#endif
+
+        for (; i < bank->num; i++)
+        {
+            const sint32 acc = FixedPoint_Ctrl_LowPass(((sint32)hi[i] * 65536L) + (sint32)lo[i], x[i], bank->shift);
+
+            hi[i] = (t_Fixed16)((acc - (sint32)(acc & 0xFFFFL)) / 65536L);
+            lo[i] = (uint16)(acc & 0xFFFFL);
+            y[i] = FixedPoint_Ctrl_LowPassOut(acc);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("LowPassBank16");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a bank of debounce counters.
+ *
+ *  @param[out] bank        Bank.
+ *  @param[in]  onTime      Switch-on time of each instance.
+ *  @param[in]  offTime     Switch-off time of each instance.
+ *  @param[out] count       Counters, cleared.
+ *  @param[in]  state       Outputs, holding the initial outputs (normalized to 0 / 1).
+ *  @param[in]  num         Number of instances.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Bank ready.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_DebounceBank_Init(FixedPoint_DebounceBank_t* bank, const uint16* onTime,
+                                            const uint16* offTime, uint16* count, boolean* state, uint32 num)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((bank != NULL) && (onTime != NULL) && (offTime != NULL) && (count != NULL) && (state != NULL))
+    {
+        uint32 i;
+
+        for (i = 0U; i < num; i++)
+        {
+            count[i] = 0U;
+            state[i] = (state[i] != 0U) ? 1U : 0U;
+        }
+
+        bank->onTime = onTime;
+        bank->offTime = offTime;
+        bank->count = count;
+        bank->state = state;
+        bank->num = num;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Debounce step of all instances of a bank.
+ *
+ *  @param[in,out] bank     Bank set up with FixedPoint_DebounceBank_Init(); outputs in bank->state.
+ *  @param[in]     in       Input of each instance (any non-zero value is TRUE).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Outputs computed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_DebounceBank(FixedPoint_DebounceBank_t* bank, const boolean* in)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("DebounceBank");
+
+    if ((bank != NULL) && (in != NULL))
+    {
+        uint16* count = bank->count;
+        boolean* state = bank->state;
+        uint32 i = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i one = _mm_set1_epi16(1);
+
+        for (; (i + FIXEDPOINT_CTRL_LANES) <= bank->num; i += FIXEDPOINT_CTRL_LANES)
+        {
+            const __m128i level = _mm_andnot_si128(
+                _mm_cmpeq_epi16(_mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(const void*)&in[i]), zero), zero),
+                one);
+            const __m128i isOn = _mm_cmpgt_epi16(
+                _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(const void*)&state[i]), zero), zero);
+            const __m128i st = _mm_and_si128(isOn, one);
+            const __m128i same = _mm_cmpeq_epi16(level, st);
+            const __m128i limit = _mm_or_si128(
+                _mm_and_si128(isOn, _mm_loadu_si128((const __m128i*)(const void*)&bank->offTime[i])),
+                _mm_andnot_si128(isOn, _mm_loadu_si128((const __m128i*)(const void*)&bank->onTime[i])));
+            /* Count the differing calls, switch once the count reaches the time of the current state */
+            const __m128i cnt = _mm_andnot_si128(
+                same, _mm_adds_epu16(_mm_loadu_si128((const __m128i*)(const void*)&count[i]), one));
+            const __m128i sw = _mm_andnot_si128(same, _mm_cmpeq_epi16(_mm_subs_epu16(limit, cnt), zero));
+            const __m128i next = _mm_or_si128(_mm_and_si128(sw, level), _mm_andnot_si128(sw, st));
+
+            _mm_storeu_si128((__m128i*)(void*)&count[i], _mm_andnot_si128(sw, cnt));
+            _mm_storel_epi64((__m128i*)(void*)&state[i], _mm_packus_epi16(next, zero));
+        }
+#endif
+
+        for (; i < bank->num; i++)
+        {
+            state[i] = FixedPoint_Ctrl_Debounce(in[i], bank->onTime[i], bank->offTime[i], &count[i], state[i]);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("DebounceBank");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
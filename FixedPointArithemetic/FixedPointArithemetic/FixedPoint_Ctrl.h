@@ -0,0 +1,157 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Ctrl.h
+
+@brief      Interface for the 16-bit control blocks (rate limiter, hysteresis, dead zone, low-pass, debounce).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_CTRL_H
+#define FIXED_POINT_CTRL_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Largest time constant shift of the low-pass filter. */
+#define FIXEDPOINT_LOWPASS_MAX_SHIFT    (15U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Rate limiter: the output follows the input by at most rise per call upwards and fall downwards. */
+typedef struct
+{
+    t_Fixed16 rise;     /**< Largest increase per call (>= 0) */
+    t_Fixed16 fall;     /**< Largest decrease per call (>= 0) */
+    t_Fixed16 y;        /**< Output of the last call */
+} FixedPoint_RateLimit16_t;
+
+/** @brief   Hysteresis: switches on at x >= upper and off at x <= lower. */
+typedef struct
+{
+    t_Fixed16 lower;    /**< Switch-off threshold */
+    t_Fixed16 upper;    /**< Switch-on threshold (>= lower) */
+    boolean   on;       /**< Output of the last call */
+} FixedPoint_Hyst16_t;
+
+/** @brief   First-order low-pass y += (x - y) * 2^-shift with 16 extra fractional bits of state. */
+typedef struct
+{
+    sint32 acc;         /**< Output with 16 extra fractional bits */
+    uint32 shift;       /**< Time constant shift, 0..FIXEDPOINT_LOWPASS_MAX_SHIFT (0 = no filtering) */
+} FixedPoint_LowPass16_t;
+
+/** @brief   Debounce: the output takes over the input after it differed for onTime or offTime calls. */
+typedef struct
+{
+    uint16  onTime;     /**< Calls with input TRUE until the output switches on (0 and 1 switch at once) */
+    uint16  offTime;    /**< Calls with input FALSE until the output switches off (0 and 1 switch at once) */
+    uint16  count;      /**< Consecutive calls with the input different from the output */
+    boolean state;      /**< Output of the last call */
+} FixedPoint_Debounce_t;
+
+/** @brief   N rate limiters with per-instance limits (structure of arrays). */
+typedef struct
+{
+    const t_Fixed16* rise;  /**< Largest increase per call of each instance */
+    const t_Fixed16* fall;  /**< Largest decrease per call of each instance */
+    t_Fixed16*       y;     /**< Outputs (state) */
+    uint32           num;   /**< Number of instances */
+} FixedPoint_RateLimitBank16_t;
+
+/** @brief   N hysteresis blocks with per-instance thresholds (structure of arrays). */
+typedef struct
+{
+    const t_Fixed16* lower; /**< Switch-off thresholds */
+    const t_Fixed16* upper; /**< Switch-on thresholds */
+    boolean*         on;    /**< Outputs (state) */
+    uint32           num;   /**< Number of instances */
+} FixedPoint_HystBank16_t;
+
+/** @brief   N low-pass filters with a common time constant (structure of arrays). */
+typedef struct
+{
+    t_Fixed16* hi;          /**< Integer part of the state (output truncated) */
+    uint16*    lo;          /**< 16 extra fractional bits of the state */
+    uint32     shift;       /**< Time constant shift, 0..FIXEDPOINT_LOWPASS_MAX_SHIFT */
+    uint32     num;         /**< Number of instances */
+} FixedPoint_LowPassBank16_t;
+
+/** @brief   N debounce counters with per-instance times (structure of arrays). */
+typedef struct
+{
+    const uint16* onTime;   /**< Switch-on times */
+    const uint16* offTime;  /**< Switch-off times */
+    uint16*       count;    /**< Consecutive calls with the input different from the output */
+    boolean*      state;    /**< Outputs (state) */
+    uint32        num;      /**< Number of instances */
+} FixedPoint_DebounceBank_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+
+/* Single instance */
+extern Std_ReturnType FixedPoint_RateLimit16_Init(FixedPoint_RateLimit16_t* rl, t_Fixed16 rise, t_Fixed16 fall,
+                                                  t_Fixed16 y0);
+extern Std_ReturnType FixedPoint_RateLimit16(FixedPoint_RateLimit16_t* rl, t_Fixed16 x, t_Fixed16* y);
+extern Std_ReturnType FixedPoint_Hyst16_Init(FixedPoint_Hyst16_t* hyst, t_Fixed16 lower, t_Fixed16 upper,
+                                             boolean on0);
+extern Std_ReturnType FixedPoint_Hyst16(FixedPoint_Hyst16_t* hyst, t_Fixed16 x, boolean* on);
+extern Std_ReturnType FixedPoint_DeadZone16(t_Fixed16 x, t_Fixed16 lower, t_Fixed16 upper, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_LowPass16_Init(FixedPoint_LowPass16_t* lp, uint32 shift, t_Fixed16 y0);
+extern Std_ReturnType FixedPoint_LowPass16(FixedPoint_LowPass16_t* lp, t_Fixed16 x, t_Fixed16* y);
+extern Std_ReturnType FixedPoint_Debounce_Init(FixedPoint_Debounce_t* db, uint16 onTime, uint16 offTime,
+                                               boolean state0);
+extern Std_ReturnType FixedPoint_Debounce(FixedPoint_Debounce_t* db, boolean in, boolean* out);
+
+/* N instances per call */
+extern Std_ReturnType FixedPoint_RateLimitBank16_Init(FixedPoint_RateLimitBank16_t* bank, const t_Fixed16* rise,
+                                                      const t_Fixed16* fall, t_Fixed16* y, uint32 num);
+extern Std_ReturnType FixedPoint_RateLimitBank16(FixedPoint_RateLimitBank16_t* bank, const t_Fixed16* x);
+extern Std_ReturnType FixedPoint_HystBank16_Init(FixedPoint_HystBank16_t* bank, const t_Fixed16* lower,
+                                                 const t_Fixed16* upper, boolean* on, uint32 num);
+extern Std_ReturnType FixedPoint_HystBank16(FixedPoint_HystBank16_t* bank, const t_Fixed16* x);
+extern Std_ReturnType FixedPoint_DeadZone16_Array(const t_Fixed16* x, const t_Fixed16* lower,
+                                                  const t_Fixed16* upper, t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_LowPassBank16_Init(FixedPoint_LowPassBank16_t* bank, uint32 shift, t_Fixed16* hi,
+                                                    uint16* lo, uint32 num);
+extern Std_ReturnType FixedPoint_LowPassBank16(FixedPoint_LowPassBank16_t* bank, const t_Fixed16* x, t_Fixed16* y);
+extern Std_ReturnType FixedPoint_DebounceBank_Init(FixedPoint_DebounceBank_t* bank, const uint16* onTime,
+                                                   const uint16* offTime, uint16* count, boolean* state,
+                                                   uint32 num);
+extern Std_ReturnType FixedPoint_DebounceBank(FixedPoint_DebounceBank_t* bank, const boolean* in);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_CTRL_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,464 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Dsp.c
+
+@brief      Bit-exact emulation of target DSP Q15 instructions.
+ *
+ * Detailed Description:
+ * - Firmware simulated offline has to reproduce the results of the target instructions, which
+ *   differ from the symmetric rounding of FixedPoint_Mult16_Core() in the last bit. For the Q15
+ *   product p = a * b the modes compute
+ *   FIXEDPOINT_DSP_ARM_SQRDMULH  sat(floor((p + 2^14) / 2^15))         round half up
+ *   FIXEDPOINT_DSP_ARM_SQDMULH   sat(floor(p / 2^15))                  truncation
+ *   FIXEDPOINT_DSP_TI_C55X       sat(round half to even of p / 2^15)   convergent rounding (RDM = 1)
+ *   FIXEDPOINT_DSP_TI_Q15        floor(p / 2^15) modulo 2^16           no saturation
+ *   Only -1 * -1 leaves the Q15 range; the saturating modes give 0x7FFF, FIXEDPOINT_DSP_TI_Q15 0x8000.
+ *   Addition and subtraction saturate (ARM QADD16 / QSUB16, C55x SATD = 1) or wrap (FIXEDPOINT_DSP_TI_Q15).
+ * - A saturation returns E_NOT_OK, the equivalent of the sticky ARM Q flag or the C55x overflow
+ *   flag, and is reported to the probe like the saturation of the core operations.
+ * - The SSE2 kernels stay in 16-bit lanes: bits 15..30 of the product are (mulhi << 1) | (mullo >> 15),
+ *   the rounding bit is bit 14 of mullo and a tie of the convergent rounding has the low 15 bits
+ *   0x4000. The saturating modes store the saturated lanes directly; lanes that saturated are run
+ *   through the scalar emulation again only to report them.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint.h"
+#include "FixedPoint_Dsp.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 16-bit multiply and saturating arithmetic intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of elements processed together by the SSE2 kernels. */
+#define FIXEDPOINT_DSP_LANES            (8U)
+
+/** @brief Offset that makes a Q30 product non-negative, so that a right shift rounds towards minus infinity. */
+#define FIXEDPOINT_DSP_OFFSET           (1LL << 31U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static Std_ReturnType FixedPoint_Dsp_Narrow(FixedPoint_DspMode_t mode, sint64 v, sint16* r);
+static Std_ReturnType FixedPoint_Dsp_MultCore(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r);
+static Std_ReturnType FixedPoint_Dsp_AddCore(FixedPoint_DspMode_t mode, FixedPoint_Operation_t op, sint16 a,
+                                             sint16 b, sint16* r);
+static Std_ReturnType FixedPoint_Dsp_Array(FixedPoint_DspMode_t mode, FixedPoint_Operation_t op, const sint16* a,
+                                           const sint16* b, sint16* r, uint32 len);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Narrow an exact result to 16 bits with the overflow behaviour of the mode.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  v       Exact result.
+ *  @param[out] r       Saturated or wrapped result.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result in range or wrapped.
+ *  @retval     E_NOT_OK    Result saturated.
+ */
+static Std_ReturnType FixedPoint_Dsp_Narrow(FixedPoint_DspMode_t mode, sint64 v, sint16* r)
+{
+    Std_ReturnType ret = E_OK;
+
+    if (mode == FIXEDPOINT_DSP_TI_Q15)
+    {
+        /* Two's complement wrap-around of the 16-bit register */
+        *r = (sint16)((sint32)((uint32)((uint64)v & 0xFFFFU) ^ 0x8000U) - 32768);
+    }
+    else if (v > 32767)
+    {
+        *r = 32767;
+        ret = E_NOT_OK;
+    }
+    else if (v < -32768)
+    {
+        *r = -32768;
+        ret = E_NOT_OK;
+    }
+    else
+    {
+        *r = (sint16)v;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Scalar emulation of the Q15 multiplication.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       First operand (Q15).
+ *  @param[in]  b       Second operand (Q15).
+ *  @param[out] r       Product (Q15).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Product in range.
+ *  @retval     E_NOT_OK    Product saturated.
+ */
+static Std_ReturnType FixedPoint_Dsp_MultCore(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r)
+{
+    /* The offset keeps the product non-negative; it is a multiple of 2^15 and does not change the low bits */
+    const sint64 p = ((sint64)a * (sint64)b) + FIXEDPOINT_DSP_OFFSET;
+    Std_ReturnType ret;
+    sint64 v;
+
+    if (mode == FIXEDPOINT_DSP_ARM_SQRDMULH)
+    {
+        v = (p + 0x4000) >> 15U;
+    }
+    else if (mode == FIXEDPOINT_DSP_TI_C55X)
+    {
+        v = (p + 0x4000) >> 15U;
+        if ((p & 0x7FFF) == 0x4000)
+        {
+            /* Tie: round to the even neighbour */
+            v &= ~(sint64)1;
+        }
+    }
+    else
+    {
+        v = p >> 15U;
+    }
+
+    ret = FixedPoint_Dsp_Narrow(mode, v - (FIXEDPOINT_DSP_OFFSET >> 15U), r);
+    if (ret != E_OK)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_OP_MULT, 16, a, b, *r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Scalar emulation of the Q15 addition and subtraction.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  op      FIXEDPOINT_OP_ADD or FIXEDPOINT_OP_SUB.
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[out] r       Sum or difference.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Result in range or wrapped.
+ *  @retval     E_NOT_OK    Result saturated.
+ */
+static Std_ReturnType FixedPoint_Dsp_AddCore(FixedPoint_DspMode_t mode, FixedPoint_Operation_t op, sint16 a,
+                                             sint16 b, sint16* r)
+{
+    const sint64 v = (op == FIXEDPOINT_OP_ADD) ? ((sint64)a + (sint64)b) : ((sint64)a - (sint64)b);
+    const Std_ReturnType ret = FixedPoint_Dsp_Narrow(mode, v, r);
+
+    if (ret != E_OK)
+    {
+        FIXEDPOINT_PROBE_SATURATE(op, 16, a, b, *r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise kernel of the emulated operations.
+ *
+ *  @param[in]  mode    Emulated semantics (valid).
+ *  @param[in]  op      FIXEDPOINT_OP_MULT, FIXEDPOINT_OP_ADD or FIXEDPOINT_OP_SUB.
+ *  @param[in]  a       First operands.
+ *  @param[in]  b       Second operands.
+ *  @param[out] r       Results (may alias a or b).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No result saturated.
+ *  @retval     E_NOT_OK    At least one result saturated.
+ */
+static Std_ReturnType FixedPoint_Dsp_Array(FixedPoint_DspMode_t mode, FixedPoint_Operation_t op, const sint16* a,
+                                           const sint16* b, sint16* r, uint32 len)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 i = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one = _mm_set1_epi16(1);
+    const __m128i min = _mm_set1_epi16(-32768);
+    const __m128i roundBit = ((mode == FIXEDPOINT_DSP_ARM_SQRDMULH) || (mode == FIXEDPOINT_DSP_TI_C55X)) ? one : zero;
+    const __m128i tieBit = (mode == FIXEDPOINT_DSP_TI_C55X) ? one : zero;
+    const boolean saturating = (mode != FIXEDPOINT_DSP_TI_Q15) ? 1U : 0U;
+
+    for (; (i + FIXEDPOINT_DSP_LANES) <= len; i += FIXEDPOINT_DSP_LANES)
+    {
+        const __m128i av = _mm_loadu_si128((const __m128i*)(const void*)&a[i]);
+        const __m128i bv = _mm_loadu_si128((const __m128i*)(const void*)&b[i]);
+        __m128i rv;
+        __m128i satv;
+        __m128i overflow;
+
+        if (op == FIXEDPOINT_OP_MULT)
+        {
+            const __m128i lo = _mm_mullo_epi16(av, bv);
+            const __m128i hi = _mm_mulhi_epi16(av, bv);
+            const __m128i tie = _mm_cmpeq_epi16(_mm_and_si128(lo, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x4000));
+
+            /* Bits 15..30 of the product, plus the rounding bit 14, minus 1 on an odd tie result */
+            rv = _mm_or_si128(_mm_slli_epi16(hi, 1), _mm_srli_epi16(lo, 15));
+            rv = _mm_add_epi16(rv, _mm_and_si128(_mm_srli_epi16(lo, 14), roundBit));
+            rv = _mm_andnot_si128(_mm_and_si128(tie, tieBit), rv);
+            overflow = _mm_and_si128(_mm_cmpeq_epi16(av, min), _mm_cmpeq_epi16(bv, min));
+            satv = _mm_xor_si128(rv, overflow);     /* -1 * -1 gives 0x8000, saturated 0x7FFF */
+        }
+        else if (op == FIXEDPOINT_OP_ADD)
+        {
+            rv = _mm_add_epi16(av, bv);
+            satv = _mm_adds_epi16(av, bv);
+            overflow = _mm_xor_si128(_mm_cmpeq_epi16(rv, satv), _mm_cmpeq_epi16(zero, zero));
+        }
+        else
+        {
+            rv = _mm_sub_epi16(av, bv);
+            satv = _mm_subs_epi16(av, bv);
+            overflow = _mm_xor_si128(_mm_cmpeq_epi16(rv, satv), _mm_cmpeq_epi16(zero, zero));
+        }
+
+        if (saturating == 0U)
+        {
+            _mm_storeu_si128((__m128i*)(void*)&r[i], rv);
+        }
+        else
+        {
+            const uint32 mask = (uint32)_mm_movemask_epi8(overflow);
+
+            if (mask != 0U)
+            {
+                /* Saturation: emulate the saturated lanes again to report them (operands saved, r may alias) */
+                sint16 aLane[FIXEDPOINT_DSP_LANES];
+                sint16 bLane[FIXEDPOINT_DSP_LANES];
+                sint16 rLane;
+                uint32 k;
+
+                _mm_storeu_si128((__m128i*)(void*)aLane, av);
+                _mm_storeu_si128((__m128i*)(void*)bLane, bv);
+                for (k = 0U; k < FIXEDPOINT_DSP_LANES; k++)
+                {
+                    if (((mask >> (2U * k)) & 1U) != 0U)
+                    {
+                        ret |= (op == FIXEDPOINT_OP_MULT)
+                             ? FixedPoint_Dsp_MultCore(mode, aLane[k], bLane[k], &rLane)
+                             : FixedPoint_Dsp_AddCore(mode, op, aLane[k], bLane[k], &rLane);
+                    }
+                }
+            }
+            _mm_storeu_si128((__m128i*)(void*)&r[i], satv);
+        }
+    }
+#endif
+
+    for (; i < len; i++)
+    {
+        ret |= (op == FIXEDPOINT_OP_MULT) ? FixedPoint_Dsp_MultCore(mode, a[i], b[i], &r[i])
+                                          : FixedPoint_Dsp_AddCore(mode, op, a[i], b[i], &r[i]);
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Q15 multiplication with the semantics of the emulated target instruction.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       First operand (Q15 word).
+ *  @param[in]  b       Second operand (Q15 word).
+ *  @param[out] r       Product (Q15 word).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Product in range (or wrapped in FIXEDPOINT_DSP_TI_Q15).
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or product saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Mult16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_MultCore(mode, a, b, r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Q15 addition with the overflow behaviour of the emulated target.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[out] r       Sum.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Sum in range (or wrapped in FIXEDPOINT_DSP_TI_Q15).
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or sum saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Add16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_AddCore(mode, FIXEDPOINT_OP_ADD, a, b, r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Q15 subtraction with the overflow behaviour of the emulated target.
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       Minuend.
+ *  @param[in]  b       Subtrahend.
+ *  @param[out] r       Difference.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Difference in range (or wrapped in FIXEDPOINT_DSP_TI_Q15).
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or difference saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Sub16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_AddCore(mode, FIXEDPOINT_OP_SUB, a, b, r);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise Q15 multiplication with the semantics of the emulated target (batch kernel).
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       First operands.
+ *  @param[in]  b       Second operands.
+ *  @param[out] r       Products (may alias a or b).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No product saturated.
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or at least one product saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Mult16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                           sint16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Dsp_Mult16_Array");
+
+    if ((a != NULL) && (b != NULL) && (r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_Array(mode, FIXEDPOINT_OP_MULT, a, b, r, len);
+    }
+
+    FIXEDPOINT_TRACE_END("Dsp_Mult16_Array");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise Q15 addition with the overflow behaviour of the emulated target (batch kernel).
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       First operands.
+ *  @param[in]  b       Second operands.
+ *  @param[out] r       Sums (may alias a or b).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No sum saturated.
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or at least one sum saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Add16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                          sint16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Dsp_Add16_Array");
+
+    if ((a != NULL) && (b != NULL) && (r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_Array(mode, FIXEDPOINT_OP_ADD, a, b, r, len);
+    }
+
+    FIXEDPOINT_TRACE_END("Dsp_Add16_Array");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise Q15 subtraction with the overflow behaviour of the emulated target (batch kernel).
+ *
+ *  @param[in]  mode    Emulated semantics.
+ *  @param[in]  a       Minuends.
+ *  @param[in]  b       Subtrahends.
+ *  @param[out] r       Differences (may alias a or b).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No difference saturated.
+ *  @retval     E_NOT_OK    Null pointer, invalid mode or at least one difference saturated.
+ */
+Std_ReturnType FixedPoint_Dsp_Sub16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                          sint16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Dsp_Sub16_Array");
+
+    if ((a != NULL) && (b != NULL) && (r != NULL) && (mode < FIXEDPOINT_DSP_MODES))
+    {
+        ret = FixedPoint_Dsp_Array(mode, FIXEDPOINT_OP_SUB, a, b, r, len);
+    }
+
+    FIXEDPOINT_TRACE_END("Dsp_Sub16_Array");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
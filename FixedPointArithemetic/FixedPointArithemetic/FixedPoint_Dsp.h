@@ -0,0 +1,72 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Dsp.h
+
+@brief      Interface for the bit-exact emulation of target DSP Q15 instructions.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_DSP_H
+#define FIXED_POINT_DSP_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Emulated target semantics of the Q15 multiplication, addition and subtraction.
+ *
+ *  The operands are raw 16-bit words read as Q15, independent of the configured SHIFT_16.
+ */
+typedef enum
+{
+    FIXEDPOINT_DSP_ARM_SQRDMULH = 0,    /**< ARM SQRDMULH / VQRDMULH.S16: sat((2ab + 2^15) >> 16), QADD16 / QSUB16 */
+    FIXEDPOINT_DSP_ARM_SQDMULH,         /**< ARM SQDMULH / VQDMULH.S16: sat((2ab) >> 16), QADD16 / QSUB16 */
+    FIXEDPOINT_DSP_TI_C55X,             /**< TI C55x MPYR with FRCT, SATD, RDM: round half to even, saturating */
+    FIXEDPOINT_DSP_TI_Q15,              /**< TI DSPLIB Q15 C code: (short)((a * b) >> 15), wrapping add / sub */
+    FIXEDPOINT_DSP_MODES                /**< Number of modes */
+} FixedPoint_DspMode_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Dsp_Mult16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r);
+extern Std_ReturnType FixedPoint_Dsp_Add16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r);
+extern Std_ReturnType FixedPoint_Dsp_Sub16(FixedPoint_DspMode_t mode, sint16 a, sint16 b, sint16* r);
+extern Std_ReturnType FixedPoint_Dsp_Mult16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                                  sint16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Dsp_Add16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                                 sint16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Dsp_Sub16_Array(FixedPoint_DspMode_t mode, const sint16* a, const sint16* b,
+                                                 sint16* r, uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_DSP_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,405 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Fft.c
+
+@brief      Block floating point fixed-point FFT.
+ *
+ * Detailed Description:
+ * - Radix-2 decimation in time FFT of power of 2 length over complex 32-bit mantissas. A vector
+ *   represents the values mantissa * 2^exponent with one exponent for the whole block (block
+ *   floating point), so the transform keeps about 29 significant bits for any signal level.
+ * - Before the first stage the block is normalized to a peak magnitude in [2^28, 2^29). A stage
+ *   grows the peak by at most 1 + sqrt(2), which still fits into 32 bits; when the peak of a stage
+ *   output reaches 2^29 the block is shifted right before the next stage and the exponent
+ *   increased. Signals that do not grow are not scaled, unlike a fixed 1/2 scaling per stage.
+ * - Twiddle factors are Q1.30, products are formed in 64 bits and rounded to nearest. The scaling
+ *   of a stage is folded into the butterflies of the next stage, so it needs no extra pass.
+ * - The inverse transform uses the conjugate twiddle factors; its 1/len scaling only lowers the
+ *   exponent by log2(len).
+ * - The twiddle table is provided by the caller and filled once by FixedPoint_Fft_Init().
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include <math.h>              /* for cos, sin (twiddle factors) */
+#include "FixedPoint_Fft.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Fractional bits of the twiddle factors. */
+#define FIXEDPOINT_FFT_TWIDDLE_BITS     (30U)
+
+/** @brief Peak magnitude a block must stay below before a stage. */
+#define FIXEDPOINT_FFT_HEADROOM         ((sint64)1 << 29)
+
+/** @brief Lower bound of the peak magnitude after normalization. */
+#define FIXEDPOINT_FFT_NORM_MIN         ((sint64)1 << 28)
+
+/** @brief pi */
+#define FIXEDPOINT_FFT_PI               (3.14159265358979323846)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+
+/* Rounding shift and block helpers. */
+static sint64 FixedPoint_Fft_Round(sint64 v, uint32 shift);
+static sint64 FixedPoint_Fft_Peak(const FixedPoint_Complex32_t* x, uint32 len);
+static void FixedPoint_Fft_Scale(FixedPoint_Complex32_t* x, uint32 len, sint32 shift);
+
+/* Transform shared by the forward and the inverse direction. */
+static void FixedPoint_Fft_Transform(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent,
+                                     boolean inverse);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Shift right with round-to-nearest (ties towards +infinity).
+ *
+ *  The offset keeps the shifted value non-negative, so no shift of a negative number is needed and
+ *  the rounding costs two additions and a shift without a branch. Ties are rare at the shifts of
+ *  the transform and their bias is far below the resolution of the 16-bit results.
+ *
+ *  @param[in]  v       Value, |v| < 2^61.
+ *  @param[in]  shift   Number of bits (0..61).
+ *
+ *  @return     Rounded v / 2^shift.
+ */
+static sint64 FixedPoint_Fft_Round(sint64 v, uint32 shift)
+{
+    const sint64 offset = ((sint64)1 << 61);
+
+    return ((v + offset + (((sint64)1 << shift) >> 1U)) >> shift) - (offset >> shift);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Largest magnitude of the real and imaginary parts of a block.
+ *
+ *  @param[in]  x       Block.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Peak magnitude.
+ */
+static sint64 FixedPoint_Fft_Peak(const FixedPoint_Complex32_t* x, uint32 len)
+{
+    sint64 peak = 0;
+    uint32 i;
+
+    for (i = 0U; i < len; i++)
+    {
+        const sint64 re = (x[i].re < 0) ? -(sint64)x[i].re : (sint64)x[i].re;
+        const sint64 im = (x[i].im < 0) ? -(sint64)x[i].im : (sint64)x[i].im;
+
+        peak = (re > peak) ? re : peak;
+        peak = (im > peak) ? im : peak;
+    }
+
+    return peak;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Scale a block by 2^-shift.
+ *
+ *  @param[in,out] x        Block.
+ *  @param[in]     len      Number of elements.
+ *  @param[in]     shift    > 0: shift right with rounding, < 0: shift left (the caller ensures the headroom).
+ */
+static void FixedPoint_Fft_Scale(FixedPoint_Complex32_t* x, uint32 len, sint32 shift)
+{
+    uint32 i;
+
+    if (shift > 0)
+    {
+        for (i = 0U; i < len; i++)
+        {
+            x[i].re = (sint32)FixedPoint_Fft_Round((sint64)x[i].re, (uint32)shift);
+            x[i].im = (sint32)FixedPoint_Fft_Round((sint64)x[i].im, (uint32)shift);
+        }
+    }
+    else if (shift < 0)
+    {
+        const sint64 factor = ((sint64)1 << (uint32)(-shift));
+
+        for (i = 0U; i < len; i++)
+        {
+            x[i].re = (sint32)((sint64)x[i].re * factor);
+            x[i].im = (sint32)((sint64)x[i].im * factor);
+        }
+    }
+    else
+    {
+        /* Already in range */
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     In-place radix-2 decimation in time transform with block scaling.
+ *
+ *  @param[in]     fft          Transform.
+ *  @param[in,out] x            Block of fft->len elements.
+ *  @param[in,out] exponent     Block exponent of x.
+ *  @param[in]     inverse      1: conjugate twiddle factors.
+ */
+static void FixedPoint_Fft_Transform(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent,
+                                     boolean inverse)
+{
+    const uint32 n = fft->len;
+    const FixedPoint_Complex32_t* const w = fft->twiddles;
+    const sint64 conj = inverse ? -1 : 1;
+    sint32 shift = 0;
+    uint32 size;
+    uint32 i;
+    uint32 j = 0U;
+
+    /* Bit reversed order */
+    for (i = 1U; i < n; i++)
+    {
+        uint32 bit = n >> 1U;
+
+        while ((j & bit) != 0U)
+        {
+            j ^= bit;
+            bit >>= 1U;
+        }
+        j ^= bit;
+
+        if (i < j)
+        {
+            const FixedPoint_Complex32_t tmp = x[i];
+
+            x[i] = x[j];
+            x[j] = tmp;
+        }
+    }
+
+    (void)FixedPoint_Fft_Normalize(x, n, exponent);
+
+    for (size = 2U; size <= n; size <<= 1U)
+    {
+        const uint32 half = size >> 1U;
+        const uint32 step = n / size;
+        const uint32 mulShift = FIXEDPOINT_FFT_TWIDDLE_BITS + (uint32)shift;
+        sint64 peak = 0;
+        uint32 start;
+        uint32 k;
+
+        /* The scaling found after the previous stage is applied to the butterfly inputs */
+        for (start = 0U; start < n; start += size)
+        {
+            FixedPoint_Complex32_t* const a = &x[start];
+            FixedPoint_Complex32_t* const b = &x[start + half];
+
+            for (k = 0U; k < half; k++)
+            {
+                const sint64 wr = (sint64)w[k * step].re;
+                const sint64 wi = (sint64)w[k * step].im * conj;
+                const sint64 br = (sint64)b[k].re;
+                const sint64 bi = (sint64)b[k].im;
+                const sint64 tr = FixedPoint_Fft_Round((br * wr) - (bi * wi), mulShift);
+                const sint64 ti = FixedPoint_Fft_Round((br * wi) + (bi * wr), mulShift);
+                const sint64 ar = FixedPoint_Fft_Round((sint64)a[k].re, (uint32)shift);
+                const sint64 ai = FixedPoint_Fft_Round((sint64)a[k].im, (uint32)shift);
+                const sint64 r0 = ar + tr;
+                const sint64 i0 = ai + ti;
+                const sint64 r1 = ar - tr;
+                const sint64 i1 = ai - ti;
+
+                a[k].re = (sint32)r0;
+                a[k].im = (sint32)i0;
+                b[k].re = (sint32)r1;
+                b[k].im = (sint32)i1;
+
+                peak |= (r0 ^ -(sint64)(r0 < 0)) | (i0 ^ -(sint64)(i0 < 0));
+                peak |= (r1 ^ -(sint64)(r1 < 0)) | (i1 ^ -(sint64)(i1 < 0));
+            }
+        }
+
+        *exponent += shift;
+
+        /* The OR of all magnitudes (one's complement for negative values) has the highest bit of their maximum */
+        shift = 0;
+        while (peak >= FIXEDPOINT_FFT_HEADROOM)
+        {
+            peak >>= 1U;
+            shift++;
+        }
+    }
+
+    /* Scaling of the last stage output */
+    FixedPoint_Fft_Scale(x, n, shift);
+    *exponent += shift;
+
+    if (inverse)
+    {
+        *exponent -= (sint32)fft->log2Len;
+    }
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a transform and fill its twiddle table.
+ *
+ *  @param[out] fft         Transform.
+ *  @param[in]  len         Transform length, power of 2 within 4..FIXEDPOINT_FFT_MAX_LEN.
+ *  @param[out] twiddles    Table of FIXEDPOINT_FFT_TWIDDLES(len) elements, owned by the caller.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Transform ready.
+ *  @retval     E_NOT_OK    Null pointer or invalid length.
+ */
+Std_ReturnType FixedPoint_Fft_Init(FixedPoint_Fft_t* fft, uint32 len, FixedPoint_Complex32_t* twiddles)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((fft != NULL) && (twiddles != NULL) && (len >= 4U) && (len <= FIXEDPOINT_FFT_MAX_LEN) &&
+        ((len & (len - 1U)) == 0U))
+    {
+        const double one = (double)((sint64)1 << FIXEDPOINT_FFT_TWIDDLE_BITS);
+        uint32 k;
+
+        fft->twiddles = twiddles;
+        fft->len = len;
+        fft->log2Len = 0U;
+
+        while ((1UL << fft->log2Len) < len)
+        {
+            fft->log2Len++;
+        }
+
+        for (k = 0U; k < FIXEDPOINT_FFT_TWIDDLES(len); k++)
+        {
+            const double angle = (-2.0 * FIXEDPOINT_FFT_PI * (double)k) / (double)len;
+
+            twiddles[k].re = (sint32)floor((cos(angle) * one) + 0.5);
+            twiddles[k].im = (sint32)floor((sin(angle) * one) + 0.5);
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     In-place forward transform X[k] = sum x[n] * exp(-2*pi*i*k*n/len).
+ *
+ *  @param[in]     fft          Transform set up with FixedPoint_Fft_Init().
+ *  @param[in,out] x            Block of fft->len elements, mantissas of the input and then of the spectrum.
+ *  @param[in,out] exponent     Block exponent of the input, then of the spectrum.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Transformed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Fft_Forward(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((fft != NULL) && (x != NULL) && (exponent != NULL))
+    {
+        FixedPoint_Fft_Transform(fft, x, exponent, 0U);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     In-place inverse transform x[n] = 1/len * sum X[k] * exp(2*pi*i*k*n/len).
+ *
+ *  @param[in]     fft          Transform set up with FixedPoint_Fft_Init().
+ *  @param[in,out] x            Block of fft->len elements, mantissas of the spectrum and then of the signal.
+ *  @param[in,out] exponent     Block exponent of the spectrum, then of the signal.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Transformed.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Fft_Inverse(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((fft != NULL) && (x != NULL) && (exponent != NULL))
+    {
+        FixedPoint_Fft_Transform(fft, x, exponent, 1U);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Scale a block to a peak magnitude in [2^28, 2^29) and adjust its exponent.
+ *
+ *  A block of zeros is left unchanged.
+ *
+ *  @param[in,out] x            Block.
+ *  @param[in]     len          Number of elements.
+ *  @param[in,out] exponent     Block exponent.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Normalized.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Fft_Normalize(FixedPoint_Complex32_t* x, uint32 len, sint32* exponent)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((x != NULL) && (exponent != NULL))
+    {
+        sint64 peak = FixedPoint_Fft_Peak(x, len);
+        sint32 shift = 0;
+
+        if (peak != 0)
+        {
+            while (peak >= FIXEDPOINT_FFT_HEADROOM)
+            {
+                peak >>= 1U;
+                shift++;
+            }
+            while (peak < FIXEDPOINT_FFT_NORM_MIN)
+            {
+                peak <<= 1U;
+                shift--;
+            }
+        }
+
+        FixedPoint_Fft_Scale(x, len, shift);
+        *exponent += shift;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
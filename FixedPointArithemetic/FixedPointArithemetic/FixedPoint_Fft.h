@@ -0,0 +1,76 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Fft.h
+
+@brief      Interface for the block floating point fixed-point FFT.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_FFT_H
+#define FIXED_POINT_FFT_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of twiddle factors of a transform of length len. */
+#define FIXEDPOINT_FFT_TWIDDLES(len)    ((len) / 2U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Complex mantissa of a block floating point vector. */
+typedef struct
+{
+    sint32 re;  /**< Real part */
+    sint32 im;  /**< Imaginary part */
+} FixedPoint_Complex32_t;
+
+/** @brief   Transform of a fixed length. */
+typedef struct
+{
+    FixedPoint_Complex32_t* twiddles;   /**< len/2 factors exp(-2*pi*i*k/len) in Q1.30 */
+    uint32                  len;        /**< Transform length (power of 2) */
+    uint32                  log2Len;    /**< log2(len) */
+} FixedPoint_Fft_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Fft_Init(FixedPoint_Fft_t* fft, uint32 len, FixedPoint_Complex32_t* twiddles);
+extern Std_ReturnType FixedPoint_Fft_Forward(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent);
+extern Std_ReturnType FixedPoint_Fft_Inverse(const FixedPoint_Fft_t* fft, FixedPoint_Complex32_t* x, sint32* exponent);
+extern Std_ReturnType FixedPoint_Fft_Normalize(FixedPoint_Complex32_t* x, uint32 len, sint32* exponent);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_FFT_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
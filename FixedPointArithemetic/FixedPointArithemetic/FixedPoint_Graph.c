@@ -0,0 +1,373 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Graph.c
+
+@brief      Incremental recomputation of derived 16-bit fixed-point signals.
+ *
+ * Detailed Description:
+ * - Derived signals are described as a dependency graph of inputs and binary operations
+ *   (Add, Sub, Mult, Div as in FixedPoint.h) in the configured 16-bit Q-format.
+ * - Nodes can only refer to previously defined nodes, so the definition order is a topological
+ *   order and evaluation is a single forward pass without sorting or recursion.
+ * - Setting an input to a different value marks it dirty. During evaluation a node is recomputed
+ *   only if one of its operands is dirty; it then becomes dirty itself for its dependents.
+ * - The same graph is evaluated for many instances at once. A recomputed node is calculated for
+ *   all instances with one batch kernel call over its contiguous value row.
+ * - All storage (node table, value table) is provided by the application, no dynamic memory is used.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Graph.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static Std_ReturnType FixedPoint_Graph_AddNode(FixedPoint_Graph_t* graph, const FixedPoint_GraphNode_t* node, uint32* nodeId);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Append a node to the graph and clear its value row.
+ *
+ *  @param[in,out]  graph   Graph to extend.
+ *  @param[in]      node    Node definition.
+ *  @param[out]     nodeId  Identifier of the new node.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Node added.
+ *  @retval     E_NOT_OK    Node table full.
+ */
+static Std_ReturnType FixedPoint_Graph_AddNode(FixedPoint_Graph_t* graph, const FixedPoint_GraphNode_t* node, uint32* nodeId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (graph->nodeCount < graph->nodeCapacity)
+    {
+        t_Fixed16* row = &graph->values[graph->nodeCount * graph->instanceCount];
+        uint32 i;
+
+        for (i = 0U; i < graph->instanceCount; i++)
+        {
+            row[i] = 0;
+        }
+
+        graph->nodes[graph->nodeCount] = *node;
+        *nodeId = graph->nodeCount;
+        graph->nodeCount++;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise an empty graph on application provided storage.
+ *
+ *  @param[out] graph           Graph to initialise.
+ *  @param[in]  nodes           Node table with nodeCapacity entries.
+ *  @param[in]  nodeCapacity    Maximum number of nodes.
+ *  @param[in]  values          Value table with nodeCapacity * instanceCount entries.
+ *  @param[in]  instanceCount   Number of instances evaluated together (>= 1).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Graph initialised.
+ *  @retval     E_NOT_OK    Null pointer or zero capacity / instance count.
+ */
+Std_ReturnType FixedPoint_Graph_Init(FixedPoint_Graph_t* graph, FixedPoint_GraphNode_t* nodes, uint32 nodeCapacity,
+                                     t_Fixed16* values, uint32 instanceCount)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (nodes != NULL) && (values != NULL) && (nodeCapacity > 0U) && (instanceCount > 0U))
+    {
+        graph->nodes = nodes;
+        graph->values = values;
+        graph->nodeCapacity = nodeCapacity;
+        graph->nodeCount = 0U;
+        graph->instanceCount = instanceCount;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Add an input node. Its value is 0 for all instances until set by the application.
+ *
+ *  @param[in,out]  graph   Graph to extend.
+ *  @param[out]     nodeId  Identifier of the new node.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Node added.
+ *  @retval     E_NOT_OK    Null pointer or node table full.
+ */
+Std_ReturnType FixedPoint_Graph_AddInput(FixedPoint_Graph_t* graph, uint32* nodeId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (nodeId != NULL))
+    {
+        FixedPoint_GraphNode_t node;
+
+        node.op = FIXEDPOINT_OP_ADD;
+        node.in1 = 0U;
+        node.in2 = 0U;
+        node.isInput = 1U;
+        node.dirty = 1U;
+        node.status = E_OK;
+
+        ret = FixedPoint_Graph_AddNode(graph, &node, nodeId);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Add an operation node: value = in1 (op) in2.
+ *
+ *  The operands must be existing nodes, which keeps the node table in topological order.
+ *  The node is computed on the next evaluation.
+ *
+ *  @param[in,out]  graph   Graph to extend.
+ *  @param[in]      op      Operation of the node.
+ *  @param[in]      in1     First operand node.
+ *  @param[in]      in2     Second operand node.
+ *  @param[out]     nodeId  Identifier of the new node.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Node added.
+ *  @retval     E_NOT_OK    Null pointer, invalid operation, unknown operand or node table full.
+ */
+Std_ReturnType FixedPoint_Graph_AddOp(FixedPoint_Graph_t* graph, FixedPoint_Operation_t op, uint32 in1, uint32 in2,
+                                      uint32* nodeId)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (nodeId != NULL) && (in1 < graph->nodeCount) && (in2 < graph->nodeCount) &&
+        ((op == FIXEDPOINT_OP_ADD) || (op == FIXEDPOINT_OP_SUB) || (op == FIXEDPOINT_OP_MULT) || (op == FIXEDPOINT_OP_DIV)))
+    {
+        FixedPoint_GraphNode_t node;
+
+        node.op = op;
+        node.in1 = in1;
+        node.in2 = in2;
+        node.isInput = 0U;
+        node.dirty = 1U;
+        node.status = E_OK;
+
+        ret = FixedPoint_Graph_AddNode(graph, &node, nodeId);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set the value of an input node for one instance.
+ *
+ *  The node is only marked dirty if the value differs from the current one.
+ *
+ *  @param[in,out]  graph       Graph.
+ *  @param[in]      nodeId      Input node.
+ *  @param[in]      instance    Instance index.
+ *  @param[in]      value       New value in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Value set.
+ *  @retval     E_NOT_OK    Null pointer, not an input node or instance out of range.
+ */
+Std_ReturnType FixedPoint_Graph_SetInput(FixedPoint_Graph_t* graph, uint32 nodeId, uint32 instance, t_Fixed16 value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (nodeId < graph->nodeCount) && (instance < graph->instanceCount) &&
+        (graph->nodes[nodeId].isInput != 0U))
+    {
+        t_Fixed16* slot = &graph->values[(nodeId * graph->instanceCount) + instance];
+
+        if (*slot != value)
+        {
+            *slot = value;
+            graph->nodes[nodeId].dirty = 1U;
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set the value of an input node for all instances.
+ *
+ *  The node is only marked dirty if at least one value differs from the current one.
+ *
+ *  @param[in,out]  graph   Graph.
+ *  @param[in]      nodeId  Input node.
+ *  @param[in]      values  New values for all instances in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Values set.
+ *  @retval     E_NOT_OK    Null pointer or not an input node.
+ */
+Std_ReturnType FixedPoint_Graph_SetInputArray(FixedPoint_Graph_t* graph, uint32 nodeId, const t_Fixed16* values)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (values != NULL) && (nodeId < graph->nodeCount) && (graph->nodes[nodeId].isInput != 0U))
+    {
+        t_Fixed16* row = &graph->values[nodeId * graph->instanceCount];
+        boolean changed = 0U;
+        uint32 i;
+
+        for (i = 0U; i < graph->instanceCount; i++)
+        {
+            changed |= (row[i] != values[i]) ? 1U : 0U;
+            row[i] = values[i];
+        }
+
+        if (changed != 0U)
+        {
+            graph->nodes[nodeId].dirty = 1U;
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Recompute all nodes that depend on changed inputs.
+ *
+ *  Single forward pass over the node table. An operation node is recomputed for all instances
+ *  if one of its operands is dirty. All dirty flags are cleared afterwards. The returned status
+ *  covers the nodes recomputed in this call; the status of each node is kept in the node table.
+ *
+ *  @param[in,out]  graph       Graph.
+ *  @param[out]     recomputed  Optional pointer to store the number of recomputed nodes (may be NULL).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All recomputed nodes calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation in a recomputed node.
+ */
+Std_ReturnType FixedPoint_Graph_Evaluate(FixedPoint_Graph_t* graph, uint32* recomputed)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (graph != NULL)
+    {
+        const uint32 n = graph->instanceCount;
+        uint32 count = 0U;
+        uint32 i;
+
+        ret = E_OK;
+
+        for (i = 0U; i < graph->nodeCount; i++)
+        {
+            FixedPoint_GraphNode_t* node = &graph->nodes[i];
+
+            if ((node->isInput == 0U) &&
+                ((node->dirty != 0U) || (graph->nodes[node->in1].dirty != 0U) || (graph->nodes[node->in2].dirty != 0U)))
+            {
+                /* One batch kernel call over the value rows of all instances */
+                node->status = FixedPoint_Op16_Strided(node->op,
+                                                       &graph->values[node->in1 * n], 1,
+                                                       &graph->values[node->in2 * n], 1,
+                                                       &graph->values[i * n], 1, n);
+                node->dirty = 1U;
+                ret |= node->status;
+                count++;
+            }
+        }
+
+        for (i = 0U; i < graph->nodeCount; i++)
+        {
+            graph->nodes[i].dirty = 0U;
+        }
+
+        if (recomputed != NULL)
+        {
+            *recomputed = count;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read the value of a node for one instance.
+ *
+ *  @param[in]  graph       Graph.
+ *  @param[in]  nodeId      Node.
+ *  @param[in]  instance    Instance index.
+ *  @param[out] value       Pointer to store the value in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Value read.
+ *  @retval     E_NOT_OK    Null pointer, unknown node or instance out of range.
+ */
+Std_ReturnType FixedPoint_Graph_GetValue(const FixedPoint_Graph_t* graph, uint32 nodeId, uint32 instance, t_Fixed16* value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((graph != NULL) && (value != NULL) && (nodeId < graph->nodeCount) && (instance < graph->instanceCount))
+    {
+        *value = graph->values[(nodeId * graph->instanceCount) + instance];
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Get the values of a node for all instances.
+ *
+ *  @param[in]  graph   Graph.
+ *  @param[in]  nodeId  Node.
+ *
+ *  @return     const t_Fixed16*
+ *  @retval     Pointer to instanceCount values, or NULL for a null graph or unknown node.
+ */
+const t_Fixed16* FixedPoint_Graph_GetValues(const FixedPoint_Graph_t* graph, uint32 nodeId)
+{
+    const t_Fixed16* row = NULL;
+
+    if ((graph != NULL) && (nodeId < graph->nodeCount))
+    {
+        row = &graph->values[nodeId * graph->instanceCount];
+    }
+
+    return row;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,88 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Graph.h
+
+@brief      Interface for incremental recomputation of derived 16-bit fixed-point signals.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_GRAPH_H
+#define FIXED_POINT_GRAPH_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Node of a dependency graph: either an input or a binary operation on two earlier nodes. */
+typedef struct
+{
+    FixedPoint_Operation_t op;      /**< Operation of the node (ignored for input nodes) */
+    uint32                 in1;     /**< First operand node (ignored for input nodes) */
+    uint32                 in2;     /**< Second operand node (ignored for input nodes) */
+    boolean                isInput; /**< Node value is set by the application */
+    boolean                dirty;   /**< Node value changed or must be recomputed */
+    Std_ReturnType         status;  /**< Status of the last computation of the node */
+} FixedPoint_GraphNode_t;
+
+/** @brief   Dependency graph evaluated for a number of instances at once.
+ *
+ * All instances share the node structure. The values are stored node-major, i.e. the values of
+ * one node for all instances are contiguous (values[node * instanceCount + instance]), so a node
+ * is recomputed for every instance with one batch kernel call.
+ */
+typedef struct
+{
+    FixedPoint_GraphNode_t* nodes;          /**< Node table provided by the application */
+    t_Fixed16*              values;         /**< Value table (nodeCapacity * instanceCount) */
+    uint32                  nodeCapacity;   /**< Number of entries of the node table */
+    uint32                  nodeCount;      /**< Number of defined nodes */
+    uint32                  instanceCount;  /**< Number of graph instances (lanes) */
+} FixedPoint_Graph_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Graph_Init(FixedPoint_Graph_t* graph, FixedPoint_GraphNode_t* nodes, uint32 nodeCapacity,
+                                            t_Fixed16* values, uint32 instanceCount);
+extern Std_ReturnType FixedPoint_Graph_AddInput(FixedPoint_Graph_t* graph, uint32* nodeId);
+extern Std_ReturnType FixedPoint_Graph_AddOp(FixedPoint_Graph_t* graph, FixedPoint_Operation_t op, uint32 in1, uint32 in2,
+                                             uint32* nodeId);
+
+extern Std_ReturnType FixedPoint_Graph_SetInput(FixedPoint_Graph_t* graph, uint32 nodeId, uint32 instance, t_Fixed16 value);
+extern Std_ReturnType FixedPoint_Graph_SetInputArray(FixedPoint_Graph_t* graph, uint32 nodeId, const t_Fixed16* values);
+extern Std_ReturnType FixedPoint_Graph_Evaluate(FixedPoint_Graph_t* graph, uint32* recomputed);
+
+extern Std_ReturnType FixedPoint_Graph_GetValue(const FixedPoint_Graph_t* graph, uint32 nodeId, uint32 instance, t_Fixed16* value);
+extern const t_Fixed16* FixedPoint_Graph_GetValues(const FixedPoint_Graph_t* graph, uint32 nodeId);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_GRAPH_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,665 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Integ.c
+
+@brief      Numerical integration of sampled signals and fixed-step ODE integration (Euler, RK4).
+ *
+ * Detailed Description:
+ * - Trapezoid and Simpson rule: the weighted sample sum (y0 + 2 y1 + ... + yn) or
+ *   (y0 + 4 y1 + 2 y2 + ... + yn) is formed exactly in 64 bits and multiplied by h / 2 or h / 3
+ *   with a single rounding, so the result does not depend on the number of samples beyond that
+ *   rounding. The cumulative trapezoid rounds every output from the exact running sum and does
+ *   not accumulate rounding errors.
+ * - Euler and RK4 integrate dim state variables of num systems per call, the systems stored as
+ *   structure of arrays, so that the right-hand side and the stage updates run as loops over the
+ *   systems. A batch of thousands of systems is one call. RK4 keeps k1 + 2 k2 + 2 k3 + k4 in 64 bits
+ *   and applies h / 6 with a single rounding; the stage states x + h/2 k and x + h k are rounded
+ *   once each.
+ * - Products of a 64-bit sum and the step size are formed in two 64-bit halves, so the 32-bit
+ *   format needs no 128-bit arithmetic. Rounding is selectable per call or integrator: half away
+ *   from zero (as the core operations), floor (as a hand-written arithmetic shift) or half to even.
+ * - Results and states outside the format saturate (E_NOT_OK, probe FIXEDPOINT_PROBE_OP_NARROW).
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint.h"
+#include "FixedPoint_Integ.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Magnitude returned for a product too large for any format; saturates in FixedPoint_Integ_Narrow(). */
+#define FIXEDPOINT_INTEG_HUGE           ((sint64)1 << 62U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static sint64 FixedPoint_Integ_MulRound(sint64 a, sint64 h, uint32 shift, boolean div3, FixedPoint_Rounding_t rounding);
+static sint64 FixedPoint_Integ_Narrow(sint64 v, sint64 min, sint64 max, Std_ReturnType* ret);
+static sint64 FixedPoint_Integ_Weighted(const t_Fixed16* y16, const t_Fixed32* y32, uint32 len, boolean simpson);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     a * h / (2^shift or 3 * 2^shift), rounded once.
+ *
+ *  The product magnitude is kept as hi * 2^32 + lo, which holds any |a| < 2^63 times |h| <= 2^31.
+ *
+ *  @param[in]  a           Wide operand (|a| < 2^63).
+ *  @param[in]  h           Step size (|h| <= 2^31).
+ *  @param[in]  shift       Power of two of the divisor (0..32).
+ *  @param[in]  div3        Divisor has the additional factor 3.
+ *  @param[in]  rounding    Rounding of the quotient.
+ *
+ *  @return     Rounded quotient, +-FIXEDPOINT_INTEG_HUGE if its magnitude reaches 2^61.
+ */
+static sint64 FixedPoint_Integ_MulRound(sint64 a, sint64 h, uint32 shift, boolean div3, FixedPoint_Rounding_t rounding)
+{
+    const boolean neg = ((a < 0) != (h < 0)) ? 1U : 0U;
+    const uint64 ua = (uint64)((a < 0) ? -a : a);
+    const uint64 uh = (uint64)((h < 0) ? -h : h);
+    const uint64 lo = (ua & 0xFFFFFFFFULL) * uh;
+    const uint64 hi = ((ua >> 32U) * uh) + (lo >> 32U);
+    const uint64 low = lo & 0xFFFFFFFFULL;
+    sint64 result;
+
+    if ((hi >> (shift + 29U)) != 0U)
+    {
+        result = neg ? -FIXEDPOINT_INTEG_HUGE : FIXEDPOINT_INTEG_HUGE;
+    }
+    else
+    {
+        const uint64 mask = ((uint64)1 << shift) - 1U;
+        const uint64 q1 = (shift < 32U) ? ((hi << (32U - shift)) | (low >> shift)) : hi;
+        const uint64 den = (div3 != 0U) ? ((uint64)3 << shift) : ((uint64)1 << shift);
+        uint64 q = (div3 != 0U) ? (q1 / 3U) : q1;
+        const uint64 rem = (div3 != 0U) ? (((q1 % 3U) << shift) | (low & mask)) : (low & mask);
+
+        if (rounding == FIXEDPOINT_ROUND_FLOOR)
+        {
+            /* Towards minus infinity: a negative quotient with remainder grows in magnitude */
+            q += ((neg != 0U) && (rem != 0U)) ? 1U : 0U;
+        }
+        else if ((2U * rem) > den)
+        {
+            q++;
+        }
+        else if ((2U * rem) == den)
+        {
+            q += ((rounding == FIXEDPOINT_ROUND_NEAREST) || ((q & 1U) != 0U)) ? 1U : 0U;
+        }
+        else
+        {
+            /* Below half: truncate */
+        }
+
+        result = neg ? -(sint64)q : (sint64)q;
+    }
+
+    return result;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Saturate a value to the range of the result format.
+ *
+ *  @param[in]  v       Value.
+ *  @param[in]  min     Smallest value of the format (FIX16_MIN or FIX32_MIN).
+ *  @param[in]  max     Largest value of the format (FIX16_MAX or FIX32_MAX).
+ *  @param[in,out] ret  Set to E_NOT_OK on saturation.
+ *
+ *  @return     Saturated value.
+ */
+static sint64 FixedPoint_Integ_Narrow(sint64 v, sint64 min, sint64 max, Std_ReturnType* ret)
+{
+    sint64 r = v;
+
+    if (v > max)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, (max == (sint64)FIX16_MAX) ? 16 : 32, v, 0, max);
+        r = max;
+        *ret = E_NOT_OK;
+    }
+    else if (v < min)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, (min == (sint64)FIX16_MIN) ? 16 : 32, v, 0, min);
+        r = min;
+        *ret = E_NOT_OK;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return r;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Exact weighted sample sum of the trapezoid or Simpson rule.
+ *
+ *  @param[in]  y16     Samples in 16-bit format, or NULL.
+ *  @param[in]  y32     Samples in 32-bit format (used if y16 is NULL).
+ *  @param[in]  len     Number of samples (>= 2, odd for Simpson).
+ *  @param[in]  simpson Simpson weights 1 4 2 4 ... 4 1 instead of trapezoid weights 1 2 2 ... 2 1.
+ *
+ *  @return     Weighted sum.
+ */
+static sint64 FixedPoint_Integ_Weighted(const t_Fixed16* y16, const t_Fixed32* y32, uint32 len, boolean simpson)
+{
+    sint64 ends;
+    sint64 odd = 0;
+    sint64 even = 0;
+    uint32 i;
+
+    if (y16 != NULL)
+    {
+        ends = (sint64)y16[0] + (sint64)y16[len - 1U];
+        for (i = 1U; (i + 1U) < len; i += 2U)
+        {
+            odd += y16[i];
+            even += ((i + 2U) < len) ? y16[i + 1U] : 0;
+        }
+    }
+    else
+    {
+        ends = (sint64)y32[0] + (sint64)y32[len - 1U];
+        for (i = 1U; (i + 1U) < len; i += 2U)
+        {
+            odd += y32[i];
+            even += ((i + 2U) < len) ? y32[i + 1U] : 0;
+        }
+    }
+
+    return (simpson != 0U) ? (ends + (4 * odd) + (2 * even)) : (ends + (2 * (odd + even)));
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Trapezoid rule integral of equally spaced samples in configured 16-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (2..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 16-bit Q-format.
+ *  @param[in]  rounding    Rounding of the result.
+ *  @param[out] r           Integral in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or the result saturated.
+ */
+Std_ReturnType FixedPoint_Trapz16(const t_Fixed16* y, uint32 len, t_Fixed16 h, FixedPoint_Rounding_t rounding,
+                                  t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((y != NULL) && (r != NULL) && (len >= 2U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        const sint64 sum = FixedPoint_Integ_Weighted(y, NULL, len, 0U);
+
+        ret = E_OK;
+        *r = (t_Fixed16)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_16 + 1U, 0U, rounding),
+                                                FIX16_MIN, FIX16_MAX, &ret);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Simpson rule integral of equally spaced samples in configured 16-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (odd, 3..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 16-bit Q-format.
+ *  @param[in]  rounding    Rounding of the result.
+ *  @param[out] r           Integral in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or the result saturated.
+ */
+Std_ReturnType FixedPoint_Simpson16(const t_Fixed16* y, uint32 len, t_Fixed16 h, FixedPoint_Rounding_t rounding,
+                                    t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((y != NULL) && (r != NULL) && (len >= 3U) && ((len & 1U) != 0U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        const sint64 sum = FixedPoint_Integ_Weighted(y, NULL, len, 1U);
+
+        ret = E_OK;
+        *r = (t_Fixed16)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_16, 1U, rounding),
+                                                FIX16_MIN, FIX16_MAX, &ret);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Running trapezoid integral r[i] = integral of y from sample 0 to i, configured 16-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (1..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 16-bit Q-format.
+ *  @param[in]  rounding    Rounding of each output.
+ *  @param[out] r           Running integral, len values, r[0] = 0 (may be y).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or an output saturated.
+ */
+Std_ReturnType FixedPoint_CumTrapz16(const t_Fixed16* y, uint32 len, t_Fixed16 h, FixedPoint_Rounding_t rounding,
+                                     t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("CumTrapz16");
+
+    if ((y != NULL) && (r != NULL) && (len >= 1U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        sint64 sum = 0;
+        sint64 prev = y[0];
+        uint32 i;
+
+        ret = E_OK;
+        r[0] = 0;
+        for (i = 1U; i < len; i++)
+        {
+            const sint64 cur = y[i];
+
+            sum += prev + cur;
+            prev = cur;
+            r[i] = (t_Fixed16)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_16 + 1U, 0U, rounding),
+                                                      FIX16_MIN, FIX16_MAX, &ret);
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("CumTrapz16");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Trapezoid rule integral of equally spaced samples in configured 32-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (2..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 32-bit Q-format.
+ *  @param[in]  rounding    Rounding of the result.
+ *  @param[out] r           Integral in configured 32-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or the result saturated.
+ */
+Std_ReturnType FixedPoint_Trapz32(const t_Fixed32* y, uint32 len, t_Fixed32 h, FixedPoint_Rounding_t rounding,
+                                  t_Fixed32* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((y != NULL) && (r != NULL) && (len >= 2U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        const sint64 sum = FixedPoint_Integ_Weighted(NULL, y, len, 0U);
+
+        ret = E_OK;
+        *r = (t_Fixed32)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_32 + 1U, 0U, rounding),
+                                                FIX32_MIN, FIX32_MAX, &ret);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Simpson rule integral of equally spaced samples in configured 32-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (odd, 3..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 32-bit Q-format.
+ *  @param[in]  rounding    Rounding of the result.
+ *  @param[out] r           Integral in configured 32-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or the result saturated.
+ */
+Std_ReturnType FixedPoint_Simpson32(const t_Fixed32* y, uint32 len, t_Fixed32 h, FixedPoint_Rounding_t rounding,
+                                    t_Fixed32* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((y != NULL) && (r != NULL) && (len >= 3U) && ((len & 1U) != 0U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        const sint64 sum = FixedPoint_Integ_Weighted(NULL, y, len, 1U);
+
+        ret = E_OK;
+        *r = (t_Fixed32)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_32, 1U, rounding),
+                                                FIX32_MIN, FIX32_MAX, &ret);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Running trapezoid integral r[i] = integral of y from sample 0 to i, configured 32-bit Q-format.
+ *
+ *  @param[in]  y           Samples.
+ *  @param[in]  len         Number of samples (1..FIXEDPOINT_INTEG_MAX_LEN).
+ *  @param[in]  h           Sample spacing in configured 32-bit Q-format.
+ *  @param[in]  rounding    Rounding of each output.
+ *  @param[out] r           Running integral, len values, r[0] = 0 (may be y).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integral computed.
+ *  @retval     E_NOT_OK    Null pointer, invalid length or rounding, or an output saturated.
+ */
+Std_ReturnType FixedPoint_CumTrapz32(const t_Fixed32* y, uint32 len, t_Fixed32 h, FixedPoint_Rounding_t rounding,
+                                     t_Fixed32* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("CumTrapz32");
+
+    if ((y != NULL) && (r != NULL) && (len >= 1U) && (len <= FIXEDPOINT_INTEG_MAX_LEN) &&
+        ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES))
+    {
+        sint64 sum = 0;
+        sint64 prev = y[0];
+        uint32 i;
+
+        ret = E_OK;
+        r[0] = 0;
+        for (i = 1U; i < len; i++)
+        {
+            const sint64 cur = y[i];
+
+            sum += prev + cur;
+            prev = cur;
+            r[i] = (t_Fixed32)FixedPoint_Integ_Narrow(FixedPoint_Integ_MulRound(sum, h, SHIFT_32 + 1U, 0U, rounding),
+                                                      FIX32_MIN, FIX32_MAX, &ret);
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("CumTrapz32");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a fixed-step integrator of num systems in configured 16-bit Q-format.
+ *
+ *  @param[out] ode         Integrator.
+ *  @param[in]  method      FIXEDPOINT_ODE_EULER or FIXEDPOINT_ODE_RK4.
+ *  @param[in]  func        Right-hand side of the systems.
+ *  @param[in]  context     Context passed to func (may be NULL).
+ *  @param[in]  dim         State variables per system (>= 1).
+ *  @param[in]  num         Number of systems (>= 1).
+ *  @param[in]  h           Step size in configured 16-bit Q-format (> 0).
+ *  @param[in]  rounding    Rounding of the state updates.
+ *  @param[in]  stage       Stage buffer of FIXEDPOINT_ODE_STAGE_LEN(dim, num) values.
+ *  @param[in]  acc         Accumulator of FIXEDPOINT_ODE_ACC_LEN(dim, num) values (RK4 only, else may be NULL).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integrator set up.
+ *  @retval     E_NOT_OK    Null pointer or invalid parameter.
+ */
+Std_ReturnType FixedPoint_Ode16_Init(FixedPoint_Ode16_t* ode, FixedPoint_OdeMethod_t method,
+                                     FixedPoint_OdeFunc16_t func, void* context, uint32 dim, uint32 num, t_Fixed16 h,
+                                     FixedPoint_Rounding_t rounding, t_Fixed16* stage, sint64* acc)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((ode != NULL) && (func != NULL) && (stage != NULL) && ((uint32)method < (uint32)FIXEDPOINT_ODE_METHODS) &&
+        ((acc != NULL) || (method == FIXEDPOINT_ODE_EULER)) && ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES) &&
+        (dim >= 1U) && (num >= 1U) && (h > 0))
+    {
+        ode->func = func;
+        ode->context = context;
+        ode->method = method;
+        ode->rounding = rounding;
+        ode->h = h;
+        ode->dim = dim;
+        ode->num = num;
+        ode->stage = stage;
+        ode->acc = acc;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Advance all systems by one step of size h, 16-bit Q-format.
+ *
+ *  @param[in,out] ode      Integrator.
+ *  @param[in,out] x        States of the systems, x[i * num + s], dim * num values.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Step completed.
+ *  @retval     E_NOT_OK    Null pointer, the right-hand side failed, or a stage or state saturated.
+ */
+Std_ReturnType FixedPoint_Ode16_Step(FixedPoint_Ode16_t* ode, t_Fixed16* x)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Ode16_Step");
+
+    if ((ode != NULL) && (x != NULL))
+    {
+        const uint32 len = ode->dim * ode->num;
+        t_Fixed16* xt = ode->stage;
+        t_Fixed16* k = &ode->stage[len];
+        uint32 i;
+
+        ret = ode->func(ode->context, x, k, ode->num);
+
+        if (ode->method == FIXEDPOINT_ODE_EULER)
+        {
+            for (i = 0U; i < len; i++)
+            {
+                x[i] = (t_Fixed16)FixedPoint_Integ_Narrow(
+                           (sint64)x[i] + FixedPoint_Integ_MulRound(k[i], ode->h, SHIFT_16, 0U, ode->rounding),
+                           FIX16_MIN, FIX16_MAX, &ret);
+            }
+        }
+        else
+        {
+            uint32 stage;
+
+            for (i = 0U; i < len; i++)
+            {
+                ode->acc[i] = k[i];
+            }
+
+            /* Stages 2 and 3 at x + h/2 k, stage 4 at x + h k; k1 + 2 k2 + 2 k3 + k4 accumulated exactly */
+            for (stage = 1U; stage < 4U; stage++)
+            {
+                const uint32 shift = (stage < 3U) ? (SHIFT_16 + 1U) : SHIFT_16;
+                const sint64 weight = (stage < 3U) ? 2 : 1;
+
+                for (i = 0U; i < len; i++)
+                {
+                    xt[i] = (t_Fixed16)FixedPoint_Integ_Narrow(
+                                (sint64)x[i] + FixedPoint_Integ_MulRound(k[i], ode->h, shift, 0U, ode->rounding),
+                                FIX16_MIN, FIX16_MAX, &ret);
+                }
+                ret |= ode->func(ode->context, xt, k, ode->num);
+                for (i = 0U; i < len; i++)
+                {
+                    ode->acc[i] += weight * (sint64)k[i];
+                }
+            }
+
+            /* x + h/6 (k1 + 2 k2 + 2 k3 + k4) */
+            for (i = 0U; i < len; i++)
+            {
+                x[i] = (t_Fixed16)FixedPoint_Integ_Narrow(
+                           (sint64)x[i] + FixedPoint_Integ_MulRound(ode->acc[i], ode->h, SHIFT_16 + 1U, 1U,
+                                                                    ode->rounding),
+                           FIX16_MIN, FIX16_MAX, &ret);
+            }
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Ode16_Step");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a fixed-step integrator of num systems in configured 32-bit Q-format.
+ *
+ *  @param[out] ode         Integrator.
+ *  @param[in]  method      FIXEDPOINT_ODE_EULER or FIXEDPOINT_ODE_RK4.
+ *  @param[in]  func        Right-hand side of the systems.
+ *  @param[in]  context     Context passed to func (may be NULL).
+ *  @param[in]  dim         State variables per system (>= 1).
+ *  @param[in]  num         Number of systems (>= 1).
+ *  @param[in]  h           Step size in configured 32-bit Q-format (> 0).
+ *  @param[in]  rounding    Rounding of the state updates.
+ *  @param[in]  stage       Stage buffer of FIXEDPOINT_ODE_STAGE_LEN(dim, num) values.
+ *  @param[in]  acc         Accumulator of FIXEDPOINT_ODE_ACC_LEN(dim, num) values (RK4 only, else may be NULL).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Integrator set up.
+ *  @retval     E_NOT_OK    Null pointer or invalid parameter.
+ */
+Std_ReturnType FixedPoint_Ode32_Init(FixedPoint_Ode32_t* ode, FixedPoint_OdeMethod_t method,
+                                     FixedPoint_OdeFunc32_t func, void* context, uint32 dim, uint32 num, t_Fixed32 h,
+                                     FixedPoint_Rounding_t rounding, t_Fixed32* stage, sint64* acc)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((ode != NULL) && (func != NULL) && (stage != NULL) && ((uint32)method < (uint32)FIXEDPOINT_ODE_METHODS) &&
+        ((acc != NULL) || (method == FIXEDPOINT_ODE_EULER)) && ((uint32)rounding < (uint32)FIXEDPOINT_ROUND_MODES) &&
+        (dim >= 1U) && (num >= 1U) && (h > 0) && (h <= FIX32_MAX))
+    {
+        ode->func = func;
+        ode->context = context;
+        ode->method = method;
+        ode->rounding = rounding;
+        ode->h = h;
+        ode->dim = dim;
+        ode->num = num;
+        ode->stage = stage;
+        ode->acc = acc;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Advance all systems by one step of size h, 32-bit Q-format.
+ *
+ *  @param[in,out] ode      Integrator.
+ *  @param[in,out] x        States of the systems, x[i * num + s], dim * num values.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Step completed.
+ *  @retval     E_NOT_OK    Null pointer, the right-hand side failed, or a stage or state saturated.
+ */
+Std_ReturnType FixedPoint_Ode32_Step(FixedPoint_Ode32_t* ode, t_Fixed32* x)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Ode32_Step");
+
+    if ((ode != NULL) && (x != NULL))
+    {
+        const uint32 len = ode->dim * ode->num;
+        t_Fixed32* xt = ode->stage;
+        t_Fixed32* k = &ode->stage[len];
+        uint32 i;
+
+        ret = ode->func(ode->context, x, k, ode->num);
+
+        if (ode->method == FIXEDPOINT_ODE_EULER)
+        {
+            for (i = 0U; i < len; i++)
+            {
+                x[i] = (t_Fixed32)FixedPoint_Integ_Narrow(
+                           (sint64)x[i] + FixedPoint_Integ_MulRound(k[i], ode->h, SHIFT_32, 0U, ode->rounding),
+                           FIX32_MIN, FIX32_MAX, &ret);
+            }
+        }
+        else
+        {
+            uint32 stage;
+
+            for (i = 0U; i < len; i++)
+            {
+                ode->acc[i] = k[i];
+            }
+
+            /* Stages 2 and 3 at x + h/2 k, stage 4 at x + h k; k1 + 2 k2 + 2 k3 + k4 accumulated exactly */
+            for (stage = 1U; stage < 4U; stage++)
+            {
+                const uint32 shift = (stage < 3U) ? (SHIFT_32 + 1U) : SHIFT_32;
+                const sint64 weight = (stage < 3U) ? 2 : 1;
+
+                for (i = 0U; i < len; i++)
+                {
+                    xt[i] = (t_Fixed32)FixedPoint_Integ_Narrow(
+                                (sint64)x[i] + FixedPoint_Integ_MulRound(k[i], ode->h, shift, 0U, ode->rounding),
+                                FIX32_MIN, FIX32_MAX, &ret);
+                }
+                ret |= ode->func(ode->context, xt, k, ode->num);
+                for (i = 0U; i < len; i++)
+                {
+                    ode->acc[i] += weight * (sint64)k[i];
+                }
+            }
+
+            /* x + h/6 (k1 + 2 k2 + 2 k3 + k4) */
+            for (i = 0U; i < len; i++)
+            {
+                x[i] = (t_Fixed32)FixedPoint_Integ_Narrow(
+                           (sint64)x[i] + FixedPoint_Integ_MulRound(ode->acc[i], ode->h, SHIFT_32 + 1U, 1U,
+                                                                    ode->rounding),
+                           FIX32_MIN, FIX32_MAX, &ret);
+            }
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Ode32_Step");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
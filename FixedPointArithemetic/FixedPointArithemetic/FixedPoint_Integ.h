@@ -0,0 +1,145 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Integ.h
+
+@brief      Interface for numerical integration of sampled signals and fixed-step ODE integration (Euler, RK4).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_INTEG_H
+#define FIXED_POINT_INTEG_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Largest number of samples of the array integrators (keeps the weighted sums within 64 bits). */
+#define FIXEDPOINT_INTEG_MAX_LEN        (1UL << 28U)
+
+/** @brief Length of the stage buffer of an ODE integrator (elements of the state type). */
+#define FIXEDPOINT_ODE_STAGE_LEN(dim, num)  (2U * (dim) * (num))
+
+/** @brief Length of the accumulator of an ODE integrator (sint64, FIXEDPOINT_ODE_RK4 only). */
+#define FIXEDPOINT_ODE_ACC_LEN(dim, num)    ((dim) * (num))
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Rounding of a wide intermediate to the result format. */
+typedef enum
+{
+    FIXEDPOINT_ROUND_NEAREST = 0,   /**< Half away from zero, as the core multiplication and division */
+    FIXEDPOINT_ROUND_FLOOR,         /**< Towards minus infinity, as an arithmetic right shift */
+    FIXEDPOINT_ROUND_EVEN,          /**< Half to even, no bias over many steps */
+    FIXEDPOINT_ROUND_MODES          /**< Number of modes */
+} FixedPoint_Rounding_t;
+
+/** @brief   Fixed-step ODE integration method. */
+typedef enum
+{
+    FIXEDPOINT_ODE_EULER = 0,       /**< Explicit Euler, 1 derivative evaluation per step */
+    FIXEDPOINT_ODE_RK4,             /**< Classic Runge-Kutta of order 4, 4 derivative evaluations per step */
+    FIXEDPOINT_ODE_METHODS          /**< Number of methods */
+} FixedPoint_OdeMethod_t;
+
+/** @brief   Right-hand side dx/dt = f(x) of num systems in configured 16-bit Q-format.
+ *
+ * x and dxdt hold the dim state variables of the systems as structure of arrays, variable i of
+ * system s at [i * num + s]. Inputs and parameters are read from the context and may be changed
+ * by the caller between steps. Returns E_NOT_OK to mark a step as failed (the step still completes).
+ */
+typedef Std_ReturnType (*FixedPoint_OdeFunc16_t)(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num);
+
+/** @brief   Right-hand side dx/dt = f(x) of num systems in configured 32-bit Q-format (layout as FixedPoint_OdeFunc16_t). */
+typedef Std_ReturnType (*FixedPoint_OdeFunc32_t)(void* context, const t_Fixed32* x, t_Fixed32* dxdt, uint32 num);
+
+/** @brief   Fixed-step integrator of num ODE systems of dim state variables in 16-bit Q-format. */
+typedef struct
+{
+    FixedPoint_OdeFunc16_t func;        /**< Right-hand side */
+    void*                  context;     /**< Context passed to func */
+    FixedPoint_OdeMethod_t method;      /**< Integration method */
+    FixedPoint_Rounding_t  rounding;    /**< Rounding of the state updates */
+    t_Fixed16              h;           /**< Step size in configured 16-bit Q-format (> 0) */
+    uint32                 dim;         /**< State variables per system */
+    uint32                 num;         /**< Number of systems */
+    t_Fixed16*             stage;       /**< Stage states and derivatives, FIXEDPOINT_ODE_STAGE_LEN(dim, num) */
+    sint64*                acc;         /**< Weighted derivative sum, FIXEDPOINT_ODE_ACC_LEN(dim, num) (RK4) */
+} FixedPoint_Ode16_t;
+
+/** @brief   Fixed-step integrator of num ODE systems of dim state variables in 32-bit Q-format. */
+typedef struct
+{
+    FixedPoint_OdeFunc32_t func;        /**< Right-hand side */
+    void*                  context;     /**< Context passed to func */
+    FixedPoint_OdeMethod_t method;      /**< Integration method */
+    FixedPoint_Rounding_t  rounding;    /**< Rounding of the state updates */
+    t_Fixed32              h;           /**< Step size in configured 32-bit Q-format (> 0) */
+    uint32                 dim;         /**< State variables per system */
+    uint32                 num;         /**< Number of systems */
+    t_Fixed32*             stage;       /**< Stage states and derivatives, FIXEDPOINT_ODE_STAGE_LEN(dim, num) */
+    sint64*                acc;         /**< Weighted derivative sum, FIXEDPOINT_ODE_ACC_LEN(dim, num) (RK4) */
+} FixedPoint_Ode32_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+
+/* Integration of sampled signals with sample spacing h */
+extern Std_ReturnType FixedPoint_Trapz16(const t_Fixed16* y, uint32 len, t_Fixed16 h, FixedPoint_Rounding_t rounding,
+                                         t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Simpson16(const t_Fixed16* y, uint32 len, t_Fixed16 h,
+                                           FixedPoint_Rounding_t rounding, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_CumTrapz16(const t_Fixed16* y, uint32 len, t_Fixed16 h,
+                                            FixedPoint_Rounding_t rounding, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Trapz32(const t_Fixed32* y, uint32 len, t_Fixed32 h, FixedPoint_Rounding_t rounding,
+                                         t_Fixed32* r);
+extern Std_ReturnType FixedPoint_Simpson32(const t_Fixed32* y, uint32 len, t_Fixed32 h,
+                                           FixedPoint_Rounding_t rounding, t_Fixed32* r);
+extern Std_ReturnType FixedPoint_CumTrapz32(const t_Fixed32* y, uint32 len, t_Fixed32 h,
+                                            FixedPoint_Rounding_t rounding, t_Fixed32* r);
+
+/* Fixed-step ODE integration of one or many systems */
+extern Std_ReturnType FixedPoint_Ode16_Init(FixedPoint_Ode16_t* ode, FixedPoint_OdeMethod_t method,
+                                            FixedPoint_OdeFunc16_t func, void* context, uint32 dim, uint32 num,
+                                            t_Fixed16 h, FixedPoint_Rounding_t rounding, t_Fixed16* stage,
+                                            sint64* acc);
+extern Std_ReturnType FixedPoint_Ode16_Step(FixedPoint_Ode16_t* ode, t_Fixed16* x);
+extern Std_ReturnType FixedPoint_Ode32_Init(FixedPoint_Ode32_t* ode, FixedPoint_OdeMethod_t method,
+                                            FixedPoint_OdeFunc32_t func, void* context, uint32 dim, uint32 num,
+                                            t_Fixed32 h, FixedPoint_Rounding_t rounding, t_Fixed32* stage,
+                                            sint64* acc);
+extern Std_ReturnType FixedPoint_Ode32_Step(FixedPoint_Ode32_t* ode, t_Fixed32* x);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_INTEG_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
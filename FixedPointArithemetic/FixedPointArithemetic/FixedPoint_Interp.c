@@ -0,0 +1,490 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Interp.c
+
+@brief      16-bit curve (1D) and map (2D) interpolation.
+ *
+ * Detailed Description:
+ * - Curves and maps follow the characteristic curves and maps of the AUTOSAR interpolation
+ *   libraries: sample points on strictly increasing axes, linear (curve) and bilinear (map)
+ *   interpolation between them and the boundary values for inputs beyond the axis ends.
+ *   Axes and values are t_Fixed16; the arithmetic is integer only.
+ * - The segment search starts at the segment of the previous call (segment, segX, segY). An input
+ *   in the same or a neighbouring segment is found with one or two comparisons, which is the
+ *   common case for slowly moving inputs such as a speed or a temperature; other inputs fall back to
+ *   a binary search of the remaining axis part.
+ * - The result is computed exactly as a fraction and rounded once (symmetric round-to-nearest):
+ *   curve  r = (v0 * (w - d) + v1 * d) / w,
+ *   map    r = sum(v_ij * wx_i * wy_j) / (wx * wy)
+ *   with the segment widths w, wx, wy and the weights d, w - d of the input position. No
+ *   intermediate ratio is rounded, so a map lookup equals the correctly rounded bilinear value.
+ *   The result lies between the neighbouring values and cannot saturate.
+ * - The array functions evaluate many lookups per call and carry the search start from element to
+ *   element, so input trajectories profit from the cached search as well.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Interp.h"
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Position of an input within its axis. */
+typedef struct
+{
+    uint32 index;   /**< Segment, axis[index] .. axis[index + 1] */
+    sint32 width;   /**< axis[index + 1] - axis[index] */
+    sint32 offset;  /**< Input - axis[index], limited to 0..width */
+} FixedPoint_InterpPos_t;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static boolean FixedPoint_Interp_AxisValid(const t_Fixed16* axis, uint32 num);
+static uint32 FixedPoint_Interp_Bisect(const t_Fixed16* axis, uint32 first, uint32 last, t_Fixed16 x);
+static void FixedPoint_Interp_Search(const t_Fixed16* axis, uint32 num, t_Fixed16 x, uint32 start,
+                                     FixedPoint_InterpPos_t* pos);
+static t_Fixed16 FixedPoint_Interp_Divide(sint64 num, sint64 den);
+static t_Fixed16 FixedPoint_Interp_Curve(const FixedPoint_Curve16_t* curve, const FixedPoint_InterpPos_t* pos);
+static t_Fixed16 FixedPoint_Interp_Map(const FixedPoint_Map16_t* map, const FixedPoint_InterpPos_t* posX,
+                                       const FixedPoint_InterpPos_t* posY);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Check an axis.
+ *
+ *  @param[in]  axis    Sample points.
+ *  @param[in]  num     Number of sample points.
+ *
+ *  @return     TRUE if there are at least two sample points and they are strictly increasing.
+ */
+static boolean FixedPoint_Interp_AxisValid(const t_Fixed16* axis, uint32 num)
+{
+    boolean valid = ((axis != NULL) && (num >= 2U)) ? 1U : 0U;
+    uint32 i;
+
+    for (i = 1U; valid && (i < num); i++)
+    {
+        valid = (axis[i] > axis[i - 1U]) ? 1U : 0U;
+    }
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Binary search for the last sample point not above x.
+ *
+ *  @param[in]  axis    Sample points.
+ *  @param[in]  first   First candidate index.
+ *  @param[in]  last    Last candidate index (>= first).
+ *  @param[in]  x       Input.
+ *
+ *  @return     Largest index within first..last with axis[index] <= x, first if there is none.
+ */
+static uint32 FixedPoint_Interp_Bisect(const t_Fixed16* axis, uint32 first, uint32 last, t_Fixed16 x)
+{
+    uint32 base = first;
+    uint32 n = (last - first) + 1U;
+
+    /* Fixed number of halving steps; the selection compiles to a conditional move */
+    while (n > 1U)
+    {
+        const uint32 half = n / 2U;
+
+        base = (axis[base + half] <= x) ? (base + half) : base;
+        n -= half;
+    }
+
+    return base;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Find the segment of an input, starting at the segment of the previous input.
+ *
+ *  @param[in]  axis    Strictly increasing sample points.
+ *  @param[in]  num     Number of sample points (>= 2).
+ *  @param[in]  x       Input.
+ *  @param[in]  start   Segment of the previous input (any value).
+ *  @param[out] pos     Segment, width and limited offset of x.
+ */
+static void FixedPoint_Interp_Search(const t_Fixed16* axis, uint32 num, t_Fixed16 x, uint32 start,
+                                     FixedPoint_InterpPos_t* pos)
+{
+    const uint32 lastSegment = num - 2U;
+    uint32 i = (start < lastSegment) ? start : lastSegment;
+    sint32 offset;
+
+    if (x >= axis[i])
+    {
+        if ((i < lastSegment) && (x > axis[i + 1U]))
+        {
+            /* Next segment, else the segments above */
+            i = (x <= axis[i + 2U]) ? (i + 1U) : FixedPoint_Interp_Bisect(axis, i + 1U, lastSegment, x);
+        }
+    }
+    else if (i > 0U)
+    {
+        /* Previous segment, else the segments below */
+        i = (x >= axis[i - 1U]) ? (i - 1U) : FixedPoint_Interp_Bisect(axis, 0U, i - 1U, x);
+    }
+    else
+    {
+        /* Below the first sample point */
+    }
+
+    pos->index = i;
+    pos->width = (sint32)axis[i + 1U] - (sint32)axis[i];
+    offset = (sint32)x - (sint32)axis[i];
+
+    if (offset < 0)
+    {
+        offset = 0;
+    }
+    else if (offset > pos->width)
+    {
+        offset = pos->width;
+    }
+    else
+    {
+        /* Within the segment */
+    }
+
+    pos->offset = offset;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Divide with symmetric round-to-nearest (ties away from zero).
+ *
+ *  @param[in]  num     Numerator.
+ *  @param[in]  den     Denominator (> 0, below 2^32).
+ *
+ *  @return     Rounded num / den; the caller guarantees that it fits 16 bits.
+ */
+static t_Fixed16 FixedPoint_Interp_Divide(sint64 num, sint64 den)
+{
+    const uint64 mag = (num < 0) ? (uint64)(-num) : (uint64)num;
+    const uint64 q = ((2U * mag) + (uint64)den) / (2U * (uint64)den);
+
+    return (t_Fixed16)((num < 0) ? -(sint64)q : (sint64)q);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Linear interpolation of a curve at a found position.
+ *
+ *  @param[in]  curve   Curve.
+ *  @param[in]  pos     Position of the input on the axis.
+ *
+ *  @return     (v0 * (w - d) + v1 * d) / w, rounded once.
+ */
+static t_Fixed16 FixedPoint_Interp_Curve(const FixedPoint_Curve16_t* curve, const FixedPoint_InterpPos_t* pos)
+{
+    const t_Fixed16* v = &curve->values[pos->index];
+    const sint64 sum = ((sint64)v[0] * (sint64)(pos->width - pos->offset)) + ((sint64)v[1] * (sint64)pos->offset);
+
+    return FixedPoint_Interp_Divide(sum, (sint64)pos->width);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Bilinear interpolation of a map at found positions.
+ *
+ *  The inner sums along y are below 2^31 in magnitude (16-bit values, weights summing to less
+ *  than 2^16), the full sum below 2^47.
+ *
+ *  @param[in]  map     Map.
+ *  @param[in]  posX    Position of x on the x axis.
+ *  @param[in]  posY    Position of y on the y axis.
+ *
+ *  @return     sum(v_ij * wx_i * wy_j) / (wx * wy), rounded once.
+ */
+static t_Fixed16 FixedPoint_Interp_Map(const FixedPoint_Map16_t* map, const FixedPoint_InterpPos_t* posX,
+                                       const FixedPoint_InterpPos_t* posY)
+{
+    const t_Fixed16* v0 = &map->values[(posX->index * map->numY) + posY->index];
+    const t_Fixed16* v1 = &v0[map->numY];
+    const sint64 wy0 = (sint64)(posY->width - posY->offset);
+    const sint64 wy1 = (sint64)posY->offset;
+    const sint64 row0 = ((sint64)v0[0] * wy0) + ((sint64)v0[1] * wy1);
+    const sint64 row1 = ((sint64)v1[0] * wy0) + ((sint64)v1[1] * wy1);
+    const sint64 sum = (row0 * (sint64)(posX->width - posX->offset)) + (row1 * (sint64)posX->offset);
+
+    return FixedPoint_Interp_Divide(sum, (sint64)posX->width * (sint64)posY->width);
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up and check a characteristic curve.
+ *
+ *  The lookups rely on the checked axis; a curve that is set up statically (calibration data)
+ *  should be checked once with this function.
+ *
+ *  @param[out] curve   Curve.
+ *  @param[in]  axis    Strictly increasing sample points of x in configured 16-bit Q-format.
+ *  @param[in]  values  Curve values at the sample points in configured 16-bit Q-format.
+ *  @param[in]  num     Number of sample points (>= 2).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Curve ready.
+ *  @retval     E_NOT_OK    Null pointer, fewer than two sample points or axis not strictly increasing.
+ */
+Std_ReturnType FixedPoint_Curve16_Init(FixedPoint_Curve16_t* curve, const t_Fixed16* axis,
+                                       const t_Fixed16* values, uint32 num)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((curve != NULL) && (values != NULL) && FixedPoint_Interp_AxisValid(axis, num))
+    {
+        curve->axis = axis;
+        curve->values = values;
+        curve->num = num;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set up and check a characteristic map.
+ *
+ *  @param[out] map     Map.
+ *  @param[in]  axisX   Strictly increasing sample points of x in configured 16-bit Q-format.
+ *  @param[in]  numX    Number of sample points of x (>= 2).
+ *  @param[in]  axisY   Strictly increasing sample points of y in configured 16-bit Q-format.
+ *  @param[in]  numY    Number of sample points of y (>= 2).
+ *  @param[in]  values  numX * numY map values in configured 16-bit Q-format, values[ix * numY + iy].
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Map ready.
+ *  @retval     E_NOT_OK    Null pointer, fewer than two sample points or an axis not strictly increasing.
+ */
+Std_ReturnType FixedPoint_Map16_Init(FixedPoint_Map16_t* map, const t_Fixed16* axisX, uint32 numX,
+                                     const t_Fixed16* axisY, uint32 numY, const t_Fixed16* values)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((map != NULL) && (values != NULL) && FixedPoint_Interp_AxisValid(axisX, numX) &&
+        FixedPoint_Interp_AxisValid(axisY, numY))
+    {
+        map->axisX = axisX;
+        map->axisY = axisY;
+        map->values = values;
+        map->numX = numX;
+        map->numY = numY;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Linear interpolation of a characteristic curve.
+ *
+ *  Inputs beyond the axis give the first or last curve value.
+ *
+ *  @param[in]     curve    Curve set up with FixedPoint_Curve16_Init().
+ *  @param[in]     x        Input in configured 16-bit Q-format.
+ *  @param[in,out] segment  Segment of the previous lookup as search start (0 initially), the segment
+ *                          of x on return. NULL searches the whole axis.
+ *  @param[out]    r        Interpolated value in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Value interpolated.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Curve16(const FixedPoint_Curve16_t* curve, t_Fixed16 x, uint32* segment,
+                                  t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((curve != NULL) && (r != NULL))
+    {
+        FixedPoint_InterpPos_t pos;
+
+        if (segment != NULL)
+        {
+            FixedPoint_Interp_Search(curve->axis, curve->num, x, *segment, &pos);
+            *segment = pos.index;
+        }
+        else
+        {
+            pos.index = FixedPoint_Interp_Bisect(curve->axis, 0U, curve->num - 2U, x);
+            FixedPoint_Interp_Search(curve->axis, curve->num, x, pos.index, &pos);
+        }
+
+        *r = FixedPoint_Interp_Curve(curve, &pos);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Bilinear interpolation of a characteristic map.
+ *
+ *  Inputs beyond an axis are limited to the axis ends.
+ *
+ *  @param[in]     map      Map set up with FixedPoint_Map16_Init().
+ *  @param[in]     x        First input in configured 16-bit Q-format.
+ *  @param[in]     y        Second input in configured 16-bit Q-format.
+ *  @param[in,out] segX     Segment of x of the previous lookup (0 initially), the segment of x on return.
+ *                          NULL searches the whole axis.
+ *  @param[in,out] segY     Same for y.
+ *  @param[out]    r        Interpolated value in configured 16-bit Q-format.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Value interpolated.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Map16(const FixedPoint_Map16_t* map, t_Fixed16 x, t_Fixed16 y, uint32* segX,
+                                uint32* segY, t_Fixed16* r)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((map != NULL) && (r != NULL))
+    {
+        FixedPoint_InterpPos_t posX;
+        FixedPoint_InterpPos_t posY;
+        const uint32 startX = (segX != NULL) ? *segX :
+                              FixedPoint_Interp_Bisect(map->axisX, 0U, map->numX - 2U, x);
+        const uint32 startY = (segY != NULL) ? *segY :
+                              FixedPoint_Interp_Bisect(map->axisY, 0U, map->numY - 2U, y);
+
+        FixedPoint_Interp_Search(map->axisX, map->numX, x, startX, &posX);
+        FixedPoint_Interp_Search(map->axisY, map->numY, y, startY, &posY);
+
+        if (segX != NULL)
+        {
+            *segX = posX.index;
+        }
+        if (segY != NULL)
+        {
+            *segY = posY.index;
+        }
+
+        *r = FixedPoint_Interp_Map(map, &posX, &posY);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Linear interpolation of a characteristic curve for an array of inputs.
+ *
+ *  The search of each element starts at the segment of the previous element.
+ *
+ *  @param[in]  curve   Curve set up with FixedPoint_Curve16_Init().
+ *  @param[in]  x       Inputs in configured 16-bit Q-format.
+ *  @param[out] r       Interpolated values in configured 16-bit Q-format (may alias x).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Values interpolated.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Curve16_Array(const FixedPoint_Curve16_t* curve, const t_Fixed16* x,
+                                        t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Curve16_Array");
+
+    if ((curve != NULL) && (x != NULL) && (r != NULL))
+    {
+        FixedPoint_InterpPos_t pos;
+        uint32 i;
+
+        pos.index = 0U;
+
+        for (i = 0U; i < len; i++)
+        {
+            FixedPoint_Interp_Search(curve->axis, curve->num, x[i], pos.index, &pos);
+            r[i] = FixedPoint_Interp_Curve(curve, &pos);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("Curve16_Array");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Bilinear interpolation of a characteristic map for arrays of input pairs.
+ *
+ *  The searches of each element start at the segments of the previous element.
+ *
+ *  @param[in]  map     Map set up with FixedPoint_Map16_Init().
+ *  @param[in]  x       First inputs in configured 16-bit Q-format.
+ *  @param[in]  y       Second inputs in configured 16-bit Q-format.
+ *  @param[out] r       Interpolated values in configured 16-bit Q-format (may alias x or y).
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Values interpolated.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Map16_Array(const FixedPoint_Map16_t* map, const t_Fixed16* x,
+                                      const t_Fixed16* y, t_Fixed16* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Map16_Array");
+
+    if ((map != NULL) && (x != NULL) && (y != NULL) && (r != NULL))
+    {
+        FixedPoint_InterpPos_t posX;
+        FixedPoint_InterpPos_t posY;
+        uint32 i;
+
+        posX.index = 0U;
+        posY.index = 0U;
+
+        for (i = 0U; i < len; i++)
+        {
+            FixedPoint_Interp_Search(map->axisX, map->numX, x[i], posX.index, &posX);
+            FixedPoint_Interp_Search(map->axisY, map->numY, y[i], posY.index, &posY);
+            r[i] = FixedPoint_Interp_Map(map, &posX, &posY);
+        }
+
+        ret = E_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("Map16_Array");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
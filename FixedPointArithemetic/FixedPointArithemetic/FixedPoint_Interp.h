@@ -0,0 +1,80 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Interp.h
+
+@brief      Interface for the 16-bit curve (1D) and map (2D) interpolation.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_INTERP_H
+#define FIXED_POINT_INTERP_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Characteristic curve y = f(x) on a strictly increasing axis. */
+typedef struct
+{
+    const t_Fixed16* axis;      /**< Sample points of x, num values */
+    const t_Fixed16* values;    /**< Curve values at the sample points, num values */
+    uint32           num;       /**< Number of sample points (>= 2) */
+} FixedPoint_Curve16_t;
+
+/** @brief   Characteristic map z = f(x, y) on two strictly increasing axes. */
+typedef struct
+{
+    const t_Fixed16* axisX;     /**< Sample points of x, numX values */
+    const t_Fixed16* axisY;     /**< Sample points of y, numY values */
+    const t_Fixed16* values;    /**< Map values, values[ix * numY + iy] belongs to (axisX[ix], axisY[iy]) */
+    uint32           numX;      /**< Number of sample points of x (>= 2) */
+    uint32           numY;      /**< Number of sample points of y (>= 2) */
+} FixedPoint_Map16_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Curve16_Init(FixedPoint_Curve16_t* curve, const t_Fixed16* axis,
+                                              const t_Fixed16* values, uint32 num);
+extern Std_ReturnType FixedPoint_Map16_Init(FixedPoint_Map16_t* map, const t_Fixed16* axisX, uint32 numX,
+                                            const t_Fixed16* axisY, uint32 numY, const t_Fixed16* values);
+extern Std_ReturnType FixedPoint_Curve16(const FixedPoint_Curve16_t* curve, t_Fixed16 x, uint32* segment,
+                                         t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Map16(const FixedPoint_Map16_t* map, t_Fixed16 x, t_Fixed16 y, uint32* segX,
+                                       uint32* segY, t_Fixed16* r);
+extern Std_ReturnType FixedPoint_Curve16_Array(const FixedPoint_Curve16_t* curve, const t_Fixed16* x,
+                                               t_Fixed16* r, uint32 len);
+extern Std_ReturnType FixedPoint_Map16_Array(const FixedPoint_Map16_t* map, const t_Fixed16* x,
+                                             const t_Fixed16* y, t_Fixed16* r, uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_INTERP_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
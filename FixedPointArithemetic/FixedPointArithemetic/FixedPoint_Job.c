@@ -0,0 +1,609 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Job.c
+
+@brief      Asynchronous submission of fixed-point batch jobs with completion polling.
+ *
+ * Detailed Description:
+ * - The application submits job descriptions (conversion, element-wise operation, FIR, dot product)
+ *   and receives a handle. Submission only stores the description and never blocks.
+ * - Jobs are executed by FixedPoint_Job_Process(), called from any processing context: a worker
+ *   thread of the application, an idle hook or the event loop itself between events.
+ * - Completion is observed by polling the handle, by waiting (the waiting context helps processing
+ *   until the job is done) or by a callback called from the processing context.
+ * - Consecutive pending jobs of the same element-wise kind whose buffers are adjacent in memory are
+ *   coalesced into one kernel call. Every job of a coalesced group reports the status of the group,
+ *   so one saturating element fails all members. The members are not executed again, which would
+ *   count their saturations twice in the metrics, probes and saturation log. A job that needs its
+ *   own status is submitted with buffers not adjacent to its neighbours. Jobs whose output overlaps
+ *   an input (in place) are never coalesced.
+ * - The queue needs no lock. A submitter claims a free slot and a FIFO entry with
+ *   FIXEDPOINT_ATOMIC_FETCH_ADD() and publishes the entry after the slot. One processing context at
+ *   a time takes jobs from the FIFO, selected with the same atomic increment; the others return
+ *   without jobs and try again later. The kernels run after the jobs have been taken, so several
+ *   contexts execute jobs in parallel.
+ * - FixedPoint_Job_Wait() backs off with FIXEDPOINT_JOB_YIELD() while the job is executed by
+ *   another context, doubling the pause up to FIXEDPOINT_JOB_BACKOFF_MAX.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Added trace points around job execution.
+01.02.00  2026-10-18  AGT    In-place jobs no longer coalesced (status recomputation ran them twice).
+01.03.00  2026-10-18  AGT    Lock-free claims with atomic increments, back-off of the wait, group status.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Job.h"
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of handle bits used for the slot index. */
+#define FIXEDPOINT_JOB_SLOT_BITS    (8U)
+
+/** @brief Mask of the slot index within a handle. */
+#define FIXEDPOINT_JOB_SLOT_MASK    ((1UL << FIXEDPOINT_JOB_SLOT_BITS) - 1UL)
+
+/** @brief Mask of the generation within a handle (after shifting out the slot index). */
+#define FIXEDPOINT_JOB_GEN_MASK     (0x00FFFFFFUL)
+
+/** @brief Mask of the FIFO index within a free-running FIFO position. */
+#define FIXEDPOINT_JOB_FIFO_MASK    (FIXEDPOINT_JOB_QUEUE_SIZE - 1U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static boolean FixedPoint_Job_IsValidDesc(const FixedPoint_JobDesc_t* desc);
+static boolean FixedPoint_Job_Overlaps(const void* a, uint32 aBytes, const void* b, uint32 bBytes);
+static boolean FixedPoint_Job_CanCoalesce(const FixedPoint_JobDesc_t* merged, const FixedPoint_JobDesc_t* next);
+static Std_ReturnType FixedPoint_Job_Execute(const FixedPoint_JobDesc_t* desc);
+static FixedPoint_JobSlot_t* FixedPoint_Job_Lookup(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Check that a job description has all buffers required by its kind.
+ *
+ *  @param[in]  desc    Job description.
+ *
+ *  @return     boolean
+ *  @retval     1U      Description valid.
+ *  @retval     0U      Missing buffer, missing filter state or unknown kind.
+ */
+static boolean FixedPoint_Job_IsValidDesc(const FixedPoint_JobDesc_t* desc)
+{
+    boolean valid = 0U;
+
+    if ((desc->in1 != NULL) && (desc->out != NULL))
+    {
+        switch (desc->kind)
+        {
+        case FIXEDPOINT_JOB_OP16:
+        case FIXEDPOINT_JOB_DOT16:
+            valid = (desc->in2 != NULL) ? 1U : 0U;
+            break;
+        case FIXEDPOINT_JOB_TO_FIX16:
+        case FIXEDPOINT_JOB_TO_FLOAT:
+            valid = 1U;
+            break;
+        case FIXEDPOINT_JOB_FIR16:
+            valid = (desc->fir != NULL) ? 1U : 0U;
+            break;
+        default:
+            valid = 0U;
+            break;
+        }
+    }
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether two buffers share memory.
+ *
+ *  @param[in]  a       First buffer (may be NULL).
+ *  @param[in]  aBytes  Size of the first buffer in bytes.
+ *  @param[in]  b       Second buffer (may be NULL).
+ *  @param[in]  bBytes  Size of the second buffer in bytes.
+ *
+ *  @return     boolean
+ *  @retval     1U      The buffers overlap.
+ *  @retval     0U      Disjoint buffers or a NULL buffer.
+ */
+static boolean FixedPoint_Job_Overlaps(const void* a, uint32 aBytes, const void* b, uint32 bBytes)
+{
+    const uint8* pa = (const uint8*)a;
+    const uint8* pb = (const uint8*)b;
+
+    return ((pa != NULL) && (pb != NULL) && (pa < (pb + bBytes)) && (pb < (pa + aBytes))) ? 1U : 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether a pending job continues the (merged) job before it in memory.
+ *
+ *  Only element-wise kinds are coalesced. FIR jobs carry filter state and dot products reduce to
+ *  a single value, so both are always executed on their own. A group whose output overlaps one of
+ *  its inputs is not extended: the merged call must give the results of the members executed one
+ *  after the other, which is not ensured once results of one member are inputs of another.
+ *
+ *  @param[in]  merged  Job (or merged group of jobs) taken so far.
+ *  @param[in]  next    Next pending job.
+ *
+ *  @return     boolean
+ *  @retval     1U      next can be appended to merged.
+ *  @retval     0U      Different kind or operation, buffers not adjacent or output overlapping an input.
+ */
+static boolean FixedPoint_Job_CanCoalesce(const FixedPoint_JobDesc_t* merged, const FixedPoint_JobDesc_t* next)
+{
+    boolean adjacent = 0U;
+
+    if (merged->kind == next->kind)
+    {
+        switch (merged->kind)
+        {
+        case FIXEDPOINT_JOB_OP16:
+            adjacent = ((merged->op == next->op) &&
+                        (((const t_Fixed16*)merged->in1 + merged->len) == (const t_Fixed16*)next->in1) &&
+                        (((const t_Fixed16*)merged->in2 + merged->len) == (const t_Fixed16*)next->in2) &&
+                        (((t_Fixed16*)merged->out + merged->len) == (t_Fixed16*)next->out)) ? 1U : 0U;
+            break;
+        case FIXEDPOINT_JOB_TO_FIX16:
+            adjacent = ((((const float*)merged->in1 + merged->len) == (const float*)next->in1) &&
+                        (((t_Fixed16*)merged->out + merged->len) == (t_Fixed16*)next->out)) ? 1U : 0U;
+            break;
+        case FIXEDPOINT_JOB_TO_FLOAT:
+            adjacent = ((((const t_Fixed16*)merged->in1 + merged->len) == (const t_Fixed16*)next->in1) &&
+                        (((float*)merged->out + merged->len) == (float*)next->out)) ? 1U : 0U;
+            break;
+        default:
+            adjacent = 0U;
+            break;
+        }
+    }
+
+    if (adjacent != 0U)
+    {
+        /* Ranges of the extended group; element sizes per kind */
+        const uint32 len = merged->len + next->len;
+        const uint32 inSize = (merged->kind == FIXEDPOINT_JOB_TO_FIX16) ? (uint32)sizeof(float)
+                                                                         : (uint32)sizeof(t_Fixed16);
+        const uint32 outSize = (merged->kind == FIXEDPOINT_JOB_TO_FLOAT) ? (uint32)sizeof(float)
+                                                                          : (uint32)sizeof(t_Fixed16);
+
+        if ((FixedPoint_Job_Overlaps(merged->out, len * outSize, merged->in1, len * inSize) != 0U) ||
+            ((merged->kind == FIXEDPOINT_JOB_OP16) &&
+             (FixedPoint_Job_Overlaps(merged->out, len * outSize, merged->in2, len * inSize) != 0U)))
+        {
+            adjacent = 0U;
+        }
+    }
+
+    return adjacent;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Execute a job with the matching batch kernel.
+ *
+ *  @param[in]  desc    Job description.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Kernel finished without saturation.
+ *  @retval     E_NOT_OK    Kernel reported saturation, division by zero or an invalid argument.
+ */
+static Std_ReturnType FixedPoint_Job_Execute(const FixedPoint_JobDesc_t* desc)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Job_Execute");
+
+    switch (desc->kind)
+    {
+    case FIXEDPOINT_JOB_OP16:
+        ret = FixedPoint_Op16_Strided(desc->op, (const t_Fixed16*)desc->in1, 1, (const t_Fixed16*)desc->in2, 1,
+                                      (t_Fixed16*)desc->out, 1, desc->len);
+        break;
+    case FIXEDPOINT_JOB_TO_FIX16:
+        ret = FixedPoint_FloatToFix16_Array((const float*)desc->in1, (t_Fixed16*)desc->out, desc->len);
+        break;
+    case FIXEDPOINT_JOB_TO_FLOAT:
+        ret = FixedPoint_Fix16ToFloat_Array((const t_Fixed16*)desc->in1, (float*)desc->out, desc->len);
+        break;
+    case FIXEDPOINT_JOB_FIR16:
+        ret = FixedPoint_Fir16(desc->fir, (const t_Fixed16*)desc->in1, (t_Fixed16*)desc->out, desc->len);
+        break;
+    case FIXEDPOINT_JOB_DOT16:
+        ret = FixedPoint_Dot16((const t_Fixed16*)desc->in1, (const t_Fixed16*)desc->in2, desc->len, (t_Fixed16*)desc->out);
+        break;
+    default:
+        ret = E_NOT_OK;
+        break;
+    }
+
+    FIXEDPOINT_TRACE_END("Job_Execute");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Resolve a handle to its slot.
+ *
+ *  @param[in]  queue   Job queue.
+ *  @param[in]  handle  Job handle.
+ *
+ *  @return     FixedPoint_JobSlot_t*
+ *  @retval     Slot of the job, or NULL if the handle is invalid or outdated.
+ */
+static FixedPoint_JobSlot_t* FixedPoint_Job_Lookup(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle)
+{
+    FixedPoint_JobSlot_t* slot = NULL;
+    const uint32 index = (uint32)(handle & FIXEDPOINT_JOB_SLOT_MASK);
+    const uint32 generation = (uint32)((handle >> FIXEDPOINT_JOB_SLOT_BITS) & FIXEDPOINT_JOB_GEN_MASK);
+
+    if ((index < FIXEDPOINT_JOB_QUEUE_SIZE) &&
+        (queue->slots[index].state != FIXEDPOINT_JOB_STATE_FREE) &&
+        (queue->slots[index].generation == generation))
+    {
+        slot = &queue->slots[index];
+    }
+
+    return slot;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise an empty job queue.
+ *
+ *  @param[out] queue   Job queue.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Queue initialised.
+ *  @retval     E_NOT_OK    Null pointer passed.
+ */
+Std_ReturnType FixedPoint_Job_Init(FixedPoint_JobQueue_t* queue)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (queue != NULL)
+    {
+        uint32 i;
+
+        for (i = 0U; i < FIXEDPOINT_JOB_QUEUE_SIZE; i++)
+        {
+            queue->slots[i].state = FIXEDPOINT_JOB_STATE_FREE;
+            queue->slots[i].generation = 0U;
+            queue->slots[i].status = E_NOT_OK;
+            queue->slots[i].claim = 0U;
+            queue->pending[i] = 0U;
+        }
+
+        queue->head = 0U;
+        queue->tail = 0U;
+        queue->taking = 0U;
+        queue->coalesced = 0U;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Submit a job for asynchronous execution.
+ *
+ *  The description is copied, the buffers it refers to must stay valid until completion.
+ *  Jobs are executed in the order of their FIFO entries. The slot is claimed by incrementing its
+ *  claim counter from 0, so concurrent submitters never share a slot. At most
+ *  FIXEDPOINT_JOB_QUEUE_SIZE jobs hold a slot, so the FIFO entry of the ticket is always free.
+ *
+ *  @param[in,out]  queue   Job queue.
+ *  @param[in]      desc    Job description.
+ *  @param[out]     handle  Handle to poll or wait for the job.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Job queued.
+ *  @retval     E_NOT_OK    Null pointer, invalid description or no free slot.
+ */
+Std_ReturnType FixedPoint_Job_Submit(FixedPoint_JobQueue_t* queue, const FixedPoint_JobDesc_t* desc,
+                                     FixedPoint_JobHandle_t* handle)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((queue != NULL) && (desc != NULL) && (handle != NULL) && (FixedPoint_Job_IsValidDesc(desc) != 0U))
+    {
+        uint32 i;
+
+        for (i = 0U; i < FIXEDPOINT_JOB_QUEUE_SIZE; i++)
+        {
+            FixedPoint_JobSlot_t* slot = &queue->slots[i];
+
+            /* The plain read skips taken slots without the atomic operation */
+            if ((slot->claim == 0U) && (FIXEDPOINT_ATOMIC_FETCH_ADD(&slot->claim, 1U) == 0U))
+            {
+                uint32 ticket;
+
+                /* Generation 0 is never used, so a valid handle is never FIXEDPOINT_JOB_INVALID_HANDLE */
+                slot->generation = (slot->generation + 1U) & FIXEDPOINT_JOB_GEN_MASK;
+                if (slot->generation == 0U)
+                {
+                    slot->generation = 1U;
+                }
+
+                slot->desc = *desc;
+                slot->status = E_NOT_OK;
+                slot->state = FIXEDPOINT_JOB_STATE_PENDING;
+                *handle = (FixedPoint_JobHandle_t)((slot->generation << FIXEDPOINT_JOB_SLOT_BITS) | i);
+
+                /* Slot complete before its FIFO entry becomes visible to the processing contexts */
+                ticket = FIXEDPOINT_ATOMIC_FETCH_ADD(&queue->tail, 1U);
+                FIXEDPOINT_MEMORY_BARRIER();
+                queue->pending[ticket & FIXEDPOINT_JOB_FIFO_MASK] = (uint16)(i + 1U);
+
+                ret = E_OK;
+                break;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Execute pending jobs in submission order.
+ *
+ *  Takes the oldest pending job and appends following jobs that can be coalesced with it
+ *  (up to FIXEDPOINT_JOB_COALESCE_MAX), executes them with one kernel call and completes them with
+ *  the status of that call. Callbacks are called after the job slot has been released, so a
+ *  callback may submit new jobs. Can be called from several processing contexts: a call that finds
+ *  another context taking jobs at the same moment returns, with fewer jobs processed than pending.
+ *
+ *  @param[in,out]  queue       Job queue.
+ *  @param[in]      maxJobs     Maximum number of jobs to complete in this call.
+ *  @param[out]     processed   Optional pointer to store the number of completed jobs (may be NULL).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Processing done (jobs report their own status).
+ *  @retval     E_NOT_OK    Null pointer passed.
+ */
+Std_ReturnType FixedPoint_Job_Process(FixedPoint_JobQueue_t* queue, uint32 maxJobs, uint32* processed)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (queue != NULL)
+    {
+        uint32 done = 0U;
+        boolean idle = 0U;
+
+        while ((done < maxJobs) && (idle == 0U))
+        {
+            uint16 group[FIXEDPOINT_JOB_COALESCE_MAX];
+            FixedPoint_JobDesc_t merged;
+            uint32 n = 0U;
+            uint32 i;
+            Std_ReturnType status;
+
+            /* Only the context that increments the flag from 0 takes jobs */
+            if (FIXEDPOINT_ATOMIC_FETCH_ADD(&queue->taking, 1U) == 0U)
+            {
+                uint32 entry = queue->pending[queue->head & FIXEDPOINT_JOB_FIFO_MASK];
+
+                /* Take the oldest published job and coalesce adjacent followers */
+                if (entry != 0U)
+                {
+                    /* Slots read after the entries that published them */
+                    FIXEDPOINT_MEMORY_BARRIER();
+                    group[0] = (uint16)(entry - 1U);
+                    merged = queue->slots[group[0]].desc;
+                    n = 1U;
+                    entry = queue->pending[(queue->head + 1U) & FIXEDPOINT_JOB_FIFO_MASK];
+
+                    while ((entry != 0U) && (n < FIXEDPOINT_JOB_COALESCE_MAX) && ((done + n) < maxJobs))
+                    {
+                        FIXEDPOINT_MEMORY_BARRIER();
+
+                        if (FixedPoint_Job_CanCoalesce(&merged, &queue->slots[entry - 1U].desc) != 0U)
+                        {
+                            group[n] = (uint16)(entry - 1U);
+                            merged.len += queue->slots[group[n]].desc.len;
+                            n++;
+                            entry = queue->pending[(queue->head + n) & FIXEDPOINT_JOB_FIFO_MASK];
+                        }
+                        else
+                        {
+                            entry = 0U;
+                        }
+                    }
+
+                    for (i = 0U; i < n; i++)
+                    {
+                        queue->slots[group[i]].state = FIXEDPOINT_JOB_STATE_RUNNING;
+                        queue->pending[(queue->head + i) & FIXEDPOINT_JOB_FIFO_MASK] = 0U;
+                    }
+
+                    queue->head += n;
+                    queue->coalesced += n - 1U;
+                }
+
+                FIXEDPOINT_MEMORY_BARRIER();
+                queue->taking = 0U;
+            }
+
+            if (n > 0U)
+            {
+                status = FixedPoint_Job_Execute(&merged);
+
+                for (i = 0U; i < n; i++)
+                {
+                    FixedPoint_JobSlot_t* slot = &queue->slots[group[i]];
+                    FixedPoint_JobCallback_t callback = slot->desc.callback;
+                    void* context = slot->desc.context;
+                    const FixedPoint_JobHandle_t handle =
+                        (FixedPoint_JobHandle_t)((slot->generation << FIXEDPOINT_JOB_SLOT_BITS) | group[i]);
+
+                    /* Status and results complete before the job is reported done */
+                    slot->status = status;
+                    FIXEDPOINT_MEMORY_BARRIER();
+
+                    if (callback != NULL)
+                    {
+                        slot->state = FIXEDPOINT_JOB_STATE_FREE;
+                        FIXEDPOINT_MEMORY_BARRIER();
+                        slot->claim = 0U;
+                        callback(handle, status, context);
+                    }
+                    else
+                    {
+                        slot->state = FIXEDPOINT_JOB_STATE_DONE;
+                    }
+                }
+
+                done += n;
+            }
+            else
+            {
+                idle = 1U;
+            }
+        }
+
+        if (processed != NULL)
+        {
+            *processed = done;
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether a job has completed, without blocking.
+ *
+ *  When the job is done, its status is returned and the handle is released (becomes invalid).
+ *  Jobs submitted with a callback are released by the processing context and cannot be polled.
+ *  A handle must be polled or waited for by one context at a time.
+ *
+ *  @param[in,out]  queue       Job queue.
+ *  @param[in]      handle      Job handle.
+ *  @param[out]     done        Pointer to store whether the job has completed.
+ *  @param[out]     jobStatus   Pointer to store the job status (written only if done).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Handle valid, *done reports completion.
+ *  @retval     E_NOT_OK    Null pointer or invalid / released handle.
+ */
+Std_ReturnType FixedPoint_Job_Poll(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle, boolean* done,
+                                   Std_ReturnType* jobStatus)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((queue != NULL) && (done != NULL) && (jobStatus != NULL))
+    {
+        FixedPoint_JobSlot_t* slot = FixedPoint_Job_Lookup(queue, handle);
+
+        if (slot != NULL)
+        {
+            if (slot->state == FIXEDPOINT_JOB_STATE_DONE)
+            {
+                /* Status read after the state that published it */
+                FIXEDPOINT_MEMORY_BARRIER();
+                *jobStatus = slot->status;
+                *done = 1U;
+                slot->state = FIXEDPOINT_JOB_STATE_FREE;
+
+                /* Slot released for the next submitter */
+                FIXEDPOINT_MEMORY_BARRIER();
+                slot->claim = 0U;
+            }
+            else
+            {
+                *done = 0U;
+            }
+
+            ret = E_OK;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Wait for completion of a job.
+ *
+ *  The calling context helps processing pending jobs until the job is done, so waiting also
+ *  works without a separate worker. While the job is executed by another context, the wait backs
+ *  off with FIXEDPOINT_JOB_YIELD(), doubling the pause up to FIXEDPOINT_JOB_BACKOFF_MAX calls.
+ *  The handle is released on return.
+ *
+ *  @param[in,out]  queue       Job queue.
+ *  @param[in]      handle      Job handle (not a callback job).
+ *  @param[out]     jobStatus   Pointer to store the job status.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Job completed, *jobStatus valid.
+ *  @retval     E_NOT_OK    Null pointer or invalid / released handle.
+ */
+Std_ReturnType FixedPoint_Job_Wait(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle, Std_ReturnType* jobStatus)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    boolean done = 0U;
+    uint32 backoff = 1U;
+
+    while ((FixedPoint_Job_Poll(queue, handle, &done, jobStatus) == E_OK) && (done == 0U))
+    {
+        uint32 processed = 0U;
+
+        (void)FixedPoint_Job_Process(queue, 1U, &processed);
+
+        if (processed == 0U)
+        {
+            uint32 i;
+
+            for (i = 0U; i < backoff; i++)
+            {
+                FIXEDPOINT_JOB_YIELD();
+            }
+
+            backoff = (backoff < FIXEDPOINT_JOB_BACKOFF_MAX) ? (backoff * 2U) : FIXEDPOINT_JOB_BACKOFF_MAX;
+        }
+        else
+        {
+            backoff = 1U;
+        }
+    }
+
+    if (done != 0U)
+    {
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,126 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Job.h
+
+@brief      Interface for asynchronous submission of fixed-point batch jobs.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Slots and FIFO entries claimed with atomic increments.
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_JOB_H
+#define FIXED_POINT_JOB_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Handle value that never refers to a job. */
+#define FIXEDPOINT_JOB_INVALID_HANDLE   ((FixedPoint_JobHandle_t)0U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Handle of a submitted job (slot index and generation). */
+typedef uint32 FixedPoint_JobHandle_t;
+
+/** @brief   Kind of batch job. */
+typedef enum
+{
+    FIXEDPOINT_JOB_OP16 = 0,    /**< out[i] = in1[i] (op) in2[i], FixedPoint_Op16_Strided() */
+    FIXEDPOINT_JOB_TO_FIX16,    /**< float in1[i] to t_Fixed16 out[i], FixedPoint_FloatToFix16_Array() */
+    FIXEDPOINT_JOB_TO_FLOAT,    /**< t_Fixed16 in1[i] to float out[i], FixedPoint_Fix16ToFloat_Array() */
+    FIXEDPOINT_JOB_FIR16,       /**< FIR filter of in1 into out, FixedPoint_Fir16() */
+    FIXEDPOINT_JOB_DOT16        /**< Dot product of in1 and in2 into out[0], FixedPoint_Dot16() */
+} FixedPoint_JobKind_t;
+
+/** @brief   State of a job slot. */
+typedef enum
+{
+    FIXEDPOINT_JOB_STATE_FREE = 0,  /**< Slot not used */
+    FIXEDPOINT_JOB_STATE_PENDING,   /**< Submitted, waiting for processing */
+    FIXEDPOINT_JOB_STATE_RUNNING,   /**< Taken by a processing context */
+    FIXEDPOINT_JOB_STATE_DONE       /**< Completed, status not yet collected */
+} FixedPoint_JobState_t;
+
+/** @brief   Completion callback, called in the processing context after the job finished. */
+typedef void (*FixedPoint_JobCallback_t)(FixedPoint_JobHandle_t handle, Std_ReturnType status, void* context);
+
+/** @brief   Description of a batch job. The buffers must stay valid until the job has completed. */
+typedef struct
+{
+    FixedPoint_JobKind_t     kind;      /**< Kind of job */
+    FixedPoint_Operation_t   op;        /**< Operation (FIXEDPOINT_JOB_OP16 only) */
+    const void*              in1;       /**< First input buffer (float for TO_FIX16, t_Fixed16 otherwise) */
+    const void*              in2;       /**< Second input buffer (OP16 and DOT16 only) */
+    void*                    out;       /**< Output buffer (float for TO_FLOAT, t_Fixed16 otherwise) */
+    uint32                   len;       /**< Number of input elements */
+    FixedPoint_Fir16_t*      fir;       /**< Filter state (FIR16 only) */
+    FixedPoint_JobCallback_t callback;  /**< Optional completion callback (NULL = collect with poll/wait) */
+    void*                    context;   /**< Application context passed to the callback */
+} FixedPoint_JobDesc_t;
+
+/** @brief   Job slot of the queue. */
+typedef struct
+{
+    FixedPoint_JobDesc_t           desc;        /**< Job description */
+    uint32                         generation;  /**< Incremented on each submission to the slot */
+    volatile FixedPoint_JobState_t state;       /**< Slot state */
+    Std_ReturnType                 status;      /**< Job result status (valid in state DONE) */
+    volatile uint32                claim;       /**< 0 = free, taken by the submitter that increments it from 0 */
+} FixedPoint_JobSlot_t;
+
+/** @brief   Job queue: fixed slot table and FIFO of pending slots. */
+typedef struct
+{
+    FixedPoint_JobSlot_t slots[FIXEDPOINT_JOB_QUEUE_SIZE];      /**< Job slots */
+    volatile uint16      pending[FIXEDPOINT_JOB_QUEUE_SIZE];    /**< FIFO of pending slot indices + 1, 0 = empty */
+    uint32               head;                                  /**< FIFO read position (free-running) */
+    volatile uint32      tail;                                  /**< FIFO write tickets handed out (free-running) */
+    volatile uint32      taking;                                /**< 0 = no context is taking jobs from the FIFO */
+    uint32               coalesced;                             /**< Jobs merged into a preceding job (statistic) */
+} FixedPoint_JobQueue_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Job_Init(FixedPoint_JobQueue_t* queue);
+extern Std_ReturnType FixedPoint_Job_Submit(FixedPoint_JobQueue_t* queue, const FixedPoint_JobDesc_t* desc,
+                                            FixedPoint_JobHandle_t* handle);
+extern Std_ReturnType FixedPoint_Job_Process(FixedPoint_JobQueue_t* queue, uint32 maxJobs, uint32* processed);
+extern Std_ReturnType FixedPoint_Job_Poll(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle, boolean* done,
+                                          Std_ReturnType* jobStatus);
+extern Std_ReturnType FixedPoint_Job_Wait(FixedPoint_JobQueue_t* queue, FixedPoint_JobHandle_t handle,
+                                          Std_ReturnType* jobStatus);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_JOB_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,941 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Layout.c
+
+@brief      Layout transform kernels (channel interleave/deinterleave, matrix transpose).
+ *
+ * Detailed Description:
+ * - Interleaved multi-channel frames (array of structures) are split into one array per channel
+ *   (structure of arrays) with FixedPoint_Deinterleave16() and merged back with
+ *   FixedPoint_Interleave16(), for 2 to 16 channels.
+ * - FixedPoint_Transpose16() and FixedPoint_Transpose8() transpose row-major matrices.
+ * - All kernels move 8 x 8 element tiles. A full tile is transposed in registers with SSE2
+ *   unpack instructions; 2 and 4 channels use dedicated SSE2 shuffles per block of 8 frames.
+ *   Partial tiles at the edges and matrix transposes without SSE2 use the portable C tile.
+ * - Deinterleave and interleave of the other channel counts below 8 (3, 5, 6, 7) fill only a
+ *   partial tile per block, which is slower than a plain strided copy per channel; they use the
+ *   plain copy, as do all channel counts without SSE2.
+ * - The matrix transposes visit the tiles in Z-order (Morton order) within squares of a power of
+ *   2 tiles, so that source and destination stay cache friendly for any cache size without a
+ *   tuned block size and without recursion.
+ * - Every kernel can convert the Q-format in the same pass: shift > 0 adds fractional bits with
+ *   saturation, shift < 0 removes fractional bits with symmetric round-to-nearest (ties away from
+ *   zero), as the arithmetic cores. The conversion is applied to each destination tile while it
+ *   is still in L1.
+ * - Source and destination must not overlap.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Plain copy for channel counts without a dedicated shuffle below the tile edge.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Layout.h"
+#include "FixedPoint_Probe.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 unpack and pack intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Edge length of a tile in elements. */
+#define FIXEDPOINT_LAYOUT_TILE      (8U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Z-order traversal of the tiles of a matrix. */
+typedef struct
+{
+    uint32 tileRows;    /**< Number of tile rows */
+    uint32 tileCols;    /**< Number of tile columns */
+    uint32 side;        /**< Edge of the Z-order squares in tiles (power of 2) */
+    uint32 count;       /**< Number of Z-order codes over all squares */
+} FixedPoint_LayoutOrder_t;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static boolean FixedPoint_Layout_ShiftValid(sint32 shift, uint32 fracBits);
+static Std_ReturnType FixedPoint_Layout_Rescale16(t_Fixed16* x, uint32 len, sint32 shift);
+static Std_ReturnType FixedPoint_Layout_Rescale8(t_Fixed8* x, uint32 len, sint32 shift);
+static void FixedPoint_Layout_Tile16(const t_Fixed16* const src[], t_Fixed16* const dst[], uint32 rows, uint32 cols);
+static void FixedPoint_Layout_Tile8(const t_Fixed8* const src[], t_Fixed8* const dst[], uint32 rows, uint32 cols);
+static boolean FixedPoint_Layout_Deinterleave16_Block(const t_Fixed16* frame, uint32 channels, t_Fixed16* const out[],
+                                                      uint32 offset);
+static boolean FixedPoint_Layout_Interleave16_Block(const t_Fixed16* const in[], uint32 channels, uint32 offset,
+                                                    t_Fixed16* frame);
+static uint32 FixedPoint_Layout_Compact(uint32 code);
+static void FixedPoint_Layout_OrderInit(FixedPoint_LayoutOrder_t* order, uint32 rows, uint32 cols);
+static boolean FixedPoint_Layout_OrderTile(const FixedPoint_LayoutOrder_t* order, uint32 index, uint32* row,
+                                           uint32* col);
+#if (FIXEDPOINT_SSE2 == 1U)
+static __m128i FixedPoint_Layout_Even16(__m128i lo, __m128i hi);
+static __m128i FixedPoint_Layout_Odd16(__m128i lo, __m128i hi);
+#endif
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Check the Q-format shift of a layout kernel.
+ *
+ *  @param[in]  shift       Fractional bits to add (> 0) or remove (< 0).
+ *  @param[in]  fracBits    Largest shift of the container (15 for 16-bit, 7 for 8-bit).
+ *
+ *  @return     boolean
+ *  @retval     1       Shift within -fracBits .. fracBits.
+ *  @retval     0       Shift out of range.
+ */
+static boolean FixedPoint_Layout_ShiftValid(sint32 shift, uint32 fracBits)
+{
+    return ((shift >= -(sint32)fracBits) && (shift <= (sint32)fracBits)) ? 1U : 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Convert 16-bit values in place to another Q-format.
+ *
+ *  @param[in,out]  x       Values to convert.
+ *  @param[in]      len     Number of values.
+ *  @param[in]      shift   Fractional bits to add with saturation (> 0) or remove with rounding (< 0).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All values converted without saturation.
+ *  @retval     E_NOT_OK    Saturation of at least one value.
+ */
+static Std_ReturnType FixedPoint_Layout_Rescale16(t_Fixed16* x, uint32 len, sint32 shift)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 i;
+
+    if (shift > 0)
+    {
+        const sint32 scale = (sint32)1 << shift;
+        const sint32 limitHi = (sint32)FIX16_MAX / scale;
+        const sint32 limitLo = (sint32)FIX16_MIN / scale;
+
+        for (i = 0U; i < len; i++)
+        {
+            const sint32 v = (sint32)x[i];
+
+            if (v > limitHi)
+            {
+                FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 16, v, shift, FIX16_MAX);
+                x[i] = FIX16_MAX;
+                ret = E_NOT_OK;
+            }
+            else if (v < limitLo)
+            {
+                FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 16, v, shift, FIX16_MIN);
+                x[i] = FIX16_MIN;
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                x[i] = (t_Fixed16)(v * scale);
+            }
+        }
+    }
+    else if (shift < 0)
+    {
+        const sint32 bits = -shift;
+        const sint32 half = (sint32)1 << (bits - 1);
+
+        for (i = 0U; i < len; i++)
+        {
+            const sint32 v = (sint32)x[i];
+
+            x[i] = (t_Fixed16)((v >= 0) ? ((v + half) >> bits) : -((-v + half) >> bits));
+        }
+    }
+    else
+    {
+        /* Same Q-format: nothing to convert */
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Convert 8-bit values in place to another Q-format.
+ *
+ *  Same behaviour as FixedPoint_Layout_Rescale16() for the 8-bit container.
+ *
+ *  @param[in,out]  x       Values to convert.
+ *  @param[in]      len     Number of values.
+ *  @param[in]      shift   Fractional bits to add with saturation (> 0) or remove with rounding (< 0).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All values converted without saturation.
+ *  @retval     E_NOT_OK    Saturation of at least one value.
+ */
+static Std_ReturnType FixedPoint_Layout_Rescale8(t_Fixed8* x, uint32 len, sint32 shift)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 i;
+
+    if (shift > 0)
+    {
+        const sint32 scale = (sint32)1 << shift;
+        const sint32 limitHi = (sint32)FIX8_MAX / scale;
+        const sint32 limitLo = (sint32)FIX8_MIN / scale;
+
+        for (i = 0U; i < len; i++)
+        {
+            const sint32 v = (sint32)x[i];
+
+            if (v > limitHi)
+            {
+                FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 8, v, shift, FIX8_MAX);
+                x[i] = FIX8_MAX;
+                ret = E_NOT_OK;
+            }
+            else if (v < limitLo)
+            {
+                FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_CONVERT, 8, v, shift, FIX8_MIN);
+                x[i] = FIX8_MIN;
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                x[i] = (t_Fixed8)(v * scale);
+            }
+        }
+    }
+    else if (shift < 0)
+    {
+        const sint32 bits = -shift;
+        const sint32 half = (sint32)1 << (bits - 1);
+
+        for (i = 0U; i < len; i++)
+        {
+            const sint32 v = (sint32)x[i];
+
+            x[i] = (t_Fixed8)((v >= 0) ? ((v + half) >> bits) : -((-v + half) >> bits));
+        }
+    }
+    else
+    {
+        /* Same Q-format: nothing to convert */
+    }
+
+    return ret;
+}
+
+#if (FIXEDPOINT_SSE2 == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Even 16-bit elements of two vectors (elements 0, 2, .. 14 of lo:hi).
+ *
+ *  @param[in]  lo      Elements 0..7.
+ *  @param[in]  hi      Elements 8..15.
+ *
+ *  @return     __m128i
+ *  @retval     Even elements in order.
+ */
+static __m128i FixedPoint_Layout_Even16(__m128i lo, __m128i hi)
+{
+    /* Sign extend the low half of each 32-bit lane; the pack cannot saturate */
+    return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(lo, 16), 16), _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16));
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Odd 16-bit elements of two vectors (elements 1, 3, .. 15 of lo:hi).
+ *
+ *  @param[in]  lo      Elements 0..7.
+ *  @param[in]  hi      Elements 8..15.
+ *
+ *  @return     __m128i
+ *  @retval     Odd elements in order.
+ */
+static __m128i FixedPoint_Layout_Odd16(__m128i lo, __m128i hi)
+{
+    return _mm_packs_epi32(_mm_srai_epi32(lo, 16), _mm_srai_epi32(hi, 16));
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Transpose one tile of 16-bit elements: dst[j][k] = src[k][j].
+ *
+ *  @param[in]  src     Pointers to the source rows of the tile.
+ *  @param[in]  dst     Pointers to the destination rows of the tile.
+ *  @param[in]  rows    Number of source rows (1..FIXEDPOINT_LAYOUT_TILE).
+ *  @param[in]  cols    Number of source columns (1..FIXEDPOINT_LAYOUT_TILE).
+ */
+static void FixedPoint_Layout_Tile16(const t_Fixed16* const src[], t_Fixed16* const dst[], uint32 rows, uint32 cols)
+{
+    boolean done = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    if ((rows == FIXEDPOINT_LAYOUT_TILE) && (cols == FIXEDPOINT_LAYOUT_TILE))
+    {
+        __m128i r[FIXEDPOINT_LAYOUT_TILE];
+        __m128i a[FIXEDPOINT_LAYOUT_TILE];
+        uint32 k;
+
+        for (k = 0U; k < FIXEDPOINT_LAYOUT_TILE; k++)
+        {
+            r[k] = _mm_loadu_si128((const __m128i*)(const void*)src[k]);
+        }
+
+        /* 16-bit pairs of row pairs, then 32-bit pairs of row quads, then 64-bit halves: one column each */
+        a[0] = _mm_unpacklo_epi16(r[0], r[1]);
+        a[1] = _mm_unpackhi_epi16(r[0], r[1]);
+        a[2] = _mm_unpacklo_epi16(r[2], r[3]);
+        a[3] = _mm_unpackhi_epi16(r[2], r[3]);
+        a[4] = _mm_unpacklo_epi16(r[4], r[5]);
+        a[5] = _mm_unpackhi_epi16(r[4], r[5]);
+        a[6] = _mm_unpacklo_epi16(r[6], r[7]);
+        a[7] = _mm_unpackhi_epi16(r[6], r[7]);
+
+        r[0] = _mm_unpacklo_epi32(a[0], a[2]);
+        r[1] = _mm_unpackhi_epi32(a[0], a[2]);
+        r[2] = _mm_unpacklo_epi32(a[1], a[3]);
+        r[3] = _mm_unpackhi_epi32(a[1], a[3]);
+        r[4] = _mm_unpacklo_epi32(a[4], a[6]);
+        r[5] = _mm_unpackhi_epi32(a[4], a[6]);
+        r[6] = _mm_unpacklo_epi32(a[5], a[7]);
+        r[7] = _mm_unpackhi_epi32(a[5], a[7]);
+
+        _mm_storeu_si128((__m128i*)(void*)dst[0], _mm_unpacklo_epi64(r[0], r[4]));
+        _mm_storeu_si128((__m128i*)(void*)dst[1], _mm_unpackhi_epi64(r[0], r[4]));
+        _mm_storeu_si128((__m128i*)(void*)dst[2], _mm_unpacklo_epi64(r[1], r[5]));
+        _mm_storeu_si128((__m128i*)(void*)dst[3], _mm_unpackhi_epi64(r[1], r[5]));
+        _mm_storeu_si128((__m128i*)(void*)dst[4], _mm_unpacklo_epi64(r[2], r[6]));
+        _mm_storeu_si128((__m128i*)(void*)dst[5], _mm_unpackhi_epi64(r[2], r[6]));
+        _mm_storeu_si128((__m128i*)(void*)dst[6], _mm_unpacklo_epi64(r[3], r[7]));
+        _mm_storeu_si128((__m128i*)(void*)dst[7], _mm_unpackhi_epi64(r[3], r[7]));
+        done = 1U;
+    }
+#endif
+
+    if (done == 0U)
+    {
+        uint32 j;
+        uint32 k;
+
+        for (j = 0U; j < cols; j++)
+        {
+            for (k = 0U; k < rows; k++)
+            {
+                dst[j][k] = src[k][j];
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Transpose one tile of 8-bit elements: dst[j][k] = src[k][j].
+ *
+ *  @param[in]  src     Pointers to the source rows of the tile.
+ *  @param[in]  dst     Pointers to the destination rows of the tile.
+ *  @param[in]  rows    Number of source rows (1..FIXEDPOINT_LAYOUT_TILE).
+ *  @param[in]  cols    Number of source columns (1..FIXEDPOINT_LAYOUT_TILE).
+ */
+static void FixedPoint_Layout_Tile8(const t_Fixed8* const src[], t_Fixed8* const dst[], uint32 rows, uint32 cols)
+{
+    boolean done = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    if ((rows == FIXEDPOINT_LAYOUT_TILE) && (cols == FIXEDPOINT_LAYOUT_TILE))
+    {
+        __m128i a[4];
+        __m128i b[4];
+        __m128i c;
+        uint32 k;
+
+        /* 8-bit pairs of row pairs, then 16-bit pairs of row quads, then 32-bit halves: two columns each */
+        for (k = 0U; k < 4U; k++)
+        {
+            a[k] = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)(const void*)src[2U * k]),
+                                     _mm_loadl_epi64((const __m128i*)(const void*)src[(2U * k) + 1U]));
+        }
+
+        b[0] = _mm_unpacklo_epi16(a[0], a[1]);
+        b[1] = _mm_unpackhi_epi16(a[0], a[1]);
+        b[2] = _mm_unpacklo_epi16(a[2], a[3]);
+        b[3] = _mm_unpackhi_epi16(a[2], a[3]);
+
+        for (k = 0U; k < 2U; k++)
+        {
+            c = _mm_unpacklo_epi32(b[k], b[k + 2U]);
+            _mm_storel_epi64((__m128i*)(void*)dst[4U * k], c);
+            _mm_storel_epi64((__m128i*)(void*)dst[(4U * k) + 1U], _mm_unpackhi_epi64(c, c));
+            c = _mm_unpackhi_epi32(b[k], b[k + 2U]);
+            _mm_storel_epi64((__m128i*)(void*)dst[(4U * k) + 2U], c);
+            _mm_storel_epi64((__m128i*)(void*)dst[(4U * k) + 3U], _mm_unpackhi_epi64(c, c));
+        }
+        done = 1U;
+    }
+#endif
+
+    if (done == 0U)
+    {
+        uint32 j;
+        uint32 k;
+
+        for (j = 0U; j < cols; j++)
+        {
+            for (k = 0U; k < rows; k++)
+            {
+                dst[j][k] = src[k][j];
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Deinterleave one full block of FIXEDPOINT_LAYOUT_TILE frames with a dedicated SIMD shuffle.
+ *
+ *  @param[in]  frame       First sample of the block in the interleaved input.
+ *  @param[in]  channels    Number of channels.
+ *  @param[in]  out         Channel arrays.
+ *  @param[in]  offset      Index of the first frame of the block in the channel arrays.
+ *
+ *  @return     boolean
+ *  @retval     1       Block processed.
+ *  @retval     0       No dedicated shuffle for this channel count (or no SSE2).
+ */
+static boolean FixedPoint_Layout_Deinterleave16_Block(const t_Fixed16* frame, uint32 channels, t_Fixed16* const out[],
+                                                      uint32 offset)
+{
+    boolean done = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    if (channels == 2U)
+    {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(const void*)&frame[0]);
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(const void*)&frame[8]);
+
+        _mm_storeu_si128((__m128i*)(void*)&out[0][offset], FixedPoint_Layout_Even16(v0, v1));
+        _mm_storeu_si128((__m128i*)(void*)&out[1][offset], FixedPoint_Layout_Odd16(v0, v1));
+        done = 1U;
+    }
+    else if (channels == 4U)
+    {
+        const __m128i v0 = _mm_loadu_si128((const __m128i*)(const void*)&frame[0]);
+        const __m128i v1 = _mm_loadu_si128((const __m128i*)(const void*)&frame[8]);
+        const __m128i v2 = _mm_loadu_si128((const __m128i*)(const void*)&frame[16]);
+        const __m128i v3 = _mm_loadu_si128((const __m128i*)(const void*)&frame[24]);
+        /* Channels 0 and 2 are the even samples, channels 1 and 3 the odd samples */
+        const __m128i even01 = FixedPoint_Layout_Even16(v0, v1);
+        const __m128i even23 = FixedPoint_Layout_Even16(v2, v3);
+        const __m128i odd01 = FixedPoint_Layout_Odd16(v0, v1);
+        const __m128i odd23 = FixedPoint_Layout_Odd16(v2, v3);
+
+        _mm_storeu_si128((__m128i*)(void*)&out[0][offset], FixedPoint_Layout_Even16(even01, even23));
+        _mm_storeu_si128((__m128i*)(void*)&out[1][offset], FixedPoint_Layout_Even16(odd01, odd23));
+        _mm_storeu_si128((__m128i*)(void*)&out[2][offset], FixedPoint_Layout_Odd16(even01, even23));
+        _mm_storeu_si128((__m128i*)(void*)&out[3][offset], FixedPoint_Layout_Odd16(odd01, odd23));
+        done = 1U;
+    }
+    else
+    {
+        /* Tiles */
+    }
+#else
+    (void)frame;
+    (void)channels;
+    (void)out;
+    (void)offset;
+#endif
+
+    return done;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Interleave one full block of FIXEDPOINT_LAYOUT_TILE frames with a dedicated SIMD shuffle.
+ *
+ *  @param[in]  in          Channel arrays.
+ *  @param[in]  channels    Number of channels.
+ *  @param[in]  offset      Index of the first frame of the block in the channel arrays.
+ *  @param[out] frame       First sample of the block in the interleaved output.
+ *
+ *  @return     boolean
+ *  @retval     1       Block processed.
+ *  @retval     0       No dedicated shuffle for this channel count (or no SSE2).
+ */
+static boolean FixedPoint_Layout_Interleave16_Block(const t_Fixed16* const in[], uint32 channels, uint32 offset,
+                                                    t_Fixed16* frame)
+{
+    boolean done = 0U;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    if (channels == 2U)
+    {
+        const __m128i c0 = _mm_loadu_si128((const __m128i*)(const void*)&in[0][offset]);
+        const __m128i c1 = _mm_loadu_si128((const __m128i*)(const void*)&in[1][offset]);
+
+        _mm_storeu_si128((__m128i*)(void*)&frame[0], _mm_unpacklo_epi16(c0, c1));
+        _mm_storeu_si128((__m128i*)(void*)&frame[8], _mm_unpackhi_epi16(c0, c1));
+        done = 1U;
+    }
+    else if (channels == 4U)
+    {
+        const __m128i c0 = _mm_loadu_si128((const __m128i*)(const void*)&in[0][offset]);
+        const __m128i c1 = _mm_loadu_si128((const __m128i*)(const void*)&in[1][offset]);
+        const __m128i c2 = _mm_loadu_si128((const __m128i*)(const void*)&in[2][offset]);
+        const __m128i c3 = _mm_loadu_si128((const __m128i*)(const void*)&in[3][offset]);
+        const __m128i lo01 = _mm_unpacklo_epi16(c0, c1);
+        const __m128i lo23 = _mm_unpacklo_epi16(c2, c3);
+        const __m128i hi01 = _mm_unpackhi_epi16(c0, c1);
+        const __m128i hi23 = _mm_unpackhi_epi16(c2, c3);
+
+        _mm_storeu_si128((__m128i*)(void*)&frame[0], _mm_unpacklo_epi32(lo01, lo23));
+        _mm_storeu_si128((__m128i*)(void*)&frame[8], _mm_unpackhi_epi32(lo01, lo23));
+        _mm_storeu_si128((__m128i*)(void*)&frame[16], _mm_unpacklo_epi32(hi01, hi23));
+        _mm_storeu_si128((__m128i*)(void*)&frame[24], _mm_unpackhi_epi32(hi01, hi23));
+        done = 1U;
+    }
+    else
+    {
+        /* Tiles */
+    }
+#else
+    (void)in;
+    (void)channels;
+    (void)offset;
+    (void)frame;
+#endif
+
+    return done;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Extract the even bits of a Morton code.
+ *
+ *  @param[in]  code    Z-order code (32 bit).
+ *
+ *  @return     uint32
+ *  @retval     Bits 0, 2, 4, .. 30 of code as a 16-bit number.
+ */
+static uint32 FixedPoint_Layout_Compact(uint32 code)
+{
+    uint32 x = code & 0x55555555UL;
+
+    x = (x | (x >> 1)) & 0x33333333UL;
+    x = (x | (x >> 2)) & 0x0F0F0F0FUL;
+    x = (x | (x >> 4)) & 0x00FF00FFUL;
+    x = (x | (x >> 8)) & 0x0000FFFFUL;
+
+    return x;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Prepare the Z-order traversal of the tiles of a matrix.
+ *
+ *  The tile grid is covered by squares of side x side tiles along its longer dimension, where side
+ *  is the smallest power of 2 not below the shorter dimension. Each square is visited in Z-order;
+ *  at most half of the codes fall outside the grid and are skipped.
+ *
+ *  @param[out] order   Traversal.
+ *  @param[in]  rows    Number of matrix rows.
+ *  @param[in]  cols    Number of matrix columns.
+ */
+static void FixedPoint_Layout_OrderInit(FixedPoint_LayoutOrder_t* order, uint32 rows, uint32 cols)
+{
+    uint32 shorter;
+    uint32 longer;
+
+    order->tileRows = (rows + FIXEDPOINT_LAYOUT_TILE - 1U) / FIXEDPOINT_LAYOUT_TILE;
+    order->tileCols = (cols + FIXEDPOINT_LAYOUT_TILE - 1U) / FIXEDPOINT_LAYOUT_TILE;
+    shorter = (order->tileRows < order->tileCols) ? order->tileRows : order->tileCols;
+    longer = (order->tileRows < order->tileCols) ? order->tileCols : order->tileRows;
+
+    order->side = 1U;
+    while (order->side < shorter)
+    {
+        order->side *= 2U;
+    }
+
+    order->count = ((longer + order->side - 1U) / order->side) * order->side * order->side;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Tile of the Z-order traversal at a position.
+ *
+ *  @param[in]  order   Traversal prepared with FixedPoint_Layout_OrderInit().
+ *  @param[in]  index   Position, 0 .. order->count - 1.
+ *  @param[out] row     First matrix row of the tile.
+ *  @param[out] col     First matrix column of the tile.
+ *
+ *  @return     boolean
+ *  @retval     1       Tile within the matrix.
+ *  @retval     0       Position outside the matrix, skip it.
+ */
+static boolean FixedPoint_Layout_OrderTile(const FixedPoint_LayoutOrder_t* order, uint32 index, uint32* row,
+                                           uint32* col)
+{
+    const uint32 square = order->side * order->side;
+    const uint32 code = index % square;
+    uint32 tileRow = FixedPoint_Layout_Compact(code >> 1);
+    uint32 tileCol = FixedPoint_Layout_Compact(code);
+
+    if (order->tileRows >= order->tileCols)
+    {
+        tileRow += (index / square) * order->side;
+    }
+    else
+    {
+        tileCol += (index / square) * order->side;
+    }
+
+    *row = tileRow * FIXEDPOINT_LAYOUT_TILE;
+    *col = tileCol * FIXEDPOINT_LAYOUT_TILE;
+
+    return ((tileRow < order->tileRows) && (tileCol < order->tileCols)) ? 1U : 0U;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Split interleaved 16-bit frames into one array per channel (array of structures to structure of arrays).
+ *
+ *  out[c][f] = in[f * channels + c], converted by shift. All elements are always written.
+ *
+ *  @param[in]  in          Interleaved frames, frames * channels samples in configured 16-bit Q-format.
+ *  @param[in]  channels    Number of channels (FIXEDPOINT_LAYOUT_MIN_CHANNELS .. FIXEDPOINT_LAYOUT_MAX_CHANNELS).
+ *  @param[in]  frames      Number of frames.
+ *  @param[out] out         One array of frames samples per channel, not overlapping in.
+ *  @param[in]  shift       Fractional bits to add (> 0, saturating) or remove (< 0, rounding), 0 = copy.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All samples moved without saturation.
+ *  @retval     E_NOT_OK    Null pointer, invalid channel count or shift, or saturation of at least one sample.
+ */
+Std_ReturnType FixedPoint_Deinterleave16(const t_Fixed16* in, uint32 channels, uint32 frames,
+                                         t_Fixed16* const out[], sint32 shift)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL) && (channels >= FIXEDPOINT_LAYOUT_MIN_CHANNELS) &&
+        (channels <= FIXEDPOINT_LAYOUT_MAX_CHANNELS) && (FixedPoint_Layout_ShiftValid(shift, 15U) != 0U))
+    {
+        boolean valid = 1U;
+        uint32 f;
+        uint32 c;
+
+        for (c = 0U; c < channels; c++)
+        {
+            valid = (out[c] == NULL) ? 0U : valid;
+        }
+
+        if (valid != 0U)
+        {
+            ret = E_OK;
+
+            for (f = 0U; f < frames; f += FIXEDPOINT_LAYOUT_TILE)
+            {
+                const uint32 nf = ((frames - f) < FIXEDPOINT_LAYOUT_TILE) ? (frames - f) : FIXEDPOINT_LAYOUT_TILE;
+
+                if ((nf == FIXEDPOINT_LAYOUT_TILE) &&
+                    (FixedPoint_Layout_Deinterleave16_Block(&in[f * channels], channels, out, f) != 0U))
+                {
+                    /* Dedicated shuffle */
+                }
+                else if ((channels < FIXEDPOINT_LAYOUT_TILE) || (FIXEDPOINT_SSE2 == 0U))
+                {
+                    for (c = 0U; c < channels; c++)
+                    {
+                        const t_Fixed16* const src = &in[(f * channels) + c];
+                        t_Fixed16* const dst = &out[c][f];
+                        uint32 k;
+
+                        for (k = 0U; k < nf; k++)
+                        {
+                            dst[k] = src[k * channels];
+                        }
+                    }
+                }
+                else
+                {
+                    uint32 c0;
+
+                    for (c0 = 0U; c0 < channels; c0 += FIXEDPOINT_LAYOUT_TILE)
+                    {
+                        const uint32 nc = ((channels - c0) < FIXEDPOINT_LAYOUT_TILE) ?
+                                          (channels - c0) : FIXEDPOINT_LAYOUT_TILE;
+                        const t_Fixed16* src[FIXEDPOINT_LAYOUT_TILE];
+                        t_Fixed16* dst[FIXEDPOINT_LAYOUT_TILE];
+                        uint32 k;
+
+                        for (k = 0U; k < nf; k++)
+                        {
+                            src[k] = &in[((f + k) * channels) + c0];
+                        }
+                        for (k = 0U; k < nc; k++)
+                        {
+                            dst[k] = &out[c0 + k][f];
+                        }
+
+                        FixedPoint_Layout_Tile16(src, dst, nf, nc);
+                    }
+                }
+
+                if (shift != 0)
+                {
+                    for (c = 0U; c < channels; c++)
+                    {
+                        ret |= FixedPoint_Layout_Rescale16(&out[c][f], nf, shift);
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Merge one array per channel into interleaved 16-bit frames (structure of arrays to array of structures).
+ *
+ *  out[f * channels + c] = in[c][f], converted by shift. All elements are always written.
+ *
+ *  @param[in]  in          One array of frames samples per channel in configured 16-bit Q-format.
+ *  @param[in]  channels    Number of channels (FIXEDPOINT_LAYOUT_MIN_CHANNELS .. FIXEDPOINT_LAYOUT_MAX_CHANNELS).
+ *  @param[in]  frames      Number of frames.
+ *  @param[out] out         Interleaved frames, frames * channels samples, not overlapping in.
+ *  @param[in]  shift       Fractional bits to add (> 0, saturating) or remove (< 0, rounding), 0 = copy.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All samples moved without saturation.
+ *  @retval     E_NOT_OK    Null pointer, invalid channel count or shift, or saturation of at least one sample.
+ */
+Std_ReturnType FixedPoint_Interleave16(const t_Fixed16* const in[], uint32 channels, uint32 frames,
+                                       t_Fixed16* out, sint32 shift)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL) && (channels >= FIXEDPOINT_LAYOUT_MIN_CHANNELS) &&
+        (channels <= FIXEDPOINT_LAYOUT_MAX_CHANNELS) && (FixedPoint_Layout_ShiftValid(shift, 15U) != 0U))
+    {
+        boolean valid = 1U;
+        uint32 f;
+        uint32 c;
+
+        for (c = 0U; c < channels; c++)
+        {
+            valid = (in[c] == NULL) ? 0U : valid;
+        }
+
+        if (valid != 0U)
+        {
+            ret = E_OK;
+
+            for (f = 0U; f < frames; f += FIXEDPOINT_LAYOUT_TILE)
+            {
+                const uint32 nf = ((frames - f) < FIXEDPOINT_LAYOUT_TILE) ? (frames - f) : FIXEDPOINT_LAYOUT_TILE;
+
+                if ((nf == FIXEDPOINT_LAYOUT_TILE) &&
+                    (FixedPoint_Layout_Interleave16_Block(in, channels, f, &out[f * channels]) != 0U))
+                {
+                    /* Dedicated shuffle */
+                }
+                else if ((channels < FIXEDPOINT_LAYOUT_TILE) || (FIXEDPOINT_SSE2 == 0U))
+                {
+                    for (c = 0U; c < channels; c++)
+                    {
+                        const t_Fixed16* const src = &in[c][f];
+                        t_Fixed16* const dst = &out[(f * channels) + c];
+                        uint32 k;
+
+                        for (k = 0U; k < nf; k++)
+                        {
+                            dst[k * channels] = src[k];
+                        }
+                    }
+                }
+                else
+                {
+                    uint32 c0;
+
+                    for (c0 = 0U; c0 < channels; c0 += FIXEDPOINT_LAYOUT_TILE)
+                    {
+                        const uint32 nc = ((channels - c0) < FIXEDPOINT_LAYOUT_TILE) ?
+                                          (channels - c0) : FIXEDPOINT_LAYOUT_TILE;
+                        const t_Fixed16* src[FIXEDPOINT_LAYOUT_TILE];
+                        t_Fixed16* dst[FIXEDPOINT_LAYOUT_TILE];
+                        uint32 k;
+
+                        for (k = 0U; k < nc; k++)
+                        {
+                            src[k] = &in[c0 + k][f];
+                        }
+                        for (k = 0U; k < nf; k++)
+                        {
+                            dst[k] = &out[((f + k) * channels) + c0];
+                        }
+
+                        FixedPoint_Layout_Tile16(src, dst, nc, nf);
+                    }
+                }
+
+                if (shift != 0)
+                {
+                    ret |= FixedPoint_Layout_Rescale16(&out[f * channels], nf * channels, shift);
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Transpose a row-major 16-bit matrix.
+ *
+ *  out[c * rows + r] = in[r * cols + c], converted by shift. All elements are always written.
+ *
+ *  @param[in]  in      rows x cols matrix in configured 16-bit Q-format.
+ *  @param[in]  rows    Number of rows of in.
+ *  @param[in]  cols    Number of columns of in.
+ *  @param[out] out     cols x rows matrix, not overlapping in.
+ *  @param[in]  shift   Fractional bits to add (> 0, saturating) or remove (< 0, rounding), 0 = copy.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements moved without saturation.
+ *  @retval     E_NOT_OK    Null pointer, in-place call, invalid shift or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Transpose16(const t_Fixed16* in, uint32 rows, uint32 cols, t_Fixed16* out, sint32 shift)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL) && (in != out) && (FixedPoint_Layout_ShiftValid(shift, 15U) != 0U))
+    {
+        FixedPoint_LayoutOrder_t order;
+        uint32 index;
+
+        FixedPoint_Layout_OrderInit(&order, rows, cols);
+        ret = E_OK;
+
+        for (index = 0U; index < order.count; index++)
+        {
+            uint32 r0;
+            uint32 c0;
+
+            if (FixedPoint_Layout_OrderTile(&order, index, &r0, &c0) != 0U)
+            {
+                const uint32 nr = ((rows - r0) < FIXEDPOINT_LAYOUT_TILE) ? (rows - r0) : FIXEDPOINT_LAYOUT_TILE;
+                const uint32 nc = ((cols - c0) < FIXEDPOINT_LAYOUT_TILE) ? (cols - c0) : FIXEDPOINT_LAYOUT_TILE;
+                const t_Fixed16* src[FIXEDPOINT_LAYOUT_TILE];
+                t_Fixed16* dst[FIXEDPOINT_LAYOUT_TILE];
+                uint32 k;
+
+                for (k = 0U; k < nr; k++)
+                {
+                    src[k] = &in[((r0 + k) * cols) + c0];
+                }
+                for (k = 0U; k < nc; k++)
+                {
+                    dst[k] = &out[((c0 + k) * rows) + r0];
+                }
+
+                FixedPoint_Layout_Tile16(src, dst, nr, nc);
+
+                if (shift != 0)
+                {
+                    for (k = 0U; k < nc; k++)
+                    {
+                        ret |= FixedPoint_Layout_Rescale16(dst[k], nr, shift);
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Transpose a row-major 8-bit matrix.
+ *
+ *  Same behaviour as FixedPoint_Transpose16() for the configured 8-bit Q-format.
+ *
+ *  @param[in]  in      rows x cols matrix in configured 8-bit Q-format.
+ *  @param[in]  rows    Number of rows of in.
+ *  @param[in]  cols    Number of columns of in.
+ *  @param[out] out     cols x rows matrix, not overlapping in.
+ *  @param[in]  shift   Fractional bits to add (> 0, saturating) or remove (< 0, rounding), 0 = copy.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements moved without saturation.
+ *  @retval     E_NOT_OK    Null pointer, in-place call, invalid shift or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Transpose8(const t_Fixed8* in, uint32 rows, uint32 cols, t_Fixed8* out, sint32 shift)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((in != NULL) && (out != NULL) && (in != out) && (FixedPoint_Layout_ShiftValid(shift, 7U) != 0U))
+    {
+        FixedPoint_LayoutOrder_t order;
+        uint32 index;
+
+        FixedPoint_Layout_OrderInit(&order, rows, cols);
+        ret = E_OK;
+
+        for (index = 0U; index < order.count; index++)
+        {
+            uint32 r0;
+            uint32 c0;
+
+            if (FixedPoint_Layout_OrderTile(&order, index, &r0, &c0) != 0U)
+            {
+                const uint32 nr = ((rows - r0) < FIXEDPOINT_LAYOUT_TILE) ? (rows - r0) : FIXEDPOINT_LAYOUT_TILE;
+                const uint32 nc = ((cols - c0) < FIXEDPOINT_LAYOUT_TILE) ? (cols - c0) : FIXEDPOINT_LAYOUT_TILE;
+                const t_Fixed8* src[FIXEDPOINT_LAYOUT_TILE];
+                t_Fixed8* dst[FIXEDPOINT_LAYOUT_TILE];
+                uint32 k;
+
+                for (k = 0U; k < nr; k++)
+                {
+                    src[k] = &in[((r0 + k) * cols) + c0];
+                }
+                for (k = 0U; k < nc; k++)
+                {
+                    dst[k] = &out[((c0 + k) * rows) + r0];
+                }
+
+                FixedPoint_Layout_Tile8(src, dst, nr, nc);
+
+                if (shift != 0)
+                {
+                    for (k = 0U; k < nc; k++)
+                    {
+                        ret |= FixedPoint_Layout_Rescale8(dst[k], nr, shift);
+                    }
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
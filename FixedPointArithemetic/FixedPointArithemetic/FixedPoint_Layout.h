@@ -0,0 +1,68 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Layout.h
+
+@brief      Interface for the layout transform kernels (channel interleave/deinterleave, matrix transpose).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_LAYOUT_H
+#define FIXED_POINT_LAYOUT_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Smallest number of channels of an interleaved frame. */
+#define FIXEDPOINT_LAYOUT_MIN_CHANNELS  (2U)
+
+/** @brief Largest number of channels of an interleaved frame. */
+#define FIXEDPOINT_LAYOUT_MAX_CHANNELS  (16U)
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+
+/* Interleaved frames (array of structures) <-> one array per channel (structure of arrays) */
+extern Std_ReturnType FixedPoint_Deinterleave16(const t_Fixed16* in, uint32 channels, uint32 frames,
+                                                t_Fixed16* const out[], sint32 shift);
+extern Std_ReturnType FixedPoint_Interleave16(const t_Fixed16* const in[], uint32 channels, uint32 frames,
+                                              t_Fixed16* out, sint32 shift);
+
+/* Row-major matrix transpose */
+extern Std_ReturnType FixedPoint_Transpose16(const t_Fixed16* in, uint32 rows, uint32 cols, t_Fixed16* out,
+                                             sint32 shift);
+extern Std_ReturnType FixedPoint_Transpose8(const t_Fixed8* in, uint32 rows, uint32 cols, t_Fixed8* out,
+                                            sint32 shift);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_LAYOUT_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
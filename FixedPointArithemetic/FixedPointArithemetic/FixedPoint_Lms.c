@@ -0,0 +1,751 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Lms.c
+
+@brief      16-bit LMS / NLMS adaptive FIR filter.
+ *
+ * Detailed Description:
+ * - Per sample n the filter computes y = sum(w[k] * x[n-k]), the error e = d - y against the
+ *   reference d and adapts w[k] = w[k] * (1 - 2^-leakShift) + mu * e * x[n-k] with mu = 2^-muShift
+ *   (LMS) or mu / (sum(x^2) + FIXEDPOINT_LMS_NLMS_EPS) (NLMS).
+ * - Data, output and error are t_Fixed16; the coefficients have 32 bits with
+ *   FIXEDPOINT_LMS_COEFF_SHIFT fractional bits, so small steps are not lost to rounding (no
+ *   stalling as with 16-bit coefficients). The filter sum is accumulated exactly in 64 bits and
+ *   rounded once; the NLMS input power is kept exactly as a 64-bit running sum.
+ * - The coefficients are stored as 16-bit halves w = hi * 2^16 + lo. The filter loop multiplies
+ *   both halves with 8 input samples per SSE2 multiply-add and widens the sums to 64 bits; the
+ *   update forms the products of 8 samples with the 16-bit step mantissa at once.
+ * - The step mu * e (NLMS: mu * e / power) is formed once per sample as a 16-bit mantissa eM and
+ *   a shift r, so that the increment of every coefficient is (eM * x + 2^(r-1)) >> r, or
+ *   (eM * x) << -r for large steps. eM * x is exact in 32 bits; a left shifted increment that
+ *   leaves 32 bits always saturates the coefficient.
+ * - Saturation audit: an output or error outside the 16-bit range is saturated (probe
+ *   FIXEDPOINT_PROBE_OP_NARROW), a clamped step or a coefficient reaching the limits
+ *   FIXEDPOINT_LMS_COEFF_MIN / FIXEDPOINT_LMS_COEFF_MAX is saturated instead of wrapping (probe
+ *   FIXEDPOINT_PROBE_OP_ADAPT); in all cases the call returns E_NOT_OK. The SSE2 update handles
+ *   groups of 8 coefficients that cannot reach the limits and leaves the others to the scalar
+ *   code, so both builds produce identical coefficients.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Lms.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 multiply-add intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of coefficients processed together by the filter and update loops. */
+#define FIXEDPOINT_LMS_LANES            (8U)
+
+/** @brief Offset making the operands of the rounding shifts non-negative (multiple of every shift used). */
+#define FIXEDPOINT_LMS_OFFSET           ((sint64)1 << 40U)
+
+/** @brief Largest magnitude of the step mantissa. */
+#define FIXEDPOINT_LMS_STEP_MAX         (32767U)
+
+/** @brief Largest right shift of the step, keeps eM * x + 2^(r-1) within 31 bits. */
+#define FIXEDPOINT_LMS_STEP_SHIFT_MAX   (30)
+
+/** @brief Largest left shift of the step, keeps (eM * x) << -r within 63 bits. */
+#define FIXEDPOINT_LMS_STEP_SHIFT_MIN   (-32)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static sint64 FixedPoint_Lms_Round(sint64 v, uint32 shift);
+static sint64 FixedPoint_Lms_ShiftRound(sint64 v, sint32 shift);
+static sint64 FixedPoint_Lms_Filter(const FixedPoint_Lms16_t* lms, const t_Fixed16* xw);
+static Std_ReturnType FixedPoint_Lms_Step(const FixedPoint_Lms16_t* lms, sint32 e, sint32* eM, sint32* r);
+static sint32 FixedPoint_Lms_Adapt(const FixedPoint_Lms16_t* lms, uint32 j, t_Fixed16 x, sint32 eM, sint32 r,
+                                   Std_ReturnType* ret);
+#if (FIXEDPOINT_SSE2 == 1U)
+static __m128i FixedPoint_Lms_Adapt4(__m128i w, __m128i p, __m128i half, __m128i shiftRight, __m128i shiftLeft,
+                                     uint32 leak);
+#endif
+static Std_ReturnType FixedPoint_Lms_Update(FixedPoint_Lms16_t* lms, const t_Fixed16* xw, sint32 eM, sint32 r);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Shift right with symmetric round-to-nearest (ties away from zero).
+ *
+ *  @param[in]  v       Value.
+ *  @param[in]  shift   Number of bits (1..62).
+ *
+ *  @return     Rounded v / 2^shift.
+ */
+static sint64 FixedPoint_Lms_Round(sint64 v, uint32 shift)
+{
+    const sint64 half = ((sint64)1 << (shift - 1U));
+    const sint64 mag = (((v < 0) ? -v : v) + half) >> shift;
+
+    return (v < 0) ? -mag : mag;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Shift rounding half up, floor((v + 2^(shift-1)) / 2^shift) as the SSE2 arithmetic shift.
+ *
+ *  @param[in]  v       Value (>= -2^40, below 2^31 for a left shift).
+ *  @param[in]  shift   Number of bits to the right (-32..40), negative for a left shift.
+ *
+ *  @return     Rounded v / 2^shift.
+ */
+static sint64 FixedPoint_Lms_ShiftRound(sint64 v, sint32 shift)
+{
+    sint64 result = v;
+
+    if (shift > 0)
+    {
+        result = ((v + FIXEDPOINT_LMS_OFFSET + ((sint64)1 << (uint32)(shift - 1))) >> (uint32)shift) -
+                 (FIXEDPOINT_LMS_OFFSET >> (uint32)shift);
+    }
+    else if (shift < 0)
+    {
+        result = v * ((sint64)1 << (uint32)(-shift));
+    }
+    else
+    {
+        /* No shift */
+    }
+
+    return result;
+}
+
+#if (FIXEDPOINT_SSE2 == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Filter sum sum(w[j] * xw[j]) over the time-reversed coefficients (SSE2).
+ *
+ *  _mm_madd_epi16 adds the products of two coefficient halves and samples into a 32-bit lane. The
+ *  only sum that does not fit is 2 * (-32768 * -32768) = 2^31, which wraps to INT32_MIN; the sign
+ *  extension to 64 bits treats this pattern as positive, so the accumulation stays exact.
+ *
+ *  @param[in]  lms     Filter state.
+ *  @param[in]  xw      numTaps input samples, oldest first.
+ *
+ *  @return     Sum with FIXEDPOINT_LMS_COEFF_SHIFT + SHIFT_16 fractional bits.
+ */
+static sint64 FixedPoint_Lms_Filter(const FixedPoint_Lms16_t* lms, const t_Fixed16* xw)
+{
+    const __m128i wrapped = _mm_set1_epi32(-2147483647 - 1);
+    const uint32 taps = lms->numTaps;
+    __m128i accHi = _mm_setzero_si128();
+    __m128i accLo = _mm_setzero_si128();
+    sint64 lanes[4];
+    sint64 acc;
+    uint32 j;
+
+    for (j = 0U; (j + FIXEDPOINT_LMS_LANES) <= taps; j += FIXEDPOINT_LMS_LANES)
+    {
+        const __m128i x = _mm_loadu_si128((const __m128i*)(const void*)&xw[j]);
+        const __m128i hi = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(const void*)&lms->coeffHi[j]), x);
+        const __m128i lo = _mm_madd_epi16(_mm_loadu_si128((const __m128i*)(const void*)&lms->coeffLo[j]), x);
+        const __m128i signHi = _mm_andnot_si128(_mm_cmpeq_epi32(hi, wrapped), _mm_srai_epi32(hi, 31));
+        const __m128i signLo = _mm_andnot_si128(_mm_cmpeq_epi32(lo, wrapped), _mm_srai_epi32(lo, 31));
+
+        accHi = _mm_add_epi64(accHi, _mm_add_epi64(_mm_unpacklo_epi32(hi, signHi), _mm_unpackhi_epi32(hi, signHi)));
+        accLo = _mm_add_epi64(accLo, _mm_add_epi64(_mm_unpacklo_epi32(lo, signLo), _mm_unpackhi_epi32(lo, signLo)));
+    }
+
+    _mm_storeu_si128((__m128i*)(void*)&lanes[0], accHi);
+    _mm_storeu_si128((__m128i*)(void*)&lanes[2], accLo);
+    acc = ((lanes[0] + lanes[1]) * 65536) + lanes[2] + lanes[3];
+
+    for (; j < taps; j++)
+    {
+        acc += (((sint64)lms->coeffHi[j] * 65536) + (sint64)lms->coeffLo[j]) * (sint64)xw[j];
+    }
+
+    return acc;
+}
+#else
+/*********************************************************************************************************************/
+/*! @brief     Filter sum sum(w[j] * xw[j]) over the time-reversed coefficients (portable C).
+ *
+ *  @param[in]  lms     Filter state.
+ *  @param[in]  xw      numTaps input samples, oldest first.
+ *
+ *  @return     Sum with FIXEDPOINT_LMS_COEFF_SHIFT + SHIFT_16 fractional bits.
+ */
+static sint64 FixedPoint_Lms_Filter(const FixedPoint_Lms16_t* lms, const t_Fixed16* xw)
+{
+    sint64 acc = 0;
+    uint32 j;
+
+    for (j = 0U; j < lms->numTaps; j++)
+    {
+        acc += (((sint64)lms->coeffHi[j] * 65536) + (sint64)lms->coeffLo[j]) * (sint64)xw[j];
+    }
+
+    return acc;
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Step of one sample as mantissa and right shift.
+ *
+ *  The increment of coefficient j is mu * e * x[j] (NLMS: divided by the input power), which is
+ *  m * 2^b * x[j] coefficient LSBs for the exact magnitude m and exponent b below. m is rounded to
+ *  14 bits, so that eM * x[j] fits in 31 bits, and the exponent becomes the shift r.
+ *
+ *  @param[in]  lms     Filter state (power updated for the current sample).
+ *  @param[in]  e       Error of the current sample (!= 0).
+ *  @param[out] eM      Signed step mantissa.
+ *  @param[out] r       Right shift within -32..30, negative for a left shift.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Step exact to the mantissa precision.
+ *  @retval     E_NOT_OK    Step clamped (every coefficient with x[j] != 0 saturates).
+ */
+static Std_ReturnType FixedPoint_Lms_Step(const FixedPoint_Lms16_t* lms, sint32 e, sint32* eM, sint32* r)
+{
+    Std_ReturnType ret = E_OK;
+    const uint64 mag = (uint64)((e < 0) ? -e : e);
+    uint64 m = mag;
+    sint32 b;
+    sint32 shift;
+    uint32 bits = 0U;
+
+    if (lms->mode == FIXEDPOINT_NLMS)
+    {
+        /* m = |e| * 2^k / (power + eps) with the dividend normalized to 62..63 bits */
+        uint32 k = 0U;
+
+        while ((mag << k) < (1ULL << 62U))
+        {
+            k++;
+        }
+        m = (mag << k) / (lms->power + FIXEDPOINT_LMS_NLMS_EPS);
+        b = (sint32)FIXEDPOINT_LMS_COEFF_SHIFT - (sint32)lms->muShift - (sint32)k;
+    }
+    else
+    {
+        b = (sint32)FIXEDPOINT_LMS_COEFF_SHIFT - (2 * (sint32)SHIFT_16) - (sint32)lms->muShift;
+    }
+
+    while ((m >> bits) >= 16384U)
+    {
+        bits++;
+    }
+
+    shift = -(b + (sint32)bits);
+    if (shift > FIXEDPOINT_LMS_STEP_SHIFT_MAX)
+    {
+        bits += (uint32)(shift - FIXEDPOINT_LMS_STEP_SHIFT_MAX);
+        shift = FIXEDPOINT_LMS_STEP_SHIFT_MAX;
+    }
+
+    if (bits >= 64U)
+    {
+        m = 0U;
+    }
+    else if (bits > 0U)
+    {
+        m = ((m >> (bits - 1U)) + 1U) >> 1U;
+    }
+    else
+    {
+        /* Already within 14 bits */
+    }
+
+    if (shift < FIXEDPOINT_LMS_STEP_SHIFT_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_ADAPT, 16, e, 0, FIXEDPOINT_LMS_STEP_MAX);
+        m = FIXEDPOINT_LMS_STEP_MAX;
+        shift = FIXEDPOINT_LMS_STEP_SHIFT_MIN;
+        ret = E_NOT_OK;
+    }
+
+    *eM = (e < 0) ? -(sint32)m : (sint32)m;
+    *r = shift;
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     New value of one coefficient (scalar update).
+ *
+ *  @param[in]      lms     Filter state.
+ *  @param[in]      j       Index into the time-reversed coefficients.
+ *  @param[in]      x       Input sample weighted by the coefficient.
+ *  @param[in]      eM      Step mantissa.
+ *  @param[in]      r       Step shift.
+ *  @param[in,out]  ret     Set to E_NOT_OK if the coefficient saturates.
+ *
+ *  @return     Coefficient after leakage and step, within FIXEDPOINT_LMS_COEFF_MIN..FIXEDPOINT_LMS_COEFF_MAX.
+ */
+static sint32 FixedPoint_Lms_Adapt(const FixedPoint_Lms16_t* lms, uint32 j, t_Fixed16 x, sint32 eM, sint32 r,
+                                   Std_ReturnType* ret)
+{
+    const sint64 w = ((sint64)lms->coeffHi[j] * 65536) + (sint64)lms->coeffLo[j];
+    sint64 v = w;
+
+    if (lms->leakShift > 0U)
+    {
+        v -= FixedPoint_Lms_ShiftRound(w, (sint32)lms->leakShift);
+    }
+    v += FixedPoint_Lms_ShiftRound((sint64)eM * (sint64)x, r);
+
+    if (v > (sint64)FIXEDPOINT_LMS_COEFF_MAX)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_ADAPT, 16, v, 0, FIXEDPOINT_LMS_COEFF_MAX);
+        v = (sint64)FIXEDPOINT_LMS_COEFF_MAX;
+        *ret = E_NOT_OK;
+    }
+    else if (v < (sint64)FIXEDPOINT_LMS_COEFF_MIN)
+    {
+        FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_ADAPT, 16, v, 0, FIXEDPOINT_LMS_COEFF_MIN);
+        v = (sint64)FIXEDPOINT_LMS_COEFF_MIN;
+        *ret = E_NOT_OK;
+    }
+    else
+    {
+        /* In range */
+    }
+
+    return (sint32)v;
+}
+
+#if (FIXEDPOINT_SSE2 == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Leakage and step of 4 coefficients (SSE2).
+ *
+ *  @param[in]  w           hi * 2^16 + unsigned lo as unpacked from the halves.
+ *  @param[in]  p           Step products eM * x.
+ *  @param[in]  half        Rounding constant of the right shift.
+ *  @param[in]  shiftRight  Right shift of the products (r > 0).
+ *  @param[in]  shiftLeft   Left shift of the products (r < 0).
+ *  @param[in]  leak        Leakage shift, 0 = none.
+ *
+ *  @return     New coefficients (no range check).
+ */
+static __m128i FixedPoint_Lms_Adapt4(__m128i w, __m128i p, __m128i half, __m128i shiftRight, __m128i shiftLeft,
+                                     uint32 leak)
+{
+    /* A negative lo borrows 2^16 from hi */
+    __m128i v = _mm_add_epi32(w, _mm_slli_epi32(_mm_srai_epi32(_mm_slli_epi32(w, 16), 31), 16));
+
+    if (leak > 0U)
+    {
+        /* floor((v + 2^(L-1)) / 2^L) = (v >> L) + bit L-1 of v */
+        const __m128i down = _mm_sra_epi32(v, _mm_cvtsi32_si128((int)leak));
+        const __m128i roundBit = _mm_and_si128(_mm_sra_epi32(v, _mm_cvtsi32_si128((int)(leak - 1U))),
+                                               _mm_set1_epi32(1));
+
+        v = _mm_sub_epi32(v, _mm_add_epi32(down, roundBit));
+    }
+
+    return _mm_add_epi32(v, _mm_sll_epi32(_mm_sra_epi32(_mm_add_epi32(p, half), shiftRight), shiftLeft));
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Leakage and step of all coefficients (SSE2).
+ *
+ *  Per 8 coefficients the 32-bit values are assembled from their halves, the step products of the
+ *  8 samples are formed with one 16-bit low and high multiplication, and the new values are split
+ *  again. The vector path needs no per-lane overflow check: it only runs while all 8 coefficients
+ *  are below 2^30 in magnitude (the two top bits of every high half equal) and the increments below
+ *  2^29, so the sum stays below FIXEDPOINT_LMS_COEFF_MAX. Other groups (large coefficients, huge
+ *  left shifted steps) are updated by FixedPoint_Lms_Adapt(), exactly and with saturation.
+ *
+ *  @param[in,out]  lms     Filter state.
+ *  @param[in]      xw      numTaps input samples, oldest first.
+ *  @param[in]      eM      Step mantissa.
+ *  @param[in]      r       Step shift.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No coefficient saturated.
+ *  @retval     E_NOT_OK    At least one coefficient saturated.
+ */
+static Std_ReturnType FixedPoint_Lms_Update(FixedPoint_Lms16_t* lms, const t_Fixed16* xw, sint32 eM, sint32 r)
+{
+    Std_ReturnType ret = E_OK;
+    const uint32 taps = lms->numTaps;
+    const uint32 leak = lms->leakShift;
+    sint16* const coeffHi = lms->coeffHi;
+    sint16* const coeffLo = lms->coeffLo;
+    const __m128i step = _mm_set1_epi16((short)eM);
+    const __m128i half = _mm_set1_epi32((r > 0) ? (1 << (uint32)(r - 1)) : 0);
+    const __m128i shiftRight = _mm_cvtsi32_si128((r > 0) ? (int)r : 0);
+    const __m128i shiftLeft = _mm_cvtsi32_si128((r < 0) ? (int)(-r) : 0);
+    const __m128i boundShift = _mm_cvtsi32_si128((r < 0) ? (int)(29 + r) : 29);
+    uint32 j;
+    uint32 k;
+
+    for (j = 0U; (j + FIXEDPOINT_LMS_LANES) <= taps; j += FIXEDPOINT_LMS_LANES)
+    {
+        const __m128i hi = _mm_loadu_si128((const __m128i*)(const void*)&coeffHi[j]);
+        const __m128i lo = _mm_loadu_si128((const __m128i*)(const void*)&coeffLo[j]);
+        const __m128i x = _mm_loadu_si128((const __m128i*)(const void*)&xw[j]);
+        const __m128i prodLo = _mm_mullo_epi16(x, step);
+        const __m128i prodHi = _mm_mulhi_epi16(x, step);
+        const __m128i p0 = _mm_unpacklo_epi16(prodLo, prodHi);
+        const __m128i p1 = _mm_unpackhi_epi16(prodLo, prodHi);
+        int large = _mm_movemask_epi8(_mm_xor_si128(hi, _mm_slli_epi16(hi, 1))) & 0xAAAA;
+
+        if (r < 0)
+        {
+            /* Left shifted increments must stay below 2^29: p >> (29 - shift) is 0 or -1 */
+            const __m128i b0 = _mm_sra_epi32(p0, boundShift);
+            const __m128i b1 = _mm_sra_epi32(p1, boundShift);
+
+            large |= _mm_movemask_epi8(_mm_cmpeq_epi32(b0, _mm_srai_epi32(b0, 31))) ^ 0xFFFF;
+            large |= _mm_movemask_epi8(_mm_cmpeq_epi32(b1, _mm_srai_epi32(b1, 31))) ^ 0xFFFF;
+        }
+
+        if (large == 0)
+        {
+            const __m128i w0 = FixedPoint_Lms_Adapt4(_mm_unpacklo_epi16(lo, hi), p0, half, shiftRight, shiftLeft, leak);
+            const __m128i w1 = FixedPoint_Lms_Adapt4(_mm_unpackhi_epi16(lo, hi), p1, half, shiftRight, shiftLeft, leak);
+            const __m128i lo0 = _mm_srai_epi32(_mm_slli_epi32(w0, 16), 16);
+            const __m128i lo1 = _mm_srai_epi32(_mm_slli_epi32(w1, 16), 16);
+
+            _mm_storeu_si128((__m128i*)(void*)&coeffHi[j],
+                             _mm_packs_epi32(_mm_srai_epi32(_mm_sub_epi32(w0, lo0), 16),
+                                             _mm_srai_epi32(_mm_sub_epi32(w1, lo1), 16)));
+            _mm_storeu_si128((__m128i*)(void*)&coeffLo[j], _mm_packs_epi32(lo0, lo1));
+        }
+        else
+        {
+            for (k = j; k < (j + FIXEDPOINT_LMS_LANES); k++)
+            {
+                const sint32 v = FixedPoint_Lms_Adapt(lms, k, xw[k], eM, r, &ret);
+                const sint32 low = (sint32)(sint16)(v & 0xFFFF);
+
+                coeffHi[k] = (sint16)((v - low) / 65536);
+                coeffLo[k] = (sint16)low;
+            }
+        }
+    }
+
+    for (; j < taps; j++)
+    {
+        const sint32 v = FixedPoint_Lms_Adapt(lms, j, xw[j], eM, r, &ret);
+        const sint32 low = (sint32)(sint16)(v & 0xFFFF);
+
+        coeffHi[j] = (sint16)((v - low) / 65536);
+        coeffLo[j] = (sint16)low;
+    }
+
+    return ret;
+}
+#else
+/*********************************************************************************************************************/
+/*! @brief     Leakage and step of all coefficients (portable C).
+ *
+ *  @param[in,out]  lms     Filter state.
+ *  @param[in]      xw      numTaps input samples, oldest first.
+ *  @param[in]      eM      Step mantissa.
+ *  @param[in]      r       Step shift.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No coefficient saturated.
+ *  @retval     E_NOT_OK    At least one coefficient saturated.
+ */
+static Std_ReturnType FixedPoint_Lms_Update(FixedPoint_Lms16_t* lms, const t_Fixed16* xw, sint32 eM, sint32 r)
+{
+    Std_ReturnType ret = E_OK;
+    uint32 j;
+
+    for (j = 0U; j < lms->numTaps; j++)
+    {
+        const sint32 v = FixedPoint_Lms_Adapt(lms, j, xw[j], eM, r, &ret);
+        const sint32 low = (sint32)(sint16)(v & 0xFFFF);
+
+        lms->coeffHi[j] = (sint16)((v - low) / 65536);
+        lms->coeffLo[j] = (sint16)low;
+    }
+
+    return ret;
+}
+#endif
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up an adaptive filter with zero coefficients and an empty input history.
+ *
+ *  @param[out] lms         Filter state.
+ *  @param[in]  mode        FIXEDPOINT_LMS or FIXEDPOINT_NLMS.
+ *  @param[in]  numTaps     Number of coefficients (>= 1).
+ *  @param[in]  coeffs      Coefficient storage of FIXEDPOINT_LMS_COEFF_LEN(numTaps) elements.
+ *  @param[in]  state       State buffer of FIXEDPOINT_LMS_STATE_LEN(numTaps, blockLen) samples.
+ *  @param[in]  blockLen    Samples processed per pass (>= 1); longer calls are split.
+ *  @param[in]  muShift     Step size mu = 2^-muShift (0..31).
+ *  @param[in]  leakShift   Leakage factor 1 - 2^-leakShift per sample (1..31), 0 for none.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Filter ready.
+ *  @retval     E_NOT_OK    Null pointer or invalid parameter.
+ */
+Std_ReturnType FixedPoint_Lms16_Init(FixedPoint_Lms16_t* lms, FixedPoint_LmsMode_t mode, uint32 numTaps,
+                                     sint16* coeffs, t_Fixed16* state, uint32 blockLen, uint32 muShift,
+                                     uint32 leakShift)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((lms != NULL) && (coeffs != NULL) && (state != NULL) && (numTaps >= 1U) && (blockLen >= 1U) &&
+        (muShift <= 31U) && (leakShift <= 31U) && ((mode == FIXEDPOINT_LMS) || (mode == FIXEDPOINT_NLMS)))
+    {
+        uint32 i;
+
+        for (i = 0U; i < FIXEDPOINT_LMS_COEFF_LEN(numTaps); i++)
+        {
+            coeffs[i] = 0;
+        }
+        for (i = 0U; i < numTaps; i++)
+        {
+            state[i] = 0;
+        }
+
+        lms->coeffHi = coeffs;
+        lms->coeffLo = &coeffs[numTaps];
+        lms->state = state;
+        lms->power = 0U;
+        lms->numTaps = numTaps;
+        lms->blockLen = blockLen;
+        lms->muShift = muShift;
+        lms->leakShift = leakShift;
+        lms->mode = mode;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Load coefficients, e.g. a previously converged filter.
+ *
+ *  @param[in,out]  lms     Filter state.
+ *  @param[in]      w       numTaps coefficients, w[k] weights x[n-k], FIXEDPOINT_LMS_COEFF_SHIFT fractional bits.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Coefficients loaded.
+ *  @retval     E_NOT_OK    Null pointer or a coefficient clamped to FIXEDPOINT_LMS_COEFF_MIN..FIXEDPOINT_LMS_COEFF_MAX.
+ */
+Std_ReturnType FixedPoint_Lms16_SetCoeffs(FixedPoint_Lms16_t* lms, const sint32* w)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((lms != NULL) && (w != NULL))
+    {
+        uint32 k;
+
+        ret = E_OK;
+
+        for (k = 0U; k < lms->numTaps; k++)
+        {
+            const uint32 j = (lms->numTaps - 1U) - k;
+            sint32 v = w[k];
+            sint32 low;
+
+            if (v > FIXEDPOINT_LMS_COEFF_MAX)
+            {
+                v = FIXEDPOINT_LMS_COEFF_MAX;
+                ret = E_NOT_OK;
+            }
+            else if (v < FIXEDPOINT_LMS_COEFF_MIN)
+            {
+                v = FIXEDPOINT_LMS_COEFF_MIN;
+                ret = E_NOT_OK;
+            }
+            else
+            {
+                /* In range */
+            }
+
+            low = (sint32)(sint16)(v & 0xFFFF);
+            lms->coeffHi[j] = (sint16)((v - low) / 65536);
+            lms->coeffLo[j] = (sint16)low;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read the coefficients.
+ *
+ *  @param[in]  lms     Filter state.
+ *  @param[out] w       numTaps coefficients, w[k] weights x[n-k], FIXEDPOINT_LMS_COEFF_SHIFT fractional bits.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Coefficients copied.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Lms16_GetCoeffs(const FixedPoint_Lms16_t* lms, sint32* w)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((lms != NULL) && (w != NULL))
+    {
+        uint32 k;
+
+        for (k = 0U; k < lms->numTaps; k++)
+        {
+            const uint32 j = (lms->numTaps - 1U) - k;
+
+            w[k] = (sint32)(((sint64)lms->coeffHi[j] * 65536) + (sint64)lms->coeffLo[j]);
+        }
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Filter a block of samples and adapt the coefficients after every sample (adaptive filter kernel).
+ *
+ *  For echo or noise cancellation in is the reference signal (far end, noise pickup), ref the
+ *  signal containing its filtered copy and err the cleaned signal. Samples before the block are
+ *  taken from the state, so consecutive blocks form a continuous stream.
+ *
+ *  @param[in,out]  lms     Filter state.
+ *  @param[in]      in      Filter input x in configured 16-bit Q-format.
+ *  @param[in]      ref     Desired signal d in configured 16-bit Q-format.
+ *  @param[out]     out     Filter output y in configured 16-bit Q-format.
+ *  @param[out]     err     Error e = d - y in configured 16-bit Q-format.
+ *  @param[in]      len     Number of samples.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All samples processed without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of an output, error, step or coefficient.
+ */
+Std_ReturnType FixedPoint_Lms16(FixedPoint_Lms16_t* lms, const t_Fixed16* in, const t_Fixed16* ref,
+                                t_Fixed16* out, t_Fixed16* err, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Lms16");
+
+    if ((lms != NULL) && (in != NULL) && (ref != NULL) && (out != NULL) && (err != NULL))
+    {
+        const uint32 taps = lms->numTaps;
+        t_Fixed16* const s = lms->state;
+        uint32 done = 0U;
+
+        ret = E_OK;
+
+        while (done < len)
+        {
+            const uint32 count = ((len - done) < lms->blockLen) ? (len - done) : lms->blockLen;
+            uint32 n;
+
+            for (n = 0U; n < count; n++)
+            {
+                s[taps + n] = in[done + n];
+            }
+
+            for (n = 0U; n < count; n++)
+            {
+                /* Window of the taps, oldest first: s[n + 1] = x[n - (numTaps - 1)] .. s[n + numTaps] = x[n] */
+                const t_Fixed16* const xw = &s[n + 1U];
+                const sint64 acc = FixedPoint_Lms_Filter(lms, xw);
+                sint64 y = FixedPoint_Lms_Round(acc, FIXEDPOINT_LMS_COEFF_SHIFT);
+                sint32 e;
+                sint32 eM = 0;
+                sint32 r = 0;
+
+                if (y > (sint64)FIX16_MAX)
+                {
+                    FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, acc, 0, FIX16_MAX);
+                    y = (sint64)FIX16_MAX;
+                    ret = E_NOT_OK;
+                }
+                else if (y < (sint64)FIX16_MIN)
+                {
+                    FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, acc, 0, FIX16_MIN);
+                    y = (sint64)FIX16_MIN;
+                    ret = E_NOT_OK;
+                }
+                else
+                {
+                    /* In range */
+                }
+                out[done + n] = (t_Fixed16)y;
+
+                /* The exact 17-bit error drives the update, the output is saturated */
+                e = (sint32)ref[done + n] - (sint32)y;
+                if (e > (sint32)FIX16_MAX)
+                {
+                    FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, e, 0, FIX16_MAX);
+                    err[done + n] = (t_Fixed16)FIX16_MAX;
+                    ret = E_NOT_OK;
+                }
+                else if (e < (sint32)FIX16_MIN)
+                {
+                    FIXEDPOINT_PROBE_SATURATE(FIXEDPOINT_PROBE_OP_NARROW, 16, e, 0, FIX16_MIN);
+                    err[done + n] = (t_Fixed16)FIX16_MIN;
+                    ret = E_NOT_OK;
+                }
+                else
+                {
+                    err[done + n] = (t_Fixed16)e;
+                }
+
+                if (lms->mode == FIXEDPOINT_NLMS)
+                {
+                    lms->power += (uint64)((sint64)xw[taps - 1U] * (sint64)xw[taps - 1U]);
+                    lms->power -= (uint64)((sint64)s[n] * (sint64)s[n]);
+                }
+
+                if (e != 0)
+                {
+                    ret |= FixedPoint_Lms_Step(lms, e, &eM, &r);
+                }
+
+                if ((eM != 0) || (lms->leakShift > 0U))
+                {
+                    ret |= FixedPoint_Lms_Update(lms, xw, eM, r);
+                }
+            }
+
+            /* Keep the last numTaps samples as history */
+            for (n = 0U; n < taps; n++)
+            {
+                s[n] = s[count + n];
+            }
+
+            done += count;
+        }
+    }
+
+    FIXEDPOINT_TRACE_END("Lms16");
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,102 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Lms.h
+
+@brief      Interface for the 16-bit LMS / NLMS adaptive FIR filter.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_LMS_H
+#define FIXED_POINT_LMS_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Samples of the state buffer of a filter with numTaps taps processing blocks of up to blockLen samples. */
+#define FIXEDPOINT_LMS_STATE_LEN(numTaps, blockLen)     ((numTaps) + (blockLen))
+
+/** @brief Elements of the coefficient storage of a filter with numTaps taps (high and low halves). */
+#define FIXEDPOINT_LMS_COEFF_LEN(numTaps)               (2U * (numTaps))
+
+/** @brief Largest coefficient; keeps the high half of the coefficient storage within 16 bits. */
+#define FIXEDPOINT_LMS_COEFF_MAX        (0x7FFF7FFFL)
+
+/** @brief Smallest coefficient. */
+#define FIXEDPOINT_LMS_COEFF_MIN        (-2147483647L - 1L)
+
+/** @brief Coefficient value 1.0 in the Q-format of the LMS coefficients. */
+#define FIXEDPOINT_LMS_COEFF_ONE        (1L << FIXEDPOINT_LMS_COEFF_SHIFT)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Adaptation rule. */
+typedef enum
+{
+    FIXEDPOINT_LMS = 0,     /**< w += mu * e * x */
+    FIXEDPOINT_NLMS         /**< w += mu * e * x / (sum(x^2) + FIXEDPOINT_LMS_NLMS_EPS) */
+} FixedPoint_LmsMode_t;
+
+/** @brief   State of a 16-bit adaptive FIR filter processed block by block.
+ *
+ *  The 32-bit coefficients w (FIXEDPOINT_LMS_COEFF_SHIFT fractional bits) are stored as two 16-bit
+ *  halves w = hi * 2^16 + lo with signed lo, time-reversed to match the state buffer; use
+ *  FixedPoint_Lms16_GetCoeffs() / FixedPoint_Lms16_SetCoeffs() to access them in natural order.
+ */
+typedef struct
+{
+    sint16*              coeffHi;    /**< High halves, coeffHi[numTaps-1-k] belongs to x[n-k] */
+    sint16*              coeffLo;    /**< Low halves */
+    t_Fixed16*           state;      /**< Input history (numTaps samples) followed by the current block */
+    uint64               power;      /**< sum(x^2) over the taps, 2 * SHIFT_16 fractional bits (NLMS) */
+    uint32               numTaps;    /**< Number of coefficients */
+    uint32               blockLen;   /**< Largest number of samples processed per pass */
+    uint32               muShift;    /**< Step size mu = 2^-muShift */
+    uint32               leakShift;  /**< Leakage w -= w * 2^-leakShift per sample, 0 = none */
+    FixedPoint_LmsMode_t mode;       /**< Adaptation rule */
+} FixedPoint_Lms16_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Lms16_Init(FixedPoint_Lms16_t* lms, FixedPoint_LmsMode_t mode, uint32 numTaps,
+                                            sint16* coeffs, t_Fixed16* state, uint32 blockLen, uint32 muShift,
+                                            uint32 leakShift);
+extern Std_ReturnType FixedPoint_Lms16_SetCoeffs(FixedPoint_Lms16_t* lms, const sint32* w);
+extern Std_ReturnType FixedPoint_Lms16_GetCoeffs(const FixedPoint_Lms16_t* lms, sint32* w);
+extern Std_ReturnType FixedPoint_Lms16(FixedPoint_Lms16_t* lms, const t_Fixed16* in, const t_Fixed16* ref,
+                                       t_Fixed16* out, t_Fixed16* err, uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_LMS_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
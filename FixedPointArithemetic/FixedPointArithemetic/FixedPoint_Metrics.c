@@ -0,0 +1,436 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Metrics.c
+
+@brief      Runtime counters and their export in Prometheus text format.
+ *
+ * Detailed Description:
+ * - The float interface counts its calls, the saturation and division by zero hooks count
+ *   saturations (see FixedPoint_Probe.h) and the batch kernels count calls, clock ticks and the
+ *   bytes they read and wrote.
+ * - Every thread counts into its own slot of a static pool, claimed with an atomic increment on
+ *   its first count. Counting takes no lock and no atomic operation. Threads beyond
+ *   FIXEDPOINT_METRICS_MAX_THREADS are not counted; the number of these threads is exported instead.
+ * - FixedPoint_Metrics_Snapshot() sums the slots of all threads. The counters only grow, so a
+ *   snapshot taken while other threads count is at most a few events behind. On targets without
+ *   atomic 64-bit stores a single counter may be read torn.
+ * - FixedPoint_Metrics_Write() prints the snapshot in the Prometheus text exposition format to a
+ *   file, a pipe or a connected socket stream. FixedPoint_Metrics_WriteFile() writes a temporary
+ *   file and renames it, as expected by the textfile collector of the node exporter.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Adaptive filter operation code counted
+01.02.00  2026-10-18  AGT    Saturations of the 32-bit format counted
+01.03.00  2026-10-18  AGT    Slot claimed with an atomic increment instead of the exclusive area
+01.04.00  2026-10-18  AGT    Threads beyond the pool counted as dropped instead of sharing a slot
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include <string.h>            /* for memset, memcpy, strlen */
+#include "FixedPoint_Metrics.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Maximum length of the path given to FixedPoint_Metrics_WriteFile(). */
+#define FIXEDPOINT_METRICS_PATH_MAX     (256U)
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Counter slots, one per thread. */
+static FixedPoint_Metrics_t FixedPoint_MetricsSlots[FIXEDPOINT_METRICS_MAX_THREADS];
+
+/** @brief Number of claim attempts; slots [0, min(count, FIXEDPOINT_METRICS_MAX_THREADS)) are in use. */
+static volatile uint32 FixedPoint_MetricsSlotCount = 0U;
+
+/** @brief Threads that found the pool exhausted and are not counted. */
+static volatile uint32 FixedPoint_MetricsDropped = 0U;
+
+/** @brief Slot of the calling thread, NULL until its first count. */
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_Metrics_t* FixedPoint_MetricsSlot = NULL;
+
+/** @brief Set once the calling thread found the pool exhausted. */
+static FIXEDPOINT_THREAD_LOCAL boolean FixedPoint_MetricsNoSlot = 0U;
+
+/** @brief Time source, NULL for no kernel timing. */
+static FixedPoint_MetricsClock_t FixedPoint_MetricsClock = NULL;
+
+/** @brief Clock ticks per second. */
+static double FixedPoint_MetricsTicksPerSecond = 1.0;
+
+/** @brief Label values of the operation codes. */
+static const char* const FixedPoint_MetricsOpNames[FIXEDPOINT_METRICS_OPS] =
+{
+    "add", "sub", "mult", "div", "convert", "narrow", "adapt"
+};
+
+/** @brief Label values of the batch kernels. */
+static const char* const FixedPoint_MetricsKernelNames[FIXEDPOINT_KERNEL_COUNT] =
+{
+    "add16_array", "sub16_array", "mult16_array", "div16_array", "mult8_array", "div8_array",
+    "op16_strided", "dot16", "fir16"
+};
+
+/** @brief Label values of the widths. */
+static const char* const FixedPoint_MetricsWidthNames[FIXEDPOINT_METRICS_WIDTHS] = { "16", "8", "32" };
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static FixedPoint_Metrics_t* FixedPoint_Metrics_GetSlot(void);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Slot of the calling thread, claimed on the first call.
+ *
+ *  The pool index is taken with an atomic fetch-add, which also holds if the exclusive area is
+ *  left empty: threads counting for the first time at the same moment never share a slot. A
+ *  thread that finds the pool exhausted is counted once as dropped and counts nothing.
+ *
+ *  @return     FixedPoint_Metrics_t*
+ *  @retval     Counter slot of the calling thread, NULL if the pool is exhausted.
+ */
+static FixedPoint_Metrics_t* FixedPoint_Metrics_GetSlot(void)
+{
+    FixedPoint_Metrics_t* slot = FixedPoint_MetricsSlot;
+
+    if ((slot == NULL) && (FixedPoint_MetricsNoSlot == 0U))
+    {
+        const uint32 index = FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_MetricsSlotCount, 1U);
+
+        if (index < FIXEDPOINT_METRICS_MAX_THREADS)
+        {
+            slot = &FixedPoint_MetricsSlots[index];
+            FixedPoint_MetricsSlot = slot;
+        }
+        else
+        {
+            (void)FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_MetricsDropped, 1U);
+            FixedPoint_MetricsNoSlot = 1U;
+        }
+    }
+
+    return slot;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set the time source of the kernel timing.
+ *
+ *  @param[in]  clock           Time source in ticks, NULL to count kernel calls and bytes only.
+ *  @param[in]  ticksPerSecond  Clock ticks per second (> 0).
+ */
+void FixedPoint_Metrics_Init(FixedPoint_MetricsClock_t clock, double ticksPerSecond)
+{
+    FixedPoint_MetricsTicksPerSecond = (ticksPerSecond > 0.0) ? ticksPerSecond : 1.0;
+    FixedPoint_MetricsClock = clock;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Current time of the kernel timing (use FIXEDPOINT_METRICS_KERNEL_BEGIN()).
+ *
+ *  @return     uint64
+ *  @retval     Clock ticks, 0 without time source.
+ */
+uint64 FixedPoint_Metrics_Now(void)
+{
+    return (FixedPoint_MetricsClock != NULL) ? FixedPoint_MetricsClock() : 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Count a call of the float interface (use FIXEDPOINT_METRICS_CALL()).
+ *
+ *  @param[in]  op      FixedPoint_Operation_t.
+ *  @param[in]  width   16 or 8.
+ */
+void FixedPoint_Metrics_Call(uint8 op, uint8 width)
+{
+    FixedPoint_Metrics_t* const slot = FixedPoint_Metrics_GetSlot();
+
+    if ((slot != NULL) && (op < FIXEDPOINT_METRICS_OPS))
+    {
+        slot->calls[(width == 16U) ? 0U : 1U][op]++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Count a saturation (use FIXEDPOINT_METRICS_SATURATE()).
+ *
+ *  @param[in]  op      FixedPoint_Operation_t or FIXEDPOINT_PROBE_OP_ code.
+ *  @param[in]  width   16, 8 or 32.
+ */
+void FixedPoint_Metrics_Saturation(uint8 op, uint8 width)
+{
+    FixedPoint_Metrics_t* const slot = FixedPoint_Metrics_GetSlot();
+
+    if ((slot != NULL) && (op < FIXEDPOINT_METRICS_OPS))
+    {
+        slot->saturations[(width == 16U) ? 0U : ((width == 8U) ? 1U : 2U)][op]++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Count a rejected division by zero (use FIXEDPOINT_METRICS_DIV_ZERO()).
+ *
+ *  @param[in]  width   16 or 8.
+ */
+void FixedPoint_Metrics_DivZero(uint8 width)
+{
+    FixedPoint_Metrics_t* const slot = FixedPoint_Metrics_GetSlot();
+
+    if (slot != NULL)
+    {
+        slot->divZero[(width == 16U) ? 0U : 1U]++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Count a batch kernel call (use FIXEDPOINT_METRICS_KERNEL_END()).
+ *
+ *  @param[in]  kernel  Batch kernel.
+ *  @param[in]  start   Time at the start of the call (FixedPoint_Metrics_Now()).
+ *  @param[in]  bytes   Bytes read and written by the call.
+ */
+void FixedPoint_Metrics_Kernel(FixedPoint_Kernel_t kernel, uint64 start, uint64 bytes)
+{
+    const uint64 end = FixedPoint_Metrics_Now();
+    FixedPoint_Metrics_t* const slot = FixedPoint_Metrics_GetSlot();
+
+    if ((slot != NULL) && ((uint32)kernel < (uint32)FIXEDPOINT_KERNEL_COUNT))
+    {
+        slot->kernelCalls[kernel]++;
+        slot->kernelTicks[kernel] += end - start;
+        slot->kernelBytes[kernel] += bytes;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Sum the counters of all threads.
+ *
+ *  @param[out] total   Pointer to store the sums.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Snapshot taken.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Metrics_Snapshot(FixedPoint_Metrics_t* total)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (total != NULL)
+    {
+        const uint32 count = FixedPoint_MetricsSlotCount;
+        const uint32 slots = (count < FIXEDPOINT_METRICS_MAX_THREADS) ? count : FIXEDPOINT_METRICS_MAX_THREADS;
+        uint32 s;
+        uint32 w;
+        uint32 k;
+
+        (void)memset(total, 0, sizeof(*total));
+
+        for (s = 0U; s < slots; s++)
+        {
+            const FixedPoint_Metrics_t* const slot = &FixedPoint_MetricsSlots[s];
+
+            for (w = 0U; w < FIXEDPOINT_METRICS_WIDTHS; w++)
+            {
+                for (k = 0U; k < FIXEDPOINT_METRICS_OPS; k++)
+                {
+                    total->saturations[w][k] += slot->saturations[w][k];
+                }
+            }
+            for (w = 0U; w < 2U; w++)
+            {
+                for (k = 0U; k < FIXEDPOINT_METRICS_OPS; k++)
+                {
+                    total->calls[w][k] += slot->calls[w][k];
+                }
+                total->divZero[w] += slot->divZero[w];
+            }
+            for (k = 0U; k < (uint32)FIXEDPOINT_KERNEL_COUNT; k++)
+            {
+                total->kernelCalls[k] += slot->kernelCalls[k];
+                total->kernelTicks[k] += slot->kernelTicks[k];
+                total->kernelBytes[k] += slot->kernelBytes[k];
+            }
+        }
+        total->droppedThreads = FixedPoint_MetricsDropped;
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Write a snapshot of the counters in Prometheus text exposition format.
+ *
+ *  @param[in]  file    Output stream (file, pipe or connected socket opened with fdopen()).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Metrics written.
+ *  @retval     E_NOT_OK    Null pointer or write error.
+ */
+Std_ReturnType FixedPoint_Metrics_Write(FILE* file)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_Metrics_t total;
+
+    if ((file != NULL) && (FixedPoint_Metrics_Snapshot(&total) == E_OK))
+    {
+        int err = 0;
+        uint32 w;
+        uint32 k;
+
+        err |= fprintf(file, "# HELP fixedpoint_calls_total Calls of the float interface.\n"
+                             "# TYPE fixedpoint_calls_total counter\n");
+        for (w = 0U; w < 2U; w++)
+        {
+            for (k = 0U; k <= (uint32)FIXEDPOINT_OP_DIV; k++)
+            {
+                err |= fprintf(file, "fixedpoint_calls_total{op=\"%s\",width=\"%s\"} %llu\n",
+                               FixedPoint_MetricsOpNames[k], FixedPoint_MetricsWidthNames[w],
+                               (unsigned long long)total.calls[w][k]);
+            }
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_saturations_total Results saturated to the format limits.\n"
+                             "# TYPE fixedpoint_saturations_total counter\n");
+        for (w = 0U; w < FIXEDPOINT_METRICS_WIDTHS; w++)
+        {
+            for (k = 0U; k < FIXEDPOINT_METRICS_OPS; k++)
+            {
+                err |= fprintf(file, "fixedpoint_saturations_total{op=\"%s\",width=\"%s\"} %llu\n",
+                               FixedPoint_MetricsOpNames[k], FixedPoint_MetricsWidthNames[w],
+                               (unsigned long long)total.saturations[w][k]);
+            }
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_division_by_zero_total Rejected divisions by zero.\n"
+                             "# TYPE fixedpoint_division_by_zero_total counter\n");
+        for (w = 0U; w < 2U; w++)
+        {
+            err |= fprintf(file, "fixedpoint_division_by_zero_total{width=\"%s\"} %llu\n",
+                           FixedPoint_MetricsWidthNames[w], (unsigned long long)total.divZero[w]);
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_kernel_calls_total Calls of the batch kernels.\n"
+                             "# TYPE fixedpoint_kernel_calls_total counter\n");
+        for (k = 0U; k < (uint32)FIXEDPOINT_KERNEL_COUNT; k++)
+        {
+            err |= fprintf(file, "fixedpoint_kernel_calls_total{kernel=\"%s\"} %llu\n",
+                           FixedPoint_MetricsKernelNames[k], (unsigned long long)total.kernelCalls[k]);
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_kernel_seconds_total Time spent in the batch kernels.\n"
+                             "# TYPE fixedpoint_kernel_seconds_total counter\n");
+        for (k = 0U; k < (uint32)FIXEDPOINT_KERNEL_COUNT; k++)
+        {
+            err |= fprintf(file, "fixedpoint_kernel_seconds_total{kernel=\"%s\"} %.9f\n",
+                           FixedPoint_MetricsKernelNames[k],
+                           (double)total.kernelTicks[k] / FixedPoint_MetricsTicksPerSecond);
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_kernel_bytes_total Bytes read and written by the batch kernels.\n"
+                             "# TYPE fixedpoint_kernel_bytes_total counter\n");
+        for (k = 0U; k < (uint32)FIXEDPOINT_KERNEL_COUNT; k++)
+        {
+            err |= fprintf(file, "fixedpoint_kernel_bytes_total{kernel=\"%s\"} %llu\n",
+                           FixedPoint_MetricsKernelNames[k], (unsigned long long)total.kernelBytes[k]);
+        }
+
+        err |= fprintf(file, "# HELP fixedpoint_metrics_dropped_threads Threads beyond the counter pool, not counted.\n"
+                             "# TYPE fixedpoint_metrics_dropped_threads gauge\n"
+                             "fixedpoint_metrics_dropped_threads %llu\n", (unsigned long long)total.droppedThreads);
+
+        /* fprintf returns a negative value on error, which sets the sign bit of err */
+        ret = ((err >= 0) && (fflush(file) == 0)) ? E_OK : E_NOT_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Replace a metrics file with a new snapshot (node exporter textfile collector).
+ *
+ *  The metrics are written to "<path>.tmp", which is then renamed to path, so that a scraper
+ *  never reads a partly written file. The rename replaces the file atomically on POSIX systems.
+ *
+ *  @param[in]  path    Path of the metrics file, e.g. /var/lib/node_exporter/fixedpoint.prom.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        File written.
+ *  @retval     E_NOT_OK    Null pointer, path too long or file error.
+ */
+Std_ReturnType FixedPoint_Metrics_WriteFile(const char* path)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    char tmpPath[FIXEDPOINT_METRICS_PATH_MAX + 5U];
+    const size_t pathLen = (path != NULL) ? strlen(path) : 0U;
+
+    if ((path != NULL) && (pathLen <= FIXEDPOINT_METRICS_PATH_MAX))
+    {
+        FILE* file;
+
+        (void)memcpy(tmpPath, path, pathLen);
+        (void)memcpy(&tmpPath[pathLen], ".tmp", 5U);
+
+        file = fopen(tmpPath, "w");
+        if (file != NULL)
+        {
+            ret = FixedPoint_Metrics_Write(file);
+            if (fclose(file) != 0)
+            {
+                ret = E_NOT_OK;
+            }
+
+            if (ret == E_OK)
+            {
+#if defined(_MSC_VER)
+                /* rename does not replace an existing file on Windows */
+                (void)remove(path);
+#endif
+                if (rename(tmpPath, path) != 0)
+                {
+                    ret = E_NOT_OK;
+                }
+            }
+        }
+    }
+
+    return ret;
+}
+#endif
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,137 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Metrics.h
+
+@brief      Interface for the runtime counters and their export in Prometheus text format.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Adaptive filter operation code counted
+01.02.00  2026-10-18  AGT   Saturations of the 32-bit format counted
+01.03.00  2026-10-18  AGT   Added number of threads not counted
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_METRICS_H
+#define FIXED_POINT_METRICS_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include <stdio.h>
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of counted operation codes: FixedPoint_Operation_t and the FIXEDPOINT_PROBE_OP_ codes. */
+#define FIXEDPOINT_METRICS_OPS      (7U)
+
+/** @brief Number of counted widths of the saturations: 16, 8 and 32 bit. */
+#define FIXEDPOINT_METRICS_WIDTHS   (3U)
+
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+/** @brief Count a call of the float interface. */
+#define FIXEDPOINT_METRICS_CALL(op, width)                  FixedPoint_Metrics_Call((uint8)(op), (uint8)(width))
+
+/** @brief Count a saturation. */
+#define FIXEDPOINT_METRICS_SATURATE(op, width)              FixedPoint_Metrics_Saturation((uint8)(op), (uint8)(width))
+
+/** @brief Count a rejected division by zero. */
+#define FIXEDPOINT_METRICS_DIV_ZERO(width)                  FixedPoint_Metrics_DivZero((uint8)(width))
+
+/** @brief Start timing a batch kernel call (declares the start time, place after the declarations). */
+#define FIXEDPOINT_METRICS_KERNEL_BEGIN()                   const uint64 metricsStart = FixedPoint_Metrics_Now()
+
+/** @brief Count a batch kernel call with its time and the bytes it read and wrote. */
+#define FIXEDPOINT_METRICS_KERNEL_END(kernel, bytes)        FixedPoint_Metrics_Kernel((kernel), metricsStart, (uint64)(bytes))
+#else
+/** @brief Metrics disabled: no code is generated. */
+#define FIXEDPOINT_METRICS_CALL(op, width)                  do { } while (0)
+
+/** @brief Metrics disabled: no code is generated. */
+#define FIXEDPOINT_METRICS_SATURATE(op, width)              do { } while (0)
+
+/** @brief Metrics disabled: no code is generated. */
+#define FIXEDPOINT_METRICS_DIV_ZERO(width)                  do { } while (0)
+
+/** @brief Metrics disabled: no code is generated. */
+#define FIXEDPOINT_METRICS_KERNEL_BEGIN()
+
+/** @brief Metrics disabled: no code is generated. */
+#define FIXEDPOINT_METRICS_KERNEL_END(kernel, bytes)        do { } while (0)
+#endif
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Batch kernels with call, time and byte counters. */
+typedef enum
+{
+    FIXEDPOINT_KERNEL_ADD16_ARRAY = 0,
+    FIXEDPOINT_KERNEL_SUB16_ARRAY,
+    FIXEDPOINT_KERNEL_MULT16_ARRAY,
+    FIXEDPOINT_KERNEL_DIV16_ARRAY,
+    FIXEDPOINT_KERNEL_MULT8_ARRAY,
+    FIXEDPOINT_KERNEL_DIV8_ARRAY,
+    FIXEDPOINT_KERNEL_OP16_STRIDED,
+    FIXEDPOINT_KERNEL_DOT16,
+    FIXEDPOINT_KERNEL_FIR16,
+    FIXEDPOINT_KERNEL_COUNT         /**< Number of kernels */
+} FixedPoint_Kernel_t;
+
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+/** @brief   Runtime counters. Index [0] of a width dimension is 16-bit, [1] is 8-bit, [2] is 32-bit. */
+typedef struct
+{
+    uint64 calls[2][FIXEDPOINT_METRICS_OPS];        /**< Calls of the float interface per width and operation */
+    uint64 saturations[FIXEDPOINT_METRICS_WIDTHS][FIXEDPOINT_METRICS_OPS];  /**< Saturations per width and code */
+    uint64 divZero[2];                              /**< Rejected divisions by zero per width */
+    uint64 kernelCalls[FIXEDPOINT_KERNEL_COUNT];    /**< Calls per batch kernel */
+    uint64 kernelTicks[FIXEDPOINT_KERNEL_COUNT];    /**< Clock ticks spent per batch kernel */
+    uint64 kernelBytes[FIXEDPOINT_KERNEL_COUNT];    /**< Bytes read and written per batch kernel */
+    uint64 droppedThreads;                          /**< Threads beyond FIXEDPOINT_METRICS_MAX_THREADS, not counted */
+} FixedPoint_Metrics_t;
+
+/** @brief   Time source of the kernel timing in ticks, provided by the platform. */
+typedef uint64 (*FixedPoint_MetricsClock_t)(void);
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern void FixedPoint_Metrics_Init(FixedPoint_MetricsClock_t clock, double ticksPerSecond);
+extern uint64 FixedPoint_Metrics_Now(void);
+extern void FixedPoint_Metrics_Call(uint8 op, uint8 width);
+extern void FixedPoint_Metrics_Saturation(uint8 op, uint8 width);
+extern void FixedPoint_Metrics_DivZero(uint8 width);
+extern void FixedPoint_Metrics_Kernel(FixedPoint_Kernel_t kernel, uint64 start, uint64 bytes);
+extern Std_ReturnType FixedPoint_Metrics_Snapshot(FixedPoint_Metrics_t* total);
+extern Std_ReturnType FixedPoint_Metrics_Write(FILE* file);
+extern Std_ReturnType FixedPoint_Metrics_WriteFile(const char* path);
+#endif
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_METRICS_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
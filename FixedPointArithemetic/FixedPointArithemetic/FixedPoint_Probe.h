@@ -0,0 +1,114 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Probe.h
+
+@brief      Hooks at the saturation and division by zero paths (USDT probes, saturation log, metrics).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Saturation log hook added
+01.02.00  2026-10-18  AGT   Metrics hook added
+01.03.00  2026-10-18  AGT   Adaptive filter operation code added
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_PROBE_H
+#define FIXED_POINT_PROBE_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+#include "FixedPoint_SatLog.h" /**< Saturation log interface*/
+#include "FixedPoint_Metrics.h" /**< Runtime counters interface*/
+
+#if (FIXEDPOINT_USDT_ENABLE == 1U)
+#include <sys/sdt.h>
+#endif
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Probe operation code of a float to fixed-point conversion (codes 0..3 are FixedPoint_Operation_t). */
+#define FIXEDPOINT_PROBE_OP_CONVERT     (4)
+
+/** @brief Probe operation code of narrowing a 64-bit accumulator (Dot16, Fir16). */
+#define FIXEDPOINT_PROBE_OP_NARROW      (5)
+
+/** @brief Probe operation code of an adaptive filter update (coefficient or step size clamped, LMS16). */
+#define FIXEDPOINT_PROBE_OP_ADAPT       (6)
+
+#if (FIXEDPOINT_USDT_ENABLE == 1U)
+/** @brief Address the probing function returns to, i.e. the call site of the first non-inlined function. */
+#define FIXEDPOINT_PROBE_CALLER()       __builtin_return_address(0)
+
+/** @brief USDT probe fixedpoint:saturate(op, width, a, b, caller).
+ *
+ *  For FIXEDPOINT_PROBE_OP_CONVERT a is the rounded scaled input, for FIXEDPOINT_PROBE_OP_NARROW the
+ *  accumulator and for FIXEDPOINT_PROBE_OP_ADAPT the unclamped coefficient or the error of a clamped step;
+ *  b is 0 in these cases.
+ */
+#define FIXEDPOINT_USDT_SATURATE(op, width, a, b) \
+    DTRACE_PROBE5(fixedpoint, saturate, (int)(op), (int)(width), (sint64)(a), (sint64)(b), \
+                  FIXEDPOINT_PROBE_CALLER())
+
+/** @brief USDT probe fixedpoint:div_zero(width, a, caller). */
+#define FIXEDPOINT_USDT_DIV_ZERO(width, a) \
+    DTRACE_PROBE3(fixedpoint, div_zero, (int)(width), (sint64)(a), FIXEDPOINT_PROBE_CALLER())
+#else
+/** @brief USDT probes disabled: no code is generated. */
+#define FIXEDPOINT_USDT_SATURATE(op, width, a, b)   do { } while (0)
+
+/** @brief USDT probes disabled: no code is generated. */
+#define FIXEDPOINT_USDT_DIV_ZERO(width, a)          do { } while (0)
+#endif
+
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+/** @brief Record a saturating operation in the saturation log of the calling thread. */
+#define FIXEDPOINT_SATLOG_RECORD(op, width, a, b, result) \
+    FixedPoint_SatLog_Record((uint8)(op), (uint8)(width), (sint64)(a), (sint64)(b), (sint32)(result))
+#else
+/** @brief Saturation log disabled: no code is generated. */
+#define FIXEDPOINT_SATLOG_RECORD(op, width, a, b, result)   do { } while (0)
+#endif
+
+/** @brief Hook of a saturation branch, placed before the result is clamped to result. */
+#define FIXEDPOINT_PROBE_SATURATE(op, width, a, b, result) \
+    do { \
+        FIXEDPOINT_USDT_SATURATE(op, width, a, b); \
+        FIXEDPOINT_SATLOG_RECORD(op, width, a, b, result); \
+        FIXEDPOINT_METRICS_SATURATE(op, width); \
+    } while (0)
+
+/** @brief Hook of a rejected division by zero; result is the value returned to the caller (0 if none). */
+#define FIXEDPOINT_PROBE_DIV_ZERO(width, a, result) \
+    do { \
+        FIXEDPOINT_USDT_DIV_ZERO(width, a); \
+        FIXEDPOINT_SATLOG_RECORD(FIXEDPOINT_OP_DIV, width, a, 0, result); \
+        FIXEDPOINT_METRICS_DIV_ZERO(width); \
+    } while (0)
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_PROBE_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
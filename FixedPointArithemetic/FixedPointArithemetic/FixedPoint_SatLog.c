@@ -0,0 +1,373 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_SatLog.c
+
+@brief      Post-mortem log of recent saturating operations.
+ *
+ * Detailed Description:
+ * - The saturation and division by zero branches of the cores call FixedPoint_SatLog_Record()
+ *   through FIXEDPOINT_PROBE_SATURATE() and FIXEDPOINT_PROBE_DIV_ZERO(). Operations that do not
+ *   saturate never reach this module, so the log costs nothing on the regular path.
+ * - Every thread writes into its own ring of FIXEDPOINT_SATLOG_SIZE entries, which keeps the most
+ *   recent saturations. The ring is claimed from a static pool on the first saturation of a thread
+ *   with an atomic increment of the pool index, so two threads never share a ring; afterwards
+ *   recording takes no lock: the entry is written, then the head index is published
+ *   behind a memory barrier. The rings are not thread-local storage, so they stay readable after
+ *   the thread has ended.
+ * - FixedPoint_SatLog_Read() returns the entries of the calling thread, oldest first.
+ * - FixedPoint_SatLog_Dump() formats the rings of all threads into a stack buffer and passes the
+ *   text to a write function. It takes no lock, allocates nothing and calls no library function,
+ *   so it can be called from a crash signal handler with an async-signal-safe write function.
+ *   A ring that is written while being dumped may show one torn entry.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Ring claimed with an atomic increment instead of the exclusive area.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_SatLog.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Size of the line buffer of the dump (one entry per line). */
+#define FIXEDPOINT_SATLOG_LINE_SIZE     (192U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Log ring of one thread. */
+typedef struct
+{
+    FixedPoint_SatLogEntry_t entries[FIXEDPOINT_SATLOG_SIZE];  /**< Most recent entries */
+    volatile uint32          head;                             /**< Number of recorded entries (free running) */
+} FixedPoint_SatLogRing_t;
+
+/** @brief   Line under construction in the dump. */
+typedef struct
+{
+    char   text[FIXEDPOINT_SATLOG_LINE_SIZE];   /**< Line text */
+    uint32 len;                                 /**< Used characters */
+} FixedPoint_SatLogLine_t;
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Ring pool, one ring per logging thread. */
+static FixedPoint_SatLogRing_t FixedPoint_SatLogRings[FIXEDPOINT_SATLOG_MAX_THREADS];
+
+/** @brief Number of claim attempts; rings [0, min(count, FIXEDPOINT_SATLOG_MAX_THREADS)) are in use. */
+static volatile uint32 FixedPoint_SatLogRingCount = 0U;
+
+/** @brief Number of threads that saturated after the pool was exhausted. */
+static volatile uint32 FixedPoint_SatLogUnlogged = 0U;
+
+/** @brief Time source, NULL for timestamps of 0. */
+static FixedPoint_SatLogClock_t FixedPoint_SatLogClock = NULL;
+
+/** @brief Ring of the calling thread, NULL until its first saturation. */
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_SatLogRing_t* FixedPoint_SatLogRing = NULL;
+
+/** @brief Set when the calling thread found the pool exhausted. */
+static FIXEDPOINT_THREAD_LOCAL boolean FixedPoint_SatLogNoRing = 0U;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static FixedPoint_SatLogRing_t* FixedPoint_SatLog_Claim(void);
+static void FixedPoint_SatLog_Append(FixedPoint_SatLogLine_t* line, const char* text);
+static void FixedPoint_SatLog_AppendInt(FixedPoint_SatLogLine_t* line, sint64 value);
+static void FixedPoint_SatLog_AppendUInt(FixedPoint_SatLogLine_t* line, uint64 value);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Claim a ring for the calling thread on its first saturation.
+ *
+ *  The pool index is taken with an atomic fetch-add, which also holds if the exclusive area is
+ *  left empty: threads saturating for the first time at the same moment get different rings.
+ *
+ *  @return     FixedPoint_SatLogRing_t*
+ *  @retval     Ring of the calling thread, NULL if the pool is exhausted.
+ */
+static FixedPoint_SatLogRing_t* FixedPoint_SatLog_Claim(void)
+{
+    FixedPoint_SatLogRing_t* ring = NULL;
+
+    if (FixedPoint_SatLogNoRing == 0U)
+    {
+        const uint32 index = FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_SatLogRingCount, 1U);
+
+        if (index < FIXEDPOINT_SATLOG_MAX_THREADS)
+        {
+            ring = &FixedPoint_SatLogRings[index];
+        }
+        else
+        {
+            (void)FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_SatLogUnlogged, 1U);
+            FixedPoint_SatLogNoRing = 1U;
+        }
+
+        FixedPoint_SatLogRing = ring;
+    }
+
+    return ring;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Append a string to a dump line, truncating at the line size.
+ *
+ *  @param[in,out]  line    Line under construction.
+ *  @param[in]      text    Zero terminated text.
+ */
+static void FixedPoint_SatLog_Append(FixedPoint_SatLogLine_t* line, const char* text)
+{
+    const char* c = text;
+
+    while ((*c != '\0') && (line->len < FIXEDPOINT_SATLOG_LINE_SIZE))
+    {
+        line->text[line->len] = *c;
+        line->len++;
+        c++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Append an unsigned decimal number to a dump line.
+ *
+ *  @param[in,out]  line    Line under construction.
+ *  @param[in]      value   Number.
+ */
+static void FixedPoint_SatLog_AppendUInt(FixedPoint_SatLogLine_t* line, uint64 value)
+{
+    char digits[21];
+    uint32 pos = 20U;
+    uint64 rest = value;
+
+    digits[20] = '\0';
+    do
+    {
+        pos--;
+        digits[pos] = (char)('0' + (char)(rest % 10U));
+        rest /= 10U;
+    } while (rest != 0U);
+
+    FixedPoint_SatLog_Append(line, &digits[pos]);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Append a signed decimal number to a dump line.
+ *
+ *  @param[in,out]  line    Line under construction.
+ *  @param[in]      value   Number.
+ */
+static void FixedPoint_SatLog_AppendInt(FixedPoint_SatLogLine_t* line, sint64 value)
+{
+    if (value < 0)
+    {
+        FixedPoint_SatLog_Append(line, "-");
+        /* Negate in the unsigned domain, valid for the most negative value too */
+        FixedPoint_SatLog_AppendUInt(line, (uint64)0 - (uint64)value);
+    }
+    else
+    {
+        FixedPoint_SatLog_AppendUInt(line, (uint64)value);
+    }
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set the time source of the log entries.
+ *
+ *  @param[in]  clock   Time source in ticks, NULL to record a timestamp of 0.
+ */
+void FixedPoint_SatLog_Init(FixedPoint_SatLogClock_t clock)
+{
+    FixedPoint_SatLogClock = clock;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Record a saturating operation (called from the saturation branches, see FixedPoint_Probe.h).
+ *
+ *  @param[in]  op      FixedPoint_Operation_t or FIXEDPOINT_PROBE_OP_ code.
+ *  @param[in]  width   16 or 8.
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[in]  result  Saturated result.
+ */
+void FixedPoint_SatLog_Record(uint8 op, uint8 width, sint64 a, sint64 b, sint32 result)
+{
+    FixedPoint_SatLogRing_t* ring = FixedPoint_SatLogRing;
+
+    if (ring == NULL)
+    {
+        ring = FixedPoint_SatLog_Claim();
+    }
+
+    if (ring != NULL)
+    {
+        const uint32 head = ring->head;
+        FixedPoint_SatLogEntry_t* const entry = &ring->entries[head & (FIXEDPOINT_SATLOG_SIZE - 1U)];
+
+        entry->timestamp = (FixedPoint_SatLogClock != NULL) ? FixedPoint_SatLogClock() : 0U;
+        entry->a = a;
+        entry->b = b;
+        entry->result = result;
+        entry->op = op;
+        entry->width = width;
+
+        /* Publish the entry before the head, so that a dump never reads an unwritten entry */
+        FIXEDPOINT_MEMORY_BARRIER();
+        ring->head = head + 1U;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Copy the most recent entries of the calling thread, oldest first.
+ *
+ *  @param[out] entries     Destination array.
+ *  @param[in]  maxCount    Capacity of entries.
+ *  @param[out] count       Number of copied entries (at most FIXEDPOINT_SATLOG_SIZE).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Entries copied (count may be 0).
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_SatLog_Read(FixedPoint_SatLogEntry_t* entries, uint32 maxCount, uint32* count)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    const FixedPoint_SatLogRing_t* const ring = FixedPoint_SatLogRing;
+
+    if ((entries != NULL) && (count != NULL))
+    {
+        uint32 n = 0U;
+
+        if (ring != NULL)
+        {
+            const uint32 head = ring->head;
+            uint32 i;
+
+            n = (head < FIXEDPOINT_SATLOG_SIZE) ? head : FIXEDPOINT_SATLOG_SIZE;
+            n = (n < maxCount) ? n : maxCount;
+
+            for (i = 0U; i < n; i++)
+            {
+                entries[i] = ring->entries[(head - n + i) & (FIXEDPOINT_SATLOG_SIZE - 1U)];
+            }
+        }
+
+        *count = n;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Write the log of all threads as text, async-signal-safe (crash dump hook).
+ *
+ *  One line per entry, oldest first per thread:
+ *  "fixedpoint satlog thread=1 seq=41 op=2 width=16 a=25600 b=25600 result=32767 ts=123456"
+ *  followed by a summary line with the number of threads that could not be logged.
+ *  Typical use in a SIGSEGV/SIGABRT handler with a write function calling write(2, text, len).
+ *
+ *  @param[in]  output  Output function.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Log written.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_SatLog_Dump(FixedPoint_SatLogWrite_t output)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (output != NULL)
+    {
+        const uint32 rings = (FixedPoint_SatLogRingCount < FIXEDPOINT_SATLOG_MAX_THREADS) ?
+                             FixedPoint_SatLogRingCount : FIXEDPOINT_SATLOG_MAX_THREADS;
+        FixedPoint_SatLogLine_t line;
+        uint32 t;
+
+        for (t = 0U; t < rings; t++)
+        {
+            const FixedPoint_SatLogRing_t* const ring = &FixedPoint_SatLogRings[t];
+            const uint32 head = ring->head;
+            const uint32 n = (head < FIXEDPOINT_SATLOG_SIZE) ? head : FIXEDPOINT_SATLOG_SIZE;
+            uint32 i;
+
+            FIXEDPOINT_MEMORY_BARRIER();
+
+            for (i = 0U; i < n; i++)
+            {
+                const uint32 seq = head - n + i;
+                const FixedPoint_SatLogEntry_t* const entry = &ring->entries[seq & (FIXEDPOINT_SATLOG_SIZE - 1U)];
+
+                line.len = 0U;
+                FixedPoint_SatLog_Append(&line, "fixedpoint satlog thread=");
+                FixedPoint_SatLog_AppendUInt(&line, (uint64)t + 1U);
+                FixedPoint_SatLog_Append(&line, " seq=");
+                FixedPoint_SatLog_AppendUInt(&line, (uint64)seq);
+                FixedPoint_SatLog_Append(&line, " op=");
+                FixedPoint_SatLog_AppendUInt(&line, (uint64)entry->op);
+                FixedPoint_SatLog_Append(&line, " width=");
+                FixedPoint_SatLog_AppendUInt(&line, (uint64)entry->width);
+                FixedPoint_SatLog_Append(&line, " a=");
+                FixedPoint_SatLog_AppendInt(&line, entry->a);
+                FixedPoint_SatLog_Append(&line, " b=");
+                FixedPoint_SatLog_AppendInt(&line, entry->b);
+                FixedPoint_SatLog_Append(&line, " result=");
+                FixedPoint_SatLog_AppendInt(&line, (sint64)entry->result);
+                FixedPoint_SatLog_Append(&line, " ts=");
+                FixedPoint_SatLog_AppendUInt(&line, entry->timestamp);
+                FixedPoint_SatLog_Append(&line, "\n");
+                output(line.text, line.len);
+            }
+        }
+
+        line.len = 0U;
+        FixedPoint_SatLog_Append(&line, "fixedpoint satlog threads=");
+        FixedPoint_SatLog_AppendUInt(&line, (uint64)rings);
+        FixedPoint_SatLog_Append(&line, " unlogged_threads=");
+        FixedPoint_SatLog_AppendUInt(&line, (uint64)FixedPoint_SatLogUnlogged);
+        FixedPoint_SatLog_Append(&line, "\n");
+        output(line.text, line.len);
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+#endif
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
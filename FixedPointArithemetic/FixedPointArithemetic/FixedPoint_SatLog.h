@@ -0,0 +1,73 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_SatLog.h
+
+@brief      Interface for the post-mortem log of recent saturating operations.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_SATLOG_H
+#define FIXED_POINT_SATLOG_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Logged saturating operation. */
+typedef struct
+{
+    uint64 timestamp;   /**< Clock ticks at the time of the operation, 0 without clock */
+    sint64 a;           /**< First operand (rounded scaled input of a conversion, accumulator of a narrowing) */
+    sint64 b;           /**< Second operand, 0 for conversions and narrowings */
+    sint32 result;      /**< Saturated result */
+    uint8  op;          /**< FixedPoint_Operation_t or FIXEDPOINT_PROBE_OP_ code */
+    uint8  width;       /**< 16 or 8 */
+} FixedPoint_SatLogEntry_t;
+
+/** @brief   Time source of the log in ticks, provided by the platform. */
+typedef uint64 (*FixedPoint_SatLogClock_t)(void);
+
+/** @brief   Output of the crash dump; must be async-signal-safe when dumping from a signal handler (e.g. write()). */
+typedef void (*FixedPoint_SatLogWrite_t)(const char* text, uint32 len);
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern void FixedPoint_SatLog_Init(FixedPoint_SatLogClock_t clock);
+extern void FixedPoint_SatLog_Record(uint8 op, uint8 width, sint64 a, sint64 b, sint32 result);
+extern Std_ReturnType FixedPoint_SatLog_Read(FixedPoint_SatLogEntry_t* entries, uint32 maxCount, uint32* count);
+extern Std_ReturnType FixedPoint_SatLog_Dump(FixedPoint_SatLogWrite_t output);
+#endif
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_SATLOG_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
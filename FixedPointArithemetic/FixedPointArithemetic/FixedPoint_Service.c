@@ -0,0 +1,473 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Service.c
+
+@brief      Serving fixed-point batch requests of several clients through a shared memory region.
+ *
+ * Detailed Description:
+ * - One server context executes the batch kernels for several clients, so the clients do not need
+ *   their own tables or worker threads. Client and server communicate only through one memory
+ *   region: a header with one request ring per client, followed by a data area for the operand
+ *   and result arrays.
+ * - The region contains no pointers. Rings use free-running counters and the requests refer to the
+ *   arrays by byte offsets, so the region can be mapped at a different address in every process
+ *   (named file mapping, POSIX shared memory) and the arrays are never copied.
+ * - Each ring has exactly one producer (its client) and one consumer (the server), so no lock is
+ *   needed. Ordering between the entries and the counters is ensured with FIXEDPOINT_MEMORY_BARRIER().
+ * - FixedPoint_Service_Serve() visits the clients round robin, starting with a different client on
+ *   every call, and executes at most quota requests per client. A client with a long backlog
+ *   therefore cannot delay the requests of the others by more than one quota.
+ * - Adjacent requests of one client with the same operation are coalesced into one kernel call, as
+ *   in the job queue, up to FIXEDPOINT_SERVICE_COALESCE_MAX requests. Every member reports the
+ *   status of the merged call and is not executed again, which would count its saturations twice
+ *   in the metrics, probes and saturation log. Requests whose result array overlaps an operand
+ *   array (in place) are never coalesced.
+ * - Requests come from other processes and are validated against the region bounds before use.
+ *   Clients can also write the region header, so the server validates against the size, data
+ *   offset and client count it was initialised with, kept in its private FixedPoint_ServiceServer_t,
+ *   and never reads them from the region. Client functions bound the client index by
+ *   FIXEDPOINT_SERVICE_MAX_CLIENTS in addition to the header.
+ * - Mapping the region, starting the server context and waking it up (event, socket, futex) is
+ *   left to the platform integration.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    In-place requests no longer coalesced, own coalescing limit.
+01.02.00  2026-10-18  AGT    Intrinsics header now included by the configuration header.
+01.03.00  2026-10-18  AGT    Requests validated against private server state instead of the shared header.
+01.04.00  2026-10-18  AGT    Members of a coalesced group report the group status, as in the job queue.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Service.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Mask of the entry index within a ring counter. */
+#define FIXEDPOINT_SERVICE_RING_MASK    (FIXEDPOINT_SERVICE_RING_SIZE - 1U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static FixedPoint_ServiceRegion_t* FixedPoint_Service_GetRegion(void* base);
+static boolean FixedPoint_Service_IsValidRequest(const FixedPoint_ServiceServer_t* server,
+                                                 const FixedPoint_ServiceRequest_t* request);
+static boolean FixedPoint_Service_CanCoalesce(const FixedPoint_ServiceRequest_t* merged,
+                                              const FixedPoint_ServiceRequest_t* next);
+static Std_ReturnType FixedPoint_Service_Execute(const FixedPoint_ServiceServer_t* server,
+                                                 const FixedPoint_ServiceRequest_t* request);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Get the header of an initialised region.
+ *
+ *  @param[in]  base    Start of the region.
+ *
+ *  @return     FixedPoint_ServiceRegion_t*
+ *  @retval     Region header, NULL if base is NULL or the region is not initialised with this layout
+ *              (the header is shared with other processes and checked on every use).
+ */
+static FixedPoint_ServiceRegion_t* FixedPoint_Service_GetRegion(void* base)
+{
+    FixedPoint_ServiceRegion_t* region = (FixedPoint_ServiceRegion_t*)base;
+
+    if ((region != NULL) &&
+        ((region->magic != FIXEDPOINT_SERVICE_MAGIC) || (region->version != FIXEDPOINT_SERVICE_VERSION) ||
+         (region->clientCount < 1U) || (region->clientCount > FIXEDPOINT_SERVICE_MAX_CLIENTS) ||
+         (region->dataOffset > region->size)))
+    {
+        region = NULL;
+    }
+
+    return region;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check that a request only refers to aligned arrays inside the data area.
+ *
+ *  The bounds are taken from the private server state, not from the region header.
+ *
+ *  @param[in]  server      Server state.
+ *  @param[in]  request     Request to check (local copy).
+ *
+ *  @return     boolean
+ *  @retval     1U      Request valid.
+ *  @retval     0U      Unknown operation, misaligned offset or array outside of the data area.
+ */
+static boolean FixedPoint_Service_IsValidRequest(const FixedPoint_ServiceServer_t* server,
+                                                 const FixedPoint_ServiceRequest_t* request)
+{
+    const uint32 offsets[3] = { request->offsetA, request->offsetB, request->offsetR };
+    boolean valid = (request->op <= (uint32)FIXEDPOINT_OP_DIV) ? 1U : 0U;
+    uint32 i;
+
+    for (i = 0U; i < 3U; i++)
+    {
+        if ((offsets[i] < server->dataOffset) || (offsets[i] > server->size) ||
+            ((offsets[i] % (uint32)sizeof(t_Fixed16)) != 0U) ||
+            (request->len > ((server->size - offsets[i]) / (uint32)sizeof(t_Fixed16))))
+        {
+            valid = 0U;
+        }
+    }
+
+    return valid;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether a request continues a (merged) request in all three arrays.
+ *
+ *  A group whose result array overlaps an operand array is not extended: the merged call must give
+ *  the results of the requests executed one after the other, which is not ensured once results of
+ *  one request are operands of another.
+ *
+ *  @param[in]  merged  Request accumulated so far.
+ *  @param[in]  next    Following request of the same client.
+ *
+ *  @return     boolean
+ *  @retval     1U      Same operation, all arrays directly follow the merged arrays and the result
+ *                      does not overlap the operands.
+ *  @retval     0U      Not mergeable.
+ */
+static boolean FixedPoint_Service_CanCoalesce(const FixedPoint_ServiceRequest_t* merged,
+                                              const FixedPoint_ServiceRequest_t* next)
+{
+    const uint32 bytes = merged->len * (uint32)sizeof(t_Fixed16);
+    const uint32 total = bytes + (next->len * (uint32)sizeof(t_Fixed16));
+
+    return (boolean)((next->op == merged->op) &&
+                     (next->offsetA == (merged->offsetA + bytes)) &&
+                     (next->offsetB == (merged->offsetB + bytes)) &&
+                     (next->offsetR == (merged->offsetR + bytes)) &&
+                     ((merged->offsetR >= (merged->offsetA + total)) ||
+                      (merged->offsetA >= (merged->offsetR + total))) &&
+                     ((merged->offsetR >= (merged->offsetB + total)) ||
+                      (merged->offsetB >= (merged->offsetR + total))));
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Execute a validated request on the arrays of the region.
+ *
+ *  @param[in]  server      Server state.
+ *  @param[in]  request     Validated request.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Request executed without saturation.
+ *  @retval     E_NOT_OK    Saturation or division by zero.
+ */
+static Std_ReturnType FixedPoint_Service_Execute(const FixedPoint_ServiceServer_t* server,
+                                                 const FixedPoint_ServiceRequest_t* request)
+{
+    uint8* const bytes = server->base;
+
+    return FixedPoint_Op16_Strided((FixedPoint_Operation_t)request->op,
+                                   (const t_Fixed16*)(void*)&bytes[request->offsetA], 1,
+                                   (const t_Fixed16*)(void*)&bytes[request->offsetB], 1,
+                                   (t_Fixed16*)(void*)&bytes[request->offsetR], 1, request->len);
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise a service region and the server state (server side).
+ *
+ *  Writes the header and empty rings. The data area starts after the header, aligned to 16 bytes.
+ *  Size, data offset and client count are also stored in the server state, which must live in
+ *  memory of the server process that clients cannot write.
+ *
+ *  @param[out] server          Server state passed to FixedPoint_Service_Serve().
+ *  @param[out] base            Start of the region, aligned to at least 4 bytes.
+ *  @param[in]  size            Size of the region as mapped in the server process, in bytes.
+ *  @param[in]  clientCount     Number of clients (1..FIXEDPOINT_SERVICE_MAX_CLIENTS).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Region initialised.
+ *  @retval     E_NOT_OK    Null pointer, invalid client count or region too small for the header.
+ */
+Std_ReturnType FixedPoint_Service_Init(FixedPoint_ServiceServer_t* server, void* base, uint32 size,
+                                       uint32 clientCount)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_ServiceRegion_t* region = (FixedPoint_ServiceRegion_t*)base;
+    const uint32 dataOffset = ((uint32)sizeof(FixedPoint_ServiceRegion_t) + 15U) & ~15UL;
+
+    if ((server != NULL) && (region != NULL) && (clientCount >= 1U) &&
+        (clientCount <= FIXEDPOINT_SERVICE_MAX_CLIENTS) && (size > dataOffset))
+    {
+        uint32 c;
+
+        for (c = 0U; c < FIXEDPOINT_SERVICE_MAX_CLIENTS; c++)
+        {
+            region->rings[c].head = 0U;
+            region->rings[c].tail = 0U;
+        }
+
+        region->version = FIXEDPOINT_SERVICE_VERSION;
+        region->size = size;
+        region->dataOffset = dataOffset;
+        region->clientCount = clientCount;
+        region->coalesced = 0U;
+
+        server->base = (uint8*)base;
+        server->size = size;
+        server->dataOffset = dataOffset;
+        server->clientCount = clientCount;
+        server->nextClient = 0U;
+
+        /* Publish the header last: clients attach only to a complete region */
+        FIXEDPOINT_MEMORY_BARRIER();
+        region->magic = FIXEDPOINT_SERVICE_MAGIC;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Attach to an initialised service region (client side).
+ *
+ *  @param[in]  base        Start of the region as mapped in the calling process.
+ *  @param[in]  size        Size of the mapping in bytes.
+ *  @param[out] dataOffset  Pointer to store the byte offset of the data area.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Region valid, layout and size match.
+ *  @retval     E_NOT_OK    Null pointer, region not initialised or size mismatch.
+ */
+Std_ReturnType FixedPoint_Service_Attach(void* base, uint32 size, uint32* dataOffset)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    const FixedPoint_ServiceRegion_t* region = FixedPoint_Service_GetRegion(base);
+
+    if ((region != NULL) && (dataOffset != NULL) && (region->size == size))
+    {
+        FIXEDPOINT_MEMORY_BARRIER();
+        *dataOffset = region->dataOffset;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Submit a request to the ring of a client.
+ *
+ *  The operand arrays must be written to the data area before. The result array must not be
+ *  accessed until the request is reported done by FixedPoint_Service_Poll().
+ *
+ *  @param[in,out]  base        Start of the region.
+ *  @param[in]      client      Index of the calling client.
+ *  @param[in]      request     Operation, array offsets and length (seq and status are ignored).
+ *  @param[out]     seq         Pointer to store the sequence number for polling.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Request submitted.
+ *  @retval     E_NOT_OK    Null pointer, invalid region or client, or ring full.
+ */
+Std_ReturnType FixedPoint_Service_Submit(void* base, uint32 client, const FixedPoint_ServiceRequest_t* request,
+                                         uint32* seq)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_ServiceRegion_t* region = FixedPoint_Service_GetRegion(base);
+
+    if ((region != NULL) && (request != NULL) && (seq != NULL) && (client < region->clientCount) &&
+        (client < FIXEDPOINT_SERVICE_MAX_CLIENTS))
+    {
+        FixedPoint_ServiceRing_t* ring = &region->rings[client];
+        const uint32 head = ring->head;
+
+        if ((head - ring->tail) < FIXEDPOINT_SERVICE_RING_SIZE)
+        {
+            FixedPoint_ServiceRequest_t* entry = &ring->entries[head & FIXEDPOINT_SERVICE_RING_MASK];
+
+            *entry = *request;
+            entry->seq = head;
+            entry->status = (uint32)E_NOT_OK;
+
+            /* Entry complete before it becomes visible to the server */
+            FIXEDPOINT_MEMORY_BARRIER();
+            ring->head = head + 1U;
+
+            *seq = head;
+            ret = E_OK;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether a request of a client has completed.
+ *
+ *  The entry of a completed request is reused by later submissions, so the status must be collected
+ *  before FIXEDPOINT_SERVICE_RING_SIZE further requests are submitted.
+ *
+ *  @param[in]  base            Start of the region.
+ *  @param[in]  client          Index of the calling client.
+ *  @param[in]  seq             Sequence number returned by FixedPoint_Service_Submit().
+ *  @param[out] done            Pointer to store whether the request has completed.
+ *  @param[out] requestStatus   Pointer to store the request status (valid if done).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Poll successful.
+ *  @retval     E_NOT_OK    Null pointer, invalid region or client, or entry already reused.
+ */
+Std_ReturnType FixedPoint_Service_Poll(void* base, uint32 client, uint32 seq, boolean* done,
+                                       Std_ReturnType* requestStatus)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_ServiceRegion_t* region = FixedPoint_Service_GetRegion(base);
+
+    if ((region != NULL) && (done != NULL) && (requestStatus != NULL) && (client < region->clientCount) &&
+        (client < FIXEDPOINT_SERVICE_MAX_CLIENTS))
+    {
+        const FixedPoint_ServiceRing_t* ring = &region->rings[client];
+        const FixedPoint_ServiceRequest_t* entry = &ring->entries[seq & FIXEDPOINT_SERVICE_RING_MASK];
+        const uint32 tail = ring->tail;
+
+        /* Status and results are read after the tail that published them */
+        FIXEDPOINT_MEMORY_BARRIER();
+
+        if (entry->seq == seq)
+        {
+            *done = (boolean)(((tail - seq) - 1U) < FIXEDPOINT_SERVICE_RING_SIZE);
+            *requestStatus = (Std_ReturnType)entry->status;
+            ret = E_OK;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Execute pending requests of all clients with round-robin fairness (server side).
+ *
+ *  Every client gets at most quota requests per call. The client served first rotates from call
+ *  to call. Only the rings and the requests are read from the region, every bound comes from the
+ *  server state.
+ *
+ *  @param[in,out]  server  Server state initialised with FixedPoint_Service_Init().
+ *  @param[in]      quota   Maximum number of requests per client (>= 1).
+ *  @param[out]     served  Optional pointer to store the number of completed requests (NULL allowed).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Requests processed (results are reported per request or coalesced group).
+ *  @retval     E_NOT_OK    Null pointer, uninitialised server or zero quota.
+ */
+Std_ReturnType FixedPoint_Service_Serve(FixedPoint_ServiceServer_t* server, uint32 quota, uint32* served)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint32 count = 0U;
+
+    if ((server != NULL) && (server->base != NULL) && (server->clientCount >= 1U) &&
+        (server->clientCount <= FIXEDPOINT_SERVICE_MAX_CLIENTS) && (quota >= 1U))
+    {
+        FixedPoint_ServiceRegion_t* const region = (FixedPoint_ServiceRegion_t*)(void*)server->base;
+        uint32 c;
+
+        for (c = 0U; c < server->clientCount; c++)
+        {
+            FixedPoint_ServiceRing_t* ring = &region->rings[(server->nextClient + c) % server->clientCount];
+            uint32 budget = quota;
+            uint32 tail = ring->tail;
+            uint32 head = ring->head;
+
+            /* Entries are read after the head that published them */
+            FIXEDPOINT_MEMORY_BARRIER();
+
+            while ((budget > 0U) && (tail != head))
+            {
+                FixedPoint_ServiceRequest_t merged = ring->entries[tail & FIXEDPOINT_SERVICE_RING_MASK];
+                uint32 members = 1U;
+                uint32 m;
+
+                /* Requests are validated and executed on local copies, a client cannot change them in between */
+                if (FixedPoint_Service_IsValidRequest(server, &merged) == 0U)
+                {
+                    ring->entries[tail & FIXEDPOINT_SERVICE_RING_MASK].status = (uint32)E_NOT_OK;
+                }
+                else
+                {
+                    boolean mergeable = 1U;
+                    Std_ReturnType status;
+
+                    /* Merge following valid requests that continue the arrays */
+                    while ((mergeable != 0U) && (members < budget) && (members < FIXEDPOINT_SERVICE_COALESCE_MAX) &&
+                           ((tail + members) != head))
+                    {
+                        const FixedPoint_ServiceRequest_t next = ring->entries[(tail + members) & FIXEDPOINT_SERVICE_RING_MASK];
+
+                        if ((FixedPoint_Service_CanCoalesce(&merged, &next) != 0U) &&
+                            (FixedPoint_Service_IsValidRequest(server, &next) != 0U))
+                        {
+                            merged.len += next.len;
+                            members++;
+                        }
+                        else
+                        {
+                            mergeable = 0U;
+                        }
+                    }
+
+                    status = FixedPoint_Service_Execute(server, &merged);
+
+                    /* Every member reports the group status */
+                    for (m = 0U; m < members; m++)
+                    {
+                        ring->entries[(tail + m) & FIXEDPOINT_SERVICE_RING_MASK].status = (uint32)status;
+                    }
+
+                    region->coalesced += members - 1U;
+                }
+
+                tail += members;
+                budget -= members;
+                count += members;
+
+                /* Results and status complete before the request is reported done */
+                FIXEDPOINT_MEMORY_BARRIER();
+                ring->tail = tail;
+            }
+        }
+
+        server->nextClient = (server->nextClient + 1U) % server->clientCount;
+        ret = E_OK;
+    }
+
+    if (served != NULL)
+    {
+        *served = count;
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,123 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Service.h
+
+@brief      Interface for serving fixed-point batch requests of several clients through a shared memory region.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Server state moved out of the shared region header.
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_SERVICE_H
+#define FIXED_POINT_SERVICE_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Identification of an initialised service region ("FXSV"). */
+#define FIXEDPOINT_SERVICE_MAGIC    (0x46585356UL)
+
+/** @brief Layout version of the service region. Client and server must use the same layout. */
+#define FIXEDPOINT_SERVICE_VERSION  (2UL)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Request entry of a client ring.
+ *
+ * The region may be mapped at different addresses in every process, so all buffers are given as
+ * byte offsets from the start of the region. Only fixed-size members are used.
+ */
+typedef struct
+{
+    uint32 op;          /**< FixedPoint_Operation_t, r[i] = a[i] (op) b[i] */
+    uint32 offsetA;     /**< Byte offset of the first operand array */
+    uint32 offsetB;     /**< Byte offset of the second operand array */
+    uint32 offsetR;     /**< Byte offset of the result array */
+    uint32 len;         /**< Number of elements */
+    uint32 seq;         /**< Sequence number assigned on submission */
+    uint32 status;      /**< Std_ReturnType of the request, valid once completed */
+} FixedPoint_ServiceRequest_t;
+
+/** @brief   Single-producer (client) single-consumer (server) request ring.
+ *
+ * head and tail are free-running counters. The client only writes head and the entries,
+ * the server only writes tail and the status of the entries.
+ */
+typedef struct
+{
+    volatile uint32             head;                                   /**< Number of submitted requests */
+    volatile uint32             tail;                                   /**< Number of completed requests */
+    FixedPoint_ServiceRequest_t entries[FIXEDPOINT_SERVICE_RING_SIZE];  /**< Request entries */
+} FixedPoint_ServiceRing_t;
+
+/** @brief   Header at the start of a service region. The data area for the arrays follows. */
+typedef struct
+{
+    uint32                   magic;                                     /**< FIXEDPOINT_SERVICE_MAGIC */
+    uint32                   version;                                   /**< FIXEDPOINT_SERVICE_VERSION */
+    uint32                   size;                                      /**< Size of the region in bytes */
+    uint32                   dataOffset;                                /**< Byte offset of the data area */
+    uint32                   clientCount;                               /**< Number of client rings */
+    uint32                   coalesced;                                 /**< Requests merged into a preceding one */
+    FixedPoint_ServiceRing_t rings[FIXEDPOINT_SERVICE_MAX_CLIENTS];     /**< One ring per client */
+} FixedPoint_ServiceRegion_t;
+
+/** @brief   State of the server, kept in memory private to the server process.
+ *
+ * Every client can write the region header, so the server copies the bounds it validates requests
+ * against at initialisation and never reads them from the region again.
+ */
+typedef struct
+{
+    uint8* base;            /**< Start of the region as mapped in the server process */
+    uint32 size;            /**< Size of the server mapping in bytes */
+    uint32 dataOffset;      /**< Byte offset of the data area */
+    uint32 clientCount;     /**< Number of client rings */
+    uint32 nextClient;      /**< Client served first in the next round */
+} FixedPoint_ServiceServer_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Service_Init(FixedPoint_ServiceServer_t* server, void* base, uint32 size,
+                                              uint32 clientCount);
+extern Std_ReturnType FixedPoint_Service_Attach(void* base, uint32 size, uint32* dataOffset);
+extern Std_ReturnType FixedPoint_Service_Submit(void* base, uint32 client, const FixedPoint_ServiceRequest_t* request,
+                                                uint32* seq);
+extern Std_ReturnType FixedPoint_Service_Poll(void* base, uint32 client, uint32 seq, boolean* done,
+                                              Std_ReturnType* requestStatus);
+extern Std_ReturnType FixedPoint_Service_Serve(FixedPoint_ServiceServer_t* server, uint32 quota, uint32* served);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_SERVICE_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
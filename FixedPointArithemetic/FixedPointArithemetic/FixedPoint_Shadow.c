@@ -0,0 +1,397 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Shadow.c
+
+@brief      Sampled accuracy monitor (shadow execution against a double reference).
+ *
+ * Detailed Description:
+ * - The float interface (FixedPoint_Add16 ... FixedPoint_Div8) and the element-wise batch kernels
+ *   count their calls down in a thread-local counter. A call that is not sampled costs one
+ *   decrement and one branch. When the counter expires, the call is checked and the counter is
+ *   reloaded from the sampling rate (1 in N calls).
+ * - A check computes the operation in double from the operand values and compares it with the
+ *   fixed-point result. The absolute error in LSBs of the result format is accumulated per
+ *   operation and width; the operands of the largest error are kept to reproduce it. For the float
+ *   interface the reference uses the float inputs, so the error includes input quantization.
+ * - A sampled batch kernel call checks up to FIXEDPOINT_SHADOW_ARRAY_CHECKS elements spread over
+ *   the array.
+ * - Results that saturate or divide by zero are counted as rejected; their error is the expected
+ *   saturation and is not accumulated.
+ * - The rate can be changed at any time with FixedPoint_Shadow_SetRate(). Each thread picks the
+ *   new rate up when its current counter expires, at the latest after FIXEDPOINT_SHADOW_POLL_INTERVAL
+ *   calls while sampling was off.
+ * - Every thread accumulates into its own statistics slot of a static pool, claimed with an atomic
+ *   increment on its first check, so checks take no lock. Threads beyond
+ *   FIXEDPOINT_SHADOW_MAX_THREADS are not monitored; they are counted instead.
+ * - FixedPoint_Shadow_GetStats() merges the slots of all threads. A slot that is updated while
+ *   being read may be a few checks behind.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Statistics slot per thread claimed with an atomic increment, merged on read.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include <string.h>            /* for memset */
+#include "FixedPoint_Shadow.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of operations with statistics (FixedPoint_Operation_t). */
+#define FIXEDPOINT_SHADOW_OPS       (4U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Statistics of one thread. */
+typedef struct
+{
+    FixedPoint_ShadowStats_t stats[2][FIXEDPOINT_SHADOW_OPS];  /**< Per width (0: 16-bit, 1: 8-bit) and operation */
+} FixedPoint_ShadowSlot_t;
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Statistics slots, one per thread. */
+static FixedPoint_ShadowSlot_t FixedPoint_ShadowSlots[FIXEDPOINT_SHADOW_MAX_THREADS];
+
+/** @brief Number of claim attempts; slots [0, min(count, FIXEDPOINT_SHADOW_MAX_THREADS)) are in use. */
+static volatile uint32 FixedPoint_ShadowSlotCount = 0U;
+
+/** @brief Threads that found the pool exhausted and are not monitored. */
+static volatile uint32 FixedPoint_ShadowDropped = 0U;
+
+/** @brief Statistics slot of the calling thread, NULL until its first check. */
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_ShadowSlot_t* FixedPoint_ShadowSlot = NULL;
+
+/** @brief Set once the calling thread found the pool exhausted. */
+static FIXEDPOINT_THREAD_LOCAL boolean FixedPoint_ShadowNoSlot = 0U;
+
+/** @brief Sampling rate, 1 in N calls, 0 = off. */
+static volatile uint32 FixedPoint_ShadowRate = FIXEDPOINT_SHADOW_DEFAULT_RATE;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static FixedPoint_ShadowSlot_t* FixedPoint_Shadow_GetSlot(void);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Statistics slot of the calling thread, claimed on its first check.
+ *
+ *  The pool index is taken with an atomic fetch-add, so threads checking for the first time at the
+ *  same moment never share a slot, also if the exclusive area is left empty.
+ *
+ *  @return     FixedPoint_ShadowSlot_t*
+ *  @retval     Statistics slot of the calling thread, NULL if the pool is exhausted.
+ */
+static FixedPoint_ShadowSlot_t* FixedPoint_Shadow_GetSlot(void)
+{
+    FixedPoint_ShadowSlot_t* slot = FixedPoint_ShadowSlot;
+
+    if ((slot == NULL) && (FixedPoint_ShadowNoSlot == 0U))
+    {
+        const uint32 index = FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_ShadowSlotCount, 1U);
+
+        if (index < FIXEDPOINT_SHADOW_MAX_THREADS)
+        {
+            slot = &FixedPoint_ShadowSlots[index];
+            FixedPoint_ShadowSlot = slot;
+        }
+        else
+        {
+            (void)FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_ShadowDropped, 1U);
+            FixedPoint_ShadowNoSlot = 1U;
+        }
+    }
+
+    return slot;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set the sampling rate.
+ *
+ *  @param[in]  rate    Check 1 in rate calls per thread, 0 to stop sampling.
+ */
+void FixedPoint_Shadow_SetRate(uint32 rate)
+{
+    FixedPoint_ShadowRate = rate;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read the sampling rate.
+ *
+ *  @return     uint32
+ *  @retval     Current rate, 0 = off.
+ */
+uint32 FixedPoint_Shadow_GetRate(void)
+{
+    return FixedPoint_ShadowRate;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Value to reload the sampling counter of a thread with.
+ *
+ *  @return     uint32
+ *  @retval     Sampling rate, or FIXEDPOINT_SHADOW_POLL_INTERVAL while sampling is off.
+ */
+uint32 FixedPoint_Shadow_Reload(void)
+{
+    const uint32 rate = FixedPoint_ShadowRate;
+
+    return (rate != 0U) ? rate : FIXEDPOINT_SHADOW_POLL_INTERVAL;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Compare a sampled fixed-point result with the double reference.
+ *
+ *  @param[in]  op      Operation.
+ *  @param[in]  width   16 or 8.
+ *  @param[in]  a       First operand value.
+ *  @param[in]  b       Second operand value.
+ *  @param[in]  r       Fixed-point result as value.
+ *  @param[in]  status  Status of the fixed-point operation.
+ */
+void FixedPoint_Shadow_Check(FixedPoint_Operation_t op, uint8 width, double a, double b, double r,
+                             Std_ReturnType status)
+{
+    const double scale = (width == 16U) ? (double)SCALE_16 : (double)SCALE_8;
+    const double maxValue = (width == 16U) ? (double)FIX16_MAX : (double)FIX8_MAX;
+    const double minValue = (width == 16U) ? (double)FIX16_MIN : (double)FIX8_MIN;
+    double reference = 0.0;
+    boolean valid = ((FixedPoint_ShadowRate != 0U) && ((uint32)op < FIXEDPOINT_SHADOW_OPS)) ? 1U : 0U;
+    boolean divZero = 0U;
+    FixedPoint_ShadowSlot_t* slot;
+
+    switch (op)
+    {
+    case FIXEDPOINT_OP_ADD:
+        reference = a + b;
+        break;
+    case FIXEDPOINT_OP_SUB:
+        reference = a - b;
+        break;
+    case FIXEDPOINT_OP_MULT:
+        reference = a * b;
+        break;
+    case FIXEDPOINT_OP_DIV:
+        divZero = (b == 0.0) ? 1U : 0U;
+        reference = (divZero == 0U) ? (a / b) : 0.0;
+        break;
+    default:
+        valid = 0U;
+        break;
+    }
+
+    slot = (valid != 0U) ? FixedPoint_Shadow_GetSlot() : NULL;
+    if (slot != NULL)
+    {
+        FixedPoint_ShadowStats_t* const stats = &slot->stats[(width == 16U) ? 0U : 1U][op];
+        const double scaled = reference * scale;
+
+        if ((status != E_OK) || (divZero != 0U) || (scaled > (maxValue + 0.5)) || (scaled < (minValue - 0.5)))
+        {
+            stats->rejected++;
+        }
+        else
+        {
+            const double error = (r * scale) - scaled;
+            const double absError = (error < 0.0) ? -error : error;
+
+            stats->samples++;
+            stats->sumError += absError;
+            if (absError > stats->maxError)
+            {
+                stats->maxError = absError;
+                stats->maxErrorA = a;
+                stats->maxErrorB = b;
+            }
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Capture the operands of the elements checked in a sampled 16-bit batch kernel call.
+ *
+ *  @param[out] sample  Captured operands.
+ *  @param[in]  a       First operand array in configured 16-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 16-bit Q-format.
+ *  @param[in]  len     Number of elements of the call.
+ */
+void FixedPoint_Shadow_Capture16(FixedPoint_ShadowSample_t* sample, const t_Fixed16* a, const t_Fixed16* b,
+                                 uint32 len)
+{
+    const uint32 step = (len / FIXEDPOINT_SHADOW_ARRAY_CHECKS) + 1U;
+    uint32 i;
+
+    sample->count = 0U;
+    for (i = 0U; i < len; i += step)
+    {
+        sample->index[sample->count] = i;
+        sample->a[sample->count] = (double)a[i] / (double)SCALE_16;
+        sample->b[sample->count] = (double)b[i] / (double)SCALE_16;
+        sample->count++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Capture the operands of the elements checked in a sampled 8-bit batch kernel call.
+ *
+ *  @param[out] sample  Captured operands.
+ *  @param[in]  a       First operand array in configured 8-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements of the call.
+ */
+void FixedPoint_Shadow_Capture8(FixedPoint_ShadowSample_t* sample, const t_Fixed8* a, const t_Fixed8* b,
+                                uint32 len)
+{
+    const uint32 step = (len / FIXEDPOINT_SHADOW_ARRAY_CHECKS) + 1U;
+    uint32 i;
+
+    sample->count = 0U;
+    for (i = 0U; i < len; i += step)
+    {
+        sample->index[sample->count] = i;
+        sample->a[sample->count] = (double)a[i] / (double)SCALE_8;
+        sample->b[sample->count] = (double)b[i] / (double)SCALE_8;
+        sample->count++;
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check the captured elements of a 16-bit batch kernel call after it has run.
+ *
+ *  @param[in]  op      Operation of the kernel.
+ *  @param[in]  sample  Operands captured with FixedPoint_Shadow_Capture16().
+ *  @param[in]  r       Result array of the call.
+ */
+void FixedPoint_Shadow_CheckArray16(FixedPoint_Operation_t op, const FixedPoint_ShadowSample_t* sample,
+                                    const t_Fixed16* r)
+{
+    uint32 k;
+
+    for (k = 0U; k < sample->count; k++)
+    {
+        FixedPoint_Shadow_Check(op, 16U, sample->a[k], sample->b[k], (double)r[sample->index[k]] / (double)SCALE_16,
+                                E_OK);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check the captured elements of an 8-bit batch kernel call after it has run.
+ *
+ *  @param[in]  op      Operation of the kernel.
+ *  @param[in]  sample  Operands captured with FixedPoint_Shadow_Capture8().
+ *  @param[in]  r       Result array of the call.
+ */
+void FixedPoint_Shadow_CheckArray8(FixedPoint_Operation_t op, const FixedPoint_ShadowSample_t* sample,
+                                   const t_Fixed8* r)
+{
+    uint32 k;
+
+    for (k = 0U; k < sample->count; k++)
+    {
+        FixedPoint_Shadow_Check(op, 8U, sample->a[k], sample->b[k], (double)r[sample->index[k]] / (double)SCALE_8,
+                                E_OK);
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read the accuracy statistics of an operation, merged over all threads.
+ *
+ *  @param[in]  op      Operation.
+ *  @param[in]  width   16 or 8.
+ *  @param[out] stats   Pointer to store a snapshot of the statistics.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Statistics copied.
+ *  @retval     E_NOT_OK    Null pointer, unknown operation or width.
+ */
+Std_ReturnType FixedPoint_Shadow_GetStats(FixedPoint_Operation_t op, uint8 width, FixedPoint_ShadowStats_t* stats)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((stats != NULL) && ((uint32)op < FIXEDPOINT_SHADOW_OPS) && ((width == 16U) || (width == 8U)))
+    {
+        const uint32 count = FixedPoint_ShadowSlotCount;
+        const uint32 slots = (count < FIXEDPOINT_SHADOW_MAX_THREADS) ? count : FIXEDPOINT_SHADOW_MAX_THREADS;
+        const uint32 w = (width == 16U) ? 0U : 1U;
+        uint32 s;
+
+        (void)memset(stats, 0, sizeof(*stats));
+        for (s = 0U; s < slots; s++)
+        {
+            const FixedPoint_ShadowStats_t* const slot = &FixedPoint_ShadowSlots[s].stats[w][op];
+
+            stats->samples += slot->samples;
+            stats->rejected += slot->rejected;
+            stats->sumError += slot->sumError;
+            if (slot->maxError > stats->maxError)
+            {
+                stats->maxError = slot->maxError;
+                stats->maxErrorA = slot->maxErrorA;
+                stats->maxErrorB = slot->maxErrorB;
+            }
+        }
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Number of threads not monitored because the statistics pool was exhausted.
+ *
+ *  @return     uint32
+ *  @retval     Threads beyond FIXEDPOINT_SHADOW_MAX_THREADS that reached a check.
+ */
+uint32 FixedPoint_Shadow_GetDropped(void)
+{
+    return FixedPoint_ShadowDropped;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Clear the accuracy statistics of all operations and threads.
+ *
+ *  Threads keep their slots. A check running at the same time may survive the reset.
+ */
+void FixedPoint_Shadow_Reset(void)
+{
+    (void)memset(FixedPoint_ShadowSlots, 0, sizeof(FixedPoint_ShadowSlots));
+}
+#endif
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,90 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Shadow.h
+
+@brief      Interface for the sampled accuracy monitor (shadow execution against a double reference).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Added number of threads not monitored.
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_SHADOW_H
+#define FIXED_POINT_SHADOW_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Accuracy statistics of one operation and width. Errors are in LSBs of the result format. */
+typedef struct
+{
+    uint64 samples;     /**< Checked results */
+    uint64 rejected;    /**< Sampled results not compared: saturation, division by zero */
+    double sumError;    /**< Sum of the absolute errors, mean = sumError / samples */
+    double maxError;    /**< Largest absolute error */
+    double maxErrorA;   /**< First operand of the largest error */
+    double maxErrorB;   /**< Second operand of the largest error */
+} FixedPoint_ShadowStats_t;
+
+/** @brief   Operands of the checked elements of a sampled batch kernel call, captured before the
+ *           kernel runs because the result array may alias an operand array. */
+typedef struct
+{
+    uint32 count;                                   /**< Captured elements, 0 = call not sampled */
+    uint32 index[FIXEDPOINT_SHADOW_ARRAY_CHECKS];   /**< Element indices */
+    double a[FIXEDPOINT_SHADOW_ARRAY_CHECKS];       /**< First operand values */
+    double b[FIXEDPOINT_SHADOW_ARRAY_CHECKS];       /**< Second operand values */
+} FixedPoint_ShadowSample_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern void FixedPoint_Shadow_SetRate(uint32 rate);
+extern uint32 FixedPoint_Shadow_GetRate(void);
+extern uint32 FixedPoint_Shadow_Reload(void);
+extern void FixedPoint_Shadow_Check(FixedPoint_Operation_t op, uint8 width, double a, double b, double r,
+                                    Std_ReturnType status);
+extern void FixedPoint_Shadow_Capture16(FixedPoint_ShadowSample_t* sample, const t_Fixed16* a, const t_Fixed16* b,
+                                        uint32 len);
+extern void FixedPoint_Shadow_Capture8(FixedPoint_ShadowSample_t* sample, const t_Fixed8* a, const t_Fixed8* b,
+                                       uint32 len);
+extern void FixedPoint_Shadow_CheckArray16(FixedPoint_Operation_t op, const FixedPoint_ShadowSample_t* sample,
+                                           const t_Fixed16* r);
+extern void FixedPoint_Shadow_CheckArray8(FixedPoint_Operation_t op, const FixedPoint_ShadowSample_t* sample,
+                                          const t_Fixed8* r);
+extern Std_ReturnType FixedPoint_Shadow_GetStats(FixedPoint_Operation_t op, uint8 width, FixedPoint_ShadowStats_t* stats);
+extern uint32 FixedPoint_Shadow_GetDropped(void);
+extern void FixedPoint_Shadow_Reset(void);
+#endif
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_SHADOW_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,659 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Sim.c
+
+@brief      Simulation of many instances of a 16-bit fixed-point algorithm in SIMD lanes.
+ *
+ * Detailed Description:
+ * - Validation runs the same fixed-point algorithm (controller, plant model, ...) for a large number
+ *   of device instances with different inputs and parameters. The algorithm is given once as a list
+ *   of steps on per-instance registers; the runtime executes every step for FIXEDPOINT_SIM_LANES
+ *   instances at once instead of calling the scalar operations instance by instance.
+ * - ADD, SUB, MULT and DIV give the results of FixedPoint_Op16_Strided() bit for bit, including the
+ *   symmetric rounding, the saturation and the division by zero. A saturation or division by zero
+ *   sets a sticky flag of the affected instance only (lane status) and is reported to the probe.
+ * - SSE2 runs ADD, SUB, MIN, MAX and MOV on 8 lanes with 16-bit instructions and MULT with 32-bit
+ *   products and a saturating pack; DIV, and all steps in builds without SSE2, run lane by lane.
+ *   Padding lanes of the last group are computed but never flagged or reported.
+ * - Groups are independent: FixedPoint_Sim_Run() executes a range of groups, so threads can run
+ *   disjoint ranges, and FixedPoint_Sim_Work() lets any number of threads claim groups in chunks of
+ *   FIXEDPOINT_SIM_CLAIM_GROUPS with an atomic counter until all groups are done.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint.h"
+#include "FixedPoint_Sim.h"
+#include "FixedPoint_Probe.h"
+#include "FixedPoint_Trace.h"
+
+#if (FIXEDPOINT_SSE2 == 1U)
+#include <emmintrin.h>         /* for the SSE2 16-bit saturating arithmetic, multiply and pack intrinsics */
+#endif
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Number of lanes of one SSE2 register. */
+#define FIXEDPOINT_SIM_VEC_LANES        (8U)
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static uint8 FixedPoint_Sim_Lane(FixedPoint_SimOp_t op, t_Fixed16 a, t_Fixed16 b, t_Fixed16* r, boolean live);
+static uint8 FixedPoint_Sim_Step(FixedPoint_SimOp_t op, const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r,
+                                 uint8* status, uint32 valid);
+static uint8 FixedPoint_Sim_Groups(const FixedPoint_Sim_t* sim, uint32 firstGroup, uint32 numGroups,
+                                   uint32 iterations);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     One step of one lane, with the semantics of the 16-bit core operations.
+ *
+ *  @param[in]  op      Operation.
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[out] r       Result.
+ *  @param[in]  live    Lane holds an instance (0 = padding lane: not flagged, not reported).
+ *
+ *  @return     Lane status flags of the step (FIXEDPOINT_SIM_STATUS_*).
+ */
+static uint8 FixedPoint_Sim_Lane(FixedPoint_SimOp_t op, t_Fixed16 a, t_Fixed16 b, t_Fixed16* r, boolean live)
+{
+    uint8 flags = 0U;
+    sint64 tmp;
+
+    if (op == FIXEDPOINT_SIM_ADD)
+    {
+        tmp = (sint64)a + (sint64)b;
+    }
+    else if (op == FIXEDPOINT_SIM_SUB)
+    {
+        tmp = (sint64)a - (sint64)b;
+    }
+    else if (op == FIXEDPOINT_SIM_MULT)
+    {
+        tmp = (sint64)a * (sint64)b;
+#if (SHIFT_16 > 0U)
+        /* Round the magnitude half away from zero, as FixedPoint_Mult16_Core() */
+        tmp = (tmp < 0) ? -((-tmp + ((sint64)1 << (SHIFT_16 - 1U))) >> SHIFT_16)
+                        : ((tmp + ((sint64)1 << (SHIFT_16 - 1U))) >> SHIFT_16);
+#endif
+    }
+    else if (op == FIXEDPOINT_SIM_DIV)
+    {
+        if (b != 0)
+        {
+            /* Scaled magnitude plus half the divisor, as FixedPoint_Div16_Core() */
+            const uint64 num = ((uint64)((a < 0) ? -(sint64)a : (sint64)a) << SHIFT_16);
+            const uint64 den = (uint64)((b < 0) ? -(sint64)b : (sint64)b);
+
+            tmp = (sint64)((num + (den >> 1U)) / den);
+            tmp = ((((sint32)a ^ (sint32)b) < 0) ? -tmp : tmp);
+        }
+        else
+        {
+            /* Division by zero: saturate towards the sign of the dividend, as FixedPoint_Div16_Array() */
+            tmp = (a > 0) ? (sint64)FIX16_MAX : ((a < 0) ? (sint64)FIX16_MIN : 0);
+            if (live != 0U)
+            {
+                FIXEDPOINT_PROBE_DIV_ZERO(16, a, tmp);
+                flags = FIXEDPOINT_SIM_STATUS_DIV_ZERO;
+            }
+        }
+    }
+    else if (op == FIXEDPOINT_SIM_MIN)
+    {
+        tmp = (a < b) ? a : b;
+    }
+    else if (op == FIXEDPOINT_SIM_MAX)
+    {
+        tmp = (a > b) ? a : b;
+    }
+    else
+    {
+        tmp = a;
+    }
+
+    if ((tmp > (sint64)FIX16_MAX) || (tmp < (sint64)FIX16_MIN))
+    {
+        tmp = (tmp > 0) ? (sint64)FIX16_MAX : (sint64)FIX16_MIN;
+        if (live != 0U)
+        {
+            FIXEDPOINT_PROBE_SATURATE(op, 16, a, b, tmp);
+            flags |= FIXEDPOINT_SIM_STATUS_SAT;
+        }
+    }
+
+    *r = (t_Fixed16)tmp;
+
+    return flags;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     One step for the FIXEDPOINT_SIM_LANES lanes of a group.
+ *
+ *  @param[in]  op      Operation.
+ *  @param[in]  a       First operand register of the group.
+ *  @param[in]  b       Second operand register of the group.
+ *  @param[out] r       Result register of the group (may be a or b).
+ *  @param[in,out] status   Lane status of the group, flags of the step are added.
+ *  @param[in]  valid   Number of lanes holding an instance (1..FIXEDPOINT_SIM_LANES).
+ *
+ *  @return     Union of the lane status flags of the step.
+ */
+static uint8 FixedPoint_Sim_Step(FixedPoint_SimOp_t op, const t_Fixed16* a, const t_Fixed16* b, t_Fixed16* r,
+                                 uint8* status, uint32 valid)
+{
+    uint8 flags = 0U;
+    uint32 i;
+
+#if (FIXEDPOINT_SSE2 == 1U)
+    if (op != FIXEDPOINT_SIM_DIV)
+    {
+        const __m128i ones = _mm_cmpeq_epi16(_mm_setzero_si128(), _mm_setzero_si128());
+        const __m128i validv = _mm_set1_epi16((sint16)valid);
+        __m128i lane = _mm_setr_epi16(0, 1, 2, 3, 4, 5, 6, 7);
+
+        for (i = 0U; i < FIXEDPOINT_SIM_LANES; i += FIXEDPOINT_SIM_VEC_LANES)
+        {
+            const __m128i av = _mm_loadu_si128((const __m128i*)(const void*)&a[i]);
+            const __m128i bv = _mm_loadu_si128((const __m128i*)(const void*)&b[i]);
+            __m128i rv;
+            __m128i sat = _mm_setzero_si128();
+            uint32 mask;
+
+            if (op == FIXEDPOINT_SIM_ADD)
+            {
+                rv = _mm_adds_epi16(av, bv);
+                sat = _mm_xor_si128(_mm_cmpeq_epi16(rv, _mm_add_epi16(av, bv)), ones);
+            }
+            else if (op == FIXEDPOINT_SIM_SUB)
+            {
+                rv = _mm_subs_epi16(av, bv);
+                sat = _mm_xor_si128(_mm_cmpeq_epi16(rv, _mm_sub_epi16(av, bv)), ones);
+            }
+            else if (op == FIXEDPOINT_SIM_MULT)
+            {
+                const __m128i lo = _mm_mullo_epi16(av, bv);
+                const __m128i hi = _mm_mulhi_epi16(av, bv);
+                __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+                __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+                const __m128i s0 = _mm_srai_epi32(p0, 31);
+                const __m128i s1 = _mm_srai_epi32(p1, 31);
+#if (SHIFT_16 > 0U)
+                const __m128i half = _mm_set1_epi32(1 << (SHIFT_16 - 1U));
+
+                /* Magnitude, rounded half away from zero and shifted, with the sign restored */
+                p0 = _mm_sub_epi32(_mm_xor_si128(_mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_xor_si128(p0, s0), s0),
+                                                                              half), SHIFT_16), s0), s0);
+                p1 = _mm_sub_epi32(_mm_xor_si128(_mm_srli_epi32(_mm_add_epi32(_mm_sub_epi32(_mm_xor_si128(p1, s1), s1),
+                                                                              half), SHIFT_16), s1), s1);
+#else
+                (void)s0;
+                (void)s1;
+#endif
+                /* The saturating pack clamps to 16 bits; a lane saturated if it does not widen back */
+                rv = _mm_packs_epi32(p0, p1);
+                sat = _mm_xor_si128(_mm_packs_epi32(
+                                        _mm_cmpeq_epi32(p0, _mm_srai_epi32(_mm_unpacklo_epi16(rv, rv), 16)),
+                                        _mm_cmpeq_epi32(p1, _mm_srai_epi32(_mm_unpackhi_epi16(rv, rv), 16))),
+                                    ones);
+            }
+            else if (op == FIXEDPOINT_SIM_MIN)
+            {
+                rv = _mm_min_epi16(av, bv);
+            }
+            else if (op == FIXEDPOINT_SIM_MAX)
+            {
+                rv = _mm_max_epi16(av, bv);
+            }
+            else
+            {
+                rv = av;
+            }
+
+            sat = _mm_and_si128(sat, _mm_cmplt_epi16(lane, validv));
+            mask = (uint32)_mm_movemask_epi8(sat);
+            if (mask != 0U)
+            {
+                /* Saturated instances: report them with the operands before the store (r may alias) */
+                const __m128i st = _mm_loadl_epi64((const __m128i*)(const void*)&status[i]);
+                t_Fixed16 res[FIXEDPOINT_SIM_VEC_LANES];
+                uint32 k;
+
+                _mm_storeu_si128((__m128i*)(void*)res, rv);
+                for (k = 0U; k < FIXEDPOINT_SIM_VEC_LANES; k++)
+                {
+                    if (((mask >> (2U * k)) & 1U) != 0U)
+                    {
+                        FIXEDPOINT_PROBE_SATURATE(op, 16, a[i + k], b[i + k], res[k]);
+                    }
+                }
+                _mm_storel_epi64((__m128i*)(void*)&status[i],
+                                 _mm_or_si128(st, _mm_and_si128(_mm_packs_epi16(sat, sat),
+                                                                _mm_set1_epi8((char)FIXEDPOINT_SIM_STATUS_SAT))));
+                flags = FIXEDPOINT_SIM_STATUS_SAT;
+            }
+            _mm_storeu_si128((__m128i*)(void*)&r[i], rv);
+            lane = _mm_add_epi16(lane, _mm_set1_epi16((sint16)FIXEDPOINT_SIM_VEC_LANES));
+        }
+    }
+    else
+#endif
+    {
+        for (i = 0U; i < FIXEDPOINT_SIM_LANES; i++)
+        {
+            const uint8 laneFlags = FixedPoint_Sim_Lane(op, a[i], b[i], &r[i], (i < valid) ? 1U : 0U);
+
+            status[i] |= laneFlags;
+            flags |= laneFlags;
+        }
+    }
+
+    return flags;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Run the algorithm on a range of groups.
+ *
+ *  Each group runs all iterations before the next group starts, so that its registers stay in L1.
+ *
+ *  @param[in]  sim         Simulation (valid).
+ *  @param[in]  firstGroup  First group.
+ *  @param[in]  numGroups   Number of groups (firstGroup + numGroups <= sim->numGroups).
+ *  @param[in]  iterations  Number of executions of the algorithm.
+ *
+ *  @return     Union of the lane status flags of the run.
+ */
+static uint8 FixedPoint_Sim_Groups(const FixedPoint_Sim_t* sim, uint32 firstGroup, uint32 numGroups,
+                                   uint32 iterations)
+{
+    uint8 flags = 0U;
+    uint32 g;
+
+    for (g = firstGroup; g < (firstGroup + numGroups); g++)
+    {
+        t_Fixed16* regs = &sim->regs[g * sim->numRegs * FIXEDPOINT_SIM_LANES];
+        uint8* status = &sim->status[g * FIXEDPOINT_SIM_LANES];
+        const uint32 first = g * FIXEDPOINT_SIM_LANES;
+        const uint32 valid = ((sim->numInstances - first) < FIXEDPOINT_SIM_LANES)
+                           ? (sim->numInstances - first) : FIXEDPOINT_SIM_LANES;
+        uint32 it;
+        uint32 s;
+
+        for (it = 0U; it < iterations; it++)
+        {
+            for (s = 0U; s < sim->numSteps; s++)
+            {
+                const FixedPoint_SimStep_t* step = &sim->steps[s];
+
+                flags |= FixedPoint_Sim_Step(step->op, &regs[(uint32)step->src1 * FIXEDPOINT_SIM_LANES],
+                                             &regs[(uint32)step->src2 * FIXEDPOINT_SIM_LANES],
+                                             &regs[(uint32)step->dst * FIXEDPOINT_SIM_LANES], status, valid);
+            }
+        }
+    }
+
+    return flags;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set up a simulation; all registers and lane status are cleared.
+ *
+ *  @param[out] sim             Simulation.
+ *  @param[in]  steps           Algorithm, executed in order; must stay valid.
+ *  @param[in]  numSteps        Number of steps (>= 1).
+ *  @param[in]  regs            Register file of FIXEDPOINT_SIM_REGS_LEN(numRegs, numInstances) values.
+ *  @param[in]  numRegs         Registers per instance (>= 1, every register of the steps below numRegs).
+ *  @param[in]  status          Lane status of FIXEDPOINT_SIM_STATUS_LEN(numInstances) bytes.
+ *  @param[in]  numInstances    Number of instances (>= 1).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Simulation set up.
+ *  @retval     E_NOT_OK    Null pointer, empty simulation or invalid step.
+ */
+Std_ReturnType FixedPoint_Sim_Init(FixedPoint_Sim_t* sim, const FixedPoint_SimStep_t* steps, uint32 numSteps,
+                                   t_Fixed16* regs, uint32 numRegs, uint8* status, uint32 numInstances)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (steps != NULL) && (regs != NULL) && (status != NULL) && (numSteps >= 1U) &&
+        (numRegs >= 1U) && (numInstances >= 1U))
+    {
+        uint32 i;
+
+        ret = E_OK;
+        for (i = 0U; i < numSteps; i++)
+        {
+            if (((uint32)steps[i].op >= (uint32)FIXEDPOINT_SIM_OPS) || ((uint32)steps[i].dst >= numRegs) ||
+                ((uint32)steps[i].src1 >= numRegs) || ((uint32)steps[i].src2 >= numRegs))
+            {
+                ret = E_NOT_OK;
+            }
+        }
+
+        if (ret == E_OK)
+        {
+            sim->steps = steps;
+            sim->numSteps = numSteps;
+            sim->regs = regs;
+            sim->status = status;
+            sim->numRegs = numRegs;
+            sim->numInstances = numInstances;
+            sim->numGroups = FIXEDPOINT_SIM_GROUPS(numInstances);
+            sim->nextGroup = sim->numGroups;
+
+            for (i = 0U; i < FIXEDPOINT_SIM_REGS_LEN(numRegs, numInstances); i++)
+            {
+                regs[i] = 0;
+            }
+            for (i = 0U; i < FIXEDPOINT_SIM_STATUS_LEN(numInstances); i++)
+            {
+                status[i] = 0U;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set a register of one instance.
+ *
+ *  @param[in,out] sim      Simulation.
+ *  @param[in]  reg         Register.
+ *  @param[in]  instance    Instance.
+ *  @param[in]  value       New value.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Register set.
+ *  @retval     E_NOT_OK    Null pointer, register or instance out of range.
+ */
+Std_ReturnType FixedPoint_Sim_Set(FixedPoint_Sim_t* sim, uint32 reg, uint32 instance, t_Fixed16 value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (reg < sim->numRegs) && (instance < sim->numInstances))
+    {
+        sim->regs[((((instance / FIXEDPOINT_SIM_LANES) * sim->numRegs) + reg) * FIXEDPOINT_SIM_LANES) +
+                  (instance % FIXEDPOINT_SIM_LANES)] = value;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read a register of one instance.
+ *
+ *  @param[in]  sim         Simulation.
+ *  @param[in]  reg         Register.
+ *  @param[in]  instance    Instance.
+ *  @param[out] value       Register value.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Register read.
+ *  @retval     E_NOT_OK    Null pointer, register or instance out of range.
+ */
+Std_ReturnType FixedPoint_Sim_Get(const FixedPoint_Sim_t* sim, uint32 reg, uint32 instance, t_Fixed16* value)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (value != NULL) && (reg < sim->numRegs) && (instance < sim->numInstances))
+    {
+        *value = sim->regs[((((instance / FIXEDPOINT_SIM_LANES) * sim->numRegs) + reg) * FIXEDPOINT_SIM_LANES) +
+                           (instance % FIXEDPOINT_SIM_LANES)];
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Set a register of all instances.
+ *
+ *  @param[in,out] sim      Simulation.
+ *  @param[in]  reg         Register.
+ *  @param[in]  values      New values, values[instance], numInstances values.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Register set.
+ *  @retval     E_NOT_OK    Null pointer or register out of range.
+ */
+Std_ReturnType FixedPoint_Sim_SetArray(FixedPoint_Sim_t* sim, uint32 reg, const t_Fixed16* values)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (values != NULL) && (reg < sim->numRegs))
+    {
+        uint32 i;
+
+        for (i = 0U; i < sim->numInstances; i++)
+        {
+            sim->regs[((((i / FIXEDPOINT_SIM_LANES) * sim->numRegs) + reg) * FIXEDPOINT_SIM_LANES) +
+                      (i % FIXEDPOINT_SIM_LANES)] = values[i];
+        }
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read a register of all instances.
+ *
+ *  @param[in]  sim         Simulation.
+ *  @param[in]  reg         Register.
+ *  @param[out] values      Register values, values[instance], numInstances values.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Register read.
+ *  @retval     E_NOT_OK    Null pointer or register out of range.
+ */
+Std_ReturnType FixedPoint_Sim_GetArray(const FixedPoint_Sim_t* sim, uint32 reg, t_Fixed16* values)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (values != NULL) && (reg < sim->numRegs))
+    {
+        uint32 i;
+
+        for (i = 0U; i < sim->numInstances; i++)
+        {
+            values[i] = sim->regs[((((i / FIXEDPOINT_SIM_LANES) * sim->numRegs) + reg) * FIXEDPOINT_SIM_LANES) +
+                                  (i % FIXEDPOINT_SIM_LANES)];
+        }
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Run the algorithm iterations times on the instances of a range of groups.
+ *
+ *  Calls on disjoint group ranges may run concurrently in different threads.
+ *
+ *  @param[in,out] sim      Simulation.
+ *  @param[in]  firstGroup  First group (group g holds instances g * FIXEDPOINT_SIM_LANES onwards).
+ *  @param[in]  numGroups   Number of groups.
+ *  @param[in]  iterations  Number of executions of the algorithm.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No instance saturated or divided by zero.
+ *  @retval     E_NOT_OK    Null pointer, group range out of range, or the lane status of an instance was set.
+ */
+Std_ReturnType FixedPoint_Sim_Run(FixedPoint_Sim_t* sim, uint32 firstGroup, uint32 numGroups, uint32 iterations)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Sim_Run");
+
+    if ((sim != NULL) && (firstGroup <= sim->numGroups) && (numGroups <= (sim->numGroups - firstGroup)))
+    {
+        ret = (FixedPoint_Sim_Groups(sim, firstGroup, numGroups, iterations) == 0U) ? E_OK : E_NOT_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("Sim_Run");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Make all groups available to FixedPoint_Sim_Work().
+ *
+ *  Called by one thread before the workers start; the workers must have returned from the previous round.
+ *
+ *  @param[in,out] sim      Simulation.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Groups available.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Sim_Begin(FixedPoint_Sim_t* sim)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (sim != NULL)
+    {
+        sim->nextGroup = 0U;
+        FIXEDPOINT_MEMORY_BARRIER();
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Worker: claim and run groups until all groups made available by FixedPoint_Sim_Begin() are done.
+ *
+ *  Any number of threads may call this concurrently; each group is run by exactly one of them.
+ *
+ *  @param[in,out] sim      Simulation.
+ *  @param[in]  iterations  Number of executions of the algorithm.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No instance of the groups run by this call saturated or divided by zero.
+ *  @retval     E_NOT_OK    Null pointer, or the lane status of an instance run by this call was set.
+ */
+Std_ReturnType FixedPoint_Sim_Work(FixedPoint_Sim_t* sim, uint32 iterations)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    FIXEDPOINT_TRACE_BEGIN("Sim_Work");
+
+    if (sim != NULL)
+    {
+        uint8 flags = 0U;
+        boolean done = 0U;
+
+        while (done == 0U)
+        {
+            const uint32 first = FIXEDPOINT_ATOMIC_FETCH_ADD(&sim->nextGroup, FIXEDPOINT_SIM_CLAIM_GROUPS);
+
+            if (first < sim->numGroups)
+            {
+                const uint32 count = ((sim->numGroups - first) < FIXEDPOINT_SIM_CLAIM_GROUPS)
+                                   ? (sim->numGroups - first) : FIXEDPOINT_SIM_CLAIM_GROUPS;
+
+                flags |= FixedPoint_Sim_Groups(sim, first, count, iterations);
+            }
+            else
+            {
+                done = 1U;
+            }
+        }
+
+        ret = (flags == 0U) ? E_OK : E_NOT_OK;
+    }
+
+    FIXEDPOINT_TRACE_END("Sim_Work");
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Read the lane status of one instance.
+ *
+ *  @param[in]  sim         Simulation.
+ *  @param[in]  instance    Instance.
+ *  @param[out] status      Sticky FIXEDPOINT_SIM_STATUS_* flags of the instance (0 = no saturation).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Status read.
+ *  @retval     E_NOT_OK    Null pointer or instance out of range.
+ */
+Std_ReturnType FixedPoint_Sim_GetStatus(const FixedPoint_Sim_t* sim, uint32 instance, uint8* status)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((sim != NULL) && (status != NULL) && (instance < sim->numInstances))
+    {
+        *status = sim->status[instance];
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Clear the lane status of all instances.
+ *
+ *  @param[in,out] sim      Simulation.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Status cleared.
+ *  @retval     E_NOT_OK    Null pointer.
+ */
+Std_ReturnType FixedPoint_Sim_ClearStatus(FixedPoint_Sim_t* sim)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (sim != NULL)
+    {
+        uint32 i;
+
+        for (i = 0U; i < FIXEDPOINT_SIM_STATUS_LEN(sim->numInstances); i++)
+        {
+            sim->status[i] = 0U;
+        }
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,126 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Sim.h
+
+@brief      Interface for the simulation of many instances of a 16-bit fixed-point algorithm in SIMD lanes.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_SIM_H
+#define FIXED_POINT_SIM_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Lane status flag: an operation of the instance saturated since the status was cleared. */
+#define FIXEDPOINT_SIM_STATUS_SAT       (0x01U)
+
+/** @brief Lane status flag: a division of the instance had a zero divisor since the status was cleared. */
+#define FIXEDPOINT_SIM_STATUS_DIV_ZERO  (0x02U)
+
+/** @brief Number of groups of FIXEDPOINT_SIM_LANES instances holding numInstances instances. */
+#define FIXEDPOINT_SIM_GROUPS(numInstances) \
+    (((numInstances) + FIXEDPOINT_SIM_LANES - 1U) / FIXEDPOINT_SIM_LANES)
+
+/** @brief Length in t_Fixed16 of the register file of numRegs registers for numInstances instances. */
+#define FIXEDPOINT_SIM_REGS_LEN(numRegs, numInstances) \
+    ((numRegs) * FIXEDPOINT_SIM_GROUPS(numInstances) * FIXEDPOINT_SIM_LANES)
+
+/** @brief Length in uint8 of the lane status of numInstances instances. */
+#define FIXEDPOINT_SIM_STATUS_LEN(numInstances) \
+    (FIXEDPOINT_SIM_GROUPS(numInstances) * FIXEDPOINT_SIM_LANES)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Operation of a simulation step; ADD to DIV have the saturation and rounding of FixedPoint_Op16_Strided(). */
+typedef enum
+{
+    FIXEDPOINT_SIM_ADD = 0,     /**< dst = src1 + src2 */
+    FIXEDPOINT_SIM_SUB,         /**< dst = src1 - src2 */
+    FIXEDPOINT_SIM_MULT,        /**< dst = src1 * src2 */
+    FIXEDPOINT_SIM_DIV,         /**< dst = src1 / src2 */
+    FIXEDPOINT_SIM_MIN,         /**< dst = min(src1, src2) */
+    FIXEDPOINT_SIM_MAX,         /**< dst = max(src1, src2) */
+    FIXEDPOINT_SIM_MOV,         /**< dst = src1 (src2 ignored) */
+    FIXEDPOINT_SIM_OPS          /**< Number of operations */
+} FixedPoint_SimOp_t;
+
+/** @brief   One step of the simulated algorithm, applied to every instance. */
+typedef struct
+{
+    FixedPoint_SimOp_t op;      /**< Operation */
+    uint16             dst;     /**< Result register (may equal a source register) */
+    uint16             src1;    /**< First operand register */
+    uint16             src2;    /**< Second operand register */
+} FixedPoint_SimStep_t;
+
+/** @brief   Simulation of numInstances instances of an algorithm given as a list of steps.
+ *
+ * Each instance has numRegs registers holding its inputs, parameters, state and outputs. The register
+ * file is kept per group of FIXEDPOINT_SIM_LANES instances, register by register
+ * (regs[(group * numRegs + reg) * FIXEDPOINT_SIM_LANES + lane]), so that a step runs over the lanes of a
+ * group with SIMD instructions while the group stays in the L1 cache, and different groups share no
+ * cache lines of the register file.
+ */
+typedef struct
+{
+    const FixedPoint_SimStep_t* steps;          /**< Algorithm, executed in order */
+    uint32                      numSteps;       /**< Number of steps */
+    t_Fixed16*                  regs;           /**< Register file, FIXEDPOINT_SIM_REGS_LEN(numRegs, numInstances) */
+    uint8*                      status;         /**< Sticky lane status, FIXEDPOINT_SIM_STATUS_LEN(numInstances) */
+    uint32                      numRegs;        /**< Registers per instance */
+    uint32                      numInstances;   /**< Number of instances */
+    uint32                      numGroups;      /**< Number of groups, FIXEDPOINT_SIM_GROUPS(numInstances) */
+    uint32                      nextGroup;      /**< Next group claimed by FixedPoint_Sim_Work() */
+} FixedPoint_Sim_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Sim_Init(FixedPoint_Sim_t* sim, const FixedPoint_SimStep_t* steps, uint32 numSteps,
+                                          t_Fixed16* regs, uint32 numRegs, uint8* status, uint32 numInstances);
+extern Std_ReturnType FixedPoint_Sim_Set(FixedPoint_Sim_t* sim, uint32 reg, uint32 instance, t_Fixed16 value);
+extern Std_ReturnType FixedPoint_Sim_Get(const FixedPoint_Sim_t* sim, uint32 reg, uint32 instance, t_Fixed16* value);
+extern Std_ReturnType FixedPoint_Sim_SetArray(FixedPoint_Sim_t* sim, uint32 reg, const t_Fixed16* values);
+extern Std_ReturnType FixedPoint_Sim_GetArray(const FixedPoint_Sim_t* sim, uint32 reg, t_Fixed16* values);
+extern Std_ReturnType FixedPoint_Sim_Run(FixedPoint_Sim_t* sim, uint32 firstGroup, uint32 numGroups,
+                                         uint32 iterations);
+extern Std_ReturnType FixedPoint_Sim_Begin(FixedPoint_Sim_t* sim);
+extern Std_ReturnType FixedPoint_Sim_Work(FixedPoint_Sim_t* sim, uint32 iterations);
+extern Std_ReturnType FixedPoint_Sim_GetStatus(const FixedPoint_Sim_t* sim, uint32 instance, uint8* status);
+extern Std_ReturnType FixedPoint_Sim_ClearStatus(FixedPoint_Sim_t* sim);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_SIM_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
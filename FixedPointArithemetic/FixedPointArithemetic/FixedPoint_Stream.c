@@ -0,0 +1,450 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Stream.c
+
+@brief      Block-based streaming pipelines over 16-bit fixed-point data.
+ *
+ * Detailed Description:
+ * - A pipeline is a chain of stages: one source (generator), any number of transforms and one sink.
+ * - Every stage is a resumable function with its own state structure. It is called once per block
+ *   and continues where the previous call stopped, so per-sample state machines become stages that
+ *   process whole blocks with the batch kernels.
+ * - Blocks are passed between stages in two application provided buffers used alternately
+ *   (ping-pong). Stage states are plain structures owned by the application, so the steady state
+ *   is free of dynamic memory.
+ * - Predefined stages: array source, array sink, file source, file sink, scalar operation
+ *   (gain, offset, ...) and FIR filter.
+ * - The file stages move one whole block per fread()/fwrite() call, so the number of library
+ *   calls and copies is independent of the sample count. Block lengths of some thousand samples
+ *   keep the I/O in large sequential transfers.
+ * - The file stages are synchronous: the pipeline waits for every fread()/fwrite() and the
+ *   arithmetic of a block does not overlap the I/O of the next one. Only the read-ahead and
+ *   write-behind of the C library and the operating system hide part of the latency. The module
+ *   creates no threads; an application that needs overlap reads in its own thread into buffers it
+ *   hands to the pipeline with FixedPoint_Stream_ArraySource().
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Added file source and sink stages.
+01.02.00  2026-10-18  AGT    Added trace points around the stage calls.
+01.03.00  2026-10-18  AGT    Documented that the file stages do not overlap I/O and computation.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Stream.h"
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise an empty pipeline.
+ *
+ *  @param[out] stream      Pipeline to initialise.
+ *  @param[in]  bufferA     First block buffer with blockLen entries.
+ *  @param[in]  bufferB     Second block buffer with blockLen entries.
+ *  @param[in]  blockLen    Maximum number of samples per block (>= 1).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Pipeline initialised.
+ *  @retval     E_NOT_OK    Null pointer or zero block length.
+ */
+Std_ReturnType FixedPoint_Stream_Init(FixedPoint_Stream_t* stream, t_Fixed16* bufferA, t_Fixed16* bufferB, uint32 blockLen)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((stream != NULL) && (bufferA != NULL) && (bufferB != NULL) && (blockLen > 0U))
+    {
+        stream->stageCount = 0U;
+        stream->buffer[0] = bufferA;
+        stream->buffer[1] = bufferB;
+        stream->blockLen = blockLen;
+        stream->finished = 0U;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Append a stage to the pipeline.
+ *
+ *  The first stage added is the source, the last one the sink.
+ *
+ *  @param[in,out]  stream      Pipeline.
+ *  @param[in]      process     Stage function.
+ *  @param[in]      context     Stage state passed to every call of the stage function.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Stage added.
+ *  @retval     E_NOT_OK    Null pointer or FIXEDPOINT_STREAM_MAX_STAGES reached.
+ */
+Std_ReturnType FixedPoint_Stream_AddStage(FixedPoint_Stream_t* stream, FixedPoint_StageFn_t process, void* context)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((stream != NULL) && (process != NULL) && (stream->stageCount < FIXEDPOINT_STREAM_MAX_STAGES))
+    {
+        stream->stages[stream->stageCount].process = process;
+        stream->stages[stream->stageCount].context = context;
+        stream->stageCount++;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Pass one block through the whole pipeline.
+ *
+ *  The source fills a block, every transform writes into the other buffer, and the sink consumes
+ *  the final block. All stages are called even if one reports E_NOT_OK (saturation), the status is
+ *  accumulated.
+ *
+ *  @param[in,out]  stream  Pipeline with at least a source and a sink.
+ *  @param[out]     end     Pointer to store whether the stream is finished.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block processed without saturation.
+ *  @retval     E_NOT_OK    Null pointer, incomplete pipeline or a stage reported E_NOT_OK.
+ */
+Std_ReturnType FixedPoint_Stream_Step(FixedPoint_Stream_t* stream, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((stream != NULL) && (end != NULL) && (stream->stageCount >= 2U))
+    {
+        FixedPoint_Block16_t block[2];
+        uint32 cur = 0U;
+        uint32 s;
+        boolean stageEnd = 0U;
+
+        block[0].data = stream->buffer[0];
+        block[0].len = 0U;
+        block[0].capacity = stream->blockLen;
+        block[1].data = stream->buffer[1];
+        block[1].len = 0U;
+        block[1].capacity = stream->blockLen;
+
+        ret = E_OK;
+
+        if (stream->finished == 0U)
+        {
+            /* Source */
+            FIXEDPOINT_TRACE_BEGIN("Stream_Source");
+            ret |= stream->stages[0].process(stream->stages[0].context, NULL, &block[cur], &stageEnd);
+            FIXEDPOINT_TRACE_END("Stream_Source");
+
+            /* Transforms: ping-pong between the two buffers */
+            for (s = 1U; s < (stream->stageCount - 1U); s++)
+            {
+                block[1U - cur].len = 0U;
+                FIXEDPOINT_TRACE_BEGIN("Stream_Transform");
+                ret |= stream->stages[s].process(stream->stages[s].context, &block[cur], &block[1U - cur], &stageEnd);
+                FIXEDPOINT_TRACE_END("Stream_Transform");
+                cur = 1U - cur;
+            }
+
+            /* Sink */
+            FIXEDPOINT_TRACE_BEGIN("Stream_Sink");
+            ret |= stream->stages[s].process(stream->stages[s].context, &block[cur], NULL, &stageEnd);
+            FIXEDPOINT_TRACE_END("Stream_Sink");
+
+            stream->finished = stageEnd;
+        }
+
+        *end = stream->finished;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Run the pipeline until a stage reports the end of the stream.
+ *
+ *  @param[in,out]  stream  Pipeline with at least a source and a sink.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Stream processed without saturation.
+ *  @retval     E_NOT_OK    Null pointer, incomplete pipeline or a stage reported E_NOT_OK.
+ */
+Std_ReturnType FixedPoint_Stream_Run(FixedPoint_Stream_t* stream)
+{
+    Std_ReturnType ret = E_OK;
+    boolean end = 0U;
+
+    while (end == 0U)
+    {
+        const Std_ReturnType step = FixedPoint_Stream_Step(stream, &end);
+
+        ret |= step;
+
+        if ((stream == NULL) || (stream->stageCount < 2U))
+        {
+            /* Invalid pipeline: Step cannot make progress */
+            ret = E_NOT_OK;
+            end = 1U;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Source stage: yields consecutive blocks of an array.
+ *
+ *  The last block may be shorter than the block length. The end of the stream is reported
+ *  together with the last block.
+ *
+ *  @param[in,out]  context     FixedPoint_StreamArraySource_t.
+ *  @param[in]      in          Unused (source).
+ *  @param[out]     out         Block to fill.
+ *  @param[out]     end         Set to 1 with the last block.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block produced.
+ *  @retval     E_NOT_OK    Null pointer passed.
+ */
+Std_ReturnType FixedPoint_Stream_ArraySource(void* context, const FixedPoint_Block16_t* in,
+                                             FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_StreamArraySource_t* src = (FixedPoint_StreamArraySource_t*)context;
+
+    (void)in;
+
+    if ((src != NULL) && (src->data != NULL) && (out != NULL) && (end != NULL))
+    {
+        const uint32 remaining = src->len - src->pos;
+        const uint32 n = (remaining < out->capacity) ? remaining : out->capacity;
+        uint32 i;
+
+        for (i = 0U; i < n; i++)
+        {
+            out->data[i] = src->data[src->pos + i];
+        }
+
+        src->pos += n;
+        out->len = n;
+
+        if (src->pos >= src->len)
+        {
+            *end = 1U;
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Sink stage: appends the blocks to an array.
+ *
+ *  Reports the end of the stream when the destination buffer is full. Samples that do not fit
+ *  are dropped and E_NOT_OK is returned.
+ *
+ *  @param[in,out]  context     FixedPoint_StreamArraySink_t.
+ *  @param[in]      in          Block to consume.
+ *  @param[out]     out         Unused (sink).
+ *  @param[out]     end         Set to 1 when the destination buffer is full.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block stored completely.
+ *  @retval     E_NOT_OK    Null pointer or destination buffer overflow.
+ */
+Std_ReturnType FixedPoint_Stream_ArraySink(void* context, const FixedPoint_Block16_t* in,
+                                           FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_StreamArraySink_t* sink = (FixedPoint_StreamArraySink_t*)context;
+
+    (void)out;
+
+    if ((sink != NULL) && (sink->data != NULL) && (in != NULL) && (end != NULL))
+    {
+        const uint32 space = sink->capacity - sink->pos;
+        const uint32 n = (in->len < space) ? in->len : space;
+        uint32 i;
+
+        for (i = 0U; i < n; i++)
+        {
+            sink->data[sink->pos + i] = in->data[i];
+        }
+
+        sink->pos += n;
+        ret = (n == in->len) ? E_OK : E_NOT_OK;
+
+        if (sink->pos >= sink->capacity)
+        {
+            *end = 1U;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Source stage: reads consecutive blocks of raw samples from a file.
+ *
+ *  One blocking fread() per block, the next block is not read ahead. The end of the stream is
+ *  reported with the first short block (end of file or read error).
+ *
+ *  @param[in,out]  context     FixedPoint_StreamFile_t.
+ *  @param[in]      in          Unused (source).
+ *  @param[out]     out         Block to fill.
+ *  @param[out]     end         Set to 1 with the last block.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block read.
+ *  @retval     E_NOT_OK    Null pointer or read error.
+ */
+Std_ReturnType FixedPoint_Stream_FileSource(void* context, const FixedPoint_Block16_t* in,
+                                            FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_StreamFile_t* src = (FixedPoint_StreamFile_t*)context;
+
+    (void)in;
+
+    if ((src != NULL) && (src->file != NULL) && (out != NULL) && (end != NULL))
+    {
+        const size_t n = fread(out->data, sizeof(t_Fixed16), (size_t)out->capacity, src->file);
+
+        out->len = (uint32)n;
+        src->samples += (uint32)n;
+        ret = (ferror(src->file) == 0) ? E_OK : E_NOT_OK;
+
+        if (n < (size_t)out->capacity)
+        {
+            *end = 1U;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Sink stage: appends the blocks as raw samples to a file.
+ *
+ *  One blocking fwrite() per block, the stream continues when it returns. A failed write ends the
+ *  stream.
+ *
+ *  @param[in,out]  context     FixedPoint_StreamFile_t.
+ *  @param[in]      in          Block to write.
+ *  @param[out]     out         Unused (sink).
+ *  @param[out]     end         Set to 1 on a write error.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block written completely.
+ *  @retval     E_NOT_OK    Null pointer or write error.
+ */
+Std_ReturnType FixedPoint_Stream_FileSink(void* context, const FixedPoint_Block16_t* in,
+                                          FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_StreamFile_t* sink = (FixedPoint_StreamFile_t*)context;
+
+    (void)out;
+
+    if ((sink != NULL) && (sink->file != NULL) && (in != NULL) && (end != NULL))
+    {
+        const size_t n = fwrite(in->data, sizeof(t_Fixed16), (size_t)in->len, sink->file);
+
+        sink->samples += (uint32)n;
+
+        if (n == (size_t)in->len)
+        {
+            ret = E_OK;
+        }
+        else
+        {
+            *end = 1U;
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Transform stage: operation with a constant operand, out[i] = in[i] (op) operand.
+ *
+ *  Runs the strided batch kernel with the operand broadcast (stride 0), e.g. for gain or offset.
+ *
+ *  @param[in,out]  context     FixedPoint_StreamScalarOp_t.
+ *  @param[in]      in          Input block.
+ *  @param[out]     out         Output block.
+ *  @param[out]     end         Unused.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block processed without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation.
+ */
+Std_ReturnType FixedPoint_Stream_ScalarOp(void* context, const FixedPoint_Block16_t* in,
+                                          FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    const FixedPoint_StreamScalarOp_t* stage = (const FixedPoint_StreamScalarOp_t*)context;
+
+    (void)end;
+
+    if ((stage != NULL) && (in != NULL) && (out != NULL))
+    {
+        ret = FixedPoint_Op16_Strided(stage->op, in->data, 1, &stage->operand, 0, out->data, 1, in->len);
+        out->len = in->len;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Transform stage: FIR filter, state carried across blocks in the filter delay line.
+ *
+ *  @param[in,out]  context     FixedPoint_Fir16_t initialised with FixedPoint_Fir16_Init().
+ *  @param[in]      in          Input block.
+ *  @param[out]     out         Output block.
+ *  @param[out]     end         Unused.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Block filtered without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation.
+ */
+Std_ReturnType FixedPoint_Stream_Fir(void* context, const FixedPoint_Block16_t* in,
+                                     FixedPoint_Block16_t* out, boolean* end)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    (void)end;
+
+    if ((in != NULL) && (out != NULL))
+    {
+        ret = FixedPoint_Fir16((FixedPoint_Fir16_t*)context, in->data, out->data, in->len);
+        out->len = in->len;
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
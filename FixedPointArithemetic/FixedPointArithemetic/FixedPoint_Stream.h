@@ -0,0 +1,141 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Stream.h
+
+@brief      Interface for block-based streaming pipelines over 16-bit fixed-point data.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Added file source and sink stages.
+01.02.00  2026-10-18  AGT   Documented that the file stages do not overlap I/O and computation.
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_STREAM_H
+#define FIXED_POINT_STREAM_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include <stdio.h>
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Block of samples passed between pipeline stages. */
+typedef struct
+{
+    t_Fixed16* data;        /**< Sample buffer */
+    uint32     len;         /**< Number of valid samples */
+    uint32     capacity;    /**< Capacity of the sample buffer (block length of the pipeline) */
+} FixedPoint_Block16_t;
+
+/** @brief   Stage function.
+ *
+ * Called once per block with the stage state in context. The source (first stage) gets in == NULL
+ * and fills out, the sink (last stage) gets out == NULL and consumes in, all stages in between
+ * transform in into out. A stage sets *end to 1 when the stream is finished after this block.
+ */
+typedef Std_ReturnType (*FixedPoint_StageFn_t)(void* context, const FixedPoint_Block16_t* in,
+                                                FixedPoint_Block16_t* out, boolean* end);
+
+/** @brief   Pipeline stage: function and its state. */
+typedef struct
+{
+    FixedPoint_StageFn_t process;   /**< Stage function */
+    void*                context;   /**< Stage state, resumed on every call */
+} FixedPoint_StreamStage_t;
+
+/** @brief   Pipeline of stages with two application provided block buffers (ping-pong). */
+typedef struct
+{
+    FixedPoint_StreamStage_t stages[FIXEDPOINT_STREAM_MAX_STAGES];  /**< Source, transforms, sink */
+    uint32                   stageCount;                            /**< Number of stages */
+    t_Fixed16*               buffer[2];                             /**< Block buffers */
+    uint32                   blockLen;                              /**< Capacity of each block buffer */
+    boolean                  finished;                              /**< A stage reported the end of the stream */
+} FixedPoint_Stream_t;
+
+/** @brief   State of FixedPoint_Stream_ArraySource(). */
+typedef struct
+{
+    const t_Fixed16* data;  /**< Samples to stream */
+    uint32           len;   /**< Number of samples */
+    uint32           pos;   /**< Read position */
+} FixedPoint_StreamArraySource_t;
+
+/** @brief   State of FixedPoint_Stream_ArraySink(). */
+typedef struct
+{
+    t_Fixed16* data;        /**< Destination buffer */
+    uint32     capacity;    /**< Capacity of the destination buffer */
+    uint32     pos;         /**< Write position */
+} FixedPoint_StreamArraySink_t;
+
+/** @brief   State of FixedPoint_Stream_FileSource() and FixedPoint_Stream_FileSink().
+ *
+ * The file holds raw t_Fixed16 samples in native byte order and must be opened in binary mode
+ * by the application. The stages read and write synchronously, one block per call, and do not
+ * overlap the I/O with the processing of the other stages.
+ */
+typedef struct
+{
+    FILE*  file;    /**< Open binary file */
+    uint32 samples; /**< Number of samples transferred so far */
+} FixedPoint_StreamFile_t;
+
+/** @brief   State of FixedPoint_Stream_ScalarOp(): out[i] = in[i] (op) operand. */
+typedef struct
+{
+    FixedPoint_Operation_t op;      /**< Operation */
+    t_Fixed16              operand; /**< Constant second operand in configured 16-bit Q-format */
+} FixedPoint_StreamScalarOp_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Stream_Init(FixedPoint_Stream_t* stream, t_Fixed16* bufferA, t_Fixed16* bufferB,
+                                             uint32 blockLen);
+extern Std_ReturnType FixedPoint_Stream_AddStage(FixedPoint_Stream_t* stream, FixedPoint_StageFn_t process, void* context);
+extern Std_ReturnType FixedPoint_Stream_Step(FixedPoint_Stream_t* stream, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_Run(FixedPoint_Stream_t* stream);
+
+/* Stage functions */
+extern Std_ReturnType FixedPoint_Stream_ArraySource(void* context, const FixedPoint_Block16_t* in,
+                                                    FixedPoint_Block16_t* out, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_ArraySink(void* context, const FixedPoint_Block16_t* in,
+                                                  FixedPoint_Block16_t* out, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_FileSource(void* context, const FixedPoint_Block16_t* in,
+                                                   FixedPoint_Block16_t* out, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_FileSink(void* context, const FixedPoint_Block16_t* in,
+                                                 FixedPoint_Block16_t* out, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_ScalarOp(void* context, const FixedPoint_Block16_t* in,
+                                                 FixedPoint_Block16_t* out, boolean* end);
+extern Std_ReturnType FixedPoint_Stream_Fir(void* context, const FixedPoint_Block16_t* in,
+                                            FixedPoint_Block16_t* out, boolean* end);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_STREAM_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
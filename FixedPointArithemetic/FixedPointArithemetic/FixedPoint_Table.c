@@ -0,0 +1,358 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Table.c
+
+@brief      Precomputed 8-bit result tables in a shareable read-only image.
+ *
+ * Detailed Description:
+ * - All 65536 operand pairs of the 8-bit format fit into one table per operation. The table image
+ *   holds the Mult8 and Div8 results and a status bitmap per operation (bit set = E_NOT_OK), so a
+ *   lookup returns exactly the result and status of the batch kernels.
+ * - FixedPoint_Table_Build() writes the image for the configured SHIFT_16/SHIFT_8 once (table
+ *   building tool, see the --build-tables option of the test application). The image is a plain
+ *   byte block without pointers and can be stored in a file.
+ * - FixedPoint_Table_Attach() uses an image in place: only the header is checked, nothing is
+ *   copied or computed, so attaching is independent of the table size. The intended use is a file
+ *   mapped read-only by every process (MapViewOfFile, mmap with PROT_READ), which lets all
+ *   processes share the same physical pages. The tables start page aligned, so the mapping may be
+ *   backed by large pages where the platform supports it.
+ * - The image is checked against the layout version and the Q-format configuration. A table built
+ *   for a different SHIFT_8 is rejected. FixedPoint_Table_Verify() additionally checks the
+ *   checksum of the tables, e.g. once after deployment.
+ * - Without an attached image the lookup functions forward to the computing batch kernels.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Added attach state query.
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Table.h"
+#include "FixedPoint_cfg.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Byte offset of the multiplication result table. */
+#define FIXEDPOINT_TABLE_MULT8_OFFSET       (FIXEDPOINT_TABLE_DATA_OFFSET)
+
+/** @brief Byte offset of the division result table. */
+#define FIXEDPOINT_TABLE_DIV8_OFFSET        (FIXEDPOINT_TABLE_MULT8_OFFSET + FIXEDPOINT_TABLE_ENTRIES)
+
+/** @brief Byte offset of the multiplication status bitmap. */
+#define FIXEDPOINT_TABLE_MULT8_ST_OFFSET    (FIXEDPOINT_TABLE_DIV8_OFFSET + FIXEDPOINT_TABLE_ENTRIES)
+
+/** @brief Byte offset of the division status bitmap. */
+#define FIXEDPOINT_TABLE_DIV8_ST_OFFSET     (FIXEDPOINT_TABLE_MULT8_ST_OFFSET + (FIXEDPOINT_TABLE_ENTRIES / 8UL))
+
+/** @brief Table index of an operand pair. */
+#define FIXEDPOINT_TABLE_INDEX(a, b)        ((((uint32)(uint8)(a)) << 8) | (uint32)(uint8)(b))
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Attached table image (read only, shared by all threads), NULL if none. */
+static const uint8* FixedPoint_TableImage = NULL;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static boolean FixedPoint_Table_IsValidHeader(const void* image, uint32 size);
+static uint32 FixedPoint_Table_Checksum(const uint8* image);
+static Std_ReturnType FixedPoint_Table_Lookup(uint32 tableOffset, uint32 statusOffset,
+                                              const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Check the header of an image against the layout and the configuration.
+ *
+ *  @param[in]  image   Table image.
+ *  @param[in]  size    Size of the image in bytes.
+ *
+ *  @return     boolean
+ *  @retval     1U      Header valid for this build.
+ *  @retval     0U      Null pointer, size, layout version or Q-format mismatch.
+ */
+static boolean FixedPoint_Table_IsValidHeader(const void* image, uint32 size)
+{
+    const FixedPoint_TableHeader_t* header = (const FixedPoint_TableHeader_t*)image;
+
+    return (boolean)((header != NULL) && (size == FIXEDPOINT_TABLE_IMAGE_SIZE) &&
+                     (header->magic == FIXEDPOINT_TABLE_MAGIC) && (header->version == FIXEDPOINT_TABLE_VERSION) &&
+                     (header->shift16 == (uint32)SHIFT_16) && (header->shift8 == (uint32)SHIFT_8) &&
+                     (header->size == FIXEDPOINT_TABLE_IMAGE_SIZE));
+}
+
+/*********************************************************************************************************************/
+/*! @brief     FNV-1a checksum of the table area of an image.
+ *
+ *  @param[in]  image   Table image of FIXEDPOINT_TABLE_IMAGE_SIZE bytes.
+ *
+ *  @return     uint32
+ *  @retval     Checksum of all bytes after the header page.
+ */
+static uint32 FixedPoint_Table_Checksum(const uint8* image)
+{
+    uint32 hash = 2166136261UL;
+    uint32 i;
+
+    for (i = FIXEDPOINT_TABLE_DATA_OFFSET; i < FIXEDPOINT_TABLE_IMAGE_SIZE; i++)
+    {
+        hash = ((hash ^ (uint32)image[i]) * 16777619UL) & 0xFFFFFFFFUL;
+    }
+
+    return hash;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise lookup in a result table of the attached image.
+ *
+ *  @param[in]  tableOffset     Byte offset of the result table.
+ *  @param[in]  statusOffset    Byte offset of the status bitmap.
+ *  @param[in]  a               First operand array in configured 8-bit Q-format.
+ *  @param[in]  b               Second operand array in configured 8-bit Q-format.
+ *  @param[out] r               Result array in configured 8-bit Q-format.
+ *  @param[in]  len             Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        No element has the status bit set.
+ *  @retval     E_NOT_OK    At least one element saturated (or division by zero).
+ */
+static Std_ReturnType FixedPoint_Table_Lookup(uint32 tableOffset, uint32 statusOffset,
+                                              const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    const uint8* const table = &FixedPoint_TableImage[tableOffset];
+    const uint8* const status = &FixedPoint_TableImage[statusOffset];
+    uint32 failed = 0U;
+    uint32 i;
+
+    for (i = 0U; i < len; i++)
+    {
+        const uint32 index = FIXEDPOINT_TABLE_INDEX(a[i], b[i]);
+
+        r[i] = (t_Fixed8)table[index];
+        failed |= (uint32)status[index >> 3] >> (index & 7U);
+    }
+
+    return ((failed & 1U) == 0U) ? E_OK : E_NOT_OK;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Build the table image for the configured Q-format (table building tool).
+ *
+ *  @param[out] image   Buffer of FIXEDPOINT_TABLE_IMAGE_SIZE bytes, aligned to at least 4 bytes.
+ *  @param[in]  size    Size of the buffer in bytes.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Image built.
+ *  @retval     E_NOT_OK    Null pointer or buffer too small.
+ */
+Std_ReturnType FixedPoint_Table_Build(void* image, uint32 size)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    uint8* const bytes = (uint8*)image;
+    FixedPoint_TableHeader_t* header = (FixedPoint_TableHeader_t*)image;
+
+    if ((image != NULL) && (size >= FIXEDPOINT_TABLE_IMAGE_SIZE))
+    {
+        uint32 i;
+
+        for (i = 0U; i < FIXEDPOINT_TABLE_IMAGE_SIZE; i++)
+        {
+            bytes[i] = 0U;
+        }
+
+        for (i = 0U; i < FIXEDPOINT_TABLE_ENTRIES; i++)
+        {
+            const t_Fixed8 a = (t_Fixed8)(sint32)(sint8)(uint8)(i >> 8);
+            const t_Fixed8 b = (t_Fixed8)(sint32)(sint8)(uint8)(i & 0xFFU);
+            t_Fixed8 r = 0;
+
+            if (FixedPoint_Mult8_Array(&a, &b, &r, 1U) != E_OK)
+            {
+                bytes[FIXEDPOINT_TABLE_MULT8_ST_OFFSET + (i >> 3)] |= (uint8)(1U << (i & 7U));
+            }
+            bytes[FIXEDPOINT_TABLE_MULT8_OFFSET + i] = (uint8)r;
+
+            if (FixedPoint_Div8_Array(&a, &b, &r, 1U) != E_OK)
+            {
+                bytes[FIXEDPOINT_TABLE_DIV8_ST_OFFSET + (i >> 3)] |= (uint8)(1U << (i & 7U));
+            }
+            bytes[FIXEDPOINT_TABLE_DIV8_OFFSET + i] = (uint8)r;
+        }
+
+        header->magic = FIXEDPOINT_TABLE_MAGIC;
+        header->version = FIXEDPOINT_TABLE_VERSION;
+        header->shift16 = (uint32)SHIFT_16;
+        header->shift8 = (uint32)SHIFT_8;
+        header->size = FIXEDPOINT_TABLE_IMAGE_SIZE;
+        header->checksum = FixedPoint_Table_Checksum(bytes);
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check header and checksum of a table image.
+ *
+ *  Reads the complete image, intended for a one-time check after deployment rather than for
+ *  every process start.
+ *
+ *  @param[in]  image   Table image.
+ *  @param[in]  size    Size of the image in bytes.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Image valid for this build and not corrupted.
+ *  @retval     E_NOT_OK    Null pointer, header mismatch or checksum error.
+ */
+Std_ReturnType FixedPoint_Table_Verify(const void* image, uint32 size)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((FixedPoint_Table_IsValidHeader(image, size) != 0U) &&
+        (((const FixedPoint_TableHeader_t*)image)->checksum == FixedPoint_Table_Checksum((const uint8*)image)))
+    {
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Use a table image in place for all following lookups.
+ *
+ *  Only the header is checked. The image must stay mapped and unchanged until
+ *  FixedPoint_Table_Detach() is called. Attach once at startup before lookups run in other threads.
+ *
+ *  @param[in]  image   Table image, e.g. a read-only file mapping.
+ *  @param[in]  size    Size of the image in bytes.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Image attached.
+ *  @retval     E_NOT_OK    Null pointer or header mismatch (previous state unchanged).
+ */
+Std_ReturnType FixedPoint_Table_Attach(const void* image, uint32 size)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (FixedPoint_Table_IsValidHeader(image, size) != 0U)
+    {
+        FixedPoint_TableImage = (const uint8*)image;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Stop using the attached table image. Lookups are computed again afterwards.
+ */
+void FixedPoint_Table_Detach(void)
+{
+    FixedPoint_TableImage = NULL;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Check whether a table image is attached.
+ *
+ *  @return     boolean
+ *  @retval     1U      Lookups use the attached image.
+ *  @retval     0U      Lookups are computed.
+ */
+boolean FixedPoint_Table_IsAttached(void)
+{
+    return (boolean)(FixedPoint_TableImage != NULL);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit multiplication over arrays from the attached table.
+ *
+ *  Same results and status as FixedPoint_Mult8_Array(), which is used if no image is attached.
+ *
+ *  @param[in]  a       First operand array in configured 8-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Table_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((FixedPoint_TableImage != NULL) && (a != NULL) && (b != NULL) && (r != NULL))
+    {
+        ret = FixedPoint_Table_Lookup(FIXEDPOINT_TABLE_MULT8_OFFSET, FIXEDPOINT_TABLE_MULT8_ST_OFFSET, a, b, r, len);
+    }
+    else
+    {
+        ret = FixedPoint_Mult8_Array(a, b, r, len);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit division over arrays from the attached table.
+ *
+ *  Same results and status as FixedPoint_Div8_Array(), which is used if no image is attached.
+ *
+ *  @param[in]  a       Dividend array in configured 8-bit Q-format.
+ *  @param[in]  b       Divisor array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Table_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((FixedPoint_TableImage != NULL) && (a != NULL) && (b != NULL) && (r != NULL))
+    {
+        ret = FixedPoint_Table_Lookup(FIXEDPOINT_TABLE_DIV8_OFFSET, FIXEDPOINT_TABLE_DIV8_ST_OFFSET, a, b, r, len);
+    }
+    else
+    {
+        ret = FixedPoint_Div8_Array(a, b, r, len);
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
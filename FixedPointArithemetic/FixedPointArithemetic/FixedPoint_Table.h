@@ -0,0 +1,89 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Table.h
+
+@brief      Interface for precomputed 8-bit result tables in a shareable read-only image.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+01.01.00  2026-10-18  AGT   Attach state query added
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_TABLE_H
+#define FIXED_POINT_TABLE_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Identification of a table image ("FXTB"). */
+#define FIXEDPOINT_TABLE_MAGIC          (0x46585442UL)
+
+/** @brief Layout version of the table image. */
+#define FIXEDPOINT_TABLE_VERSION        (1UL)
+
+/** @brief Number of entries of one 8-bit result table (all operand pairs). */
+#define FIXEDPOINT_TABLE_ENTRIES        (65536UL)
+
+/** @brief Byte offset of the first table. The header occupies the first page, the tables start page aligned. */
+#define FIXEDPOINT_TABLE_DATA_OFFSET    (4096UL)
+
+/** @brief Size of a complete table image in bytes: two result tables and two status bitmaps. */
+#define FIXEDPOINT_TABLE_IMAGE_SIZE     (FIXEDPOINT_TABLE_DATA_OFFSET + (2UL * FIXEDPOINT_TABLE_ENTRIES) + \
+                                         (2UL * (FIXEDPOINT_TABLE_ENTRIES / 8UL)))
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Header at the start of a table image. */
+typedef struct
+{
+    uint32 magic;       /**< FIXEDPOINT_TABLE_MAGIC */
+    uint32 version;     /**< FIXEDPOINT_TABLE_VERSION */
+    uint32 shift16;     /**< SHIFT_16 of the building configuration */
+    uint32 shift8;      /**< SHIFT_8 of the building configuration */
+    uint32 size;        /**< Size of the image in bytes */
+    uint32 checksum;    /**< FNV-1a checksum of all bytes after the header page */
+} FixedPoint_TableHeader_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Table_Build(void* image, uint32 size);
+extern Std_ReturnType FixedPoint_Table_Verify(const void* image, uint32 size);
+extern Std_ReturnType FixedPoint_Table_Attach(const void* image, uint32 size);
+extern void FixedPoint_Table_Detach(void);
+extern boolean FixedPoint_Table_IsAttached(void);
+extern Std_ReturnType FixedPoint_Table_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+extern Std_ReturnType FixedPoint_Table_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_TABLE_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
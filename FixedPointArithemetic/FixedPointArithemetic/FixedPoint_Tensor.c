@@ -0,0 +1,558 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Tensor.c
+
+@brief      N-dimensional strided 16-bit fixed-point tensors with NumPy-style broadcasting.
+ *
+ * Detailed Description:
+ * - A tensor is a non-owning view (data pointer, shape, element strides, Q-format).
+ * - Element-wise operations follow the NumPy broadcasting rules: shapes are aligned at the innermost
+ *   dimension, missing dimensions and dimensions of extent 1 are repeated (stride 0).
+ * - Before execution, dimensions of extent 1 are dropped and neighbouring dimensions that are
+ *   contiguous for all three operands are merged. The remaining innermost dimension is processed
+ *   with one call to FixedPoint_Op16_Strided(), which forwards contiguous runs to the batch kernels.
+ * - The remaining outer dimensions form a flat index range [0, outerCount). Callers that want to
+ *   parallelize can split this range over their own worker threads with FixedPoint_Tensor16_OpPartial().
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Tensor.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Execution plan of an element-wise operation after broadcasting and dimension collapsing.
+ *
+ * Dimension rank-1 is the inner dimension processed by one strided kernel call, all other
+ * dimensions are iterated as outer dimensions.
+ */
+typedef struct
+{
+    uint32 rank;                                /**< Number of dimensions after collapsing (>= 1) */
+    uint32 shape[FIXEDPOINT_TENSOR_MAX_RANK];   /**< Extent of each collapsed dimension */
+    sint32 strideA[FIXEDPOINT_TENSOR_MAX_RANK]; /**< Element strides of operand a (0 = broadcast) */
+    sint32 strideB[FIXEDPOINT_TENSOR_MAX_RANK]; /**< Element strides of operand b (0 = broadcast) */
+    sint32 strideR[FIXEDPOINT_TENSOR_MAX_RANK]; /**< Element strides of the result */
+    uint32 outerCount;                          /**< Product of the outer dimension extents */
+} FixedPoint_TensorPlan_t;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static Std_ReturnType FixedPoint_Tensor16_CheckView(const FixedPoint_Tensor16_t* tensor);
+static Std_ReturnType FixedPoint_Tensor16_BroadcastStride(const FixedPoint_Tensor16_t* tensor, uint32 outRank, uint32 dim,
+                                                          uint32* extent, sint32* stride);
+static Std_ReturnType FixedPoint_Tensor16_Plan(const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                               const FixedPoint_Tensor16_t* out, FixedPoint_TensorPlan_t* plan);
+static Std_ReturnType FixedPoint_Tensor16_Execute(FixedPoint_Operation_t op, const FixedPoint_TensorPlan_t* plan,
+                                                  const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                                  FixedPoint_Tensor16_t* out, uint32 outerFirst, uint32 outerCount);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Validate that a tensor view is usable as operand of an element-wise operation.
+ *
+ *  @param[in]  tensor  Tensor view to check.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Valid view in the configured 16-bit Q-format.
+ *  @retval     E_NOT_OK    Null pointer, invalid rank or Q-format other than SHIFT_16.
+ */
+static Std_ReturnType FixedPoint_Tensor16_CheckView(const FixedPoint_Tensor16_t* tensor)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((tensor != NULL) && (tensor->data != NULL) &&
+        (tensor->rank >= 1U) && (tensor->rank <= FIXEDPOINT_TENSOR_MAX_RANK) &&
+        (tensor->fracBits == SHIFT_16))
+    {
+        /* The kernels operate in the configured Q-format only, no implicit rescaling is done */
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Get extent and stride of an operand dimension aligned to the output rank.
+ *
+ *  Dimensions are aligned at the innermost dimension. A dimension that does not exist in the
+ *  operand is reported with extent 1 and stride 0.
+ *
+ *  @param[in]  tensor  Operand tensor.
+ *  @param[in]  outRank Rank of the output tensor.
+ *  @param[in]  dim     Output dimension index.
+ *  @param[out] extent  Extent of the operand in this dimension.
+ *  @param[out] stride  Stride of the operand in this dimension.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Dimension resolved.
+ *  @retval     E_NOT_OK    Operand has a higher rank than the output.
+ */
+static Std_ReturnType FixedPoint_Tensor16_BroadcastStride(const FixedPoint_Tensor16_t* tensor, uint32 outRank, uint32 dim,
+                                                          uint32* extent, sint32* stride)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (tensor->rank <= outRank)
+    {
+        const uint32 offset = outRank - tensor->rank;
+
+        if (dim < offset)
+        {
+            /* Leading dimension missing in the operand */
+            *extent = 1U;
+            *stride = 0;
+        }
+        else
+        {
+            *extent = tensor->shape[dim - offset];
+            *stride = tensor->strides[dim - offset];
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Build the execution plan of an element-wise operation.
+ *
+ *  Resolves the broadcast strides of both operands against the output shape, drops dimensions
+ *  of extent 1 and merges neighbouring dimensions that are contiguous for all operands, so that
+ *  the inner loop runs as long as possible.
+ *
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[in]  out     Result tensor, its shape must equal the broadcast shape of a and b.
+ *  @param[out] plan    Execution plan.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Plan created.
+ *  @retval     E_NOT_OK    Invalid view or shapes not broadcast compatible.
+ */
+static Std_ReturnType FixedPoint_Tensor16_Plan(const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                               const FixedPoint_Tensor16_t* out, FixedPoint_TensorPlan_t* plan)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((FixedPoint_Tensor16_CheckView(a) == E_OK) &&
+        (FixedPoint_Tensor16_CheckView(b) == E_OK) &&
+        (FixedPoint_Tensor16_CheckView(out) == E_OK) &&
+        (plan != NULL))
+    {
+        uint32 d;
+        uint32 n = 0U;
+        boolean empty = 0U;
+
+        ret = E_OK;
+
+        /* Broadcast: collect non-trivial dimensions */
+        for (d = 0U; (d < out->rank) && (ret == E_OK); d++)
+        {
+            const uint32 extent = out->shape[d];
+            uint32 extentA = 0U;
+            uint32 extentB = 0U;
+            sint32 strideA = 0;
+            sint32 strideB = 0;
+
+            if ((FixedPoint_Tensor16_BroadcastStride(a, out->rank, d, &extentA, &strideA) != E_OK) ||
+                (FixedPoint_Tensor16_BroadcastStride(b, out->rank, d, &extentB, &strideB) != E_OK))
+            {
+                ret = E_NOT_OK;
+            }
+            else if (extent != ((extentA == 1U) ? extentB : extentA))
+            {
+                /* Output shape must equal the broadcast shape */
+                ret = E_NOT_OK;
+            }
+            else if (((extentA != extent) && (extentA != 1U)) || ((extentB != extent) && (extentB != 1U)))
+            {
+                /* Operand extent is neither equal nor 1: not broadcast compatible */
+                ret = E_NOT_OK;
+            }
+            else if (extent == 0U)
+            {
+                empty = 1U;
+            }
+            else if (extent > 1U)
+            {
+                plan->shape[n]   = extent;
+                plan->strideA[n] = (extentA == 1U) ? 0 : strideA;
+                plan->strideB[n] = (extentB == 1U) ? 0 : strideB;
+                plan->strideR[n] = out->strides[d];
+                n++;
+            }
+            else
+            {
+                /* Extent 1 does not contribute to the iteration */
+            }
+        }
+
+        if (ret == E_OK)
+        {
+            if (n == 0U)
+            {
+                /* Every dimension has extent 1: single element */
+                plan->shape[0]   = 1U;
+                plan->strideA[0] = 1;
+                plan->strideB[0] = 1;
+                plan->strideR[0] = 1;
+                n = 1U;
+            }
+            else
+            {
+                /* Collapse: merge dimension d into its inner neighbour if all operands are contiguous across it */
+                uint32 w = n - 1U;
+
+                for (d = n - 1U; d > 0U; d--)
+                {
+                    const uint32 outer = d - 1U;
+                    const sint32 inner = (sint32)plan->shape[w];
+
+                    if ((plan->strideA[outer] == (plan->strideA[w] * inner)) &&
+                        (plan->strideB[outer] == (plan->strideB[w] * inner)) &&
+                        (plan->strideR[outer] == (plan->strideR[w] * inner)))
+                    {
+                        plan->shape[w] *= plan->shape[outer];
+                    }
+                    else
+                    {
+                        w--;
+                        plan->shape[w]   = plan->shape[outer];
+                        plan->strideA[w] = plan->strideA[outer];
+                        plan->strideB[w] = plan->strideB[outer];
+                        plan->strideR[w] = plan->strideR[outer];
+                    }
+                }
+
+                /* Move the collapsed dimensions [w, n) to the front */
+                for (d = 0U; d < (n - w); d++)
+                {
+                    plan->shape[d]   = plan->shape[w + d];
+                    plan->strideA[d] = plan->strideA[w + d];
+                    plan->strideB[d] = plan->strideB[w + d];
+                    plan->strideR[d] = plan->strideR[w + d];
+                }
+
+                n = n - w;
+            }
+
+            plan->rank = n;
+            plan->outerCount = 1U;
+
+            for (d = 0U; d < (n - 1U); d++)
+            {
+                plan->outerCount *= plan->shape[d];
+            }
+
+            if (empty != 0U)
+            {
+                /* Zero-sized output: nothing to iterate */
+                plan->outerCount = 0U;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Execute a range of outer iterations of a plan.
+ *
+ *  The flat outer index is decomposed once into per-dimension indices, afterwards the offsets
+ *  are advanced like an odometer, so no division is done per inner run.
+ *
+ *  @param[in]  op          Operation to perform.
+ *  @param[in]  plan        Execution plan.
+ *  @param[in]  a           First operand.
+ *  @param[in]  b           Second operand.
+ *  @param[out] out         Result tensor.
+ *  @param[in]  outerFirst  First flat outer index to process.
+ *  @param[in]  outerCount  Number of outer iterations to process.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid range, invalid operation, division by zero or saturation.
+ */
+static Std_ReturnType FixedPoint_Tensor16_Execute(FixedPoint_Operation_t op, const FixedPoint_TensorPlan_t* plan,
+                                                  const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                                  FixedPoint_Tensor16_t* out, uint32 outerFirst, uint32 outerCount)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((outerFirst <= plan->outerCount) && (outerCount <= (plan->outerCount - outerFirst)))
+    {
+        const uint32 inner = plan->rank - 1U;
+        uint32 idx[FIXEDPOINT_TENSOR_MAX_RANK];
+        sint32 offA = 0;
+        sint32 offB = 0;
+        sint32 offR = 0;
+        uint32 rem = outerFirst;
+        uint32 k;
+        uint32 d;
+
+        ret = E_OK;
+
+        /* Decompose the first flat outer index */
+        for (d = inner; d > 0U; d--)
+        {
+            idx[d - 1U] = rem % plan->shape[d - 1U];
+            rem /= plan->shape[d - 1U];
+            offA += (sint32)idx[d - 1U] * plan->strideA[d - 1U];
+            offB += (sint32)idx[d - 1U] * plan->strideB[d - 1U];
+            offR += (sint32)idx[d - 1U] * plan->strideR[d - 1U];
+        }
+
+        for (k = 0U; k < outerCount; k++)
+        {
+            ret |= FixedPoint_Op16_Strided(op,
+                                           &a->data[offA], plan->strideA[inner],
+                                           &b->data[offB], plan->strideB[inner],
+                                           &out->data[offR], plan->strideR[inner],
+                                           plan->shape[inner]);
+
+            /* Advance the outer index (odometer) */
+            for (d = inner; d > 0U; d--)
+            {
+                idx[d - 1U]++;
+                offA += plan->strideA[d - 1U];
+                offB += plan->strideB[d - 1U];
+                offR += plan->strideR[d - 1U];
+
+                if (idx[d - 1U] < plan->shape[d - 1U])
+                {
+                    break;
+                }
+
+                /* Wrap this dimension and carry into the next outer one */
+                offA -= (sint32)plan->shape[d - 1U] * plan->strideA[d - 1U];
+                offB -= (sint32)plan->shape[d - 1U] * plan->strideB[d - 1U];
+                offR -= (sint32)plan->shape[d - 1U] * plan->strideR[d - 1U];
+                idx[d - 1U] = 0U;
+            }
+        }
+    }
+
+    return ret;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Initialise a tensor view on contiguous row-major data.
+ *
+ *  Strides are set for row-major (last dimension fastest) layout and the Q-format is set to the
+ *  configured 16-bit format (SHIFT_16).
+ *
+ *  @param[out] tensor  Tensor view to initialise.
+ *  @param[in]  data    Pointer to the first element.
+ *  @param[in]  rank    Number of dimensions (1..FIXEDPOINT_TENSOR_MAX_RANK).
+ *  @param[in]  shape   Extent of each dimension, outermost first.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Tensor initialised.
+ *  @retval     E_NOT_OK    Null pointer or invalid rank.
+ */
+Std_ReturnType FixedPoint_Tensor16_Init(FixedPoint_Tensor16_t* tensor, t_Fixed16* data, uint32 rank, const uint32* shape)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((tensor != NULL) && (data != NULL) && (shape != NULL) &&
+        (rank >= 1U) && (rank <= FIXEDPOINT_TENSOR_MAX_RANK))
+    {
+        sint32 stride = 1;
+        uint32 d;
+
+        for (d = rank; d > 0U; d--)
+        {
+            tensor->shape[d - 1U] = shape[d - 1U];
+            tensor->strides[d - 1U] = stride;
+            stride *= (sint32)shape[d - 1U];
+        }
+
+        tensor->data = data;
+        tensor->rank = rank;
+        tensor->fracBits = SHIFT_16;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Create a view with a different shape on the data of a contiguous tensor.
+ *
+ *  The source tensor must be contiguous in row-major order and the new shape must have the same
+ *  number of elements. No data is copied.
+ *
+ *  @param[in]  tensor  Source tensor.
+ *  @param[in]  rank    Number of dimensions of the view.
+ *  @param[in]  shape   Extent of each dimension of the view, outermost first.
+ *  @param[out] view    Reshaped view.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        View created.
+ *  @retval     E_NOT_OK    Null pointer, invalid rank, source not contiguous or element count mismatch.
+ */
+Std_ReturnType FixedPoint_Tensor16_Reshape(const FixedPoint_Tensor16_t* tensor, uint32 rank, const uint32* shape,
+                                           FixedPoint_Tensor16_t* view)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((FixedPoint_Tensor16_CheckView(tensor) == E_OK) && (shape != NULL) && (view != NULL))
+    {
+        uint32 srcCount = 1U;
+        uint32 dstCount = 1U;
+        sint32 expected = 1;
+        boolean contiguous = 1U;
+        uint32 d;
+
+        for (d = tensor->rank; d > 0U; d--)
+        {
+            if ((tensor->shape[d - 1U] > 1U) && (tensor->strides[d - 1U] != expected))
+            {
+                contiguous = 0U;
+            }
+            expected *= (sint32)tensor->shape[d - 1U];
+            srcCount *= tensor->shape[d - 1U];
+        }
+
+        for (d = 0U; (d < rank) && (d < FIXEDPOINT_TENSOR_MAX_RANK); d++)
+        {
+            dstCount *= shape[d];
+        }
+
+        if ((contiguous != 0U) && (srcCount == dstCount))
+        {
+            ret = FixedPoint_Tensor16_Init(view, tensor->data, rank, shape);
+        }
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise operation on tensors with broadcasting: out = a (op) b.
+ *
+ *  The shape of out must equal the broadcast shape of a and b. All tensors must be in the
+ *  configured 16-bit Q-format. The result may alias an operand only if both use the same layout.
+ *  Saturation and division by zero follow the batch kernels; all elements are always written.
+ *
+ *  @param[in]  op      Operation to perform.
+ *  @param[in]  a       First operand.
+ *  @param[in]  b       Second operand.
+ *  @param[out] out     Result tensor.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid tensor, incompatible shapes, division by zero or saturation.
+ */
+Std_ReturnType FixedPoint_Tensor16_Op(FixedPoint_Operation_t op, const FixedPoint_Tensor16_t* a,
+                                      const FixedPoint_Tensor16_t* b, FixedPoint_Tensor16_t* out)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_TensorPlan_t plan;
+
+    if (FixedPoint_Tensor16_Plan(a, b, out, &plan) == E_OK)
+    {
+        ret = FixedPoint_Tensor16_Execute(op, &plan, a, b, out, 0U, plan.outerCount);
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Get the number of outer iterations of an element-wise tensor operation.
+ *
+ *  The outer iterations are independent of each other and can be distributed over worker threads
+ *  by calling FixedPoint_Tensor16_OpPartial() with disjoint ranges.
+ *
+ *  @param[in]  a           First operand.
+ *  @param[in]  b           Second operand.
+ *  @param[in]  out         Result tensor.
+ *  @param[out] outerCount  Number of outer iterations after dimension collapsing.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Count determined.
+ *  @retval     E_NOT_OK    Null pointer, invalid tensor or incompatible shapes.
+ */
+Std_ReturnType FixedPoint_Tensor16_GetOuterCount(const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                                 const FixedPoint_Tensor16_t* out, uint32* outerCount)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_TensorPlan_t plan;
+
+    if ((outerCount != NULL) && (FixedPoint_Tensor16_Plan(a, b, out, &plan) == E_OK))
+    {
+        *outerCount = plan.outerCount;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Element-wise tensor operation restricted to a range of outer iterations.
+ *
+ *  Same as FixedPoint_Tensor16_Op() but only the outer iterations [outerFirst, outerFirst + outerCount)
+ *  are processed. Disjoint ranges write disjoint output elements and may run concurrently.
+ *
+ *  @param[in]  op          Operation to perform.
+ *  @param[in]  a           First operand.
+ *  @param[in]  b           Second operand.
+ *  @param[out] out         Result tensor.
+ *  @param[in]  outerFirst  First outer iteration.
+ *  @param[in]  outerCount  Number of outer iterations.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements of the range calculated without saturation.
+ *  @retval     E_NOT_OK    Invalid tensor, incompatible shapes, invalid range, division by zero or saturation.
+ */
+Std_ReturnType FixedPoint_Tensor16_OpPartial(FixedPoint_Operation_t op, const FixedPoint_Tensor16_t* a,
+                                             const FixedPoint_Tensor16_t* b, FixedPoint_Tensor16_t* out,
+                                             uint32 outerFirst, uint32 outerCount)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_TensorPlan_t plan;
+
+    if (FixedPoint_Tensor16_Plan(a, b, out, &plan) == E_OK)
+    {
+        ret = FixedPoint_Tensor16_Execute(op, &plan, a, b, out, outerFirst, outerCount);
+    }
+
+    return ret;
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,75 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Tensor.h
+
+@brief      Interface for N-dimensional strided 16-bit fixed-point tensors with broadcasting.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_TENSOR_H
+#define FIXED_POINT_TENSOR_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Strided view on 16-bit fixed-point data.
+ *
+ * The tensor does not own its data. Shape and strides are stored outermost dimension first,
+ * strides are given in elements (not bytes) and may be 0 to repeat data along a dimension.
+ */
+typedef struct
+{
+    t_Fixed16* data;                                /**< Pointer to the element at index [0, 0, ...] */
+    uint32     rank;                                /**< Number of used dimensions (1..FIXEDPOINT_TENSOR_MAX_RANK) */
+    uint32     shape[FIXEDPOINT_TENSOR_MAX_RANK];   /**< Extent of each dimension */
+    sint32     strides[FIXEDPOINT_TENSOR_MAX_RANK]; /**< Element stride of each dimension */
+    uint32     fracBits;                            /**< Number of fractional bits of the stored Q-format */
+} FixedPoint_Tensor16_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Tensor16_Init(FixedPoint_Tensor16_t* tensor, t_Fixed16* data, uint32 rank, const uint32* shape);
+extern Std_ReturnType FixedPoint_Tensor16_Reshape(const FixedPoint_Tensor16_t* tensor, uint32 rank, const uint32* shape,
+                                                  FixedPoint_Tensor16_t* view);
+
+extern Std_ReturnType FixedPoint_Tensor16_Op(FixedPoint_Operation_t op, const FixedPoint_Tensor16_t* a,
+                                             const FixedPoint_Tensor16_t* b, FixedPoint_Tensor16_t* out);
+extern Std_ReturnType FixedPoint_Tensor16_GetOuterCount(const FixedPoint_Tensor16_t* a, const FixedPoint_Tensor16_t* b,
+                                                        const FixedPoint_Tensor16_t* out, uint32* outerCount);
+extern Std_ReturnType FixedPoint_Tensor16_OpPartial(FixedPoint_Operation_t op, const FixedPoint_Tensor16_t* a,
+                                                    const FixedPoint_Tensor16_t* b, FixedPoint_Tensor16_t* out,
+                                                    uint32 outerFirst, uint32 outerCount);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_TENSOR_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,293 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Trace.c
+
+@brief      Timeline tracing of kernels and pipeline stages (Chrome trace format).
+ *
+ * Detailed Description:
+ * - Batch kernels, stream stages and job execution are wrapped in FIXEDPOINT_TRACE_BEGIN() and
+ *   FIXEDPOINT_TRACE_END(). With FIXEDPOINT_TRACE_ENABLE set to 0U the macros expand to nothing and
+ *   this module is not compiled, so tracing costs nothing in production builds.
+ * - When enabled, an event stores the name pointer, the phase and a raw time stamp in a buffer of
+ *   the calling thread. The buffers are thread-local, so recording takes no lock and no atomic
+ *   operation: one clock read and three stores.
+ * - Every recorded begin event reserves a slot for its end event. A begin event is dropped when the
+ *   buffer has no room for it and the end events of all open sections; its end event is dropped
+ *   with it. End events of recorded sections are therefore never lost, and the recorded part keeps
+ *   matching begin and end events. Dropped events are counted.
+ * - FixedPoint_Trace_Flush() converts the events of the calling thread to the JSON array format of
+ *   the Chrome trace viewer (chrome://tracing, ui.perfetto.dev) and empties the buffer. It writes
+ *   only the buffer of the calling thread: every thread has to flush its own buffer into the same
+ *   file, framed by FixedPoint_Trace_WriteHeader() and FixedPoint_Trace_WriteFooter(), and the
+ *   events of a thread that ends without flushing are lost. Writing to the shared file must be
+ *   serialized by the caller. Flush outside of traced sections; a section open across a flush has
+ *   its begin and end event in different parts of the file.
+ * - Time stamps are converted to microseconds only when flushing.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+01.01.00  2026-10-18  AGT    Room reserved for the end events of open sections
+01.02.00  2026-10-18  AGT    Thread id taken with an atomic increment instead of the exclusive area
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Trace.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Recorded trace event. */
+typedef struct
+{
+    const char* name;       /**< Section name (string literal) */
+    uint64      timestamp;  /**< Raw clock ticks */
+    char        phase;      /**< 'B' begin, 'E' end */
+} FixedPoint_TraceEvent_t;
+
+/** @brief   Event buffer of one thread. */
+typedef struct
+{
+    FixedPoint_TraceEvent_t events[FIXEDPOINT_TRACE_BUFFER_SIZE];   /**< Recorded events */
+    uint32                  count;                                  /**< Number of recorded events */
+    uint32                  dropped;                                /**< Events dropped since the last flush */
+    uint32                  open;                                   /**< Recorded sections without end event */
+    uint32                  skipped;                                /**< Open sections with dropped begin event */
+    uint32                  tid;                                    /**< Trace thread id, 0 = not assigned yet */
+} FixedPoint_TraceBuffer_t;
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Event buffer of the calling thread. */
+static FIXEDPOINT_THREAD_LOCAL FixedPoint_TraceBuffer_t FixedPoint_TraceBuffer;
+
+/** @brief Time source, NULL until FixedPoint_Trace_Init() (no events are recorded before). */
+static FixedPoint_TraceClock_t FixedPoint_TraceClock = NULL;
+
+/** @brief Clock ticks per microsecond. */
+static double FixedPoint_TraceTicksPerUs = 1.0;
+
+/** @brief Last assigned trace thread id. */
+static volatile uint32 FixedPoint_TraceLastTid = 0U;
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Set the time source and start recording.
+ *
+ *  Call once before the traced threads start.
+ *
+ *  @param[in]  clock       Time source in ticks.
+ *  @param[in]  ticksPerUs  Clock ticks per microsecond (> 0).
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Tracing started.
+ *  @retval     E_NOT_OK    Null pointer or invalid tick rate.
+ */
+Std_ReturnType FixedPoint_Trace_Init(FixedPoint_TraceClock_t clock, double ticksPerUs)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((clock != NULL) && (ticksPerUs > 0.0))
+    {
+        FixedPoint_TraceTicksPerUs = ticksPerUs;
+        FixedPoint_TraceClock = clock;
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Record an event in the buffer of the calling thread (use the FIXEDPOINT_TRACE_ macros).
+ *
+ *  A begin event is only recorded if the slots of its own and all pending end events stay free.
+ *  Once a begin event is dropped, nested begin events find even less room and are dropped too, so
+ *  the dropped sections are always the innermost ones and an end event closes a dropped section
+ *  as long as any is open.
+ *
+ *  @param[in]  name    Section name, must stay valid until flushed (string literal).
+ *  @param[in]  phase   'B' for begin, 'E' for end.
+ */
+void FixedPoint_Trace_Event(const char* name, char phase)
+{
+    FixedPoint_TraceBuffer_t* const buffer = &FixedPoint_TraceBuffer;
+
+    if (FixedPoint_TraceClock != NULL)
+    {
+        boolean record;
+
+        if (phase == 'B')
+        {
+            /* Room for this event, its end event and the end events of all open sections */
+            record = ((FIXEDPOINT_TRACE_BUFFER_SIZE - buffer->count) >= (buffer->open + 2U)) ? 1U : 0U;
+
+            if (record != 0U)
+            {
+                buffer->open++;
+            }
+            else
+            {
+                buffer->skipped++;
+            }
+        }
+        else if (buffer->skipped > 0U)
+        {
+            /* End of a section whose begin event was dropped */
+            buffer->skipped--;
+            record = 0U;
+        }
+        else
+        {
+            /* The slot was reserved by the begin event; an unmatched end event needs a free one */
+            record = (buffer->count < FIXEDPOINT_TRACE_BUFFER_SIZE) ? 1U : 0U;
+
+            if (buffer->open > 0U)
+            {
+                buffer->open--;
+            }
+        }
+
+        if (record != 0U)
+        {
+            FixedPoint_TraceEvent_t* const event = &buffer->events[buffer->count];
+
+            event->timestamp = FixedPoint_TraceClock();
+            event->name = name;
+            event->phase = phase;
+            buffer->count++;
+        }
+        else
+        {
+            buffer->dropped++;
+        }
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Start a trace file (JSON array format).
+ *
+ *  @param[in]  file    Trace file opened for writing.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Header written.
+ *  @retval     E_NOT_OK    Null pointer or write error.
+ */
+Std_ReturnType FixedPoint_Trace_WriteHeader(FILE* file)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((file != NULL) && (fputs("[\n", file) >= 0))
+    {
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Write the events of the calling thread to a trace file and empty its buffer.
+ *
+ *  Buffers of other threads are not written. The reservations of sections still open stay in
+ *  place, so their end events are recorded after the flush.
+ *
+ *  @param[in]  file        Trace file started with FixedPoint_Trace_WriteHeader().
+ *  @param[out] dropped     Optional pointer to store the number of events dropped since the last flush.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Events written.
+ *  @retval     E_NOT_OK    Null pointer or write error.
+ */
+Std_ReturnType FixedPoint_Trace_Flush(FILE* file, uint32* dropped)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    FixedPoint_TraceBuffer_t* const buffer = &FixedPoint_TraceBuffer;
+
+    if (file != NULL)
+    {
+        uint32 i;
+
+        if (buffer->tid == 0U)
+        {
+            /* Threads flushing for the first time at the same moment get different ids */
+            buffer->tid = FIXEDPOINT_ATOMIC_FETCH_ADD(&FixedPoint_TraceLastTid, 1U) + 1U;
+        }
+
+        ret = E_OK;
+
+        for (i = 0U; i < buffer->count; i++)
+        {
+            const FixedPoint_TraceEvent_t* const event = &buffer->events[i];
+
+            if (fprintf(file, "{\"name\":\"%s\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":1,\"tid\":%lu},\n",
+                        event->name, event->phase, (double)event->timestamp / FixedPoint_TraceTicksPerUs,
+                        (unsigned long)buffer->tid) < 0)
+            {
+                ret = E_NOT_OK;
+            }
+        }
+
+        if (dropped != NULL)
+        {
+            *dropped = buffer->dropped;
+        }
+
+        buffer->count = 0U;
+        buffer->dropped = 0U;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Finish a trace file after all threads have flushed.
+ *
+ *  Closes the event array with a process name record, so that the file is also valid JSON.
+ *
+ *  @param[in]  file    Trace file.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Footer written.
+ *  @retval     E_NOT_OK    Null pointer or write error.
+ */
+Std_ReturnType FixedPoint_Trace_WriteFooter(FILE* file)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if ((file != NULL) &&
+        (fputs("{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"args\":{\"name\":\"FixedPoint\"}}\n]\n", file) >= 0))
+    {
+        ret = E_OK;
+    }
+
+    return ret;
+}
+#endif
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -0,0 +1,79 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Trace.h
+
+@brief      Interface for timeline tracing of kernels and pipeline stages (Chrome trace format).
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_TRACE_H
+#define FIXED_POINT_TRACE_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include <stdio.h>
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint_cfg.h" /**< Configuration header*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+/** @brief Record the begin of a traced section. name must be a string literal (only the pointer is stored). */
+#define FIXEDPOINT_TRACE_BEGIN(name)    FixedPoint_Trace_Event((name), 'B')
+
+/** @brief Record the end of the traced section opened with FIXEDPOINT_TRACE_BEGIN(name). */
+#define FIXEDPOINT_TRACE_END(name)      FixedPoint_Trace_Event((name), 'E')
+#else
+/** @brief Tracing disabled: no code is generated. */
+#define FIXEDPOINT_TRACE_BEGIN(name)    do { } while (0)
+
+/** @brief Tracing disabled: no code is generated. */
+#define FIXEDPOINT_TRACE_END(name)      do { } while (0)
+#endif
+
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Time source of the trace in ticks, provided by the platform (e.g. performance counter). */
+typedef uint64 (*FixedPoint_TraceClock_t)(void);
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Trace_Init(FixedPoint_TraceClock_t clock, double ticksPerUs);
+extern void FixedPoint_Trace_Event(const char* name, char phase);
+extern Std_ReturnType FixedPoint_Trace_WriteHeader(FILE* file);
+extern Std_ReturnType FixedPoint_Trace_Flush(FILE* file, uint32* dropped);
+extern Std_ReturnType FixedPoint_Trace_WriteFooter(FILE* file);
+#endif
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_TRACE_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
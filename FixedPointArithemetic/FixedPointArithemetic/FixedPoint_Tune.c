@@ -0,0 +1,338 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Tune.c
+
+@brief      Kernel autotuner and profile based implementation dispatch.
+ *
+ * Detailed Description:
+ * - Which implementation of a kernel is fastest depends on the host: the 8-bit table lookup wins
+ *   if the 64 KiB tables stay in the cache, the arithmetic wins otherwise. The best block length of
+ *   block-wise processing depends on the cache sizes in the same way.
+ * - FixedPoint_Tune_Run() is executed once per host (tuning tool, see the --tune option of the test
+ *   application). It times every candidate on the local machine with a clock of the platform and
+ *   stores the fastest choice in a FixedPoint_TuneProfile_t, which the application keeps in a file.
+ * - At init the application passes the stored profile to FixedPoint_Tune_Init(). The dispatch
+ *   functions then call the selected implementation through a function pointer, and
+ *   FixedPoint_Tune_GetBlockLen() provides the block length, e.g. for FixedPoint_Stream_Init().
+ * - Without a (valid) profile the arithmetic implementations and FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN
+ *   are used. A profile of another Q-format configuration is rejected.
+ * - All candidates return identical results and status, so the profile only affects the speed.
+
+@author     agent
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT    Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+#include <stddef.h>            /* for NULL */
+#include "FixedPoint_Tune.h"
+#include "FixedPoint_Table.h"
+#include "FixedPoint_cfg.h"
+
+/** @addtogroup g_FixedPoint
+@{ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Smallest block length candidate. Candidates grow by a factor of 4. */
+#define FIXEDPOINT_TUNE_MIN_BLOCK_LEN   (64U)
+
+/** @brief Number of taps of the FIR filter used to time the block lengths. */
+#define FIXEDPOINT_TUNE_FIR_TAPS        (8U)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Signature of the 8-bit batch kernels. */
+typedef Std_ReturnType (*FixedPoint_Kernel8_t)(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+
+/**********************************************************************************************************************
+LOCAL VARIABLES
+**********************************************************************************************************************/
+
+/** @brief Selected 8-bit multiplication (set at init, read only afterwards). */
+static FixedPoint_Kernel8_t FixedPoint_TuneMult8 = &FixedPoint_Mult8_Array;
+
+/** @brief Selected 8-bit division (set at init, read only afterwards). */
+static FixedPoint_Kernel8_t FixedPoint_TuneDiv8 = &FixedPoint_Div8_Array;
+
+/** @brief Selected block length (set at init, read only afterwards). */
+static uint32 FixedPoint_TuneBlockLen = FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN;
+
+/**********************************************************************************************************************
+LOCAL FUNCTION PROTOTYPES
+**********************************************************************************************************************/
+static double FixedPoint_Tune_Time8(FixedPoint_Kernel8_t kernel, t_Fixed8* work, uint32 len,
+                                    FixedPoint_TuneClock_t clock);
+static double FixedPoint_Tune_TimeBlocks(uint32 blockLen, t_Fixed16* work, uint32 len, FixedPoint_TuneClock_t clock);
+
+/**********************************************************************************************************************
+LOCAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Best time of an 8-bit kernel over FIXEDPOINT_TUNE_REPEATS runs.
+ *
+ *  @param[in]  kernel  Candidate implementation.
+ *  @param[in]  work    Operands a (len), b (len) and result r (len), stored one after another.
+ *  @param[in]  len     Number of elements.
+ *  @param[in]  clock   Time source in microseconds.
+ *
+ *  @return     double
+ *  @retval     Shortest measured time in microseconds.
+ */
+static double FixedPoint_Tune_Time8(FixedPoint_Kernel8_t kernel, t_Fixed8* work, uint32 len,
+                                    FixedPoint_TuneClock_t clock)
+{
+    double best = 1.0e30;
+    uint32 run;
+
+    for (run = 0U; run < FIXEDPOINT_TUNE_REPEATS; run++)
+    {
+        const double start = clock();
+        double elapsed;
+
+        (void)kernel(work, &work[len], &work[2U * len], len);
+
+        elapsed = clock() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Best time of a gain and FIR chain processed block by block over FIXEDPOINT_TUNE_REPEATS runs.
+ *
+ *  @param[in]  blockLen    Candidate block length.
+ *  @param[in]  work        Input (len), block scratch (len) and output (len), stored one after another.
+ *  @param[in]  len         Number of samples.
+ *  @param[in]  clock       Time source in microseconds.
+ *
+ *  @return     double
+ *  @retval     Shortest measured time in microseconds.
+ */
+static double FixedPoint_Tune_TimeBlocks(uint32 blockLen, t_Fixed16* work, uint32 len, FixedPoint_TuneClock_t clock)
+{
+    static const t_Fixed16 coeffs[FIXEDPOINT_TUNE_FIR_TAPS] = { 1, 3, 7, 12, 12, 7, 3, 1 };
+    const t_Fixed16 gain = (t_Fixed16)(SCALE_16 / 2U);
+    t_Fixed16 delay[FIXEDPOINT_TUNE_FIR_TAPS - 1U];
+    FixedPoint_Fir16_t fir;
+    double best = 1.0e30;
+    uint32 run;
+
+    for (run = 0U; run < FIXEDPOINT_TUNE_REPEATS; run++)
+    {
+        const double start = clock();
+        double elapsed;
+        uint32 pos;
+
+        (void)FixedPoint_Fir16_Init(&fir, coeffs, FIXEDPOINT_TUNE_FIR_TAPS, delay);
+
+        for (pos = 0U; pos < len; pos += blockLen)
+        {
+            const uint32 n = ((len - pos) < blockLen) ? (len - pos) : blockLen;
+
+            (void)FixedPoint_Op16_Strided(FIXEDPOINT_OP_MULT, &work[pos], 1, &gain, 0, &work[len], 1, n);
+            (void)FixedPoint_Fir16(&fir, &work[len], &work[(2U * len) + pos], n);
+        }
+
+        elapsed = clock() - start;
+        best = (elapsed < best) ? elapsed : best;
+    }
+
+    return best;
+}
+
+/**********************************************************************************************************************
+GLOBAL FUNCTIONS
+**********************************************************************************************************************/
+
+/*********************************************************************************************************************/
+/*! @brief     Time all candidates on the local machine and fill a tuning profile (tuning tool).
+ *
+ *  The table candidates are only considered if a table image is attached (FixedPoint_Table_Attach()).
+ *  The work buffer is overwritten.
+ *
+ *  @param[out]     profile     Profile to fill.
+ *  @param[in,out]  work        Work buffer.
+ *  @param[in]      workLen     Number of elements of the work buffer (>= 3 * 64).
+ *  @param[in]      clock       Time source in microseconds.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Profile filled.
+ *  @retval     E_NOT_OK    Null pointer or work buffer too small.
+ */
+Std_ReturnType FixedPoint_Tune_Run(FixedPoint_TuneProfile_t* profile, t_Fixed16* work, uint32 workLen,
+                                   FixedPoint_TuneClock_t clock)
+{
+    Std_ReturnType ret = E_NOT_OK;
+    const uint32 len = workLen / 3U;
+
+    if ((profile != NULL) && (work != NULL) && (clock != NULL) && (len >= FIXEDPOINT_TUNE_MIN_BLOCK_LEN))
+    {
+        t_Fixed8* const work8 = (t_Fixed8*)(void*)work;
+        double bestTime = 1.0e30;
+        uint32 blockLen;
+        uint32 i;
+
+        profile->magic = FIXEDPOINT_TUNE_MAGIC;
+        profile->version = FIXEDPOINT_TUNE_VERSION;
+        profile->shift16 = (uint32)SHIFT_16;
+        profile->shift8 = (uint32)SHIFT_8;
+        profile->mult8Impl = (uint32)FIXEDPOINT_IMPL_COMPUTE;
+        profile->div8Impl = (uint32)FIXEDPOINT_IMPL_COMPUTE;
+        profile->blockLen = FIXEDPOINT_TUNE_MIN_BLOCK_LEN;
+
+        /* 8-bit kernels: arithmetic against table lookup on scattered operand pairs */
+        for (i = 0U; i < len; i++)
+        {
+            work8[i] = (t_Fixed8)(sint8)(uint8)(i * 37U);
+            work8[len + i] = (t_Fixed8)(sint8)(uint8)((i * 11U) + 1U);
+        }
+
+        if (FixedPoint_Table_IsAttached() != 0U)
+        {
+            if (FixedPoint_Tune_Time8(&FixedPoint_Table_Mult8_Array, work8, len, clock) <
+                FixedPoint_Tune_Time8(&FixedPoint_Mult8_Array, work8, len, clock))
+            {
+                profile->mult8Impl = (uint32)FIXEDPOINT_IMPL_TABLE;
+            }
+
+            if (FixedPoint_Tune_Time8(&FixedPoint_Table_Div8_Array, work8, len, clock) <
+                FixedPoint_Tune_Time8(&FixedPoint_Div8_Array, work8, len, clock))
+            {
+                profile->div8Impl = (uint32)FIXEDPOINT_IMPL_TABLE;
+            }
+        }
+
+        /* Block length of block-wise processing */
+        for (i = 0U; i < len; i++)
+        {
+            work[i] = (t_Fixed16)((sint32)(i % 1024U) - 512);
+        }
+
+        for (blockLen = FIXEDPOINT_TUNE_MIN_BLOCK_LEN; blockLen <= len; blockLen *= 4U)
+        {
+            const double elapsed = FixedPoint_Tune_TimeBlocks(blockLen, work, len, clock);
+
+            if (elapsed < bestTime)
+            {
+                bestTime = elapsed;
+                profile->blockLen = blockLen;
+            }
+        }
+
+        ret = E_OK;
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Select the implementations and the block length of a tuning profile.
+ *
+ *  Call once at init, before the dispatch functions are used from other threads.
+ *
+ *  @param[in]  profile     Profile read from the host's profile file, NULL for the defaults.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Profile (or defaults) applied.
+ *  @retval     E_NOT_OK    Profile invalid or of another configuration (previous selection unchanged).
+ */
+Std_ReturnType FixedPoint_Tune_Init(const FixedPoint_TuneProfile_t* profile)
+{
+    Std_ReturnType ret = E_NOT_OK;
+
+    if (profile == NULL)
+    {
+        FixedPoint_TuneMult8 = &FixedPoint_Mult8_Array;
+        FixedPoint_TuneDiv8 = &FixedPoint_Div8_Array;
+        FixedPoint_TuneBlockLen = FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN;
+        ret = E_OK;
+    }
+    else if ((profile->magic == FIXEDPOINT_TUNE_MAGIC) && (profile->version == FIXEDPOINT_TUNE_VERSION) &&
+             (profile->shift16 == (uint32)SHIFT_16) && (profile->shift8 == (uint32)SHIFT_8) &&
+             (profile->mult8Impl <= (uint32)FIXEDPOINT_IMPL_TABLE) && (profile->div8Impl <= (uint32)FIXEDPOINT_IMPL_TABLE) &&
+             (profile->blockLen > 0U))
+    {
+        FixedPoint_TuneMult8 = (profile->mult8Impl == (uint32)FIXEDPOINT_IMPL_TABLE) ?
+                               &FixedPoint_Table_Mult8_Array : &FixedPoint_Mult8_Array;
+        FixedPoint_TuneDiv8 = (profile->div8Impl == (uint32)FIXEDPOINT_IMPL_TABLE) ?
+                              &FixedPoint_Table_Div8_Array : &FixedPoint_Div8_Array;
+        FixedPoint_TuneBlockLen = profile->blockLen;
+        ret = E_OK;
+    }
+    else
+    {
+        /* Invalid profile: keep the current selection */
+    }
+
+    return ret;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Block length selected by the profile.
+ *
+ *  @return     uint32
+ *  @retval     Block length for block-wise processing.
+ */
+uint32 FixedPoint_Tune_GetBlockLen(void)
+{
+    return FixedPoint_TuneBlockLen;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit multiplication over arrays with the implementation selected by the profile.
+ *
+ *  @param[in]  a       First operand array in configured 8-bit Q-format.
+ *  @param[in]  b       Second operand array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Tune_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    return FixedPoint_TuneMult8(a, b, r, len);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     8-bit division over arrays with the implementation selected by the profile.
+ *
+ *  @param[in]  a       Dividend array in configured 8-bit Q-format.
+ *  @param[in]  b       Divisor array in configured 8-bit Q-format.
+ *  @param[out] r       Result array in configured 8-bit Q-format.
+ *  @param[in]  len     Number of elements.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        All elements calculated without saturation.
+ *  @retval     E_NOT_OK    Null pointer, division by zero or saturation of at least one element.
+ */
+Std_ReturnType FixedPoint_Tune_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len)
+{
+    return FixedPoint_TuneDiv8(a, b, r, len);
+}
+
+/** @} end addtogroup */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
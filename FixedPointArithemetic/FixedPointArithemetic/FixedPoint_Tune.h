@@ -0,0 +1,88 @@
+/** @file *************************************************************************************************************
+
+Component   Fixed Point Arithmetic
+
+Filename    FixedPoint_Tune.h
+
+@brief      Interface for the kernel autotuner and the profile based implementation dispatch.
+
+@author     agent
+
+
+@verbatim
+***********************************************************************************************************************
+* Changes                                                                                                             *
+***********************************************************************************************************************
+
+Version   Date        Sign  Description
+--------  ----------  ----  -----------
+01.00.00  2026-10-18  AGT   Initial check in
+
+@endverbatim
+**********************************************************************************************************************/
+#ifndef FIXED_POINT_TUNE_H
+#define FIXED_POINT_TUNE_H
+
+/**********************************************************************************************************************
+INCLUDES
+**********************************************************************************************************************/
+
+#include "Global_Types.h" /**< Fundamental data types header*/
+#include "FixedPoint.h" /**< Fixed point module interface*/
+
+/** @addtogroup g_FixedPoint
+ *  @{
+ */
+
+/**********************************************************************************************************************
+MACROS
+**********************************************************************************************************************/
+
+/** @brief Identification of a tuning profile ("FXTP"). */
+#define FIXEDPOINT_TUNE_MAGIC       (0x46585450UL)
+
+/** @brief Layout version of the tuning profile. */
+#define FIXEDPOINT_TUNE_VERSION     (1UL)
+
+/**********************************************************************************************************************
+TYPEDEFS
+**********************************************************************************************************************/
+
+/** @brief   Implementation candidates of a kernel. */
+typedef enum
+{
+    FIXEDPOINT_IMPL_COMPUTE = 0,    /**< Integer arithmetic (batch kernel) */
+    FIXEDPOINT_IMPL_TABLE           /**< Lookup in the attached table image (FixedPoint_Table) */
+} FixedPoint_Impl_t;
+
+/** @brief   Time source for the autotuner in microseconds, provided by the platform. */
+typedef double (*FixedPoint_TuneClock_t)(void);
+
+/** @brief   Tuning profile of one host, written by the autotuner and read at init. */
+typedef struct
+{
+    uint32 magic;       /**< FIXEDPOINT_TUNE_MAGIC */
+    uint32 version;     /**< FIXEDPOINT_TUNE_VERSION */
+    uint32 shift16;     /**< SHIFT_16 of the tuned configuration */
+    uint32 shift8;      /**< SHIFT_8 of the tuned configuration */
+    uint32 mult8Impl;   /**< FixedPoint_Impl_t of the 8-bit multiplication */
+    uint32 div8Impl;    /**< FixedPoint_Impl_t of the 8-bit division */
+    uint32 blockLen;    /**< Fastest block length for block-wise processing (stream pipelines, FIR) */
+} FixedPoint_TuneProfile_t;
+
+/**********************************************************************************************************************
+EXTERNAL FUNCTIONS
+**********************************************************************************************************************/
+extern Std_ReturnType FixedPoint_Tune_Run(FixedPoint_TuneProfile_t* profile, t_Fixed16* work, uint32 workLen,
+                                          FixedPoint_TuneClock_t clock);
+extern Std_ReturnType FixedPoint_Tune_Init(const FixedPoint_TuneProfile_t* profile);
+extern uint32 FixedPoint_Tune_GetBlockLen(void);
+extern Std_ReturnType FixedPoint_Tune_Mult8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+extern Std_ReturnType FixedPoint_Tune_Div8_Array(const t_Fixed8* a, const t_Fixed8* b, t_Fixed8* r, uint32 len);
+
+/** @} end addtogroup */
+
+#endif /* FIXED_POINT_TUNE_H */
+/**********************************************************************************************************************
+EOF
+**********************************************************************************************************************/
@@ -40,6 +40,31 @@
  * --------  ----------  ----  -----------
  * 01.00.00  2025-12-29  Hari  Initial check in
  * 01.01.00  2026-01-07  Hari   Updated and added comments.
+ * 01.02.00  2026-10-18  AGT    Added tensor configuration.
+ * 01.03.00  2026-10-18  AGT    Added result cache configuration.
+ * 01.04.00  2026-10-18  AGT    Added job queue configuration and exclusive area.
+ * 01.05.00  2026-10-18  AGT    Added streaming pipeline configuration.
+ * 01.06.00  2026-10-18  AGT    Added compute service configuration and memory barrier.
+ * 01.07.00  2026-10-18  AGT    Added autotuner configuration.
+ * 01.08.00  2026-10-18  AGT    Added trace configuration.
+ * 01.09.00  2026-10-18  AGT    Added USDT probe configuration.
+ * 01.10.00  2026-10-18  AGT    Added saturation log configuration.
+ * 01.11.00  2026-10-18  AGT    Added shadow execution configuration.
+ * 01.12.00  2026-10-18  AGT    Added metrics configuration.
+ * 01.13.00  2026-10-18  AGT    Added non-temporal store configuration.
+ * 01.14.00  2026-10-18  AGT    Added SSE2 target detection.
+ * 01.15.00  2026-10-18  AGT    Added FFT and fast convolution configuration.
+ * 01.16.00  2026-10-18  AGT    Added correlation configuration.
+ * 01.17.00  2026-10-18  AGT    Added adaptive filter configuration.
+ * 01.18.00  2026-10-18  AGT    Added simulation runtime configuration and atomic add.
+ * 01.19.00  2026-10-18  AGT    Added 32-bit Q-format configuration.
+ * 01.20.00  2026-10-18  AGT    Added coalescing limit of the compute service.
+ * 01.21.00  2026-10-18  AGT    Intrinsics header of the barrier and atomic macros included here (MSVC).
+ * 01.22.00  2026-10-18  AGT    Job queue size power of 2, added back-off of the job wait.
+ * 01.23.00  2026-10-18  AGT    Added number of threads with shadow statistics.
+ * 01.24.00  2026-10-18  AGT    Metrics of threads beyond the pool dropped instead of shared.
+ * 01.25.00  2026-10-18  AGT    Non-temporal stores off by default.
+ * 01.26.00  2026-10-18  AGT    Correlation FFT cost recalibrated to the measured crossover.
  *
  * @endverbatim
  **********************************************************************************************************************/
@@ -51,6 +76,9 @@
   INCLUDES
  **********************************************************************************************************************/
 #include "Global_Types.h"
+#if defined(_MSC_VER)
+#include <intrin.h>            /* for _ReadWriteBarrier, _InterlockedExchangeAdd and _mm_pause of the macros below */
+#endif
 
  /** @addtogroup g_FixedPoint
   *  @{
@@ -71,6 +99,17 @@
 #define SCALE_16    (1U << SHIFT_16)
 
 
+/* --- 32-bit Q-Format Configuration --- */
+/** @brief Number of fractional bits for 32-bit fixed-point arithmetic (integration and ODE stepping).
+ *
+ * Default value 16 corresponds to Q15.16 format: 1 sign bit, 15 integer bits, 16 fractional bits
+ */
+#define SHIFT_32    (16U)
+
+ /** @brief Scaling factor for 32-bit fixed-point arithmetic (2^SHIFT_32). */
+#define SCALE_32    (1UL << SHIFT_32)
+
+
 /* --- 8-bit Q-Format Configuration --- */
 /** @brief Number of fractional bits for 8-bit fixed-point arithmetic.
  *
@@ -89,6 +128,12 @@
 /** @brief Minimum representable raw fixed-point value for 16-bit container (t_Fixed16). */
 #define FIX16_MIN   ((t_Fixed16)-32768)
 
+/** @brief Maximum representable raw fixed-point value for 32-bit container (t_Fixed32). */
+#define FIX32_MAX   ((t_Fixed32) 2147483647L)
+
+/** @brief Minimum representable raw fixed-point value for 32-bit container (t_Fixed32). */
+#define FIX32_MIN   ((t_Fixed32)(-2147483647L - 1L))
+
 /** @brief Maximum representable raw fixed-point value for 8-bit container (t_Fixed8). */
 #define FIX8_MAX    ((t_Fixed8)  127)
 
@@ -96,6 +141,248 @@
 #define FIX8_MIN    ((t_Fixed8) -128)
 
 
+/* --- Tensor Configuration --- */
+/** @brief Maximum number of dimensions of a FixedPoint_Tensor16_t. Shape and stride arrays are sized by this value. */
+#define FIXEDPOINT_TENSOR_MAX_RANK  (6U)
+
+
+/* --- Result Cache Configuration --- */
+/** @brief Enable (1U) or disable (0U) the result cache in front of FixedPoint_Mult16 and FixedPoint_Div16.
+ *
+ * The cache is keyed on the quantized operand pair, so it only pays off for callers that repeat
+ * the same operands (setpoints, constants). When disabled, no cache code or data is compiled.
+ */
+#define FIXEDPOINT_RESULT_CACHE_ENABLE  (0U)
+
+/** @brief Number of direct-mapped cache entries per operation and thread (power of 2). */
+#define FIXEDPOINT_RESULT_CACHE_SIZE    (64U)
+
+/** @brief Storage class for thread-local module data (compiler specific). */
+#if defined(_MSC_VER)
+#define FIXEDPOINT_THREAD_LOCAL     __declspec(thread)
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L)
+#define FIXEDPOINT_THREAD_LOCAL     _Thread_local
+#else
+#define FIXEDPOINT_THREAD_LOCAL     __thread
+#endif
+
+
+/* --- Job Queue Configuration --- */
+/** @brief Number of job slots of a FixedPoint_JobQueue_t (power of 2, 1..256). */
+#define FIXEDPOINT_JOB_QUEUE_SIZE       (32U)
+
+/** @brief Maximum number of adjacent element-wise jobs merged into one kernel call. */
+#define FIXEDPOINT_JOB_COALESCE_MAX     (8U)
+
+/** @brief Longest back-off of FixedPoint_Job_Wait() in FIXEDPOINT_JOB_YIELD() calls (doubled per idle round). */
+#define FIXEDPOINT_JOB_BACKOFF_MAX      (1024U)
+
+/** @brief Give up the processor for a moment while FixedPoint_Job_Wait() waits for another context.
+ *
+ * A pause hint of the CPU by default. Map it to the yield of the platform (SwitchToThread,
+ * sched_yield) if the waiting thread shares a core with the processing one.
+ */
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+#define FIXEDPOINT_JOB_YIELD()          _mm_pause()
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define FIXEDPOINT_JOB_YIELD()          __builtin_ia32_pause()
+#else
+#define FIXEDPOINT_JOB_YIELD()          FIXEDPOINT_MEMORY_BARRIER()
+#endif
+
+/** @brief Enter the exclusive area protecting shared module data.
+ *
+ * Empty by default for single-context use. If the modules using it are called from different
+ * threads or interrupt levels, map these macros to a mutex or critical section of the platform.
+ */
+#define FIXEDPOINT_ENTER_CRITICAL()     do { } while (0)
+
+/** @brief Leave the exclusive area entered with FIXEDPOINT_ENTER_CRITICAL(). */
+#define FIXEDPOINT_EXIT_CRITICAL()      do { } while (0)
+
+
+/* --- Streaming Pipeline Configuration --- */
+/** @brief Maximum number of stages (source, transforms, sink) of a FixedPoint_Stream_t (>= 2). */
+#define FIXEDPOINT_STREAM_MAX_STAGES    (8U)
+
+
+/* --- Compute Service Configuration --- */
+/** @brief Maximum number of clients of a service region. */
+#define FIXEDPOINT_SERVICE_MAX_CLIENTS  (4U)
+
+/** @brief Number of request entries per client ring (power of 2). */
+#define FIXEDPOINT_SERVICE_RING_SIZE    (16U)
+
+/** @brief Maximum number of adjacent requests of one client merged into one kernel call. */
+#define FIXEDPOINT_SERVICE_COALESCE_MAX (8U)
+
+/** @brief Full memory barrier ordering the ring entries and counters shared between processes.
+ *
+ * The MSVC variant only prevents compiler reordering, which is sufficient on x86/x64. Map it to
+ * a hardware barrier (e.g. __dmb) on weakly ordered targets.
+ */
+#if defined(_MSC_VER)
+#define FIXEDPOINT_MEMORY_BARRIER()     _ReadWriteBarrier()
+#else
+#define FIXEDPOINT_MEMORY_BARRIER()     __sync_synchronize()
+#endif
+
+
+/* --- Autotuner Configuration --- */
+/** @brief Number of timed runs per candidate; the shortest run is compared. */
+#define FIXEDPOINT_TUNE_REPEATS             (5U)
+
+/** @brief Block length used for block-wise processing without a tuning profile. */
+#define FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN   (1024U)
+
+
+/* --- Trace Configuration --- */
+/** @brief Enable (1U) or disable (0U) the timeline trace points in kernels, stream stages and jobs.
+ *
+ * When disabled, the FIXEDPOINT_TRACE_ macros expand to nothing and no trace code or data is compiled.
+ */
+#define FIXEDPOINT_TRACE_ENABLE         (0U)
+
+/** @brief Number of trace events buffered per thread between two flushes. */
+#define FIXEDPOINT_TRACE_BUFFER_SIZE    (4096U)
+
+
+/* --- USDT Probe Configuration --- */
+/** @brief Enable (1U) or disable (0U) the USDT probes at the saturation and division by zero paths.
+ *
+ * Requires <sys/sdt.h> (systemtap-sdt-dev / systemtap-sdt-devel) and a GCC or Clang ELF target.
+ * An enabled probe is a single nop until a tracer (bpftrace, perf, SystemTap) attaches to it.
+ */
+#define FIXEDPOINT_USDT_ENABLE          (0U)
+
+
+/* --- Saturation Log Configuration --- */
+/** @brief Enable (1U) or disable (0U) the log of the most recent saturating operations per thread.
+ *
+ * Entries are only written in the saturation and division by zero branches; operations that do
+ * not saturate run the same code as without the log.
+ */
+#define FIXEDPOINT_SATLOG_ENABLE        (0U)
+
+/** @brief Number of entries of the log ring of one thread (power of 2). */
+#define FIXEDPOINT_SATLOG_SIZE          (64U)
+
+/** @brief Maximum number of threads with a log ring; further threads are counted but not logged. */
+#define FIXEDPOINT_SATLOG_MAX_THREADS   (8U)
+
+
+/* --- Shadow Execution Configuration --- */
+/** @brief Enable (1U) or disable (0U) the sampled comparison of results against a double reference.
+ *
+ * When enabled, a call that is not sampled costs one decrement and one branch.
+ */
+#define FIXEDPOINT_SHADOW_ENABLE            (0U)
+
+/** @brief Sampling rate at start-up: 1 in N calls per thread is checked, 0 = off. */
+#define FIXEDPOINT_SHADOW_DEFAULT_RATE      (1024U)
+
+/** @brief Calls between two checks of the rate while sampling is off. */
+#define FIXEDPOINT_SHADOW_POLL_INTERVAL     (65536U)
+
+/** @brief Maximum number of elements checked in a sampled batch kernel call. */
+#define FIXEDPOINT_SHADOW_ARRAY_CHECKS      (16U)
+
+/** @brief Number of threads with their own statistics slot; checks of further threads are not accumulated. */
+#define FIXEDPOINT_SHADOW_MAX_THREADS       (8U)
+
+
+/* --- Metrics Configuration --- */
+/** @brief Enable (1U) or disable (0U) the runtime counters (calls, saturations, kernel time and bytes).
+ *
+ * When disabled, the FIXEDPOINT_METRICS_ macros expand to nothing and no metrics code or data is compiled.
+ */
+#define FIXEDPOINT_METRICS_ENABLE       (0U)
+
+/** @brief Number of threads with their own counter slot; further threads are not counted, only their number. */
+#define FIXEDPOINT_METRICS_MAX_THREADS  (8U)
+
+
+/* --- Non-Temporal Store Configuration --- */
+/** @brief Result length in elements from which the 16-bit element-wise batch kernels bypass the cache, 0 = never.
+ *
+ * Above the threshold the results are written with non-temporal stores and the inputs are prefetched
+ * without allocating them in the outer cache levels, so that a result much larger than the last level
+ * cache does not evict the data of the next stage (e.g. coefficient tables). Non-temporal stores
+ * require SSE2, other targets only prefetch. Changed at run time with FixedPoint_SetNonTemporalThreshold().
+ * Off by default: on the reference host (benchmark "Non-temporal stores") neither the producer nor the
+ * downstream stage gained. Enable only after the benchmark shows a gain on the target.
+ */
+#define FIXEDPOINT_NT_THRESHOLD         (0U)
+
+/** @brief Distance in bytes between the input being processed and the input being prefetched. */
+#define FIXEDPOINT_PREFETCH_DISTANCE    (512U)
+
+/** @brief Cache line size of the target in bytes (power of 2). */
+#define FIXEDPOINT_CACHE_LINE_SIZE      (64U)
+
+/** @brief SSE2 intrinsics (<emmintrin.h>) available on the target (1U) or not (0U), detected from the compiler.
+ *
+ * Selects the SIMD variants of the non-temporal stores and the layout kernels; without SSE2 the
+ * portable C variants with identical results are used.
+ */
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FIXEDPOINT_SSE2                 (1U)
+#else
+#define FIXEDPOINT_SSE2                 (0U)
+#endif
+
+
+/* --- FFT and Fast Convolution Configuration --- */
+/** @brief Largest transform length of the fixed-point FFT (power of 2). */
+#define FIXEDPOINT_FFT_MAX_LEN          (8192U)
+
+/** @brief Filters with up to this many taps are processed in direct form, longer ones with the FFT.
+ *
+ * Below the break-even length the direct form is faster and exact; above it the partitioned
+ * overlap-save convolution wins by a factor growing with the filter length. The default is the
+ * break-even measured by the convolution benchmark on x86-64 (between 128 and 256 taps).
+ */
+#define FIXEDPOINT_CONV_DIRECT_MAX_TAPS (192U)
+
+/** @brief Largest number of filter partitions of the partitioned convolution. */
+#define FIXEDPOINT_CONV_MAX_PARTS       (64U)
+
+/** @brief Cost of the FFT path of the correlation kernels in direct path multiply-accumulates per fftLen * log2(fftLen).
+ *
+ * With an FFT path set up, a call uses it when numLags * min(xLen, yLen) exceeds this factor times
+ * fftLen * log2(fftLen). The default is the crossover measured on x86-64 for signals of 256 to 4096
+ * samples: at factors below about 90 (e.g. 2048 samples, lags 0..2047) the direct path is faster,
+ * above it (e.g. all 4095 lags of 2048 samples) the FFT path. See the correlation benchmark.
+ */
+#define FIXEDPOINT_CORR_FFT_COST        (96U)
+
+
+/* --- Adaptive Filter Configuration --- */
+/** @brief Fractional bits of the 32-bit LMS coefficients (Q3.28 by default, range [-8, 8)). */
+#define FIXEDPOINT_LMS_COEFF_SHIFT      (28U)
+
+/** @brief Regularization of the NLMS input power in 16-bit Q-format squared (2^(2 * SHIFT_16) = 1.0).
+ *
+ * Bounds the normalized step size of the NLMS filter while the input is (nearly) silent.
+ */
+#define FIXEDPOINT_LMS_NLMS_EPS         (1ULL << (2U * SHIFT_16))
+
+
+/* --- Simulation Runtime Configuration --- */
+/** @brief Instances of a simulation group, stepped together in SIMD lanes (multiple of 8, 16..64). */
+#define FIXEDPOINT_SIM_LANES            (32U)
+
+/** @brief Groups claimed at once by a worker of FixedPoint_Sim_Work(). */
+#define FIXEDPOINT_SIM_CLAIM_GROUPS     (8U)
+
+/** @brief Atomically add v to the uint32 *p and yield the previous value (claims of work groups and pool entries). */
+#if defined(_MSC_VER)
+#define FIXEDPOINT_ATOMIC_FETCH_ADD(p, v)   ((uint32)_InterlockedExchangeAdd((volatile long*)(p), (long)(v)))
+#else
+#define FIXEDPOINT_ATOMIC_FETCH_ADD(p, v)   ((uint32)__sync_fetch_and_add((p), (uint32)(v)))
+#endif
+
+
 /**********************************************************************************************************************
  CONFIG VALIDATION (COMPILE-TIME CHECKS)
 **********************************************************************************************************************/
@@ -108,6 +395,108 @@
 #error "SHIFT_8 must be <= 7 for signed 8-bit fixed-point."
 #endif
 
+#if (SHIFT_32 > 31U)
+#error "SHIFT_32 must be <= 31 for signed 32-bit fixed-point."
+#endif
+
+#if (FIXEDPOINT_TENSOR_MAX_RANK < 1U)
+#error "FIXEDPOINT_TENSOR_MAX_RANK must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_RESULT_CACHE_SIZE == 0U) || ((FIXEDPOINT_RESULT_CACHE_SIZE & (FIXEDPOINT_RESULT_CACHE_SIZE - 1U)) != 0U))
+#error "FIXEDPOINT_RESULT_CACHE_SIZE must be a power of 2."
+#endif
+
+#if ((FIXEDPOINT_JOB_QUEUE_SIZE < 1U) || (FIXEDPOINT_JOB_QUEUE_SIZE > 256U) || \
+     ((FIXEDPOINT_JOB_QUEUE_SIZE & (FIXEDPOINT_JOB_QUEUE_SIZE - 1U)) != 0U))
+#error "FIXEDPOINT_JOB_QUEUE_SIZE must be a power of 2 within 1..256."
+#endif
+
+#if (FIXEDPOINT_JOB_BACKOFF_MAX < 1U)
+#error "FIXEDPOINT_JOB_BACKOFF_MAX must be >= 1."
+#endif
+
+#if (FIXEDPOINT_JOB_COALESCE_MAX < 1U)
+#error "FIXEDPOINT_JOB_COALESCE_MAX must be >= 1."
+#endif
+
+#if (FIXEDPOINT_STREAM_MAX_STAGES < 2U)
+#error "FIXEDPOINT_STREAM_MAX_STAGES must be >= 2 (source and sink)."
+#endif
+
+#if (FIXEDPOINT_SERVICE_MAX_CLIENTS < 1U)
+#error "FIXEDPOINT_SERVICE_MAX_CLIENTS must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_SERVICE_RING_SIZE == 0U) || ((FIXEDPOINT_SERVICE_RING_SIZE & (FIXEDPOINT_SERVICE_RING_SIZE - 1U)) != 0U))
+#error "FIXEDPOINT_SERVICE_RING_SIZE must be a power of 2."
+#endif
+
+#if (FIXEDPOINT_SERVICE_COALESCE_MAX < 1U)
+#error "FIXEDPOINT_SERVICE_COALESCE_MAX must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_TUNE_REPEATS < 1U) || (FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN < 1U))
+#error "FIXEDPOINT_TUNE_REPEATS and FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN must be >= 1."
+#endif
+
+#if (FIXEDPOINT_TRACE_BUFFER_SIZE < 1U)
+#error "FIXEDPOINT_TRACE_BUFFER_SIZE must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_USDT_ENABLE == 1U) && !(defined(__GNUC__) && defined(__ELF__)))
+#error "FIXEDPOINT_USDT_ENABLE requires a GCC or Clang ELF target."
+#endif
+
+#if ((FIXEDPOINT_SATLOG_SIZE == 0U) || ((FIXEDPOINT_SATLOG_SIZE & (FIXEDPOINT_SATLOG_SIZE - 1U)) != 0U))
+#error "FIXEDPOINT_SATLOG_SIZE must be a power of 2."
+#endif
+
+#if (FIXEDPOINT_SATLOG_MAX_THREADS < 1U)
+#error "FIXEDPOINT_SATLOG_MAX_THREADS must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_SHADOW_POLL_INTERVAL < 1U) || (FIXEDPOINT_SHADOW_ARRAY_CHECKS < 1U) || \
+     (FIXEDPOINT_SHADOW_MAX_THREADS < 1U))
+#error "FIXEDPOINT_SHADOW_POLL_INTERVAL, FIXEDPOINT_SHADOW_ARRAY_CHECKS and FIXEDPOINT_SHADOW_MAX_THREADS must be >= 1."
+#endif
+
+#if (FIXEDPOINT_METRICS_MAX_THREADS < 1U)
+#error "FIXEDPOINT_METRICS_MAX_THREADS must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_CACHE_LINE_SIZE < 16U) || ((FIXEDPOINT_CACHE_LINE_SIZE & (FIXEDPOINT_CACHE_LINE_SIZE - 1U)) != 0U))
+#error "FIXEDPOINT_CACHE_LINE_SIZE must be a power of 2 and >= 16."
+#endif
+
+#if ((FIXEDPOINT_PREFETCH_DISTANCE % FIXEDPOINT_CACHE_LINE_SIZE) != 0U)
+#error "FIXEDPOINT_PREFETCH_DISTANCE must be a multiple of FIXEDPOINT_CACHE_LINE_SIZE."
+#endif
+
+#if ((FIXEDPOINT_FFT_MAX_LEN < 4U) || ((FIXEDPOINT_FFT_MAX_LEN & (FIXEDPOINT_FFT_MAX_LEN - 1U)) != 0U))
+#error "FIXEDPOINT_FFT_MAX_LEN must be a power of 2 and >= 4."
+#endif
+
+#if ((FIXEDPOINT_CONV_DIRECT_MAX_TAPS < 1U) || (FIXEDPOINT_CONV_MAX_PARTS < 1U))
+#error "FIXEDPOINT_CONV_DIRECT_MAX_TAPS and FIXEDPOINT_CONV_MAX_PARTS must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_LMS_COEFF_SHIFT < 1U) || (FIXEDPOINT_LMS_COEFF_SHIFT > 30U))
+#error "FIXEDPOINT_LMS_COEFF_SHIFT must be within 1..30."
+#endif
+
+#if (FIXEDPOINT_LMS_NLMS_EPS < 1U)
+#error "FIXEDPOINT_LMS_NLMS_EPS must be >= 1."
+#endif
+
+#if ((FIXEDPOINT_SIM_LANES < 16U) || (FIXEDPOINT_SIM_LANES > 64U) || ((FIXEDPOINT_SIM_LANES % 8U) != 0U))
+#error "FIXEDPOINT_SIM_LANES must be a multiple of 8 within 16..64."
+#endif
+
+#if (FIXEDPOINT_SIM_CLAIM_GROUPS < 1U)
+#error "FIXEDPOINT_SIM_CLAIM_GROUPS must be >= 1."
+#endif
+
 /** @} end addtogroup */
 
 #endif /* FIXED_POINT_CFG_H */
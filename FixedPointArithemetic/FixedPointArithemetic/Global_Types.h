@@ -16,6 +16,8 @@ Filename    Global_Types.h
 Version   Date        Sign  Description
 --------  ----------  ----  -----------
 01.00.00  2025-12-10  Hari   Initial check in
+01.01.00  2026-10-18  AGT    Added unsigned 8 and 16 bit types
+01.02.00  2026-10-18  AGT    Added 32 bit fixed point type
 
 @endverbatim
 **********************************************************************************************************************/
@@ -40,12 +42,15 @@ typedef unsigned char        boolean; /* boolean type */
 
 typedef signed char        sint8;   /**< 8 bit signed integer -128 .. 127 */
 typedef signed short       sint16;  /**< 16 bit signed integer -32768 .. 32767 */
+typedef unsigned char      uint8;   /**< 8 bit unsigned integer 0 .. 255 */
+typedef unsigned short     uint16;  /**< 16 bit unsigned integer 0 .. 65535 */
 typedef signed long        sint32;  /**< 32 bit signed integer */
 typedef unsigned long        uint32;  /**< 32 bit unsigned integer */
 typedef signed long long   sint64;  /**< 64 bit signed integer */
 typedef unsigned long long   uint64;  /**< 64 bit unsigned integer */
 
 
+typedef sint32 t_Fixed32; /**< for fixed point 32 bit (values within 32 bits, also where sint32 is wider) */
 typedef sint16 t_Fixed16; /**< for fixed point 16 bit */
 typedef sint8  t_Fixed8; /**< for fixed point 8 bit  */
 
@@ -66,6 +66,39 @@
   * 01.01.00  2025-12-22  Hari   Updated into automated test setup with structured test vectors and PASS/FAIL report.
   * 01.02.00  2025-12-27  Hari   Added more cases.
   * 01.03.00  2026-01-09  Hari   Updated and added detailed comments.
+  * 01.04.00  2026-10-18  AGT    Added module checks for the batch kernels and tensor broadcasting.
+  * 01.05.00  2026-10-18  AGT    Added result cache checks.
+  * 01.06.00  2026-10-18  AGT    Added dependency graph checks.
+  * 01.07.00  2026-10-18  AGT    Added job queue checks and --bench option.
+  * 01.08.00  2026-10-18  AGT    Added streaming pipeline checks.
+  * 01.09.00  2026-10-18  AGT    Added file stage round trip check.
+  * 01.10.00  2026-10-18  AGT    Added compute service checks.
+  * 01.11.00  2026-10-18  AGT    Added table image checks and --build-tables option.
+  * 01.12.00  2026-10-18  AGT    Added autotuner checks and --tune option.
+  * 01.13.00  2026-10-18  AGT    Added trace checks.
+  * 01.14.00  2026-10-18  AGT    Added saturation log checks.
+  * 01.15.00  2026-10-18  AGT    Added shadow execution checks.
+  * 01.16.00  2026-10-18  AGT    Added metrics checks.
+  * 01.17.00  2026-10-18  AGT    Added --roofline option.
+  * 01.18.00  2026-10-18  AGT    Added non-temporal batch kernel check.
+  * 01.19.00  2026-10-18  AGT    Added layout transform checks.
+  * 01.20.00  2026-10-18  AGT    Added FFT and fast convolution checks.
+  * 01.21.00  2026-10-18  AGT    Added correlation checks.
+  * 01.22.00  2026-10-18  AGT    Added adaptive filter checks.
+  * 01.23.00  2026-10-18  AGT    Added curve and map interpolation checks.
+  * 01.24.00  2026-10-18  AGT    Added control block checks.
+  * 01.25.00  2026-10-18  AGT    Added target DSP emulation checks.
+  * 01.26.00  2026-10-18  AGT    Added simulation runtime checks.
+  * 01.27.00  2026-10-18  AGT    Added integration and ODE checks.
+  * 01.28.00  2026-10-18  AGT    Added saturating in-place job check.
+  * 01.29.00  2026-10-18  AGT    Added saturating in-place service request check.
+  * 01.30.00  2026-10-18  AGT    Added check that nested kernel calls are counted once.
+  * 01.31.00  2026-10-18  AGT    Added trace buffer overflow check.
+  * 01.32.00  2026-10-18  AGT    Service checks use the private server state, added tampered header check.
+  * 01.33.00  2026-10-18  AGT    Group status of coalesced jobs, added concurrent job queue check.
+  * 01.34.00  2026-10-18  AGT    Added concurrent shadow execution check.
+  * 01.35.00  2026-10-18  AGT    Added metrics check of threads beyond the counter pool.
+  * 01.36.00  2026-10-18  AGT    Added service check of the group status of coalesced requests.
   *
   * @endverbatim
   **********************************************************************************************************************/
@@ -75,9 +108,34 @@
 **********************************************************************************************************************/
 #include <Windows.h>
 #include <conio.h>
+#include <math.h>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
 #include "Global_Types.h"
 #include "FixedPoint.h"
+#include "FixedPoint_Tensor.h"
+#include "FixedPoint_Graph.h"
+#include "FixedPoint_Job.h"
+#include "FixedPoint_Stream.h"
+#include "FixedPoint_Service.h"
+#include "FixedPoint_Table.h"
+#include "FixedPoint_Tune.h"
+#include "FixedPoint_Trace.h"
+#include "FixedPoint_SatLog.h"
+#include "FixedPoint_Shadow.h"
+#include "FixedPoint_Metrics.h"
+#include "FixedPoint_Layout.h"
+#include "FixedPoint_Conv.h"
+#include "FixedPoint_Corr.h"
+#include "FixedPoint_Lms.h"
+#include "FixedPoint_Interp.h"
+#include "FixedPoint_Ctrl.h"
+#include "FixedPoint_Dsp.h"
+#include "FixedPoint_Sim.h"
+#include "FixedPoint_Integ.h"
+#include "Benchmark.h"
 
 /** @defgroup g_TestHarness Test Harness (Main.c)
  *  @brief Command-line test application for the FixedPoint module.
@@ -146,6 +204,36 @@
 /** @brief Value below one LSB to trigger precision underflow for test case in 8-bit format. */
 #define FIX8_BELOW_RES   (0.49f * FIX8_RESOLUTION)
 
+/** @brief Instances of the simulation runtime checks (not a multiple of FIXEDPOINT_SIM_LANES). */
+#define SIM_TEST_INSTANCES  (1000U)
+
+/** @brief Registers per instance of the simulation runtime checks. */
+#define SIM_TEST_REGS       (14U)
+
+/** @brief Oscillators integrated in one call by the ODE checks. */
+#define INTEG_TEST_SYSTEMS  (500U)
+
+/** @brief Threads submitting, processing and waiting for jobs at the same time in the job queue checks. */
+#define JOB_TEST_THREADS    (4U)
+
+/** @brief Jobs submitted one after the other by every thread of the concurrent job queue check. */
+#define JOB_TEST_JOBS       (2000U)
+
+/** @brief Elements per job of the concurrent job queue check. */
+#define JOB_TEST_LEN        (8U)
+
+/** @brief Threads checking at the same time in the shadow execution checks. */
+#define SHADOW_TEST_THREADS (4U)
+
+/** @brief Sampled calls per thread of the concurrent shadow execution check. */
+#define SHADOW_TEST_CALLS   (1000U)
+
+/** @brief Threads of the metrics pool check: two more than the pool has slots. */
+#define METRICS_TEST_THREADS (FIXEDPOINT_METRICS_MAX_THREADS + 2U)
+
+/** @brief Counted calls per thread of the metrics pool check. */
+#define METRICS_TEST_CALLS  (1000U)
+
 
 
 /***********************************************************************************************************************
@@ -188,11 +276,83 @@ typedef struct
     Std_ReturnType   expectedStatus;   /**< Expected return status (E_OK / E_NOT_OK) */
 } TestVector_t;
 
+/** @brief   Thread of the concurrent job queue check: own operand and result arrays, shared queue. */
+typedef struct
+{
+    FixedPoint_JobQueue_t* queue;               /**< Queue shared by all threads */
+    t_Fixed16              in[JOB_TEST_LEN];    /**< Operands of the current job */
+    t_Fixed16              out[JOB_TEST_LEN];   /**< Results of the current job */
+    uint32                 errors;              /**< Jobs not accepted, failed or with wrong results */
+} JobTestThread_t;
+
+/***********************************************************************************************************************
+ LOCAL VARIABLES
+ **********************************************************************************************************************/
+
+/** @brief Buffer for a table image (table checks and --build-tables), uint32 for alignment. */
+static uint32 TableImage[(FIXEDPOINT_TABLE_IMAGE_SIZE + 3UL) / 4UL];
+
+/** @brief Work buffer of the autotuner (autotuner checks and --tune). */
+static t_Fixed16 TuneWork[3U * 16384U];
+
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+/** @brief Text written by the saturation log dump (saturation log checks). */
+static char SatLogText[16384];
+
+/** @brief Used characters of SatLogText. */
+static uint32 SatLogTextLen = 0U;
+#endif
+
 /***********************************************************************************************************************
  LOCAL FUNCTION PROTOTYPES
  **********************************************************************************************************************/
 static void RunAllTests(void);
 static void RunSingleTest(const TestVector_t* test, unsigned int id, unsigned int* passCount, unsigned int* failCount);
+static void ReportCheck(const char* group, unsigned int id, boolean ok, const char* description,
+                        unsigned int* passCount, unsigned int* failCount);
+static void RunTensorTests(unsigned int* passCount, unsigned int* failCount);
+static void RunGraphTests(unsigned int* passCount, unsigned int* failCount);
+static void RunJobTests(unsigned int* passCount, unsigned int* failCount);
+static void JobTestCallback(FixedPoint_JobHandle_t handle, Std_ReturnType status, void* context);
+static DWORD WINAPI JobTestWorker(LPVOID arg);
+static void RunStreamTests(unsigned int* passCount, unsigned int* failCount);
+static void RunServiceTests(unsigned int* passCount, unsigned int* failCount);
+static void RunTableTests(unsigned int* passCount, unsigned int* failCount);
+static int BuildTableFile(const char* path);
+static double TuneClock(void);
+static void RunTuneTests(unsigned int* passCount, unsigned int* failCount);
+static void RunLayoutTests(unsigned int* passCount, unsigned int* failCount);
+static void RunConvTests(unsigned int* passCount, unsigned int* failCount);
+static void RunCorrTests(unsigned int* passCount, unsigned int* failCount);
+static void RunLmsTests(unsigned int* passCount, unsigned int* failCount);
+static void RunInterpTests(unsigned int* passCount, unsigned int* failCount);
+static void RunCtrlTests(unsigned int* passCount, unsigned int* failCount);
+static void RunDspTests(unsigned int* passCount, unsigned int* failCount);
+static void RunSimTests(unsigned int* passCount, unsigned int* failCount);
+static void RunIntegTests(unsigned int* passCount, unsigned int* failCount);
+static Std_ReturnType IntegTestLinear16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num);
+static Std_ReturnType IntegTestLinear32(void* context, const t_Fixed32* x, t_Fixed32* dxdt, uint32 num);
+static Std_ReturnType IntegTestOsc16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num);
+static int TuneToFile(const char* path);
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+static void RunCacheTests(unsigned int* passCount, unsigned int* failCount);
+#endif
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+static uint64 TraceClock(void);
+static void RunTraceTests(unsigned int* passCount, unsigned int* failCount);
+#endif
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+static void SatLogCapture(const char* text, uint32 len);
+static void RunSatLogTests(unsigned int* passCount, unsigned int* failCount);
+#endif
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+static void RunShadowTests(unsigned int* passCount, unsigned int* failCount);
+static DWORD WINAPI ShadowTestWorker(LPVOID arg);
+#endif
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+static void RunMetricsTests(unsigned int* passCount, unsigned int* failCount);
+static DWORD WINAPI MetricsTestWorker(LPVOID arg);
+#endif
 
 /***********************************************************************************************************************
  LOCAL FUNCTIONS
@@ -385,136 +545,3028 @@ static void RunSingleTest(const TestVector_t* test, unsigned int id, unsigned in
 }
 
 /*********************************************************************************************************************/
-/*! @brief     Execute all predefined test vectors and print a summary.
+/*! @brief     Print the PASS/FAIL line of a module check and update the counters.
  *
- *  The test set covers:
- *  - Typical operations in 16-bit and 8-bit
- *  - Positive and negative boundary and saturation behaviour
- *  - Rounding and precision loss near resolution limits
- *  - Division by zero handling
+ *  Module checks cover interfaces that do not fit into the float test vector table
+ *  (e.g. array and tensor interfaces). Each check is evaluated by the caller.
+ *
+ *  @param[in]      group       Short name of the checked module (printed as test case prefix).
+ *  @param[in]      id          Check identifier within the group.
+ *  @param[in]      ok          Result of the check (non-zero = passed).
+ *  @param[in]      description Short description for displaying in console output.
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
  */
-static void RunAllTests(void)
+static void ReportCheck(const char* group, unsigned int id, boolean ok, const char* description,
+                        unsigned int* passCount, unsigned int* failCount)
 {
-    unsigned int passCount = 0u;
-    unsigned int failCount = 0u;
-    unsigned int i;
+    if (ok != 0U)
+    {
+        printf("[PASS] %s_%02u: %s\n", group, id, description);
+        if (passCount != NULL)
+        {
+            (*passCount)++;
+        }
+    }
+    else
+    {
+        printf("[FAIL] %s_%02u: %s\n", group, id, description);
+        if (failCount != NULL)
+        {
+            (*failCount)++;
+        }
+    }
+}
 
-    /* Test vector definition.
-     * The expected values are approximate and tolerances are defined according to the fixed-point resolution.
-     */
-    static const TestVector_t tests[] =
+/*********************************************************************************************************************/
+/*! @brief     Checks of the batch kernels and the tensor broadcasting.
+ *
+ *  A [batch, channel, time] signal is scaled by per-channel gains of shape [channel, 1]
+ *  and compared element by element with the scalar float API. Further checks cover
+ *  partial execution over the outer range, rejection of incompatible shapes and the
+ *  non-temporal path of the batch kernels.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunTensorTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 signal[2 * 3 * 5];
+    static t_Fixed16 result[2 * 3 * 5];
+    static t_Fixed16 resultPartial[2 * 3 * 5];
+    t_Fixed16 gains[3] = { (t_Fixed16)(SCALE_16 / 2U), (t_Fixed16)(2U * SCALE_16), (t_Fixed16)(-(sint32)SCALE_16) };
+    const uint32 shapeSignal[3] = { 2U, 3U, 5U };
+    const uint32 shapeGain[2] = { 3U, 1U };
+    const uint32 shapeBad[2] = { 2U, 1U };
+    FixedPoint_Tensor16_t tSignal;
+    FixedPoint_Tensor16_t tGain;
+    FixedPoint_Tensor16_t tResult;
+    FixedPoint_Tensor16_t tResultPartial;
+    FixedPoint_Tensor16_t tBad;
+    Std_ReturnType status;
+    uint32 outerCount = 0U;
+    uint32 i;
+    boolean ok = 1U;
+
+    printf("\n--- MODULE CHECKS: TENSOR ---\n");
+
+    for (i = 0U; i < (2U * 3U * 5U); i++)
     {
-        /* 16-bit : Typical arithmetic (calibrated for default Q7.8) */
-        {  100.5f,  20.22f, 120.72f,  TEST_EPSILON_16, "16-bit add: typical range",          TEST_OP_ADD, TEST_WIDTH_16, E_OK },
-        {  10.0f,   3.0f,   7.0f,    TEST_EPSILON_16, "16-bit sub: typical range",          TEST_OP_SUB, TEST_WIDTH_16, E_OK },
-        {   2.0f,   (-1.55f),   (-3.1f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
-        {   2.0f,   (1.55f),   (3.1f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
-        {   13.50f,   (8.50f),   (114.75f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
-        {  11.2f,   (-7.0f),   (-1.6f),    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
-        {  8.0f,   (3.0f),   (2.666f),    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
-        {  1.99f,   (5.373f), (0.3704f)  ,    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
-        
+        signal[i] = (t_Fixed16)(((sint32)i - 12) * (sint32)(SCALE_16 / 4U));
+    }
 
-        /* 16-bit Saturation Cases (Configuration aware)*/
-        {  20000.0f, 20000.0f,   FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: positive saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
-        { (-20000.0f),(-20000.0f), FIX16_REAL_MIN ,  TEST_EPSILON_16, "16-bit add: negative saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
-        { 20000.0f, 2.0f, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit mul: positive saturation", TEST_OP_MUL, TEST_WIDTH_16, E_NOT_OK },
-        { (-20000.0f), 2.0f, FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit mul: negative saturation", TEST_OP_MUL, TEST_WIDTH_16, E_NOT_OK },
+    (void)FixedPoint_Tensor16_Init(&tSignal, signal, 3U, shapeSignal);
+    (void)FixedPoint_Tensor16_Init(&tGain, gains, 2U, shapeGain);
+    (void)FixedPoint_Tensor16_Init(&tResult, result, 3U, shapeSignal);
+    (void)FixedPoint_Tensor16_Init(&tResultPartial, resultPartial, 3U, shapeSignal);
 
-        /* 16-bit Boundary Cases (Configuration aware)*/        
-        /* Exact boundary representability */
-        { FIX16_REAL_MAX, 0.0f, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: exact MAX boundary", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
-        { FIX16_REAL_MIN, 0.0f, FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit add: exact MIN boundary", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
-        /* Just over boundary saturation (1 LSB above MAX and below MIN)*/
-        { FIX16_REAL_MAX, FIX16_RESOLUTION, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: MAX + 1 LSB -> saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
-        { FIX16_REAL_MIN, (-FIX16_RESOLUTION), FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit add: MIN - 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK},
+    /* Per-channel gain broadcast against the scalar float API */
+    status = FixedPoint_Tensor16_Op(FIXEDPOINT_OP_MULT, &tSignal, &tGain, &tResult);
+    for (i = 0U; i < (2U * 3U * 5U); i++)
+    {
+        float expected = 0.0f;
+        const uint32 channel = (i / 5U) % 3U;
 
-        /*16-bit: Rounding midpoint (tie) behaviour (ties away from zero)  (Configuration aware)*/
-       { (0.5f * FIX16_RESOLUTION), 0.0f, FIX16_RESOLUTION, TEST_EPSILON_16, "16-bit add: +0.5 LSB rounds to +1 LSB", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
-       { (-0.5f * FIX16_RESOLUTION), 0.0f, (-FIX16_RESOLUTION), TEST_EPSILON_16, "16-bit add: -0.5 LSB rounds to -1 LSB", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
- 
-        /* 16-bit :  Precision underflow (values below half of resolution, Configuration aware) */
-        {   FIX16_BELOW_RES,  FIX16_BELOW_RES,  0.0f ,  TEST_EPSILON_16,  "16-bit add: below resolution",         TEST_OP_ADD, TEST_WIDTH_16,  E_OK },
+        (void)FixedPoint_Mult16((float)signal[i] / (float)SCALE_16, (float)gains[channel] / (float)SCALE_16, &expected);
+        if ((float)result[i] != (expected * (float)SCALE_16))
+        {
+            ok = 0U;
+        }
+    }
+    ReportCheck("TENSOR", 1U, (boolean)((status == E_OK) && (ok != 0U)),
+                "[2,3,5] x [3,1] per-channel gain matches scalar FixedPoint_Mult16", passCount, failCount);
+
+    /* Partial execution over two disjoint outer ranges gives the same result */
+    status = FixedPoint_Tensor16_GetOuterCount(&tSignal, &tGain, &tResultPartial, &outerCount);
+    status |= FixedPoint_Tensor16_OpPartial(FIXEDPOINT_OP_MULT, &tSignal, &tGain, &tResultPartial, 0U, outerCount / 2U);
+    status |= FixedPoint_Tensor16_OpPartial(FIXEDPOINT_OP_MULT, &tSignal, &tGain, &tResultPartial,
+                                            outerCount / 2U, outerCount - (outerCount / 2U));
+    ok = (status == E_OK) ? 1U : 0U;
+    for (i = 0U; i < (2U * 3U * 5U); i++)
+    {
+        if (result[i] != resultPartial[i])
+        {
+            ok = 0U;
+        }
+    }
+    ReportCheck("TENSOR", 2U, ok, "split outer range equals full operation", passCount, failCount);
 
-        /* 16-bit : Division by zero */
-        {  10.0f,   0.0f,   0.0f,  TEST_EPSILON_16, "16-bit div: division by zero",        TEST_OP_DIV, TEST_WIDTH_16, E_NOT_OK },
+    /* Incompatible shapes are rejected */
+    (void)FixedPoint_Tensor16_Init(&tBad, gains, 2U, shapeBad);
+    status = FixedPoint_Tensor16_Op(FIXEDPOINT_OP_ADD, &tSignal, &tBad, &tResult);
+    ReportCheck("TENSOR", 3U, (boolean)(status == E_NOT_OK), "[2,3,5] + [2,1] rejected as not broadcastable",
+                passCount, failCount);
 
-        /* 8-bit : Typical arithmetic within range (calibrated for default Q3.4) */
-        {   2.0f,   3.5f,   5.5f,  TEST_EPSILON_8,  "8-bit add: typical range",            TEST_OP_ADD, TEST_WIDTH_8,  E_OK },
-        {   4.0f,   6.0f,  (-2.0f),  TEST_EPSILON_8,  "8-bit sub: typical range",            TEST_OP_SUB, TEST_WIDTH_8,  E_OK },
-        {   2.0f,   -3.12f,   -6.24f,  TEST_EPSILON_8,  "8-bit mul: typical range",            TEST_OP_MUL, TEST_WIDTH_8,  E_OK },
-        {   2.0f,   3.12f,   6.24f,  TEST_EPSILON_8,  "8-bit mul: typical range",            TEST_OP_MUL, TEST_WIDTH_8,  E_OK },
-        {   5.0f,   2.0f,   2.5f,  TEST_EPSILON_8,  "8-bit div: typical range",            TEST_OP_DIV, TEST_WIDTH_8,  E_OK },
-        {   5.0f,   (-2.0f),   (-2.5f),  TEST_EPSILON_8,  "8-bit div: typical range",            TEST_OP_DIV, TEST_WIDTH_8,  E_OK},
-         {  7.9f,   (2.0f),   (3.95f),    TEST_EPSILON_8, "8-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_8, E_OK },
-        {  1.99f,   (5.373f), (0.3704f)  ,    TEST_EPSILON_8, "8-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_8, E_OK },
-        
-        
+    /* Saturation and division by zero reported by the batch kernel */
+    {
+        const t_Fixed16 num[2] = { FIX16_MAX, (t_Fixed16)SCALE_16 };
+        const t_Fixed16 den[2] = { (t_Fixed16)SCALE_16, 0 };
+        t_Fixed16 quot[2] = { 0, 0 };
 
+        status = FixedPoint_Div16_Array(num, den, quot, 2U);
+        ReportCheck("TENSOR", 4U, (boolean)((status == E_NOT_OK) && (quot[0] == FIX16_MAX) && (quot[1] == FIX16_MAX)),
+                    "batch division by zero saturates and reports E_NOT_OK", passCount, failCount);
+    }
 
-        /* 8-bit: Saturation cases (Configuration aware) */
-        {   250.0f,   310.0f,   FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: positive saturation",      TEST_OP_ADD, TEST_WIDTH_8,  E_NOT_OK },
-        {  (-250.0f),  (-310.0f),  FIX8_REAL_MIN,  TEST_EPSILON_8,  "8-bit add: negative saturation",      TEST_OP_ADD, TEST_WIDTH_8,  E_NOT_OK },
-        { 300.0f, 2.0f, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit mul: positive saturation ", TEST_OP_MUL, TEST_WIDTH_8, E_NOT_OK },
-        { (-300.0f), 2.0f, FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit mul: negative saturation", TEST_OP_MUL, TEST_WIDTH_8, E_NOT_OK },
+    /* Non-temporal path of the batch kernels gives the same results and status as the regular path */
+    {
+        static t_Fixed16 x[1001];
+        static t_Fixed16 y[1001];
+        static t_Fixed16 rRegular[1001];
+        static t_Fixed16 rStreamed[1001];
+        const uint32 threshold = FixedPoint_GetNonTemporalThreshold();
+        uint32 op;
+
+        for (i = 0U; i < 1001U; i++)
+        {
+            x[i] = (t_Fixed16)((sint32)((i * 2654435761U) & 0xFFFFU) - 32768);
+            y[i] = ((i % 97U) == 0U) ? (t_Fixed16)0 : (t_Fixed16)((sint32)((i * 40503U) & 0x3FFU) - 512);
+        }
 
+        ok = 1U;
+        for (op = 0U; op <= (uint32)FIXEDPOINT_OP_DIV; op++)
+        {
+            Std_ReturnType statusStreamed;
+
+            /* Odd start element: the streamed call covers the unaligned head, full blocks and the tail */
+            FixedPoint_SetNonTemporalThreshold(1U);
+            statusStreamed = FixedPoint_Op16_Strided((FixedPoint_Operation_t)op, &x[1], 1, &y[1], 1, &rStreamed[1], 1,
+                                                     1000U);
+            FixedPoint_SetNonTemporalThreshold(0U);
+            status = FixedPoint_Op16_Strided((FixedPoint_Operation_t)op, &x[1], 1, &y[1], 1, rRegular, 1, 1000U);
+            ok &= (status == statusStreamed) ? 1U : 0U;
+            for (i = 0U; i < 1000U; i++)
+            {
+                ok &= (rRegular[i] == rStreamed[i + 1U]) ? 1U : 0U;
+            }
+        }
+        FixedPoint_SetNonTemporalThreshold(threshold);
+        ReportCheck("TENSOR", 5U, ok, "non-temporal batch kernels equal the regular path for all operations",
+                    passCount, failCount);
+    }
+}
 
-        /* 8-bit Boundary Cases (Configuration aware)*/
-        /* Exact boundary representability */
-        { FIX8_REAL_MAX, 0.0f, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: exact MAX boundary", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
-        { FIX8_REAL_MIN, 0.0f, FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit add: exact MIN boundary", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
-        /* Just over boundary saturation (1 LSB above MAX and below MIN)*/
-        { FIX8_REAL_MAX, FIX8_RESOLUTION, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: MAX + 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_8, E_NOT_OK },
-        { FIX8_REAL_MIN, (-FIX8_RESOLUTION), FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit add: MIN - 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_8, E_NOT_OK},
+/*********************************************************************************************************************/
+/*! @brief     Checks of the incremental dependency graph.
+ *
+ *  Graph with inputs x, y, k and derived nodes s = x + y, p = s * x, q = y / k, evaluated for
+ *  4 instances. After changing only x, only s and p must be recomputed; values are compared
+ *  with the scalar float API.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunGraphTests(unsigned int* passCount, unsigned int* failCount)
+{
+    FixedPoint_GraphNode_t nodes[6];
+    t_Fixed16 values[6 * 4];
+    FixedPoint_Graph_t graph;
+    const t_Fixed16 xs[4] = { (t_Fixed16)SCALE_16, (t_Fixed16)(2U * SCALE_16), (t_Fixed16)(-3 * (sint32)SCALE_16), 0 };
+    const t_Fixed16 ys[4] = { (t_Fixed16)(SCALE_16 / 2U), (t_Fixed16)SCALE_16, (t_Fixed16)SCALE_16, (t_Fixed16)(4U * SCALE_16) };
+    const t_Fixed16 ks[4] = { (t_Fixed16)(2U * SCALE_16), (t_Fixed16)(2U * SCALE_16), (t_Fixed16)(2U * SCALE_16), (t_Fixed16)(2U * SCALE_16) };
+    uint32 x = 0U;
+    uint32 y = 0U;
+    uint32 k = 0U;
+    uint32 sNode = 0U;
+    uint32 pNode = 0U;
+    uint32 qNode = 0U;
+    uint32 recomputed = 0U;
+    Std_ReturnType status;
+    t_Fixed16 value = 0;
+    float expected = 0.0f;
+    uint32 i;
+    boolean ok = 1U;
+
+    printf("\n--- MODULE CHECKS: GRAPH ---\n");
+
+    status = FixedPoint_Graph_Init(&graph, nodes, 6U, values, 4U);
+    status |= FixedPoint_Graph_AddInput(&graph, &x);
+    status |= FixedPoint_Graph_AddInput(&graph, &y);
+    status |= FixedPoint_Graph_AddInput(&graph, &k);
+    status |= FixedPoint_Graph_AddOp(&graph, FIXEDPOINT_OP_ADD, x, y, &sNode);
+    status |= FixedPoint_Graph_AddOp(&graph, FIXEDPOINT_OP_MULT, sNode, x, &pNode);
+    status |= FixedPoint_Graph_AddOp(&graph, FIXEDPOINT_OP_DIV, y, k, &qNode);
+    status |= FixedPoint_Graph_SetInputArray(&graph, x, xs);
+    status |= FixedPoint_Graph_SetInputArray(&graph, y, ys);
+    status |= FixedPoint_Graph_SetInputArray(&graph, k, ks);
+    status |= FixedPoint_Graph_Evaluate(&graph, &recomputed);
+    ReportCheck("GRAPH", 1U, (boolean)((status == E_OK) && (recomputed == 3U)),
+                "first evaluation computes all operation nodes", passCount, failCount);
+
+    status = FixedPoint_Graph_SetInput(&graph, x, 2U, (t_Fixed16)(5U * SCALE_16));
+    status |= FixedPoint_Graph_Evaluate(&graph, &recomputed);
+    ReportCheck("GRAPH", 2U, (boolean)((status == E_OK) && (recomputed == 2U)),
+                "changing x recomputes only x + y and (x + y) * x", passCount, failCount);
+
+    for (i = 0U; i < 4U; i++)
+    {
+        const float xf = (i == 2U) ? 5.0f : ((float)xs[i] / (float)SCALE_16);
+        const float yf = (float)ys[i] / (float)SCALE_16;
+        float sum = 0.0f;
+
+        (void)FixedPoint_Add16(xf, yf, &sum);
+        (void)FixedPoint_Mult16(sum, xf, &expected);
+        (void)FixedPoint_Graph_GetValue(&graph, pNode, i, &value);
+        if (((float)value / (float)SCALE_16) != expected)
+        {
+            ok = 0U;
+        }
+    }
+    ReportCheck("GRAPH", 3U, ok, "derived values of all instances match the scalar float API", passCount, failCount);
 
-        /*8-bit: Rounding midpoint (tie) behaviour (ties away from zero)  (Configuration aware)*/
-       { (0.5f * FIX8_RESOLUTION), 0.0f, FIX8_RESOLUTION, TEST_EPSILON_8, "8-bit add: +0.5 LSB rounds to +1 LSB", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
-       { (-0.5f * FIX8_RESOLUTION), 0.0f, (-FIX8_RESOLUTION), TEST_EPSILON_8, "8-bit add: -0.5 LSB rounds to -1 LSB", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
+    status = FixedPoint_Graph_SetInput(&graph, y, 0U, (t_Fixed16)(SCALE_16 / 2U));
+    status |= FixedPoint_Graph_Evaluate(&graph, &recomputed);
+    ReportCheck("GRAPH", 4U, (boolean)((status == E_OK) && (recomputed == 0U)),
+                "setting an unchanged input value recomputes nothing", passCount, failCount);
+}
 
+/*********************************************************************************************************************/
+/*! @brief     Completion callback of the job queue checks, counts completed jobs.
+ *
+ *  @param[in]  handle      Handle of the completed job (unused).
+ *  @param[in]  status      Job status (unused).
+ *  @param[in]  context     Pointer to the completion counter (uint32).
+ */
+static void JobTestCallback(FixedPoint_JobHandle_t handle, Std_ReturnType status, void* context)
+{
+    (void)handle;
+    (void)status;
 
-        /* 8-bit Precision underflow (values below half of resolution, Configuration aware) */
-        {   FIX8_BELOW_RES,  FIX8_BELOW_RES,  0.0f ,  TEST_EPSILON_8,  "8-bit add: below resolution",         TEST_OP_ADD, TEST_WIDTH_8,  E_OK },
-       
+    if (context != NULL)
+    {
+        (*(uint32*)context)++;
+    }
+}
 
-        /* 8-bit : Division by zero */
-        {   5.0f,   0.0f,   0.0f,  TEST_EPSILON_8,  "8-bit div: division by zero",         TEST_OP_DIV, TEST_WIDTH_8,  E_NOT_OK }
-    };
+/*********************************************************************************************************************/
+/*! @brief     Thread of the concurrent job queue check: submits jobs one after the other and waits for each.
+ *
+ *  The waiting thread processes any pending job, so the jobs of all threads are executed by all threads.
+ *
+ *  @param[in,out]  arg     JobTestThread_t of the thread.
+ *
+ *  @return     0.
+ */
+static DWORD WINAPI JobTestWorker(LPVOID arg)
+{
+    JobTestThread_t* thread = (JobTestThread_t*)arg;
+    FixedPoint_JobDesc_t desc;
+    FixedPoint_JobHandle_t handle;
+    Std_ReturnType status;
+    uint32 n;
+    uint32 i;
+
+    desc.kind = FIXEDPOINT_JOB_OP16;
+    desc.op = FIXEDPOINT_OP_ADD;
+    desc.in1 = thread->in;
+    desc.in2 = thread->in;
+    desc.out = thread->out;
+    desc.len = JOB_TEST_LEN;
+    desc.fir = NULL;
+    desc.callback = NULL;
+    desc.context = NULL;
+
+    for (n = 0U; n < JOB_TEST_JOBS; n++)
+    {
+        for (i = 0U; i < JOB_TEST_LEN; i++)
+        {
+            thread->in[i] = (t_Fixed16)(n + i);
+        }
 
-    const unsigned int numTests = (unsigned int)(sizeof(tests) / sizeof(tests[0]));
+        if ((FixedPoint_Job_Submit(thread->queue, &desc, &handle) != E_OK) ||
+            (FixedPoint_Job_Wait(thread->queue, handle, &status) != E_OK) || (status != E_OK))
+        {
+            thread->errors++;
+        }
+        else
+        {
+            for (i = 0U; i < JOB_TEST_LEN; i++)
+            {
+                thread->errors += (thread->out[i] != (t_Fixed16)(2U * (n + i))) ? 1U : 0U;
+            }
+        }
+    }
 
-    printf("--- FIXED POINT ARITHMETIC TEST REPORT ---\n\n");
+    return 0U;
+}
 
-    for (i = 0u; i < numTests; i++)
+/*********************************************************************************************************************/
+/*! @brief     Checks of the asynchronous job queue.
+ *
+ *  Three adjacent multiplication jobs must be coalesced and give the same result as the batch
+ *  kernel; a saturating member fails the whole group, which is executed once. Waiting on a FIR
+ *  job, callback completion and threads submitting and waiting at the same time are checked as well.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunJobTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static FixedPoint_JobQueue_t queue;
+    t_Fixed16 a[12];
+    t_Fixed16 b[12];
+    t_Fixed16 r[12];
+    t_Fixed16 expected[12];
+    const t_Fixed16 coeffs[3] = { (t_Fixed16)(SCALE_16 / 4U), (t_Fixed16)(SCALE_16 / 2U), (t_Fixed16)(SCALE_16 / 4U) };
+    t_Fixed16 delay[2];
+    t_Fixed16 firOut[12];
+    FixedPoint_Fir16_t fir;
+    FixedPoint_JobDesc_t desc;
+    FixedPoint_JobHandle_t handles[3];
+    Std_ReturnType jobStatus[3] = { E_NOT_OK, E_NOT_OK, E_NOT_OK };
+    uint32 callbacks = 0U;
+    uint32 i;
+    boolean ok = 1U;
+
+    printf("\n--- MODULE CHECKS: JOB QUEUE ---\n");
+
+    for (i = 0U; i < 12U; i++)
     {
-        /* Run each test case */
-        RunSingleTest(&tests[i], i + 1u, &passCount, &failCount);
+        a[i] = (t_Fixed16)(((sint32)i - 6) * (sint32)SCALE_16);
+        b[i] = (t_Fixed16)(SCALE_16 / 2U);
     }
+    a[11] = FIX16_MAX;
+    b[11] = (t_Fixed16)(2U * SCALE_16);
+    (void)FixedPoint_Mult16_Array(a, b, expected, 12U);
+
+    (void)FixedPoint_Job_Init(&queue);
+    desc.kind = FIXEDPOINT_JOB_OP16;
+    desc.op = FIXEDPOINT_OP_MULT;
+    desc.len = 4U;
+    desc.fir = NULL;
+    desc.callback = NULL;
+    desc.context = NULL;
+    for (i = 0U; i < 3U; i++)
+    {
+        desc.in1 = &a[i * 4U];
+        desc.in2 = &b[i * 4U];
+        desc.out = &r[i * 4U];
+        (void)FixedPoint_Job_Submit(&queue, &desc, &handles[i]);
+    }
+    (void)FixedPoint_Job_Process(&queue, 8U, NULL);
+    for (i = 0U; i < 3U; i++)
+    {
+        boolean done = 0U;
 
-    printf("\n--- SUMMARY ---\n");
-    printf("Total tests : %u\n", numTests);
-    printf("Passed      : %u\n", passCount);
-    printf("Failed      : %u\n", failCount);
+        if ((FixedPoint_Job_Poll(&queue, handles[i], &done, &jobStatus[i]) != E_OK) || (done == 0U))
+        {
+            ok = 0U;
+        }
+    }
+    for (i = 0U; i < 12U; i++)
+    {
+        if (r[i] != expected[i])
+        {
+            ok = 0U;
+        }
+    }
+    ReportCheck("JOB", 1U, (boolean)((ok != 0U) && (queue.coalesced == 2U)),
+                "three adjacent jobs coalesced, results equal the batch kernel", passCount, failCount);
+    ReportCheck("JOB", 2U, (boolean)((jobStatus[0] == E_NOT_OK) && (jobStatus[1] == E_NOT_OK) &&
+                                     (jobStatus[2] == E_NOT_OK)),
+                "saturating member fails every job of its coalesced group", passCount, failCount);
+
+    /* FIR job collected with wait (processing done by the waiting context) */
+    (void)FixedPoint_Fir16_Init(&fir, coeffs, 3U, delay);
+    desc.kind = FIXEDPOINT_JOB_FIR16;
+    desc.in1 = a;
+    desc.in2 = NULL;
+    desc.out = firOut;
+    desc.len = 8U;
+    desc.fir = &fir;
+    (void)FixedPoint_Job_Submit(&queue, &desc, &handles[0]);
+    ok = (FixedPoint_Job_Wait(&queue, handles[0], &jobStatus[0]) == E_OK) ? 1U : 0U;
+    ok &= (firOut[4] == (t_Fixed16)(-3 * (sint32)SCALE_16)) ? 1U : 0U;
+    ok &= (FixedPoint_Job_Wait(&queue, handles[0], &jobStatus[0]) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("JOB", 3U, ok, "FIR job completed by wait, handle released afterwards", passCount, failCount);
+
+    /* Callback completion */
+    desc.kind = FIXEDPOINT_JOB_DOT16;
+    desc.in1 = a;
+    desc.in2 = b;
+    desc.out = &r[0];
+    desc.len = 4U;
+    desc.fir = NULL;
+    desc.callback = &JobTestCallback;
+    desc.context = &callbacks;
+    (void)FixedPoint_Job_Submit(&queue, &desc, &handles[0]);
+    (void)FixedPoint_Job_Submit(&queue, &desc, &handles[1]);
+    (void)FixedPoint_Job_Process(&queue, 8U, NULL);
+    ReportCheck("JOB", 4U, (boolean)((callbacks == 2U) && (r[0] == (t_Fixed16)(-9 * (sint32)SCALE_16))),
+                "dot product jobs complete through the callback", passCount, failCount);
+
+    /* Adjacent in-place jobs, the second one saturating: applied once each, own status */
+    for (i = 0U; i < 8U; i++)
+    {
+        a[i] = 100;
+        b[i] = 10;
+    }
+    a[7] = 32760;
+    desc.kind = FIXEDPOINT_JOB_OP16;
+    desc.op = FIXEDPOINT_OP_ADD;
+    desc.len = 4U;
+    desc.callback = NULL;
+    desc.context = NULL;
+    queue.coalesced = 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        desc.in1 = &a[i * 4U];
+        desc.in2 = &b[i * 4U];
+        desc.out = &a[i * 4U];
+        (void)FixedPoint_Job_Submit(&queue, &desc, &handles[i]);
+    }
+    (void)FixedPoint_Job_Process(&queue, 8U, NULL);
+    ok = (queue.coalesced == 0U) ? 1U : 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        boolean done = 0U;
+
+        ok &= ((FixedPoint_Job_Poll(&queue, handles[i], &done, &jobStatus[i]) == E_OK) && (done != 0U)) ? 1U : 0U;
+    }
+    for (i = 0U; i < 7U; i++)
+    {
+        ok &= (a[i] == 110) ? 1U : 0U;
+    }
+    ok &= ((a[7] == FIX16_MAX) && (jobStatus[0] == E_OK) && (jobStatus[1] == E_NOT_OK)) ? 1U : 0U;
+    ReportCheck("JOB", 5U, ok, "saturating in-place jobs not coalesced, applied once with their own status",
+                passCount, failCount);
+
+    /* Threads submitting and waiting at the same time; every waiting thread also processes */
+    {
+        static JobTestThread_t threads[JOB_TEST_THREADS];
+        HANDLE handlesT[JOB_TEST_THREADS];
+        uint32 t;
+
+        (void)FixedPoint_Job_Init(&queue);
+        for (t = 0U; t < JOB_TEST_THREADS; t++)
+        {
+            threads[t].queue = &queue;
+            threads[t].errors = 0U;
+        }
+        for (t = 1U; t < JOB_TEST_THREADS; t++)
+        {
+            handlesT[t] = CreateThread(NULL, 0U, JobTestWorker, &threads[t], 0U, NULL);
+        }
+        (void)JobTestWorker(&threads[0]);
+        (void)WaitForMultipleObjects((DWORD)(JOB_TEST_THREADS - 1U), &handlesT[1], TRUE, INFINITE);
+
+        ok = 1U;
+        for (t = 0U; t < JOB_TEST_THREADS; t++)
+        {
+            if (t > 0U)
+            {
+                (void)CloseHandle(handlesT[t]);
+            }
+            ok &= (threads[t].errors == 0U) ? 1U : 0U;
+        }
+        for (i = 0U; i < FIXEDPOINT_JOB_QUEUE_SIZE; i++)
+        {
+            ok &= ((queue.slots[i].claim == 0U) && (queue.pending[i] == 0U)) ? 1U : 0U;
+        }
+        ReportCheck("JOB", 6U, ok, "concurrent submitters and waiters get their own results, all slots released",
+                    passCount, failCount);
+    }
 }
 
-/***********************************************************************************************************************
- GLOBAL FUNCTIONS
- **********************************************************************************************************************/
+/*********************************************************************************************************************/
+/*! @brief     Checks of the block-based streaming pipeline.
+ *
+ *  A pipeline source -> gain -> FIR -> sink with a block length that does not divide the stream
+ *  length must produce the same samples as the batch kernels applied to the whole array.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunStreamTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 input[100];
+    static t_Fixed16 output[100];
+    static t_Fixed16 expected[100];
+    static t_Fixed16 gain[100];
+    static t_Fixed16 scaled[100];
+    t_Fixed16 bufA[16];
+    t_Fixed16 bufB[16];
+    const t_Fixed16 coeffs[3] = { (t_Fixed16)(SCALE_16 / 4U), (t_Fixed16)(SCALE_16 / 2U), (t_Fixed16)(SCALE_16 / 4U) };
+    t_Fixed16 delayRef[2];
+    t_Fixed16 delay[2];
+    FixedPoint_Fir16_t firRef;
+    FixedPoint_Fir16_t fir;
+    FixedPoint_Stream_t stream;
+    FixedPoint_StreamArraySource_t source;
+    FixedPoint_StreamArraySink_t sink;
+    FixedPoint_StreamScalarOp_t scale;
+    FixedPoint_StreamFile_t fileStage;
+    Std_ReturnType ret;
+    uint32 steps = 0U;
+    boolean end = 0U;
+    boolean ok = 1U;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: STREAMING PIPELINE ---\n");
+
+    for (i = 0U; i < 100U; i++)
+    {
+        input[i] = (t_Fixed16)((sint32)((i * 37U) % 200U) * 16 - 1600);
+        gain[i] = (t_Fixed16)(SCALE_16 / 2U);
+        output[i] = 0;
+    }
+    (void)FixedPoint_Mult16_Array(input, gain, scaled, 100U);
+    (void)FixedPoint_Fir16_Init(&firRef, coeffs, 3U, delayRef);
+    (void)FixedPoint_Fir16(&firRef, scaled, expected, 100U);
+
+    source.data = input;
+    source.len = 100U;
+    source.pos = 0U;
+    sink.data = output;
+    sink.capacity = 100U;
+    sink.pos = 0U;
+    scale.op = FIXEDPOINT_OP_MULT;
+    scale.operand = (t_Fixed16)(SCALE_16 / 2U);
+    (void)FixedPoint_Fir16_Init(&fir, coeffs, 3U, delay);
+
+    ret = FixedPoint_Stream_Init(&stream, bufA, bufB, 16U);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySource, &source);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ScalarOp, &scale);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_Fir, &fir);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySink, &sink);
+
+    while ((end == 0U) && (steps < 100U))
+    {
+        ret |= FixedPoint_Stream_Step(&stream, &end);
+        steps++;
+    }
+    for (i = 0U; i < 100U; i++)
+    {
+        if (output[i] != expected[i])
+        {
+            ok = 0U;
+        }
+    }
+    ReportCheck("STREAM", 1U, (boolean)((ret == E_OK) && (ok != 0U) && (steps == 7U) && (sink.pos == 100U)),
+                "source -> gain -> FIR -> sink equals the batch kernels over the whole array", passCount, failCount);
+
+    ret = FixedPoint_Stream_Step(&stream, &end);
+    ReportCheck("STREAM", 2U, (boolean)((ret == E_OK) && (end != 0U) && (sink.pos == 100U)),
+                "finished pipeline is not resumed", passCount, failCount);
+
+    /* Round trip through a temporary file: array -> file, file -> array */
+    fileStage.file = tmpfile();
+    fileStage.samples = 0U;
+    ok = (fileStage.file != NULL) ? 1U : 0U;
+    if (ok != 0U)
+    {
+        source.pos = 0U;
+        sink.pos = 0U;
+        ret = FixedPoint_Stream_Init(&stream, bufA, bufB, 16U);
+        ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySource, &source);
+        ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_FileSink, &fileStage);
+        ret |= FixedPoint_Stream_Run(&stream);
+        rewind(fileStage.file);
+        fileStage.samples = 0U;
+        ret |= FixedPoint_Stream_Init(&stream, bufA, bufB, 16U);
+        ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_FileSource, &fileStage);
+        ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySink, &sink);
+        ret |= FixedPoint_Stream_Run(&stream);
+        (void)fclose(fileStage.file);
+        ok = ((ret == E_OK) && (fileStage.samples == 100U) && (memcmp(output, input, sizeof(input)) == 0)) ? 1U : 0U;
+    }
+    ReportCheck("STREAM", 3U, ok, "file sink and file source round trip", passCount, failCount);
+}
 
- /*********************************************************************************************************************/
- /*! @brief        Main entry point for the FixedPoint test suite.
-  *
-  *  This function executes all predefined test vectors for both 16-bit and
-  *  8 bit fixed-point arithmetic. The test results are printed to the console
-  *  as PASS/FAIL. Afterwards, the application waits for a key press
-  *  before terminating, so that output remains visible.
-  *
-  *  @return       int
-  *
-  *  @retval       0            Execution finished successfully.
-  */
-int main(void)
+/*********************************************************************************************************************/
+/*! @brief     Checks of the compute service on a region shared by two clients.
+ *
+ *  With a quota of one request, one serve call must complete one request of each client even if
+ *  the first client has a longer backlog. Adjacent requests must be coalesced with results equal
+ *  to the batch kernel, a saturating member fails its whole group, and requests outside of the
+ *  region must be rejected, also after a client has overwritten the bounds in the region header.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunServiceTests(unsigned int* passCount, unsigned int* failCount)
 {
-    RunAllTests();
+    static uint32 region[2048];
+    const uint32 size = (uint32)sizeof(region);
+    FixedPoint_ServiceRegion_t* const header = (FixedPoint_ServiceRegion_t*)(void*)region;
+    FixedPoint_ServiceServer_t server;
+    FixedPoint_ServiceRequest_t request;
+    t_Fixed16 expected[12];
+    t_Fixed16* a;
+    t_Fixed16* b;
+    t_Fixed16* r;
+    uint32 dataOffset = 0U;
+    uint32 seq[4] = { 0U, 0U, 0U, 0U };
+    uint32 served = 0U;
+    boolean done[4] = { 0U, 0U, 0U, 0U };
+    Std_ReturnType status[4] = { E_NOT_OK, E_NOT_OK, E_NOT_OK, E_NOT_OK };
+    Std_ReturnType ret;
+    boolean ok = 1U;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: COMPUTE SERVICE ---\n");
+
+    ret = FixedPoint_Service_Init(&server, region, size, 2U);
+    ret |= FixedPoint_Service_Attach(region, size, &dataOffset);
+
+    /* Client side: arrays a, b, r of 12 elements in the data area */
+    a = (t_Fixed16*)(void*)((uint8*)region + dataOffset);
+    b = &a[12];
+    r = &a[24];
+    for (i = 0U; i < 12U; i++)
+    {
+        a[i] = (t_Fixed16)(((sint32)i - 6) * (sint32)SCALE_16);
+        b[i] = (t_Fixed16)(3U * SCALE_16 / 2U);
+        r[i] = 0;
+    }
+    (void)FixedPoint_Mult16_Array(a, b, expected, 12U);
+
+    /* Client 0: three adjacent requests of 4 elements, client 1: one request */
+    request.op = (uint32)FIXEDPOINT_OP_MULT;
+    request.len = 4U;
+    for (i = 0U; i < 3U; i++)
+    {
+        request.offsetA = dataOffset + (i * 8U);
+        request.offsetB = request.offsetA + 24U;
+        request.offsetR = request.offsetA + 48U;
+        ret |= FixedPoint_Service_Submit(region, 0U, &request, &seq[i]);
+    }
+    request.op = (uint32)FIXEDPOINT_OP_ADD;
+    request.offsetA = dataOffset;
+    request.offsetB = dataOffset;
+    request.offsetR = dataOffset + 72U;
+    ret |= FixedPoint_Service_Submit(region, 1U, &request, &seq[3]);
+
+    ret |= FixedPoint_Service_Serve(&server, 1U, &served);
+    ret |= FixedPoint_Service_Poll(region, 0U, seq[0], &done[0], &status[0]);
+    ret |= FixedPoint_Service_Poll(region, 0U, seq[1], &done[1], &status[1]);
+    ret |= FixedPoint_Service_Poll(region, 1U, seq[3], &done[3], &status[3]);
+    ReportCheck("SERVICE", 1U, (boolean)((ret == E_OK) && (served == 2U) && (done[0] != 0U) && (done[1] == 0U) &&
+                                         (done[3] != 0U) && (status[3] == E_OK) && (a[36] == (t_Fixed16)(-12 * (sint32)SCALE_16))),
+                "quota 1 serves one request of each client per round", passCount, failCount);
+
+    ret = FixedPoint_Service_Serve(&server, 8U, &served);
+    for (i = 0U; i < 3U; i++)
+    {
+        ret |= FixedPoint_Service_Poll(region, 0U, seq[i], &done[i], &status[i]);
+        ok &= ((done[i] != 0U) && (status[i] == E_OK)) ? 1U : 0U;
+    }
+    for (i = 0U; i < 12U; i++)
+    {
+        ok &= (r[i] == expected[i]) ? 1U : 0U;
+    }
+    ReportCheck("SERVICE", 2U, (boolean)((ret == E_OK) && (ok != 0U) && (served == 2U) && (header->coalesced == 1U)),
+                "adjacent requests coalesced, results equal the batch kernel", passCount, failCount);
+
+    /* Result array reaching past the end of the region */
+    request.offsetR = size - 4U;
+    ret = FixedPoint_Service_Submit(region, 1U, &request, &seq[3]);
+    ret |= FixedPoint_Service_Serve(&server, 8U, NULL);
+    ret |= FixedPoint_Service_Poll(region, 1U, seq[3], &done[3], &status[3]);
+    ReportCheck("SERVICE", 3U, (boolean)((ret == E_OK) && (done[3] != 0U) && (status[3] == E_NOT_OK)),
+                "request outside of the region rejected", passCount, failCount);
+
+    /* Adjacent in-place requests, the second one saturating: applied once each, own status */
+    for (i = 0U; i < 8U; i++)
+    {
+        a[i] = 100;
+        b[i] = 10;
+    }
+    a[7] = 32760;
+    header->coalesced = 0U;
+    request.op = (uint32)FIXEDPOINT_OP_ADD;
+    request.len = 4U;
+    for (i = 0U; i < 2U; i++)
+    {
+        request.offsetA = dataOffset + (i * 8U);
+        request.offsetB = request.offsetA + 24U;
+        request.offsetR = request.offsetA;
+        ret |= FixedPoint_Service_Submit(region, 0U, &request, &seq[i]);
+    }
+    ret |= FixedPoint_Service_Serve(&server, 8U, NULL);
+    ok = (header->coalesced == 0U) ? 1U : 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        ret |= FixedPoint_Service_Poll(region, 0U, seq[i], &done[i], &status[i]);
+        ok &= (done[i] != 0U) ? 1U : 0U;
+    }
+    for (i = 0U; i < 7U; i++)
+    {
+        ok &= (a[i] == 110) ? 1U : 0U;
+    }
+    ok &= ((ret == E_OK) && (a[7] == FIX16_MAX) && (status[0] == E_OK) && (status[1] == E_NOT_OK)) ? 1U : 0U;
+    ReportCheck("SERVICE", 4U, ok, "saturating in-place requests not coalesced, applied once with their own status",
+                passCount, failCount);
+
+    /* A client widens the bounds and clears the client count in the header: the server keeps its own */
+    request.op = (uint32)FIXEDPOINT_OP_ADD;
+    request.offsetA = dataOffset;
+    request.offsetB = dataOffset;
+    request.offsetR = size;
+    ret = FixedPoint_Service_Submit(region, 1U, &request, &seq[3]);
+    header->size = 0x7FFFFFF0UL;
+    header->dataOffset = 0U;
+    header->clientCount = 0U;
+    ret |= FixedPoint_Service_Serve(&server, 8U, &served);
+    status[3] = (Std_ReturnType)header->rings[1].entries[seq[3] % FIXEDPOINT_SERVICE_RING_SIZE].status;
+    ok = ((ret == E_OK) && (served == 1U) && (header->rings[1].tail == (seq[3] + 1U)) && (status[3] == E_NOT_OK)) ?
+         1U : 0U;
+    header->size = size;
+    header->dataOffset = dataOffset;
+    header->clientCount = 2U;
+    ReportCheck("SERVICE", 5U, ok, "bounds written into the shared header by a client ignored by the server",
+                passCount, failCount);
+
+    /* Adjacent requests, the second one saturating: coalesced, executed once, group status for both */
+    for (i = 0U; i < 8U; i++)
+    {
+        a[i] = 100;
+        b[i] = 10;
+        r[i] = 0;
+    }
+    a[7] = 32760;
+    header->coalesced = 0U;
+    request.op = (uint32)FIXEDPOINT_OP_ADD;
+    request.len = 4U;
+    for (i = 0U; i < 2U; i++)
+    {
+        request.offsetA = dataOffset + (i * 8U);
+        request.offsetB = request.offsetA + 24U;
+        request.offsetR = request.offsetA + 48U;
+        ret |= FixedPoint_Service_Submit(region, 0U, &request, &seq[i]);
+    }
+    ret |= FixedPoint_Service_Serve(&server, 8U, NULL);
+    ok = (header->coalesced == 1U) ? 1U : 0U;
+    for (i = 0U; i < 2U; i++)
+    {
+        ret |= FixedPoint_Service_Poll(region, 0U, seq[i], &done[i], &status[i]);
+        ok &= ((done[i] != 0U) && (status[i] == E_NOT_OK)) ? 1U : 0U;
+    }
+    for (i = 0U; i < 7U; i++)
+    {
+        ok &= (r[i] == 110) ? 1U : 0U;
+    }
+    ok &= ((ret == E_OK) && (r[7] == FIX16_MAX)) ? 1U : 0U;
+    ReportCheck("SERVICE", 6U, ok, "saturating member fails every request of its coalesced group",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the precomputed 8-bit table image.
+ *
+ *  Lookups in an attached image must return the result and status of the computing kernels for
+ *  all operand pairs. Images of another configuration must be rejected and a corrupted table must
+ *  be detected by the checksum.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunTableTests(unsigned int* passCount, unsigned int* failCount)
+{
+    FixedPoint_TableHeader_t* header = (FixedPoint_TableHeader_t*)(void*)TableImage;
+    uint8* bytes = (uint8*)(void*)TableImage;
+    const uint32 size = FIXEDPOINT_TABLE_IMAGE_SIZE;
+    Std_ReturnType ret;
+    boolean ok = 1U;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: TABLE IMAGE ---\n");
+
+    ret = FixedPoint_Table_Build(TableImage, size);
+    ret |= FixedPoint_Table_Verify(TableImage, size);
+    ret |= FixedPoint_Table_Attach(TableImage, size);
+
+    for (i = 0U; i < FIXEDPOINT_TABLE_ENTRIES; i++)
+    {
+        const t_Fixed8 a = (t_Fixed8)(sint8)(uint8)(i >> 8);
+        const t_Fixed8 b = (t_Fixed8)(sint8)(uint8)(i & 0xFFU);
+        t_Fixed8 rTable = 0;
+        t_Fixed8 rCore = 0;
+
+        ok &= ((FixedPoint_Table_Mult8_Array(&a, &b, &rTable, 1U) == FixedPoint_Mult8_Array(&a, &b, &rCore, 1U)) &&
+               (rTable == rCore)) ? 1U : 0U;
+        ok &= ((FixedPoint_Table_Div8_Array(&a, &b, &rTable, 1U) == FixedPoint_Div8_Array(&a, &b, &rCore, 1U)) &&
+               (rTable == rCore)) ? 1U : 0U;
+    }
+    ReportCheck("TABLE", 1U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "attached image equals Mult8/Div8 kernels for all operand pairs", passCount, failCount);
+
+    FixedPoint_Table_Detach();
+    header->shift8 += 1U;
+    ok = (FixedPoint_Table_Attach(TableImage, size) == E_NOT_OK) ? 1U : 0U;
+    header->shift8 -= 1U;
+    bytes[FIXEDPOINT_TABLE_DATA_OFFSET + 1234U] ^= 0x01U;
+    ok &= (FixedPoint_Table_Verify(TableImage, size) == E_NOT_OK) ? 1U : 0U;
+    bytes[FIXEDPOINT_TABLE_DATA_OFFSET + 1234U] ^= 0x01U;
+    ok &= (FixedPoint_Table_Verify(TableImage, size) == E_OK) ? 1U : 0U;
+    ReportCheck("TABLE", 2U, ok, "configuration mismatch rejected, corruption detected by checksum",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Table building tool: write the table image of the current configuration to a file.
+ *
+ *  @param[in]  path    Output file name.
+ *
+ *  @return     int
+ *  @retval     0       Image written.
+ *  @retval     1       Image could not be built or written.
+ */
+static int BuildTableFile(const char* path)
+{
+    int result = 1;
+    FILE* file;
+
+    if (FixedPoint_Table_Build(TableImage, FIXEDPOINT_TABLE_IMAGE_SIZE) == E_OK)
+    {
+        file = fopen(path, "wb");
+        if (file != NULL)
+        {
+            if (fwrite(TableImage, 1U, FIXEDPOINT_TABLE_IMAGE_SIZE, file) == FIXEDPOINT_TABLE_IMAGE_SIZE)
+            {
+                result = 0;
+            }
+            result |= (fclose(file) == 0) ? 0 : 1;
+        }
+    }
+
+    printf("Table image %s: %s (%lu bytes, SHIFT_16=%u, SHIFT_8=%u)\n", path, (result == 0) ? "written" : "FAILED",
+           (unsigned long)FIXEDPOINT_TABLE_IMAGE_SIZE, (unsigned int)SHIFT_16, (unsigned int)SHIFT_8);
+
+    return result;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Time source of the autotuner: processor time in microseconds.
+ *
+ *  @return     double
+ *  @retval     Time stamp in microseconds.
+ */
+static double TuneClock(void)
+{
+    return ((double)clock() * 1.0e6) / (double)CLOCKS_PER_SEC;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the autotuner and the profile based dispatch.
+ *
+ *  A profile written by the tuner must be accepted at init and the dispatch must return the
+ *  results of the kernels whatever implementation was selected. A profile of another
+ *  configuration must be rejected without changing the selection.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunTuneTests(unsigned int* passCount, unsigned int* failCount)
+{
+    FixedPoint_TuneProfile_t profile;
+    t_Fixed8 a[64];
+    t_Fixed8 b[64];
+    t_Fixed8 r[64];
+    t_Fixed8 expected[64];
+    Std_ReturnType ret;
+    boolean ok = 1U;
+    uint32 blockLen;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: AUTOTUNER ---\n");
+
+    for (i = 0U; i < 64U; i++)
+    {
+        a[i] = (t_Fixed8)(sint8)(uint8)(i * 53U);
+        b[i] = (t_Fixed8)(sint8)(uint8)(i * 29U);
+    }
+
+    (void)FixedPoint_Table_Build(TableImage, FIXEDPOINT_TABLE_IMAGE_SIZE);
+    (void)FixedPoint_Table_Attach(TableImage, FIXEDPOINT_TABLE_IMAGE_SIZE);
+    ret = FixedPoint_Tune_Run(&profile, TuneWork, 3U * 1024U, &TuneClock);
+    ret |= FixedPoint_Tune_Init(&profile);
+    ok &= ((FixedPoint_Tune_Mult8_Array(a, b, r, 64U) == FixedPoint_Mult8_Array(a, b, expected, 64U)) &&
+           (memcmp(r, expected, sizeof(r)) == 0)) ? 1U : 0U;
+    ok &= ((FixedPoint_Tune_Div8_Array(a, b, r, 64U) == FixedPoint_Div8_Array(a, b, expected, 64U)) &&
+           (memcmp(r, expected, sizeof(r)) == 0)) ? 1U : 0U;
+    blockLen = FixedPoint_Tune_GetBlockLen();
+    ReportCheck("TUNE", 1U, (boolean)((ret == E_OK) && (ok != 0U) && (blockLen == profile.blockLen) &&
+                                      (blockLen >= 64U) && (blockLen <= 1024U)),
+                "tuned profile accepted, dispatch equals the kernels", passCount, failCount);
+
+    profile.shift8 += 1U;
+    profile.blockLen = 7U;
+    ok = (FixedPoint_Tune_Init(&profile) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Tune_GetBlockLen() == blockLen) ? 1U : 0U;
+    ok &= ((FixedPoint_Tune_Init(NULL) == E_OK) && (FixedPoint_Tune_GetBlockLen() == FIXEDPOINT_TUNE_DEFAULT_BLOCK_LEN)) ? 1U : 0U;
+    ReportCheck("TUNE", 2U, ok, "profile of another configuration rejected, defaults restorable", passCount, failCount);
+
+    FixedPoint_Table_Detach();
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the layout transform kernels.
+ *
+ *  Deinterleave and interleave are compared with the index formula for every channel count and a
+ *  frame count that is not a multiple of the tile, so that the SIMD blocks, full and partial
+ *  tiles are covered. The transposes are checked on a non-square matrix with partial tiles and
+ *  the fused Q-format conversion against a scalar reference.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunLayoutTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 frames16[37U * FIXEDPOINT_LAYOUT_MAX_CHANNELS];
+    static t_Fixed16 planes16[FIXEDPOINT_LAYOUT_MAX_CHANNELS][37];
+    static t_Fixed16 back16[37U * FIXEDPOINT_LAYOUT_MAX_CHANNELS];
+    static t_Fixed16 matrix16[45U * 29U];
+    static t_Fixed16 result16[45U * 29U];
+    static t_Fixed8 matrix8[45U * 29U];
+    static t_Fixed8 result8[45U * 29U];
+    t_Fixed16* planes[FIXEDPOINT_LAYOUT_MAX_CHANNELS];
+    const t_Fixed16* planesIn[FIXEDPOINT_LAYOUT_MAX_CHANNELS];
+    Std_ReturnType ret = E_OK;
+    boolean ok = 1U;
+    uint32 channels;
+    uint32 i;
+    uint32 c;
+
+    printf("\n--- MODULE CHECKS: LAYOUT ---\n");
+
+    for (c = 0U; c < FIXEDPOINT_LAYOUT_MAX_CHANNELS; c++)
+    {
+        planes[c] = planes16[c];
+        planesIn[c] = planes16[c];
+    }
+    for (i = 0U; i < (37U * FIXEDPOINT_LAYOUT_MAX_CHANNELS); i++)
+    {
+        frames16[i] = (t_Fixed16)((sint32)((i * 2654435761U) & 0xFFFFU) - 32768);
+    }
+
+    for (channels = FIXEDPOINT_LAYOUT_MIN_CHANNELS; channels <= FIXEDPOINT_LAYOUT_MAX_CHANNELS; channels++)
+    {
+        ret |= FixedPoint_Deinterleave16(frames16, channels, 37U, planes, 0);
+        ret |= FixedPoint_Interleave16(planesIn, channels, 37U, back16, 0);
+
+        for (i = 0U; i < (37U * channels); i++)
+        {
+            ok &= ((planes16[i % channels][i / channels] == frames16[i]) && (back16[i] == frames16[i])) ? 1U : 0U;
+        }
+    }
+    ReportCheck("LAYOUT", 1U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "deinterleave/interleave of 2..16 channels match the index formula", passCount, failCount);
+
+    for (i = 0U; i < (45U * 29U); i++)
+    {
+        matrix16[i] = (t_Fixed16)((sint32)((i * 40503U) & 0xFFFFU) - 32768);
+        matrix8[i] = (t_Fixed8)((sint32)((i * 40503U) & 0xFFU) - 128);
+    }
+    ret = FixedPoint_Transpose16(matrix16, 45U, 29U, result16, 0);
+    ret |= FixedPoint_Transpose8(matrix8, 45U, 29U, result8, 0);
+    ok = 1U;
+    for (i = 0U; i < (45U * 29U); i++)
+    {
+        const uint32 r = i / 29U;
+        const uint32 col = i % 29U;
+
+        ok &= ((result16[(col * 45U) + r] == matrix16[i]) && (result8[(col * 45U) + r] == matrix8[i])) ? 1U : 0U;
+    }
+    ReportCheck("LAYOUT", 2U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "45 x 29 transpose of t_Fixed16 and t_Fixed8", passCount, failCount);
+
+    /* Fused conversion: remove 3 fractional bits with rounding, add 2 with saturation */
+    ret = FixedPoint_Transpose16(matrix16, 45U, 29U, result16, -3);
+    ok = (ret == E_OK) ? 1U : 0U;
+    for (i = 0U; i < (45U * 29U); i++)
+    {
+        const sint32 v = (sint32)matrix16[i];
+        const sint32 expected = (v >= 0) ? ((v + 4) / 8) : -((-v + 4) / 8);
+
+        ok &= ((sint32)result16[((i % 29U) * 45U) + (i / 29U)] == expected) ? 1U : 0U;
+    }
+    ret = FixedPoint_Deinterleave16(frames16, 3U, 37U, planes, 2);
+    ok &= (ret == E_NOT_OK) ? 1U : 0U;
+    for (i = 0U; i < (37U * 3U); i++)
+    {
+        const sint32 v = (sint32)frames16[i] * 4;
+        const sint32 expected = (v > (sint32)FIX16_MAX) ? (sint32)FIX16_MAX :
+                                ((v < (sint32)FIX16_MIN) ? (sint32)FIX16_MIN : v);
+
+        ok &= ((sint32)planes16[i % 3U][i / 3U] == expected) ? 1U : 0U;
+    }
+    ReportCheck("LAYOUT", 3U, ok, "fused Q-format conversion rounds and saturates like the reference",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the fixed-point FFT and the convolution engine.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunConvTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static FixedPoint_Complex32_t twiddles[FIXEDPOINT_FFT_TWIDDLES(256U)];
+    static FixedPoint_Complex32_t spectrum[256U];
+    static FixedPoint_Complex32_t workspace[FIXEDPOINT_CONV_WORKSPACE_LEN(300U, 64U)];
+    static t_Fixed16 coeffs[300U];
+    static t_Fixed16 input[640U];
+    static t_Fixed16 outFir[640U];
+    static t_Fixed16 outConv[640U];
+    static t_Fixed16 delayFir[299U];
+    static t_Fixed16 delayConv[FIXEDPOINT_CONV_DELAY_LEN(300U, 64U)];
+    FixedPoint_Fft_t fft;
+    FixedPoint_Fir16_t fir;
+    FixedPoint_Conv16_t conv;
+    Std_ReturnType ret;
+    boolean ok = 1U;
+    sint32 exponent = 0;
+    sint32 maxDiff = 0;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: CONV ---\n");
+
+    /* Forward and inverse transform restore the input; a constant transforms to a DC line */
+    for (i = 0U; i < 256U; i++)
+    {
+        spectrum[i].re = (sint32)((i * 2654435761U) & 0xFFFFU) - 32768;
+        spectrum[i].im = (sint32)((i * 40503U) & 0xFFFFU) - 32768;
+    }
+    ret = FixedPoint_Fft_Init(&fft, 256U, twiddles);
+    ret |= FixedPoint_Fft_Forward(&fft, spectrum, &exponent);
+    ret |= FixedPoint_Fft_Inverse(&fft, spectrum, &exponent);
+    for (i = 0U; i < 256U; i++)
+    {
+        const double scale = ldexp(1.0, (int)exponent);
+        const double re = (double)spectrum[i].re * scale;
+        const double im = (double)spectrum[i].im * scale;
+
+        ok &= ((fabs(re - (double)((sint32)((i * 2654435761U) & 0xFFFFU) - 32768)) <= 1.0) &&
+               (fabs(im - (double)((sint32)((i * 40503U) & 0xFFFFU) - 32768)) <= 1.0)) ? 1U : 0U;
+    }
+    for (i = 0U; i < 256U; i++)
+    {
+        spectrum[i].re = 1000;
+        spectrum[i].im = 0;
+    }
+    exponent = 0;
+    ret |= FixedPoint_Fft_Forward(&fft, spectrum, &exponent);
+    ok &= (fabs(ldexp((double)spectrum[0].re, (int)exponent) - 256000.0) <= 1.0) ? 1U : 0U;
+    for (i = 1U; i < 256U; i++)
+    {
+        ok &= ((fabs(ldexp((double)spectrum[i].re, (int)exponent)) <= 1.0) &&
+               (fabs(ldexp((double)spectrum[i].im, (int)exponent)) <= 1.0)) ? 1U : 0U;
+    }
+    ReportCheck("CONV", 1U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "256-point FFT round trip within 1 LSB, DC line of a constant", passCount, failCount);
+
+    /* 300 taps on the FFT path (5 partitions of 64) against the direct form */
+    for (i = 0U; i < 300U; i++)
+    {
+        coeffs[i] = (t_Fixed16)((sint32)((i * 2654435761U) & 0x7FU) - 64);
+    }
+    for (i = 0U; i < 640U; i++)
+    {
+        input[i] = (t_Fixed16)((sint32)((i * 40503U) & 0xFFFU) - 2048);
+    }
+    ret = FixedPoint_Fir16_Init(&fir, coeffs, 300U, delayFir);
+    ret |= FixedPoint_Conv16_Init(&conv, coeffs, 300U, 64U, workspace,
+                                  FIXEDPOINT_CONV_WORKSPACE_LEN(300U, 64U), delayConv);
+    for (i = 0U; i < 640U; i += 128U)
+    {
+        ret |= FixedPoint_Fir16(&fir, &input[i], &outFir[i], 128U);
+        ret |= FixedPoint_Conv16_Process(&conv, &input[i], &outConv[i], 128U);
+    }
+    for (i = 0U; i < 640U; i++)
+    {
+        const sint32 diff = (sint32)outConv[i] - (sint32)outFir[i];
+
+        maxDiff = ((diff < 0 ? -diff : diff) > maxDiff) ? (diff < 0 ? -diff : diff) : maxDiff;
+    }
+    ReportCheck("CONV", 2U, (boolean)((ret == E_OK) && (conv.direct == 0U) && (maxDiff <= 1)),
+                "partitioned overlap-save FFT matches the direct form within 1 LSB", passCount, failCount);
+
+    /* Short filters stay in direct form and are exact; the FFT path needs whole blocks */
+    ret = FixedPoint_Fir16_Init(&fir, coeffs, 32U, delayFir);
+    ret |= FixedPoint_Conv16_Init(&conv, coeffs, 32U, 64U, NULL, 0U, delayConv);
+    ret |= FixedPoint_Fir16(&fir, input, outFir, 50U);
+    ret |= FixedPoint_Conv16_Process(&conv, input, outConv, 50U);
+    ok = ((ret == E_OK) && (conv.direct != 0U) && (memcmp(outFir, outConv, 50U * sizeof(t_Fixed16)) == 0)) ? 1U : 0U;
+    ok &= (FixedPoint_Conv16_Init(&conv, coeffs, 300U, 64U, workspace, 100U, delayConv) == E_NOT_OK) ? 1U : 0U;
+    ret = FixedPoint_Conv16_Init(&conv, coeffs, 300U, 64U, workspace,
+                                 FIXEDPOINT_CONV_WORKSPACE_LEN(300U, 64U), delayConv);
+    ok &= ((ret == E_OK) && (FixedPoint_Conv16_Process(&conv, input, outConv, 50U) == E_NOT_OK)) ? 1U : 0U;
+    ReportCheck("CONV", 3U, ok, "automatic direct form for short filters, invalid workspace and length rejected",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the correlation kernels.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunCorrTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static FixedPoint_Complex32_t workspace[FIXEDPOINT_CORR_WORKSPACE_LEN(1024U)];
+    static t_Fixed16 x[300U];
+    static t_Fixed16 y[300U];
+    static t_Fixed16 direct[600U];
+    static t_Fixed16 viaFft[600U];
+    FixedPoint_Corr16_t corr;
+    Std_ReturnType ret;
+    boolean ok = 1U;
+    sint32 lag;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: CORR ---\n");
+
+    /* Full correlation against the reference, with runs of -32768 * -32768 products */
+    for (i = 0U; i < 300U; i++)
+    {
+        x[i] = (t_Fixed16)((sint32)((i * 2654435761U) & 0xFFFFU) - 32768);
+        y[i] = (t_Fixed16)((sint32)((i * 40503U) & 0xFFU) - 128);
+    }
+    for (i = 10U; i < 20U; i++)
+    {
+        x[i] = FIX16_MIN;
+        y[i] = FIX16_MIN;
+    }
+    ret = FixedPoint_Xcorr16(NULL, x, 50U, y, 37U, -36, 86U, FIXEDPOINT_CORR_RAW, direct);
+    for (lag = -36; lag < 50; lag++)
+    {
+        sint64 sum = 0;
+        sint64 mag;
+        sint64 expected;
+        sint32 n;
+
+        for (n = 0; n < 37; n++)
+        {
+            if (((n + lag) >= 0) && ((n + lag) < 50))
+            {
+                sum += (sint64)x[n + lag] * (sint64)y[n];
+            }
+        }
+        mag = (((sum < 0) ? -sum : sum) + ((sint64)1 << (SHIFT_16 - 1U))) >> SHIFT_16;
+        expected = (sum < 0) ? -mag : mag;
+        expected = (expected > (sint64)FIX16_MAX) ? (sint64)FIX16_MAX :
+                   ((expected < (sint64)FIX16_MIN) ? (sint64)FIX16_MIN : expected);
+        ok &= ((sint64)direct[lag + 36] == expected) ? 1U : 0U;
+    }
+    ReportCheck("CORR", 1U, (boolean)((ret == E_NOT_OK) && (ok != 0U)),
+                "full cross-correlation matches the 64-bit reference incl. saturation", passCount, failCount);
+
+    /* FFT path against the direct path: autocorrelation and cross-correlation of small signals */
+    for (i = 0U; i < 300U; i++)
+    {
+        x[i] = (t_Fixed16)((sint32)((i * 2654435761U) & 0x1FFU) - 256);
+        y[i] = (t_Fixed16)((sint32)((i * 40503U) & 0xFFU) - 128);
+    }
+    ret = FixedPoint_Corr16_Init(&corr, 1024U, workspace, FIXEDPOINT_CORR_WORKSPACE_LEN(1024U));
+    corr.fftCost = 0U;
+    ret |= FixedPoint_Autocorr16(NULL, x, 300U, 200U, FIXEDPOINT_CORR_RAW, direct);
+    ret |= FixedPoint_Autocorr16(&corr, x, 300U, 200U, FIXEDPOINT_CORR_RAW, viaFft);
+    for (i = 0U; i < 200U; i++)
+    {
+        ok &= (abs((int)direct[i] - (int)viaFft[i]) <= 1) ? 1U : 0U;
+    }
+    ret |= FixedPoint_Xcorr16(NULL, x, 300U, y, 250U, -249, 549U, FIXEDPOINT_CORR_RAW, direct);
+    ret |= FixedPoint_Xcorr16(&corr, x, 300U, y, 250U, -249, 549U, FIXEDPOINT_CORR_RAW, viaFft);
+    for (i = 0U; i < 549U; i++)
+    {
+        ok &= (abs((int)direct[i] - (int)viaFft[i]) <= 1) ? 1U : 0U;
+    }
+    ReportCheck("CORR", 2U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "FFT path matches the direct path within 1 LSB", passCount, failCount);
+
+    /* Correlation coefficient: 1 at lag 0 of the autocorrelation, -1 against -x / 2, silence */
+    for (i = 0U; i < 300U; i++)
+    {
+        y[i] = (t_Fixed16)(-(sint32)x[i] / 2);
+    }
+    ret = FixedPoint_Autocorr16(NULL, x, 300U, 4U, FIXEDPOINT_CORR_COEFF, direct);
+    ret |= FixedPoint_Xcorr16(NULL, x, 300U, y, 300U, 0, 1U, FIXEDPOINT_CORR_COEFF, viaFft);
+    ok = ((ret == E_OK) && ((int)direct[0] == (1 << SHIFT_16)) && (abs((int)direct[1]) < (1 << SHIFT_16)) &&
+          (abs((int)viaFft[0] + (1 << SHIFT_16)) <= 1)) ? 1U : 0U;
+    for (i = 0U; i < 300U; i++)
+    {
+        y[i] = 0;
+    }
+    ret = FixedPoint_Xcorr16(NULL, x, 300U, y, 300U, -2, 5U, FIXEDPOINT_CORR_COEFF, direct);
+    ok &= ((ret == E_NOT_OK) && (direct[0] == 0) && (direct[4] == 0)) ? 1U : 0U;
+    ReportCheck("CORR", 3U, ok, "normalized correlation coefficient, zero energy rejected", passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the adaptive filter.
+ *
+ *  A 20-tap system is identified from noise input by the fixed-point filter and by a double
+ *  precision filter with the same step size; both must converge to the system and to each other.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunLmsTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 x[3000U];
+    static t_Fixed16 d[3000U];
+    static t_Fixed16 out[3000U];
+    static t_Fixed16 err[3000U];
+    static t_Fixed16 outSplit[3000U];
+    static t_Fixed16 errSplit[3000U];
+    static sint16 coeffs[FIXEDPOINT_LMS_COEFF_LEN(20U)];
+    static sint16 coeffsSplit[FIXEDPOINT_LMS_COEFF_LEN(20U)];
+    static t_Fixed16 state[FIXEDPOINT_LMS_STATE_LEN(20U, 64U)];
+    static t_Fixed16 stateSplit[FIXEDPOINT_LMS_STATE_LEN(20U, 64U)];
+    const double scale = (double)(1U << SHIFT_16);
+    const double one = (double)FIXEDPOINT_LMS_COEFF_ONE;
+    FixedPoint_Lms16_t lms;
+    FixedPoint_Lms16_t lmsSplit;
+    double h[20U];
+    double wRef[20U];
+    sint32 w[20U];
+    sint32 wSplit[20U];
+    Std_ReturnType ret;
+    boolean ok;
+    double maxDiff;
+    double errPower;
+    double refPower;
+    uint32 seed = 12345U;
+    uint32 mode;
+    uint32 i;
+    uint32 k;
+
+    printf("\n--- MODULE CHECKS: LMS ---\n");
+
+    /* Unknown system and its quantized response to uniform noise within +-16 */
+    for (k = 0U; k < 20U; k++)
+    {
+        h[k] = ((k % 3U) == 1U ? -0.6 : 0.9) * pow(0.8, (double)k);
+    }
+    for (i = 0U; i < 3000U; i++)
+    {
+        double acc = 0.0;
+
+        seed = (seed * 1103515245U) + 12345U;
+        x[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x1FFFU) - 4096);
+        for (k = 0U; (k < 20U) && (k <= i); k++)
+        {
+            acc += h[k] * (double)x[i - k];
+        }
+        d[i] = (t_Fixed16)floor(acc + 0.5);
+    }
+
+    for (mode = 0U; mode < 2U; mode++)
+    {
+        /* LMS: mu = 2^-12 over 3000 samples, NLMS: mu = 1/2 over 400 samples */
+        const FixedPoint_LmsMode_t lmsMode = (mode == 0U) ? FIXEDPOINT_LMS : FIXEDPOINT_NLMS;
+        const uint32 muShift = (mode == 0U) ? 12U : 1U;
+        const uint32 len = (mode == 0U) ? 3000U : 400U;
+        const double mu = 1.0 / (double)(1UL << muShift);
+
+        ret = FixedPoint_Lms16_Init(&lms, lmsMode, 20U, coeffs, state, 64U, muShift, 0U);
+        ret |= FixedPoint_Lms16(&lms, x, d, out, err, len);
+        ret |= FixedPoint_Lms16_GetCoeffs(&lms, w);
+
+        /* The same stream in pieces of 37 samples gives the same result */
+        ret |= FixedPoint_Lms16_Init(&lmsSplit, lmsMode, 20U, coeffsSplit, stateSplit, 64U, muShift, 0U);
+        for (i = 0U; i < len; i += 37U)
+        {
+            const uint32 count = ((len - i) < 37U) ? (len - i) : 37U;
+
+            ret |= FixedPoint_Lms16(&lmsSplit, &x[i], &d[i], &outSplit[i], &errSplit[i], count);
+        }
+        ret |= FixedPoint_Lms16_GetCoeffs(&lmsSplit, wSplit);
+        ok = ((memcmp(out, outSplit, len * sizeof(t_Fixed16)) == 0) &&
+              (memcmp(err, errSplit, len * sizeof(t_Fixed16)) == 0) &&
+              (memcmp(w, wSplit, sizeof(w)) == 0)) ? 1U : 0U;
+
+        /* Double precision reference on the same samples */
+        for (k = 0U; k < 20U; k++)
+        {
+            wRef[k] = 0.0;
+        }
+        for (i = 0U; i < len; i++)
+        {
+            double y = 0.0;
+            double power = 0.0;
+            double e;
+
+            for (k = 0U; (k < 20U) && (k <= i); k++)
+            {
+                y += wRef[k] * ((double)x[i - k] / scale);
+                power += ((double)x[i - k] / scale) * ((double)x[i - k] / scale);
+            }
+            e = ((double)d[i] / scale) - y;
+            for (k = 0U; (k < 20U) && (k <= i); k++)
+            {
+                const double step = (mode == 0U) ? mu : (mu / (power + 1.0));
+
+                wRef[k] += step * e * ((double)x[i - k] / scale);
+            }
+        }
+
+        maxDiff = 0.0;
+        for (k = 0U; k < 20U; k++)
+        {
+            maxDiff = fmax(maxDiff, fabs(((double)w[k] / one) - wRef[k]));
+            maxDiff = fmax(maxDiff, fabs(((double)w[k] / one) - h[k]));
+        }
+        errPower = 0.0;
+        refPower = 0.0;
+        for (i = len - 100U; i < len; i++)
+        {
+            errPower += (double)err[i] * (double)err[i];
+            refPower += (double)d[i] * (double)d[i];
+        }
+
+        ok &= ((ret == E_OK) && (maxDiff < 0.002) && (errPower < (refPower * 1e-5))) ? 1U : 0U;
+        ReportCheck("LMS", mode + 1U, ok,
+                    (mode == 0U) ? "LMS identifies the system like the double reference, blocks continuous"
+                                 : "NLMS identifies the system like the double reference, blocks continuous",
+                    passCount, failCount);
+    }
+
+    /* Leakage: without input the coefficients decay by (1 - 2^-6) per sample */
+    ret = FixedPoint_Lms16_Init(&lmsSplit, FIXEDPOINT_LMS, 20U, coeffsSplit, stateSplit, 64U, 12U, 6U);
+    ret |= FixedPoint_Lms16_SetCoeffs(&lmsSplit, w);
+    ret |= FixedPoint_Lms16_GetCoeffs(&lmsSplit, wSplit);
+    ok = (memcmp(w, wSplit, sizeof(w)) == 0) ? 1U : 0U;
+    for (i = 0U; i < 256U; i++)
+    {
+        x[i] = 0;
+        d[i] = 0;
+    }
+    ret |= FixedPoint_Lms16(&lmsSplit, x, d, out, err, 256U);
+    ret |= FixedPoint_Lms16_GetCoeffs(&lmsSplit, wSplit);
+    for (k = 0U; k < 20U; k++)
+    {
+        const double expected = (double)w[k] * pow(1.0 - (1.0 / 64.0), 256.0);
+
+        ok &= (fabs((double)wSplit[k] - expected) <= 256.0) ? 1U : 0U;
+    }
+    ReportCheck("LMS", 3U, (boolean)((ret == E_OK) && (ok != 0U)), "leakage decay, coefficient set/get round trip",
+                passCount, failCount);
+
+    /* Saturation audit: an unstable step clamps steps and coefficients instead of wrapping */
+    for (i = 0U; i < 256U; i++)
+    {
+        x[i] = (t_Fixed16)(((i & 1U) != 0U) ? FIX16_MAX : FIX16_MIN);
+        d[i] = (t_Fixed16)(((i & 2U) != 0U) ? FIX16_MAX : FIX16_MIN);
+    }
+    ret = FixedPoint_Lms16_Init(&lms, FIXEDPOINT_LMS, 20U, coeffs, state, 64U, 0U, 0U);
+    ok = ((ret == E_OK) && (FixedPoint_Lms16(&lms, x, d, out, err, 256U) == E_NOT_OK)) ? 1U : 0U;
+    ret = FixedPoint_Lms16_GetCoeffs(&lms, w);
+    maxDiff = 0.0;
+    for (k = 0U; k < 20U; k++)
+    {
+        ok &= ((w[k] >= FIXEDPOINT_LMS_COEFF_MIN) && (w[k] <= FIXEDPOINT_LMS_COEFF_MAX)) ? 1U : 0U;
+        maxDiff = fmax(maxDiff, fabs((double)w[k]));
+    }
+    ok &= ((ret == E_OK) && (maxDiff >= (double)FIXEDPOINT_LMS_COEFF_MAX)) ? 1U : 0U;
+    ok &= (FixedPoint_Lms16_Init(&lms, FIXEDPOINT_LMS, 0U, coeffs, state, 64U, 0U, 0U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("LMS", 4U, ok, "unstable step saturates coefficients without wrap-around, invalid setup rejected",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the curve and map interpolation.
+ *
+ *  The results are compared with the interpolation in double precision; a single final rounding
+ *  keeps every result within half an LSB of it.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunInterpTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static const t_Fixed16 axis[9U] = { -20000, -12000, -3000, -2999, 0, 500, 7000, 20000, 32767 };
+    static const t_Fixed16 values[9U] = { 30000, -32768, 1000, -5000, 32767, 0, 123, -7, -32768 };
+    static const t_Fixed16 axisX[6U] = { -30000, -1000, 0, 1, 4000, 25000 };
+    static const t_Fixed16 axisY[5U] = { -32768, -7, 3, 9000, 32767 };
+    static t_Fixed16 mapValues[30U];
+    static t_Fixed16 x[4096U];
+    static t_Fixed16 y[4096U];
+    static t_Fixed16 r[4096U];
+    static t_Fixed16 rSeg[4096U];
+    static t_Fixed16 rRef[4096U];
+    FixedPoint_Curve16_t curve;
+    FixedPoint_Map16_t map;
+    Std_ReturnType ret;
+    boolean ok;
+    double maxDiff = 0.0;
+    uint32 seed = 4711U;
+    uint32 segX = 1000U;
+    uint32 segY = 0U;
+    uint32 i;
+    sint32 v;
+
+    printf("\n--- MODULE CHECKS: INTERP ---\n");
+
+    for (i = 0U; i < 30U; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        mapValues[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+    }
+    mapValues[0U] = FIX16_MIN;
+    mapValues[29U] = FIX16_MAX;
+
+    /* Curve over the whole input range, beyond the axis ends the boundary values */
+    ret = FixedPoint_Curve16_Init(&curve, axis, values, 9U);
+    for (v = -32768; v <= 32767; v += 7)
+    {
+        const double xc = fmin(fmax((double)v, (double)axis[0U]), (double)axis[8U]);
+        t_Fixed16 res = 0;
+        double ref;
+
+        i = 0U;
+        while ((i < 7U) && (xc > (double)axis[i + 1U]))
+        {
+            i++;
+        }
+        ref = (double)values[i] + (((double)values[i + 1U] - (double)values[i]) * (xc - (double)axis[i]) /
+                                   ((double)axis[i + 1U] - (double)axis[i]));
+        ret |= FixedPoint_Curve16(&curve, (t_Fixed16)v, NULL, &res);
+        maxDiff = fmax(maxDiff, fabs((double)res - ref));
+    }
+    ok = ((ret == E_OK) && (maxDiff <= (0.5 + 1e-9))) ? 1U : 0U;
+    ReportCheck("INTERP", 1U, ok, "curve within 0.5 LSB of exact linear interpolation, boundary values", passCount,
+                failCount);
+
+    /* Map at random points, including points beyond the axes */
+    ret = FixedPoint_Map16_Init(&map, axisX, 6U, axisY, 5U, mapValues);
+    maxDiff = 0.0;
+    for (i = 0U; i < 4096U; i++)
+    {
+        double xc;
+        double yc;
+        double fx;
+        double fy;
+        double ref;
+        uint32 ix = 0U;
+        uint32 iy = 0U;
+
+        seed = (seed * 1103515245U) + 12345U;
+        x[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+        seed = (seed * 1103515245U) + 12345U;
+        y[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+        if ((i & 15U) == 0U)
+        {
+            x[i] = axisX[(i >> 4U) % 6U];
+            y[i] = axisY[(i >> 4U) % 5U];
+        }
+
+        xc = fmin(fmax((double)x[i], (double)axisX[0U]), (double)axisX[5U]);
+        yc = fmin(fmax((double)y[i], (double)axisY[0U]), (double)axisY[4U]);
+        while ((ix < 4U) && (xc > (double)axisX[ix + 1U]))
+        {
+            ix++;
+        }
+        while ((iy < 3U) && (yc > (double)axisY[iy + 1U]))
+        {
+            iy++;
+        }
+        fx = (xc - (double)axisX[ix]) / ((double)axisX[ix + 1U] - (double)axisX[ix]);
+        fy = (yc - (double)axisY[iy]) / ((double)axisY[iy + 1U] - (double)axisY[iy]);
+        ref = ((1.0 - fx) * (1.0 - fy) * (double)mapValues[(ix * 5U) + iy]) +
+              ((1.0 - fx) * fy * (double)mapValues[(ix * 5U) + iy + 1U]) +
+              (fx * (1.0 - fy) * (double)mapValues[((ix + 1U) * 5U) + iy]) +
+              (fx * fy * (double)mapValues[((ix + 1U) * 5U) + iy + 1U]);
+        ret |= FixedPoint_Map16(&map, x[i], y[i], NULL, NULL, &rRef[i]);
+        maxDiff = fmax(maxDiff, fabs((double)rRef[i] - ref));
+    }
+    ok = ((ret == E_OK) && (maxDiff <= (0.5 + 1e-6))) ? 1U : 0U;
+    ReportCheck("INTERP", 2U, ok, "map within 0.5 LSB of exact bilinear interpolation", passCount, failCount);
+
+    /* Cached search: slowly moving, jumping and random inputs give the results of the full search */
+    ret = FixedPoint_Map16_Array(&map, x, y, r, 4096U);
+    ok = (memcmp(r, rRef, sizeof(r)) == 0) ? 1U : 0U;
+    for (i = 0U; i < 4096U; i++)
+    {
+        x[i] = (t_Fixed16)((((i / 512U) & 1U) != 0U) ? (32767 - (sint32)((i % 512U) * 128U))
+                                                      : (-32768 + (sint32)((i % 512U) * 128U)));
+        y[i] = (t_Fixed16)((sint32)(i * 16U) - 32768);
+        if ((i % 1000U) == 999U)
+        {
+            x[i] = (t_Fixed16)(-x[i]);
+        }
+        ret |= FixedPoint_Map16(&map, x[i], y[i], NULL, NULL, &rRef[i]);
+        ret |= FixedPoint_Map16(&map, x[i], y[i], &segX, &segY, &rSeg[i]);
+    }
+    ok &= (memcmp(rSeg, rRef, sizeof(rSeg)) == 0) ? 1U : 0U;
+    ret |= FixedPoint_Map16_Array(&map, x, y, r, 4096U);
+    ok &= (memcmp(r, rRef, sizeof(r)) == 0) ? 1U : 0U;
+    segX = 0xFFFFFFFFUL;
+    for (i = 0U; i < 4096U; i++)
+    {
+        ret |= FixedPoint_Curve16(&curve, x[i], NULL, &rRef[i]);
+        ret |= FixedPoint_Curve16(&curve, x[i], &segX, &rSeg[i]);
+        ok &= (segX <= 7U) ? 1U : 0U;
+    }
+    ok &= (memcmp(rSeg, rRef, sizeof(rSeg)) == 0) ? 1U : 0U;
+    ret |= FixedPoint_Curve16_Array(&curve, x, r, 4096U);
+    ok &= ((ret == E_OK) && (memcmp(r, rRef, sizeof(r)) == 0)) ? 1U : 0U;
+    ReportCheck("INTERP", 3U, ok, "cached segment search and array lookups match the full search", passCount,
+                failCount);
+
+    /* Invalid tables and arguments */
+    ok = (FixedPoint_Curve16_Init(&curve, axis, values, 1U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Curve16_Init(&curve, axisY, NULL, 5U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Curve16_Init(&curve, values, axis, 9U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Map16_Init(&map, axisX, 6U, values, 4U, mapValues) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Map16_Init(&map, axisX, 6U, axisY, 5U, mapValues) == E_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Map16(&map, 0, 0, NULL, NULL, NULL) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Curve16_Array(NULL, x, r, 4U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("INTERP", 4U, ok, "non-increasing axes, short axes and null pointers rejected", passCount,
+                failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the control blocks.
+ *
+ *  Each block is checked against a known response; the bank of each block must match single
+ *  instances fed with the same random inputs and parameters.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunCtrlTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 pA[37U];
+    static t_Fixed16 pB[37U];
+    static t_Fixed16 x[37U];
+    static t_Fixed16 y[37U];
+    static t_Fixed16 yRef[37U];
+    static uint16 frac[37U];
+    static uint16 tOn[37U];
+    static uint16 tOff[37U];
+    static uint16 count[37U];
+    static boolean in[37U];
+    static boolean flags[37U];
+    FixedPoint_RateLimit16_t rl[37U];
+    FixedPoint_Hyst16_t hyst[37U];
+    FixedPoint_LowPass16_t lp[37U];
+    FixedPoint_Debounce_t db[37U];
+    FixedPoint_RateLimitBank16_t rlBank;
+    FixedPoint_HystBank16_t hystBank;
+    FixedPoint_LowPassBank16_t lpBank;
+    FixedPoint_DebounceBank_t dbBank;
+    Std_ReturnType ret;
+    boolean ok;
+    boolean flag;
+    uint32 seed = 777U;
+    uint32 step;
+    uint32 i;
+
+    printf("\n--- MODULE CHECKS: CTRL ---\n");
+
+    /* Rate limiter: step up by 300 and down by 500 per call, then bank against single instances */
+    ret = FixedPoint_RateLimit16_Init(&rl[0U], 300, 500, 0);
+    ok = 1U;
+    for (step = 1U; step <= 40U; step++)
+    {
+        ret |= FixedPoint_RateLimit16(&rl[0U], (step <= 20U) ? 5000 : -3000, &y[0U]);
+        ok &= (y[0U] == ((step <= 20U) ? (t_Fixed16)((step * 300U < 5000U) ? (step * 300U) : 5000U)
+                                        : (t_Fixed16)((5000 - ((sint32)(step - 20U) * 500) > -3000)
+                                                      ? (5000 - ((sint32)(step - 20U) * 500)) : -3000))) ? 1U : 0U;
+    }
+    for (i = 0U; i < 37U; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        pA[i] = (t_Fixed16)((seed >> 8U) & 0x7FFFU);
+        seed = (seed * 1103515245U) + 12345U;
+        pB[i] = (t_Fixed16)((seed >> 12U) & 0x0FFFU);
+        y[i] = (t_Fixed16)((sint32)((seed >> 4U) & 0xFFFFU) - 32768);
+        ret |= FixedPoint_RateLimit16_Init(&rl[i], pA[i], pB[i], y[i]);
+    }
+    ret |= FixedPoint_RateLimitBank16_Init(&rlBank, pA, pB, y, 37U);
+    for (step = 0U; step < 200U; step++)
+    {
+        for (i = 0U; i < 37U; i++)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            x[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+            ret |= FixedPoint_RateLimit16(&rl[i], x[i], &yRef[i]);
+        }
+        ret |= FixedPoint_RateLimitBank16(&rlBank, x);
+        ok &= (memcmp(y, yRef, sizeof(y)) == 0) ? 1U : 0U;
+    }
+    pA[3U] = -1;
+    ok &= (FixedPoint_RateLimitBank16_Init(&rlBank, pA, pB, y, 37U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_RateLimit16_Init(&rl[0U], 1, -1, 0) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("CTRL", 1U, (boolean)((ret == E_OK) && (ok != 0U)), "rate limiter ramps, bank matches instances",
+                passCount, failCount);
+
+    /* Hysteresis: switches at the thresholds only */
+    ret = FixedPoint_Hyst16_Init(&hyst[0U], -100, 100, 0U);
+    ret |= FixedPoint_Hyst16(&hyst[0U], 99, &flag);
+    ok = (flag == 0U) ? 1U : 0U;
+    ret |= FixedPoint_Hyst16(&hyst[0U], 100, &flag);
+    ok &= (flag == 1U) ? 1U : 0U;
+    ret |= FixedPoint_Hyst16(&hyst[0U], -99, &flag);
+    ok &= (flag == 1U) ? 1U : 0U;
+    ret |= FixedPoint_Hyst16(&hyst[0U], -100, &flag);
+    ok &= (flag == 0U) ? 1U : 0U;
+    for (i = 0U; i < 37U; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        pA[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x3FFU) - 512);
+        pB[i] = (t_Fixed16)(pA[i] + (t_Fixed16)((seed >> 20U) & 0xFFU));
+        flags[i] = (boolean)(i % 3U);
+        ret |= FixedPoint_Hyst16_Init(&hyst[i], pA[i], pB[i], flags[i]);
+    }
+    ret |= FixedPoint_HystBank16_Init(&hystBank, pA, pB, flags, 37U);
+    for (step = 0U; step < 200U; step++)
+    {
+        for (i = 0U; i < 37U; i++)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            x[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x7FFU) - 1024);
+            ret |= FixedPoint_Hyst16(&hyst[i], x[i], &in[i]);
+        }
+        ret |= FixedPoint_HystBank16(&hystBank, x);
+        ok &= (memcmp(flags, in, sizeof(in)) == 0) ? 1U : 0U;
+    }
+    ok &= (FixedPoint_Hyst16_Init(&hyst[0U], 1, 0, 0U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("CTRL", 2U, (boolean)((ret == E_OK) && (ok != 0U)), "hysteresis thresholds, bank matches instances",
+                passCount, failCount);
+
+    /* Dead zone: distance from the zone, saturation reported per element */
+    ret = FixedPoint_DeadZone16(50, -10, 20, &y[0U]);
+    ret |= FixedPoint_DeadZone16(-50, -10, 20, &y[1U]);
+    ret |= FixedPoint_DeadZone16(0, -10, 20, &y[2U]);
+    ok = ((ret == E_OK) && (y[0U] == 30) && (y[1U] == -40) && (y[2U] == 0)) ? 1U : 0U;
+    ok &= ((FixedPoint_DeadZone16(FIX16_MIN, 20000, 30000, &y[0U]) == E_NOT_OK) && (y[0U] == FIX16_MIN)) ? 1U : 0U;
+    for (i = 0U; i < 37U; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        x[i] = (t_Fixed16)((sint32)((seed >> 8U) & 0x7FFFU) - 16384);
+        pA[i] = (t_Fixed16)((sint32)((seed >> 4U) & 0x3FFFU) - 8192);
+        pB[i] = (t_Fixed16)(pA[i] + (t_Fixed16)((seed >> 18U) & 0x3FFFU));
+        ret = FixedPoint_DeadZone16(x[i], pA[i], pB[i], &yRef[i]);
+        ok &= (ret == E_OK) ? 1U : 0U;
+    }
+    ok &= ((FixedPoint_DeadZone16_Array(x, pA, pB, y, 37U) == E_OK) && (memcmp(y, yRef, sizeof(y)) == 0)) ? 1U : 0U;
+    x[9U] = FIX16_MAX;
+    pA[9U] = -20000;
+    pB[9U] = -20000;
+    ok &= (FixedPoint_DeadZone16_Array(x, pA, pB, y, 37U) == E_NOT_OK) ? 1U : 0U;
+    ok &= ((y[9U] == FIX16_MAX) && (y[8U] == yRef[8U]) && (y[36U] == yRef[36U])) ? 1U : 0U;
+    ReportCheck("CTRL", 3U, ok, "dead zone distances, saturation reported, array matches scalar", passCount,
+                failCount);
+
+    /* Low-pass: step response of a shift 4 filter within 1 LSB of 1 - (1 - 2^-4)^n, constant reached exactly */
+    ret = FixedPoint_LowPass16_Init(&lp[0U], 4U, 0);
+    ok = 1U;
+    for (step = 1U; step <= 300U; step++)
+    {
+        ret |= FixedPoint_LowPass16(&lp[0U], 10000, &y[0U]);
+        ok &= (fabs((double)y[0U] - (10000.0 * (1.0 - pow(1.0 - (1.0 / 16.0), (double)step)))) <= 1.0) ? 1U : 0U;
+    }
+    ok &= (y[0U] == 10000) ? 1U : 0U;
+    for (step = 1U; step <= 300U; step++)
+    {
+        ret |= FixedPoint_LowPass16(&lp[0U], -7, &y[0U]);
+    }
+    ok &= (y[0U] == -7) ? 1U : 0U;
+    for (i = 0U; i < 37U; i++)
+    {
+        y[i] = (t_Fixed16)(((i & 1U) != 0U) ? FIX16_MAX : FIX16_MIN);
+        ret |= FixedPoint_LowPass16_Init(&lp[i], 3U, y[i]);
+    }
+    ret |= FixedPoint_LowPassBank16_Init(&lpBank, 3U, y, frac, 37U);
+    for (step = 0U; step < 200U; step++)
+    {
+        for (i = 0U; i < 37U; i++)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            x[i] = (step < 20U) ? (t_Fixed16)(((i & 2U) != 0U) ? FIX16_MAX : FIX16_MIN)
+                                : (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+            ret |= FixedPoint_LowPass16(&lp[i], x[i], &yRef[i]);
+        }
+        ret |= FixedPoint_LowPassBank16(&lpBank, x, x);
+        ok &= (memcmp(x, yRef, sizeof(x)) == 0) ? 1U : 0U;
+    }
+    ok &= (FixedPoint_LowPass16_Init(&lp[0U], FIXEDPOINT_LOWPASS_MAX_SHIFT + 1U, 0) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("CTRL", 4U, (boolean)((ret == E_OK) && (ok != 0U)),
+                "low-pass step response without dead band, bank matches instances", passCount, failCount);
+
+    /* Debounce: on after 3 calls, off after 2 calls, glitches ignored */
+    {
+        static const boolean pattern[12U] = { 1U, 1U, 0U, 1U, 1U, 1U, 1U, 0U, 1U, 0U, 0U, 0U };
+        static const boolean expected[12U] = { 0U, 0U, 0U, 0U, 0U, 1U, 1U, 1U, 1U, 1U, 0U, 0U };
+
+        ret = FixedPoint_Debounce_Init(&db[0U], 3U, 2U, 0U);
+        ok = 1U;
+        for (step = 0U; step < 12U; step++)
+        {
+            ret |= FixedPoint_Debounce(&db[0U], pattern[step], &flag);
+            ok &= (flag == expected[step]) ? 1U : 0U;
+        }
+    }
+    for (i = 0U; i < 37U; i++)
+    {
+        tOn[i] = (uint16)(i % 5U);
+        tOff[i] = (uint16)((i * 7U) % 4U);
+        flags[i] = (boolean)(i & 1U);
+        ret |= FixedPoint_Debounce_Init(&db[i], tOn[i], tOff[i], flags[i]);
+    }
+    ret |= FixedPoint_DebounceBank_Init(&dbBank, tOn, tOff, count, flags, 37U);
+    for (step = 0U; step < 300U; step++)
+    {
+        for (i = 0U; i < 37U; i++)
+        {
+            seed = (seed * 1103515245U) + 12345U;
+            in[i] = (boolean)((((seed >> 16U) & 3U) != 0U) ? ((step / 8U) & 1U) : ((seed >> 8U) & 2U));
+            ret |= FixedPoint_Debounce(&db[i], in[i], &flag);
+        }
+        ret |= FixedPoint_DebounceBank(&dbBank, in);
+        for (i = 0U; i < 37U; i++)
+        {
+            ok &= ((flags[i] == db[i].state) && (count[i] == db[i].count)) ? 1U : 0U;
+        }
+    }
+    ok &= (FixedPoint_DebounceBank(NULL, in) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("CTRL", 5U, (boolean)((ret == E_OK) && (ok != 0U)), "debounce times, bank matches instances",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the target DSP emulation.
+ *
+ *  Hand-checked rounding cases, the scalar emulation against the instruction definitions in double
+ *  precision and the SSE2 kernels against the scalar emulation for all first operands.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunDspTests(unsigned int* passCount, unsigned int* failCount)
+{
+    /* a * 0x4000 = a / 2 in Q15 for a = 3, 1, -1, -3, per mode */
+    static const sint16 halves[4U] = { 3, 1, -1, -3 };
+    static const sint16 expected[FIXEDPOINT_DSP_MODES][4U] =
+    {
+        { 2, 1, 0, -1 },    /* SQRDMULH: round half up */
+        { 1, 0, -1, -2 },   /* SQDMULH: truncation */
+        { 2, 0, 0, -2 },    /* C55x: round half to even */
+        { 1, 0, -1, -2 }    /* TI Q15: truncation */
+    };
+    static sint16 a[65536U];
+    static sint16 b[65536U];
+    static sint16 r[65536U];
+    Std_ReturnType ret;
+    Std_ReturnType retRef;
+    boolean ok = 1U;
+    uint32 seed = 99U;
+    uint32 mode;
+    uint32 op;
+    uint32 i;
+    sint16 v;
+
+    printf("\n--- MODULE CHECKS: DSP ---\n");
+
+    for (mode = 0U; mode < (uint32)FIXEDPOINT_DSP_MODES; mode++)
+    {
+        const FixedPoint_DspMode_t m = (FixedPoint_DspMode_t)mode;
+        const boolean wraps = (m == FIXEDPOINT_DSP_TI_Q15) ? 1U : 0U;
+
+        for (i = 0U; i < 4U; i++)
+        {
+            ok &= ((FixedPoint_Dsp_Mult16(m, halves[i], 0x4000, &v) == E_OK) && (v == expected[mode][i])) ? 1U : 0U;
+        }
+        ok &= ((FixedPoint_Dsp_Mult16(m, 0x4000, 0x4000, &v) == E_OK) && (v == 0x2000)) ? 1U : 0U;
+        ret = FixedPoint_Dsp_Mult16(m, -32768, -32768, &v);
+        ok &= wraps ? ((ret == E_OK) && (v == -32768)) : ((ret == E_NOT_OK) && (v == 32767));
+        ret = FixedPoint_Dsp_Add16(m, 30000, 10000, &v);
+        ok &= wraps ? ((ret == E_OK) && (v == -25536)) : ((ret == E_NOT_OK) && (v == 32767));
+        ret = FixedPoint_Dsp_Sub16(m, -30000, 10000, &v);
+        ok &= wraps ? ((ret == E_OK) && (v == 25536)) : ((ret == E_NOT_OK) && (v == -32768));
+    }
+    ReportCheck("DSP", 1U, ok, "rounding of each mode, saturation or wrap of -1 * -1 and of add / sub", passCount,
+                failCount);
+
+    /* Scalar emulation against the instruction definitions */
+    ok = 1U;
+    for (i = 0U; i < 200000U; i++)
+    {
+        sint16 x;
+        sint16 y;
+        double p;
+        double ref[FIXEDPOINT_DSP_MODES];
+
+        seed = (seed * 1103515245U) + 12345U;
+        x = (sint16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+        seed = (seed * 1103515245U) + 12345U;
+        y = (sint16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+        if ((i & 7U) == 0U)
+        {
+            y = (sint16)(((i >> 3U) & 1U) != 0U ? 0x4000 : -0x4000);
+        }
+
+        p = (double)x * (double)y;
+        ref[FIXEDPOINT_DSP_ARM_SQRDMULH] = fmin(floor(((2.0 * p) + 32768.0) / 65536.0), 32767.0);
+        ref[FIXEDPOINT_DSP_ARM_SQDMULH] = fmin(floor((2.0 * p) / 65536.0), 32767.0);
+        ref[FIXEDPOINT_DSP_TI_C55X] = fmin(nearbyint(p / 32768.0), 32767.0);
+        ref[FIXEDPOINT_DSP_TI_Q15] = (double)(sint16)(uint16)(uint32)(sint32)floor(p / 32768.0);
+
+        for (mode = 0U; mode < (uint32)FIXEDPOINT_DSP_MODES; mode++)
+        {
+            (void)FixedPoint_Dsp_Mult16((FixedPoint_DspMode_t)mode, x, y, &v);
+            ok &= ((double)v == ref[mode]) ? 1U : 0U;
+        }
+    }
+    ReportCheck("DSP", 2U, ok, "scalar emulation matches the SQRDMULH, SQDMULH, MPYR and Q15 C definitions",
+                passCount, failCount);
+
+    /* SSE2 kernels against the scalar emulation: all first operands, random and extreme second operands */
+    ok = 1U;
+    for (i = 0U; i < 65536U; i++)
+    {
+        seed = (seed * 1103515245U) + 12345U;
+        a[i] = (sint16)((sint32)i - 32768);
+        b[i] = (sint16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);
+        if ((seed & 0x300U) == 0U)
+        {
+            b[i] = (sint16)(((seed & 0x400U) != 0U) ? -32768 : 32767);
+        }
+    }
+    b[0] = -32768;  /* -1 * -1 in the first SIMD group */
+    for (mode = 0U; mode < (uint32)FIXEDPOINT_DSP_MODES; mode++)
+    {
+        for (op = 0U; op < 3U; op++)
+        {
+            const FixedPoint_DspMode_t m = (FixedPoint_DspMode_t)mode;
+
+            ret = (op == 0U) ? FixedPoint_Dsp_Mult16_Array(m, a, b, r, 65536U)
+                : ((op == 1U) ? FixedPoint_Dsp_Add16_Array(m, a, b, r, 65536U)
+                              : FixedPoint_Dsp_Sub16_Array(m, a, b, r, 65536U));
+            retRef = E_OK;
+            for (i = 0U; i < 65536U; i++)
+            {
+                retRef |= (op == 0U) ? FixedPoint_Dsp_Mult16(m, a[i], b[i], &v)
+                        : ((op == 1U) ? FixedPoint_Dsp_Add16(m, a[i], b[i], &v) : FixedPoint_Dsp_Sub16(m, a[i], b[i], &v));
+                ok &= (r[i] == v) ? 1U : 0U;
+            }
+            ok &= (ret == retRef) ? 1U : 0U;
+            ok &= (ret == ((m == FIXEDPOINT_DSP_TI_Q15) ? E_OK : E_NOT_OK)) ? 1U : 0U;
+        }
+    }
+    /* In place with saturated lanes */
+    for (i = 0U; i < 64U; i++)
+    {
+        r[i] = a[i];
+    }
+    (void)FixedPoint_Dsp_Sub16_Array(FIXEDPOINT_DSP_ARM_SQDMULH, r, b, r, 64U);
+    for (i = 0U; i < 64U; i++)
+    {
+        (void)FixedPoint_Dsp_Sub16(FIXEDPOINT_DSP_ARM_SQDMULH, a[i], b[i], &v);
+        ok &= (r[i] == v) ? 1U : 0U;
+    }
+    ReportCheck("DSP", 3U, ok, "SSE2 kernels bit-identical to the scalar emulation, saturation flag, in place",
+                passCount, failCount);
+
+    /* Invalid arguments */
+    ok = (FixedPoint_Dsp_Mult16(FIXEDPOINT_DSP_MODES, 1, 1, &v) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Dsp_Add16(FIXEDPOINT_DSP_ARM_SQRDMULH, 1, 1, NULL) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Dsp_Mult16_Array(FIXEDPOINT_DSP_TI_C55X, a, NULL, r, 8U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("DSP", 4U, ok, "invalid mode and null pointers rejected", passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Module checks of the simulation runtime.
+ *
+ *  A PI controller with a first-order plant, run for 1000 instances with random parameters, against
+ *  the same steps executed instance by instance with FixedPoint_Op16_Strided().
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunSimTests(unsigned int* passCount, unsigned int* failCount)
+{
+    /* Registers: 0 w, 1 y, 2 kp, 3 ki, 4 integral, 5 umin, 6 umax, 7 alpha, 8 e, 9 ki * e, 10 u, 11 dy,
+       12 gain, 13 last u */
+    static const FixedPoint_SimStep_t steps[12U] =
+    {
+        { FIXEDPOINT_SIM_SUB, 8U, 0U, 1U },
+        { FIXEDPOINT_SIM_MULT, 9U, 3U, 8U },
+        { FIXEDPOINT_SIM_ADD, 4U, 4U, 9U },
+        { FIXEDPOINT_SIM_MAX, 4U, 4U, 5U },
+        { FIXEDPOINT_SIM_MIN, 4U, 4U, 6U },
+        { FIXEDPOINT_SIM_MULT, 10U, 2U, 8U },
+        { FIXEDPOINT_SIM_ADD, 10U, 10U, 4U },
+        { FIXEDPOINT_SIM_DIV, 10U, 10U, 12U },
+        { FIXEDPOINT_SIM_SUB, 11U, 10U, 1U },
+        { FIXEDPOINT_SIM_MULT, 11U, 7U, 11U },
+        { FIXEDPOINT_SIM_ADD, 1U, 1U, 11U },
+        { FIXEDPOINT_SIM_MOV, 13U, 10U, 0U }
+    };
+    static const FixedPoint_SimStep_t divOnly[1U] = { { FIXEDPOINT_SIM_DIV, 0U, 1U, 2U } };
+    static const FixedPoint_SimStep_t badStep[1U] = { { FIXEDPOINT_SIM_ADD, 0U, 1U, SIM_TEST_REGS } };
+    static t_Fixed16 regs[FIXEDPOINT_SIM_REGS_LEN(SIM_TEST_REGS, SIM_TEST_INSTANCES)];
+    static t_Fixed16 regs2[FIXEDPOINT_SIM_REGS_LEN(SIM_TEST_REGS, SIM_TEST_INSTANCES)];
+    static uint8 status[FIXEDPOINT_SIM_STATUS_LEN(SIM_TEST_INSTANCES)];
+    static uint8 status2[FIXEDPOINT_SIM_STATUS_LEN(SIM_TEST_INSTANCES)];
+    static t_Fixed16 ref[SIM_TEST_INSTANCES][SIM_TEST_REGS];
+    static uint8 refStatus[SIM_TEST_INSTANCES];
+    static t_Fixed16 values[SIM_TEST_INSTANCES];
+    FixedPoint_Sim_t sim;
+    FixedPoint_Sim_t sim2;
+    Std_ReturnType ret;
+    boolean ok;
+    uint32 seed = 321U;
+    uint32 flagged = 0U;
+    uint32 n;
+    uint32 k;
+    uint32 it;
+    uint32 s;
+    uint8 st;
+    t_Fixed16 v;
+
+    printf("\n--- MODULE CHECKS: SIMULATION ---\n");
+
+    ok = (FixedPoint_Sim_Init(&sim, steps, 12U, regs, SIM_TEST_REGS, status, SIM_TEST_INSTANCES) == E_OK) ? 1U : 0U;
+    for (n = 0U; n < SIM_TEST_INSTANCES; n++)
+    {
+        for (k = 0U; k < SIM_TEST_REGS; k++)
+        {
+            ref[n][k] = 0;
+        }
+        seed = (seed * 1103515245U) + 12345U;
+        ref[n][0] = (t_Fixed16)((sint32)((seed >> 8U) & 0xFFFFU) - 32768);      /* setpoint */
+        seed = (seed * 1103515245U) + 12345U;
+        ref[n][2] = (t_Fixed16)((seed >> 8U) & 0x3FFU);                          /* kp 0..4 */
+        ref[n][3] = (t_Fixed16)((seed >> 18U) & 0x3FU);                          /* ki 0..0.25 */
+        ref[n][7] = (t_Fixed16)((seed >> 24U) & 0x7FU);                          /* alpha 0..0.5 */
+        seed = (seed * 1103515245U) + 12345U;
+        ref[n][6] = (t_Fixed16)((seed >> 8U) & 0x7FFFU);                         /* umax */
+        ref[n][5] = (t_Fixed16)(-(sint32)ref[n][6]);                             /* umin */
+        ref[n][12] = (t_Fixed16)(((n % 97U) == 5U) ? 0 : (((n % 13U) == 0U) ? 16 : 256));  /* gain */
+        refStatus[n] = 0U;
+        for (k = 0U; k < SIM_TEST_REGS; k++)
+        {
+            ok &= (FixedPoint_Sim_Set(&sim, k, n, ref[n][k]) == E_OK) ? 1U : 0U;
+        }
+    }
+
+    /* Reference: instance by instance through the batch kernels */
+    for (n = 0U; n < SIM_TEST_INSTANCES; n++)
+    {
+        for (it = 0U; it < 20U; it++)
+        {
+            for (s = 0U; s < 12U; s++)
+            {
+                t_Fixed16* r = ref[n];
+                const FixedPoint_SimStep_t* step = &steps[s];
+
+                if (step->op <= FIXEDPOINT_SIM_DIV)
+                {
+                    ret = FixedPoint_Op16_Strided((FixedPoint_Operation_t)step->op, &r[step->src1], 1, &r[step->src2],
+                                                  1, &r[step->dst], 1, 1U);
+                    if (ret != E_OK)
+                    {
+                        refStatus[n] |= ((step->op == FIXEDPOINT_SIM_DIV) && (r[step->src2] == 0))
+                                      ? FIXEDPOINT_SIM_STATUS_DIV_ZERO : FIXEDPOINT_SIM_STATUS_SAT;
+                    }
+                }
+                else if (step->op == FIXEDPOINT_SIM_MIN)
+                {
+                    r[step->dst] = (r[step->src1] < r[step->src2]) ? r[step->src1] : r[step->src2];
+                }
+                else if (step->op == FIXEDPOINT_SIM_MAX)
+                {
+                    r[step->dst] = (r[step->src1] > r[step->src2]) ? r[step->src1] : r[step->src2];
+                }
+                else
+                {
+                    r[step->dst] = r[step->src1];
+                }
+            }
+        }
+    }
+
+    /* Two runs of 10 iterations, the second one split into group ranges */
+    ret = FixedPoint_Sim_Run(&sim, 0U, sim.numGroups, 10U);
+    ret |= FixedPoint_Sim_Run(&sim, 0U, 5U, 10U);
+    ret |= FixedPoint_Sim_Run(&sim, 5U, sim.numGroups - 5U, 10U);
+    for (n = 0U; n < SIM_TEST_INSTANCES; n++)
+    {
+        for (k = 0U; k < SIM_TEST_REGS; k++)
+        {
+            ok &= ((FixedPoint_Sim_Get(&sim, k, n, &v) == E_OK) && (v == ref[n][k])) ? 1U : 0U;
+        }
+        ok &= ((FixedPoint_Sim_GetStatus(&sim, n, &st) == E_OK) && (st == refStatus[n])) ? 1U : 0U;
+        flagged += (st != 0U) ? 1U : 0U;
+    }
+    ok &= ((ret == E_NOT_OK) && (flagged > 0U) && (flagged < SIM_TEST_INSTANCES)) ? 1U : 0U;
+    ReportCheck("SIM", 1U, ok, "PI controller and plant bit-exact per instance, per-lane saturation status",
+                passCount, failCount);
+
+    /* Workers claiming groups, arrays in and out, padding lanes not flagged */
+    ok = (FixedPoint_Sim_Init(&sim2, steps, 12U, regs2, SIM_TEST_REGS, status2, SIM_TEST_INSTANCES) == E_OK) ? 1U : 0U;
+    for (k = 0U; k < SIM_TEST_REGS; k++)
+    {
+        for (n = 0U; n < SIM_TEST_INSTANCES; n++)
+        {
+            (void)FixedPoint_Sim_Get(&sim, k, n, &values[n]);
+        }
+        ok &= (FixedPoint_Sim_SetArray(&sim2, k, values) == E_OK) ? 1U : 0U;
+    }
+    (void)FixedPoint_Sim_ClearStatus(&sim);
+    (void)FixedPoint_Sim_Run(&sim, 0U, sim.numGroups, 3U);
+    ok &= (FixedPoint_Sim_Begin(&sim2) == E_OK) ? 1U : 0U;
+    (void)FixedPoint_Sim_Work(&sim2, 3U);
+    (void)FixedPoint_Sim_Work(&sim2, 3U);     /* second worker finds nothing left */
+    for (k = 0U; k < SIM_TEST_REGS; k++)
+    {
+        ok &= (FixedPoint_Sim_GetArray(&sim2, k, values) == E_OK) ? 1U : 0U;
+        for (n = 0U; n < SIM_TEST_INSTANCES; n++)
+        {
+            (void)FixedPoint_Sim_Get(&sim, k, n, &v);
+            ok &= (values[n] == v) ? 1U : 0U;
+        }
+    }
+    for (n = 0U; n < FIXEDPOINT_SIM_STATUS_LEN(SIM_TEST_INSTANCES); n++)
+    {
+        ok &= (status[n] == status2[n]) ? 1U : 0U;
+    }
+    (void)FixedPoint_Sim_Init(&sim2, divOnly, 1U, regs2, SIM_TEST_REGS, status2, SIM_TEST_INSTANCES);
+    (void)FixedPoint_Sim_Set(&sim2, 2U, 7U, 256);
+    ret = FixedPoint_Sim_Run(&sim2, 0U, sim2.numGroups, 1U);
+    for (n = 0U; n < FIXEDPOINT_SIM_STATUS_LEN(SIM_TEST_INSTANCES); n++)
+    {
+        ok &= (status2[n] == (((n < SIM_TEST_INSTANCES) && (n != 7U)) ? FIXEDPOINT_SIM_STATUS_DIV_ZERO : 0U)) ? 1U : 0U;
+    }
+    ok &= ((ret == E_NOT_OK) && (FixedPoint_Sim_ClearStatus(&sim2) == E_OK) && (status2[0] == 0U)) ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Run(&sim2, 0U, 1U, 1U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("SIM", 2U, ok, "workers claiming groups match a single run, padding lanes not flagged",
+                passCount, failCount);
+
+    /* Invalid arguments */
+    ok = (FixedPoint_Sim_Init(&sim2, badStep, 1U, regs2, SIM_TEST_REGS, status2, SIM_TEST_INSTANCES) == E_NOT_OK)
+       ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Init(&sim2, steps, 12U, regs2, SIM_TEST_REGS, status2, 0U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Run(&sim, sim.numGroups, 1U, 1U) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Set(&sim, 0U, SIM_TEST_INSTANCES, 0) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Get(&sim, SIM_TEST_REGS, 0U, &v) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Sim_Work(NULL, 1U) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("SIM", 3U, ok, "invalid steps, ranges and null pointers rejected", passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Right-hand side dx/dt = a x of the ODE checks, 16-bit, one gain a per system.
+ *
+ *  @param[in]  context     Gains in configured 16-bit Q-format (t_Fixed16, num values).
+ *  @param[in]  x           States.
+ *  @param[out] dxdt        Derivatives.
+ *  @param[in]  num         Number of systems.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Always.
+ */
+static Std_ReturnType IntegTestLinear16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num)
+{
+    const t_Fixed16* a = (const t_Fixed16*)context;
+    uint32 s;
+
+    for (s = 0U; s < num; s++)
+    {
+        sint32 d = ((sint32)a[s] * (sint32)x[s]) / (sint32)SCALE_16;
+
+        d = (d > FIX16_MAX) ? FIX16_MAX : ((d < FIX16_MIN) ? FIX16_MIN : d);
+        dxdt[s] = (t_Fixed16)d;
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Right-hand side dx/dt = a x of the ODE checks, 32-bit, one gain a per system.
+ *
+ *  @param[in]  context     Gains in configured 32-bit Q-format (t_Fixed32, num values).
+ *  @param[in]  x           States.
+ *  @param[out] dxdt        Derivatives.
+ *  @param[in]  num         Number of systems.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Always.
+ */
+static Std_ReturnType IntegTestLinear32(void* context, const t_Fixed32* x, t_Fixed32* dxdt, uint32 num)
+{
+    const t_Fixed32* a = (const t_Fixed32*)context;
+    uint32 s;
+
+    for (s = 0U; s < num; s++)
+    {
+        sint64 d = ((sint64)a[s] * (sint64)x[s]) / (sint64)SCALE_32;
+
+        d = (d > FIX32_MAX) ? FIX32_MAX : ((d < FIX32_MIN) ? FIX32_MIN : d);
+        dxdt[s] = (t_Fixed32)d;
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Right-hand side of the oscillators x' = v, v' = -w2 x of the ODE checks, 16-bit.
+ *
+ *  @param[in]  context     Squared angular frequencies w2 in configured 16-bit Q-format (t_Fixed16, num values).
+ *  @param[in]  x           States, positions x[s] and velocities x[num + s].
+ *  @param[out] dxdt        Derivatives.
+ *  @param[in]  num         Number of systems.
+ *
+ *  @return     Std_ReturnType
+ *  @retval     E_OK        Always.
+ */
+static Std_ReturnType IntegTestOsc16(void* context, const t_Fixed16* x, t_Fixed16* dxdt, uint32 num)
+{
+    const t_Fixed16* w2 = (const t_Fixed16*)context;
+    uint32 s;
+
+    for (s = 0U; s < num; s++)
+    {
+        sint32 d = -((sint32)w2[s] * (sint32)x[s]) / (sint32)SCALE_16;
+
+        d = (d > FIX16_MAX) ? FIX16_MAX : ((d < FIX16_MIN) ? FIX16_MIN : d);
+        dxdt[s] = x[num + s];
+        dxdt[num + s] = (t_Fixed16)d;
+    }
+
+    return E_OK;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the integrators of sampled signals and of the Euler and RK4 ODE steps.
+ *
+ *  Simpson's rule must be exact for a cubic and the trapezoid rule for a ramp; the rounding modes are
+ *  checked on half-LSB results. RK4 must beat Euler on dx/dt = -x, and a batch of oscillators stepped
+ *  in one call must match stepping each oscillator on its own bit for bit.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunIntegTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 x[2U * INTEG_TEST_SYSTEMS];
+    static t_Fixed16 w2[INTEG_TEST_SYSTEMS];
+    static t_Fixed16 stage[FIXEDPOINT_ODE_STAGE_LEN(2U, INTEG_TEST_SYSTEMS)];
+    static sint64 acc[FIXEDPOINT_ODE_ACC_LEN(2U, INTEG_TEST_SYSTEMS)];
+    static t_Fixed16 ref[2U * INTEG_TEST_SYSTEMS];
+    t_Fixed16 y16[9U];
+    t_Fixed16 c16[9U];
+    t_Fixed32 y32[17U];
+    t_Fixed32 c32[17U];
+    t_Fixed16 stage16[FIXEDPOINT_ODE_STAGE_LEN(2U, 1U)];
+    t_Fixed32 stage32[FIXEDPOINT_ODE_STAGE_LEN(1U, 1U)];
+    sint64 acc1[FIXEDPOINT_ODE_ACC_LEN(2U, 1U)];
+    FixedPoint_Ode16_t ode;
+    FixedPoint_Ode32_t ode32;
+    Std_ReturnType ret;
+    boolean ok;
+    t_Fixed16 r16;
+    t_Fixed16 r16b;
+    t_Fixed16 r16c;
+    t_Fixed16 gain16;
+    t_Fixed16 s16[2U];
+    t_Fixed32 r32;
+    t_Fixed32 gain32;
+    t_Fixed32 s32;
+    double errEuler;
+    double errRk4;
+    double err32;
+    uint32 n;
+    uint32 it;
+
+    printf("\n--- MODULE CHECKS: INTEGRATION ---\n");
+
+    /* Simpson on x^3 over [0, 2] with h = 1/4 gives 4, trapezoid on x gives 2 */
+    for (n = 0U; n < 9U; n++)
+    {
+        y16[n] = (t_Fixed16)(((sint32)(n * n * n) * (sint32)SCALE_16) / 64);
+    }
+    ok = ((FixedPoint_Simpson16(y16, 9U, (t_Fixed16)(SCALE_16 / 4), FIXEDPOINT_ROUND_NEAREST, &r16) == E_OK) &&
+          (r16 == (t_Fixed16)(4 * SCALE_16))) ? 1U : 0U;
+    for (n = 0U; n < 9U; n++)
+    {
+        y16[n] = (t_Fixed16)(((sint32)n * (sint32)SCALE_16) / 4);
+    }
+    ok &= ((FixedPoint_Trapz16(y16, 9U, (t_Fixed16)(SCALE_16 / 4), FIXEDPOINT_ROUND_NEAREST, &r16) == E_OK) &&
+           (r16 == (t_Fixed16)(2 * SCALE_16))) ? 1U : 0U;
+
+    /* Half-LSB results +0.5, +1.5 and -0.5 in the three rounding modes */
+    y16[0] = 1;
+    y16[1] = 0;
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, &r16);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_FLOOR, &r16b);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_EVEN, &r16c);
+    ok &= ((r16 == 1) && (r16b == 0) && (r16c == 0)) ? 1U : 0U;
+    y16[0] = 3;
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, &r16);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_FLOOR, &r16b);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_EVEN, &r16c);
+    ok &= ((r16 == 2) && (r16b == 1) && (r16c == 2)) ? 1U : 0U;
+    y16[0] = -1;
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, &r16);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_FLOOR, &r16b);
+    (void)FixedPoint_Trapz16(y16, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_EVEN, &r16c);
+    ok &= ((r16 == -1) && (r16b == -1) && (r16c == 0)) ? 1U : 0U;
+    ReportCheck("INTEG", 1U, ok, "16-bit Simpson exact for a cubic, trapezoid for a ramp, rounding modes",
+                passCount, failCount);
+
+    /* 32-bit: Simpson on x^3 over [0, 2] with h = 1/8, running trapezoid in place ends at the trapezoid */
+    for (n = 0U; n < 17U; n++)
+    {
+        y32[n] = (t_Fixed32)(((sint64)(n * n * n) * (sint64)SCALE_32) / 512);
+        c32[n] = y32[n];
+    }
+    ok = ((FixedPoint_Simpson32(y32, 17U, (t_Fixed32)(SCALE_32 / 8), FIXEDPOINT_ROUND_EVEN, &r32) == E_OK) &&
+          (r32 == (t_Fixed32)(4 * (sint64)SCALE_32))) ? 1U : 0U;
+    ok &= (FixedPoint_Trapz32(y32, 17U, (t_Fixed32)(SCALE_32 / 8), FIXEDPOINT_ROUND_EVEN, &r32) == E_OK) ? 1U : 0U;
+    ok &= ((FixedPoint_CumTrapz32(c32, 17U, (t_Fixed32)(SCALE_32 / 8), FIXEDPOINT_ROUND_EVEN, c32) == E_OK) &&
+           (c32[0] == 0) && (c32[16] == r32)) ? 1U : 0U;
+    for (n = 0U; n < 9U; n++)
+    {
+        y16[n] = (t_Fixed16)SCALE_16;
+    }
+    ok &= ((FixedPoint_CumTrapz16(y16, 9U, (t_Fixed16)(SCALE_16 / 4), FIXEDPOINT_ROUND_NEAREST, c16) == E_OK) &&
+           (c16[4] == (t_Fixed16)SCALE_16) && (c16[8] == (t_Fixed16)(2 * SCALE_16))) ? 1U : 0U;
+    for (n = 0U; n < 17U; n++)
+    {
+        y32[n] = FIX32_MAX;
+    }
+    ok &= ((FixedPoint_Trapz32(y32, 17U, (t_Fixed32)SCALE_32, FIXEDPOINT_ROUND_NEAREST, &r32) == E_NOT_OK) &&
+           (r32 == FIX32_MAX)) ? 1U : 0U;
+    ReportCheck("INTEG", 2U, ok, "32-bit Simpson exact, running trapezoid in place, saturation", passCount, failCount);
+
+    /* dx/dt = -x from x = 1 to t = 1: RK4 closer to exp(-1) than Euler, 32-bit RK4 within a few LSB */
+    gain16 = (t_Fixed16)(-(sint32)SCALE_16);
+    s16[0] = (t_Fixed16)SCALE_16;
+    ok = (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_EULER, IntegTestLinear16, &gain16, 1U, 1U,
+                                (t_Fixed16)(SCALE_16 / 8), FIXEDPOINT_ROUND_NEAREST, stage16, NULL) == E_OK) ? 1U : 0U;
+    for (it = 0U; it < 8U; it++)
+    {
+        ok &= (FixedPoint_Ode16_Step(&ode, s16) == E_OK) ? 1U : 0U;
+    }
+    errEuler = fabs(((double)s16[0] / (double)SCALE_16) - exp(-1.0));
+    s16[0] = (t_Fixed16)SCALE_16;
+    ok &= (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_RK4, IntegTestLinear16, &gain16, 1U, 1U,
+                                 (t_Fixed16)(SCALE_16 / 8), FIXEDPOINT_ROUND_NEAREST, stage16, acc1) == E_OK) ? 1U : 0U;
+    for (it = 0U; it < 8U; it++)
+    {
+        ok &= (FixedPoint_Ode16_Step(&ode, s16) == E_OK) ? 1U : 0U;
+    }
+    errRk4 = fabs(((double)s16[0] / (double)SCALE_16) - exp(-1.0));
+    gain32 = (t_Fixed32)(-(sint64)SCALE_32);
+    s32 = (t_Fixed32)SCALE_32;
+    ok &= (FixedPoint_Ode32_Init(&ode32, FIXEDPOINT_ODE_RK4, IntegTestLinear32, &gain32, 1U, 1U,
+                                 (t_Fixed32)(SCALE_32 / 8), FIXEDPOINT_ROUND_EVEN, stage32, acc1) == E_OK) ? 1U : 0U;
+    for (it = 0U; it < 8U; it++)
+    {
+        ok &= (FixedPoint_Ode32_Step(&ode32, &s32) == E_OK) ? 1U : 0U;
+    }
+    err32 = fabs(((double)s32 / (double)SCALE_32) - exp(-1.0));
+    ok &= ((errRk4 < errEuler) && (err32 < (8.0 / (double)SCALE_32))) ? 1U : 0U;
+    ReportCheck("INTEG", 3U, ok, "RK4 more accurate than Euler on exponential decay, 16 and 32 bit",
+                passCount, failCount);
+
+    /* Oscillators with different frequencies in one call against one call per oscillator */
+    for (n = 0U; n < INTEG_TEST_SYSTEMS; n++)
+    {
+        w2[n] = (t_Fixed16)((SCALE_16 / 4U) + ((n * 7U) % (4U * SCALE_16)));
+        x[n] = (t_Fixed16)((sint32)SCALE_16 - (sint32)(n % 64U));
+        x[INTEG_TEST_SYSTEMS + n] = 0;
+        ref[2U * n] = x[n];
+        ref[(2U * n) + 1U] = 0;
+    }
+    ok = (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_RK4, IntegTestOsc16, w2, 2U, INTEG_TEST_SYSTEMS,
+                                (t_Fixed16)(SCALE_16 / 16), FIXEDPOINT_ROUND_EVEN, stage, acc) == E_OK) ? 1U : 0U;
+    for (it = 0U; it < 50U; it++)
+    {
+        ok &= (FixedPoint_Ode16_Step(&ode, x) == E_OK) ? 1U : 0U;
+    }
+    for (n = 0U; n < INTEG_TEST_SYSTEMS; n++)
+    {
+        ok &= (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_RK4, IntegTestOsc16, &w2[n], 2U, 1U,
+                                     (t_Fixed16)(SCALE_16 / 16), FIXEDPOINT_ROUND_EVEN, stage16, acc1) == E_OK)
+            ? 1U : 0U;
+        for (it = 0U; it < 50U; it++)
+        {
+            ok &= (FixedPoint_Ode16_Step(&ode, &ref[2U * n]) == E_OK) ? 1U : 0U;
+        }
+        ok &= ((x[n] == ref[2U * n]) && (x[INTEG_TEST_SYSTEMS + n] == ref[(2U * n) + 1U])) ? 1U : 0U;
+    }
+
+    /* Growth dx/dt = x beyond the format saturates */
+    gain16 = (t_Fixed16)SCALE_16;
+    s16[0] = (t_Fixed16)(FIX16_MAX / 2);
+    ok &= (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_EULER, IntegTestLinear16, &gain16, 1U, 1U,
+                                 (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, stage16, NULL) == E_OK) ? 1U : 0U;
+    ret = FixedPoint_Ode16_Step(&ode, s16);
+    ret |= FixedPoint_Ode16_Step(&ode, s16);
+    ok &= ((ret == E_NOT_OK) && (s16[0] == FIX16_MAX)) ? 1U : 0U;
+    ReportCheck("INTEG", 4U, ok, "batched RK4 oscillators bit-exact with single systems, saturation flagged",
+                passCount, failCount);
+
+    /* Invalid arguments */
+    ok = (FixedPoint_Trapz16(y16, 1U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, &r16) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Simpson16(y16, 8U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, &r16) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Trapz32(y32, 2U, (t_Fixed32)SCALE_32, FIXEDPOINT_ROUND_MODES, &r32) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_CumTrapz16(NULL, 2U, (t_Fixed16)SCALE_16, FIXEDPOINT_ROUND_NEAREST, c16) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Ode16_Init(&ode, FIXEDPOINT_ODE_RK4, IntegTestOsc16, w2, 2U, 1U, (t_Fixed16)SCALE_16,
+                                 FIXEDPOINT_ROUND_NEAREST, stage16, NULL) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Ode32_Init(&ode32, FIXEDPOINT_ODE_EULER, IntegTestLinear32, &gain32, 1U, 1U, 0,
+                                 FIXEDPOINT_ROUND_NEAREST, stage32, NULL) == E_NOT_OK) ? 1U : 0U;
+    ok &= (FixedPoint_Ode32_Step(&ode32, NULL) == E_NOT_OK) ? 1U : 0U;
+    ReportCheck("INTEG", 5U, ok, "invalid lengths, rounding modes, buffers and step sizes rejected",
+                passCount, failCount);
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Tuning tool: time all candidates on this host and write the tuning profile to a file.
+ *
+ *  The table image is built in memory for the table candidates.
+ *
+ *  @param[in]  path    Output file name.
+ *
+ *  @return     int
+ *  @retval     0       Profile written.
+ *  @retval     1       Tuning or writing failed.
+ */
+static int TuneToFile(const char* path)
+{
+    FixedPoint_TuneProfile_t profile;
+    int result = 1;
+    FILE* file;
+
+    (void)FixedPoint_Table_Build(TableImage, FIXEDPOINT_TABLE_IMAGE_SIZE);
+    (void)FixedPoint_Table_Attach(TableImage, FIXEDPOINT_TABLE_IMAGE_SIZE);
+
+    if (FixedPoint_Tune_Run(&profile, TuneWork, (uint32)(sizeof(TuneWork) / sizeof(TuneWork[0])), &TuneClock) == E_OK)
+    {
+        file = fopen(path, "wb");
+        if (file != NULL)
+        {
+            if (fwrite(&profile, sizeof(profile), 1U, file) == 1U)
+            {
+                result = 0;
+            }
+            result |= (fclose(file) == 0) ? 0 : 1;
+        }
+
+        printf("Tuning profile %s: %s (mult8=%s, div8=%s, block length %lu)\n", path,
+               (result == 0) ? "written" : "FAILED",
+               (profile.mult8Impl == (uint32)FIXEDPOINT_IMPL_TABLE) ? "table" : "compute",
+               (profile.div8Impl == (uint32)FIXEDPOINT_IMPL_TABLE) ? "table" : "compute",
+               (unsigned long)profile.blockLen);
+    }
+
+    FixedPoint_Table_Detach();
+
+    return result;
+}
+
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Checks of the result cache in front of FixedPoint_Mult16 and FixedPoint_Div16.
+ *
+ *  A repeated operand pair must be answered from the cache with the same result and status
+ *  as the first (computed) call.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunCacheTests(unsigned int* passCount, unsigned int* failCount)
+{
+    FixedPoint_CacheStats_t stats = { 0U, 0U };
+    float first = 0.0f;
+    float second = 0.0f;
+    Std_ReturnType status1;
+    Std_ReturnType status2;
+
+    printf("\n--- MODULE CHECKS: RESULT CACHE ---\n");
+
+    FixedPoint_ResetCache();
+    status1 = FixedPoint_Div16(10.0f, 3.0f, &first);
+    status2 = FixedPoint_Div16(10.0f, 3.0f, &second);
+    (void)FixedPoint_GetCacheStats(FIXEDPOINT_OP_DIV, &stats);
+    ReportCheck("CACHE", 1U, (boolean)((stats.hits == 1U) && (stats.misses == 1U)),
+                "repeated Div16 operand pair is a cache hit", passCount, failCount);
+    ReportCheck("CACHE", 2U, (boolean)((first == second) && (status1 == status2)),
+                "cached Div16 result and status equal the computed ones", passCount, failCount);
+
+    status1 = FixedPoint_Mult16(100.0f, 100.0f, &first);
+    status2 = FixedPoint_Mult16(100.0f, 100.0f, &second);
+    ReportCheck("CACHE", 3U, (boolean)((first == second) && (status1 == E_NOT_OK) && (status2 == E_NOT_OK)),
+                "cached Mult16 keeps the saturation status", passCount, failCount);
+}
+#endif
+
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Time source of the trace: performance counter ticks.
+ *
+ *  @return     uint64
+ *  @retval     Current counter value.
+ */
+static uint64 TraceClock(void)
+{
+    LARGE_INTEGER count;
+
+    (void)QueryPerformanceCounter(&count);
+
+    return (uint64)count.QuadPart;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the timeline trace.
+ *
+ *  A traced stream pipeline must produce matching begin and end events in the Chrome trace output,
+ *  also when the event buffer runs full inside an open section.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunTraceTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static t_Fixed16 input[100];
+    static t_Fixed16 output[100];
+    t_Fixed16 bufA[16];
+    t_Fixed16 bufB[16];
+    char line[256];
+    LARGE_INTEGER freq;
+    FixedPoint_Stream_t stream;
+    FixedPoint_StreamArraySource_t source;
+    FixedPoint_StreamArraySink_t sink;
+    FixedPoint_StreamScalarOp_t scale;
+    uint32 dropped = 1U;
+    uint32 begins = 0U;
+    uint32 ends = 0U;
+    uint32 i;
+    FILE* file;
+    Std_ReturnType ret;
+
+    printf("\n--- MODULE CHECKS: TRACE ---\n");
+
+    (void)QueryPerformanceFrequency(&freq);
+    ret = FixedPoint_Trace_Init(&TraceClock, (double)freq.QuadPart / 1.0e6);
+
+    (void)memset(input, 0, sizeof(input));
+    source.data = input;
+    source.len = 100U;
+    source.pos = 0U;
+    sink.data = output;
+    sink.capacity = 100U;
+    sink.pos = 0U;
+    scale.op = FIXEDPOINT_OP_ADD;
+    scale.operand = 1;
+    ret |= FixedPoint_Stream_Init(&stream, bufA, bufB, 16U);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySource, &source);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ScalarOp, &scale);
+    ret |= FixedPoint_Stream_AddStage(&stream, &FixedPoint_Stream_ArraySink, &sink);
+
+    /* Discard events recorded by earlier checks */
+    file = tmpfile();
+    ret |= FixedPoint_Trace_Flush(file, NULL);
+    ret |= FixedPoint_Stream_Run(&stream);
+    ret |= FixedPoint_Trace_WriteHeader(file);
+    ret |= FixedPoint_Trace_Flush(file, &dropped);
+    ret |= FixedPoint_Trace_WriteFooter(file);
+
+    if (file != NULL)
+    {
+        rewind(file);
+        while (fgets(line, (int)sizeof(line), file) != NULL)
+        {
+            begins += (strstr(line, "\"ph\":\"B\"") != NULL) ? 1U : 0U;
+            ends += (strstr(line, "\"ph\":\"E\"") != NULL) ? 1U : 0U;
+        }
+        (void)fclose(file);
+    }
+
+    /* 7 blocks: source, transform, strided kernel and sink per block */
+    ReportCheck("TRACE", 1U, (boolean)((ret == E_OK) && (dropped == 0U) && (begins == 28U) && (ends == 28U)),
+                "traced pipeline writes matching begin and end events", passCount, failCount);
+
+    /* Overflow inside an open section: the end event of the section must still be recorded */
+    file = tmpfile();
+    begins = 0U;
+    ends = 0U;
+    dropped = 0U;
+    ret = E_OK;
+    FIXEDPOINT_TRACE_BEGIN("Check_Outer");
+    for (i = 0U; i < FIXEDPOINT_TRACE_BUFFER_SIZE; i++)
+    {
+        FIXEDPOINT_TRACE_BEGIN("Check_Inner");
+        FIXEDPOINT_TRACE_END("Check_Inner");
+    }
+    FIXEDPOINT_TRACE_END("Check_Outer");
+    ret |= FixedPoint_Trace_Flush(file, &dropped);
+
+    if (file != NULL)
+    {
+        rewind(file);
+        while (fgets(line, (int)sizeof(line), file) != NULL)
+        {
+            begins += (strstr(line, "\"ph\":\"B\"") != NULL) ? 1U : 0U;
+            ends += (strstr(line, "\"ph\":\"E\"") != NULL) ? 1U : 0U;
+        }
+        (void)fclose(file);
+    }
+
+    ReportCheck("TRACE", 2U, (boolean)((ret == E_OK) && (dropped > 0U) && (begins == ends) &&
+                                       ((begins + ends) == FIXEDPOINT_TRACE_BUFFER_SIZE)),
+                "full buffer keeps the end event of an open section", passCount, failCount);
+}
+#endif
+
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Write function of the saturation log dump: appends to SatLogText.
+ *
+ *  @param[in]  text    Text to append.
+ *  @param[in]  len     Number of characters.
+ */
+static void SatLogCapture(const char* text, uint32 len)
+{
+    if ((SatLogTextLen + len) < (uint32)sizeof(SatLogText))
+    {
+        (void)memcpy(&SatLogText[SatLogTextLen], text, len);
+        SatLogTextLen += len;
+        SatLogText[SatLogTextLen] = '\0';
+    }
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the saturation log.
+ *
+ *  Saturating operations must be logged with operands and result, regular operations must not
+ *  be logged and the dump must contain the logged entries.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunSatLogTests(unsigned int* passCount, unsigned int* failCount)
+{
+    FixedPoint_SatLogEntry_t entry;
+    uint32 count = 0U;
+    float r = 0.0f;
+    Std_ReturnType ret;
+
+    printf("\n--- MODULE CHECKS: SATURATION LOG ---\n");
+
+    FixedPoint_SatLog_Init(NULL);
+
+    /* 100.0 + 100.0 saturates in Q7.8 */
+    (void)FixedPoint_Add16(100.0f, 100.0f, &r);
+    ret = FixedPoint_SatLog_Read(&entry, 1U, &count);
+    ReportCheck("SATLOG", 1U, (boolean)((ret == E_OK) && (count == 1U) && (entry.op == (uint8)FIXEDPOINT_OP_ADD) &&
+                                        (entry.width == 16U) && (entry.a == (100 << SHIFT_16)) &&
+                                        (entry.b == (100 << SHIFT_16)) && (entry.result == FIX16_MAX)),
+                "saturating Add16 is logged with operands and result", passCount, failCount);
+
+    /* Division by zero is logged, the following regular operation is not */
+    (void)FixedPoint_Div8(1.0f, 0.0f, &r);
+    (void)FixedPoint_Add16(1.0f, 1.0f, &r);
+    ret = FixedPoint_SatLog_Read(&entry, 1U, &count);
+    ReportCheck("SATLOG", 2U, (boolean)((ret == E_OK) && (count == 1U) && (entry.op == (uint8)FIXEDPOINT_OP_DIV) &&
+                                        (entry.width == 8U) && (entry.a == (1 << SHIFT_8)) && (entry.b == 0)),
+                "division by zero is logged, regular operations are not", passCount, failCount);
+
+    SatLogTextLen = 0U;
+    SatLogText[0] = '\0';
+    ret = FixedPoint_SatLog_Dump(&SatLogCapture);
+    ReportCheck("SATLOG", 3U, (boolean)((ret == E_OK) && (strstr(SatLogText, " op=0 width=16 ") != NULL) &&
+                                        (strstr(SatLogText, " op=3 width=8 ") != NULL) &&
+                                        (strstr(SatLogText, "unlogged_threads=0\n") != NULL)),
+                "dump writes the logged entries", passCount, failCount);
+}
+#endif
+
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Thread of the concurrent shadow execution check: SHADOW_TEST_CALLS exact multiplications.
+ *
+ *  @param[in]  arg     Unused.
+ *
+ *  @return     0.
+ */
+static DWORD WINAPI ShadowTestWorker(LPVOID arg)
+{
+    float result = 0.0f;
+    uint32 n;
+
+    (void)arg;
+    for (n = 0U; n < SHADOW_TEST_CALLS; n++)
+    {
+        (void)FixedPoint_Mult16(1.5f, 2.25f, &result);
+    }
+
+    return 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the shadow execution accuracy monitor.
+ *
+ *  With a sampling rate of 1 every call is checked: exact results show no error, rounded results
+ *  stay within half an LSB, saturated results are rejected and rate 0 stops sampling. Checks of
+ *  threads running at the same time are merged, threads beyond the pool are only counted.
+ *
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunShadowTests(unsigned int* passCount, unsigned int* failCount)
+{
+    t_Fixed16 a[100];
+    t_Fixed16 b[100];
+    FixedPoint_ShadowStats_t stats;
+    float result = 0.0f;
+    uint32 i;
+    Std_ReturnType ret;
+
+    printf("\n--- MODULE CHECKS: SHADOW EXECUTION ---\n");
+
+    /* The new rate applies when the running countdown of this thread (at most the default rate) expires */
+    FixedPoint_Shadow_SetRate(1U);
+    for (i = 0U; i < FIXEDPOINT_SHADOW_DEFAULT_RATE; i++)
+    {
+        (void)FixedPoint_Add16(0.0f, 0.0f, &result);
+    }
+    FixedPoint_Shadow_Reset();
+
+    (void)FixedPoint_Mult16(1.5f, 2.25f, &result);
+    (void)FixedPoint_Mult16(100.0f, 100.0f, &result);
+    ret = FixedPoint_Shadow_GetStats(FIXEDPOINT_OP_MULT, 16U, &stats);
+    ReportCheck("SHADOW", 1U, (boolean)((ret == E_OK) && (stats.samples == 1U) && (stats.rejected == 1U) &&
+                                        (stats.maxError == 0.0)),
+                "exact result has no error, saturated result is rejected", passCount, failCount);
+
+    for (i = 0U; i < 100U; i++)
+    {
+        a[i] = (t_Fixed16)((sint32)(i * 37U) - 1800);
+        b[i] = (t_Fixed16)((sint32)(i * 11U) + 3);
+    }
+    FixedPoint_Shadow_Reset();
+    ret = FixedPoint_Mult16_Array(a, b, a, 100U);
+    ret |= FixedPoint_Shadow_GetStats(FIXEDPOINT_OP_MULT, 16U, &stats);
+    ReportCheck("SHADOW", 2U, (boolean)((ret == E_OK) && ((stats.samples + stats.rejected) == 15U) &&
+                                        (stats.samples > 0U) && (stats.maxError <= 0.5)),
+                "in-place batch kernel is checked on captured operands within 0.5 LSB", passCount, failCount);
+
+    FixedPoint_Shadow_SetRate(0U);
+    (void)FixedPoint_Add16(0.0f, 0.0f, &result);
+    FixedPoint_Shadow_Reset();
+    for (i = 0U; i < 100U; i++)
+    {
+        (void)FixedPoint_Mult16(0.1f, 0.1f, &result);
+    }
+    ret = FixedPoint_Shadow_GetStats(FIXEDPOINT_OP_MULT, 16U, &stats);
+    ReportCheck("SHADOW", 3U, (boolean)((ret == E_OK) && (stats.samples == 0U) && (stats.rejected == 0U)),
+                "rate 0 stops sampling", passCount, failCount);
+
+    /* New threads check their first call, so every call of the workers is sampled */
+    {
+        HANDLE handles[SHADOW_TEST_THREADS];
+        const uint32 dropped = FixedPoint_Shadow_GetDropped();
+        uint32 t;
+
+        FixedPoint_Shadow_SetRate(1U);
+        FixedPoint_Shadow_Reset();
+        for (t = 0U; t < SHADOW_TEST_THREADS; t++)
+        {
+            handles[t] = CreateThread(NULL, 0U, ShadowTestWorker, NULL, 0U, NULL);
+        }
+        (void)WaitForMultipleObjects((DWORD)SHADOW_TEST_THREADS, handles, TRUE, INFINITE);
+        for (t = 0U; t < SHADOW_TEST_THREADS; t++)
+        {
+            (void)CloseHandle(handles[t]);
+        }
+        ret = FixedPoint_Shadow_GetStats(FIXEDPOINT_OP_MULT, 16U, &stats);
+        ReportCheck("SHADOW", 4U, (boolean)((ret == E_OK) && (stats.rejected == 0U) && (stats.maxError == 0.0) &&
+                                            (stats.samples == ((uint64)SHADOW_TEST_CALLS *
+                                                               (SHADOW_TEST_THREADS -
+                                                                (FixedPoint_Shadow_GetDropped() - dropped))))),
+                    "checks of concurrent threads merged, threads beyond the pool counted", passCount, failCount);
+    }
+
+    FixedPoint_Shadow_SetRate(FIXEDPOINT_SHADOW_DEFAULT_RATE);
+}
+#endif
+
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+/*********************************************************************************************************************/
+/*! @brief     Thread of the metrics pool check: METRICS_TEST_CALLS additions.
+ *
+ *  @param[in]  arg     Unused.
+ *
+ *  @return     0.
+ */
+static DWORD WINAPI MetricsTestWorker(LPVOID arg)
+{
+    float result = 0.0f;
+    uint32 n;
+
+    (void)arg;
+    for (n = 0U; n < METRICS_TEST_CALLS; n++)
+    {
+        (void)FixedPoint_Add16(1.0f, 1.0f, &result);
+    }
+
+    return 0U;
+}
+
+/*********************************************************************************************************************/
+/*! @brief     Checks of the runtime counters and the Prometheus text export.
+ *
+ *  Threads beyond the counter pool must not be counted, only their number.
+ *  @param[in,out]  passCount   Pointer to counter for passed tests.
+ *  @param[in,out]  failCount   Pointer to counter for failed tests.
+ */
+static void RunMetricsTests(unsigned int* passCount, unsigned int* failCount)
+{
+    static FixedPoint_Metrics_t before;
+    static FixedPoint_Metrics_t after;
+    t_Fixed16 a[100];
+    char line[256];
+    boolean typeFound = 0U;
+    boolean bytesFound = 0U;
+    float r = 0.0f;
+    FILE* file;
+    Std_ReturnType ret;
+
+    printf("\n--- MODULE CHECKS: METRICS ---\n");
+
+    FixedPoint_Metrics_Init(NULL, 1.0);
+
+    ret = FixedPoint_Metrics_Snapshot(&before);
+    (void)FixedPoint_Add16(100.0f, 100.0f, &r);
+    (void)FixedPoint_Div8(1.0f, 0.0f, &r);
+    ret |= FixedPoint_Metrics_Snapshot(&after);
+    ReportCheck("METRICS", 1U, (boolean)((ret == E_OK) &&
+                                         ((after.calls[0][FIXEDPOINT_OP_ADD] - before.calls[0][FIXEDPOINT_OP_ADD]) == 1U) &&
+                                         ((after.saturations[0][FIXEDPOINT_OP_ADD] -
+                                           before.saturations[0][FIXEDPOINT_OP_ADD]) == 1U) &&
+                                         ((after.calls[1][FIXEDPOINT_OP_DIV] - before.calls[1][FIXEDPOINT_OP_DIV]) == 1U) &&
+                                         ((after.divZero[1] - before.divZero[1]) == 1U)),
+                "calls, saturations and divisions by zero are counted", passCount, failCount);
+
+    (void)memset(a, 0, sizeof(a));
+    ret = FixedPoint_Metrics_Snapshot(&before);
+    (void)FixedPoint_Mult16_Array(a, a, a, 100U);
+    ret |= FixedPoint_Metrics_Snapshot(&after);
+    ReportCheck("METRICS", 2U, (boolean)((ret == E_OK) &&
+                                         ((after.kernelCalls[FIXEDPOINT_KERNEL_MULT16_ARRAY] -
+                                           before.kernelCalls[FIXEDPOINT_KERNEL_MULT16_ARRAY]) == 1U) &&
+                                         ((after.kernelBytes[FIXEDPOINT_KERNEL_MULT16_ARRAY] -
+                                           before.kernelBytes[FIXEDPOINT_KERNEL_MULT16_ARRAY]) == 600U)),
+                "batch kernel calls and bytes are counted", passCount, failCount);
+
+    file = tmpfile();
+    ret = FixedPoint_Metrics_Write(file);
+    if (file != NULL)
+    {
+        rewind(file);
+        while (fgets(line, (int)sizeof(line), file) != NULL)
+        {
+            typeFound |= (strcmp(line, "# TYPE fixedpoint_saturations_total counter\n") == 0) ? 1U : 0U;
+            bytesFound |= (strstr(line, "fixedpoint_kernel_bytes_total{kernel=\"mult16_array\"} ") == line) ? 1U : 0U;
+        }
+        (void)fclose(file);
+    }
+    ReportCheck("METRICS", 3U, (boolean)((ret == E_OK) && (typeFound != 0U) && (bytesFound != 0U)),
+                "export writes Prometheus text format", passCount, failCount);
+
+    /* The strided operation is counted as itself only, also for contiguous runs and strided division */
+    ret = FixedPoint_Metrics_Snapshot(&before);
+    (void)FixedPoint_Op16_Strided(FIXEDPOINT_OP_ADD, a, 1, a, 1, a, 1, 100U);
+    (void)FixedPoint_Op16_Strided(FIXEDPOINT_OP_DIV, a, 2, &a[1], 2, a, 2, 50U);
+    ret |= FixedPoint_Metrics_Snapshot(&after);
+    ReportCheck("METRICS", 4U, (boolean)((ret == E_OK) &&
+                                         ((after.kernelCalls[FIXEDPOINT_KERNEL_OP16_STRIDED] -
+                                           before.kernelCalls[FIXEDPOINT_KERNEL_OP16_STRIDED]) == 2U) &&
+                                         (after.kernelCalls[FIXEDPOINT_KERNEL_ADD16_ARRAY] ==
+                                          before.kernelCalls[FIXEDPOINT_KERNEL_ADD16_ARRAY]) &&
+                                         (after.kernelCalls[FIXEDPOINT_KERNEL_DIV16_ARRAY] ==
+                                          before.kernelCalls[FIXEDPOINT_KERNEL_DIV16_ARRAY])),
+                "nested kernel calls counted once, by the outermost kernel", passCount, failCount);
+
+    /* More threads than slots: at least two of them find the pool exhausted */
+    {
+        HANDLE handles[METRICS_TEST_THREADS];
+        uint64 dropped;
+        uint32 t;
+
+        ret = FixedPoint_Metrics_Snapshot(&before);
+        for (t = 0U; t < METRICS_TEST_THREADS; t++)
+        {
+            handles[t] = CreateThread(NULL, 0U, MetricsTestWorker, NULL, 0U, NULL);
+        }
+        (void)WaitForMultipleObjects((DWORD)METRICS_TEST_THREADS, handles, TRUE, INFINITE);
+        for (t = 0U; t < METRICS_TEST_THREADS; t++)
+        {
+            (void)CloseHandle(handles[t]);
+        }
+        ret |= FixedPoint_Metrics_Snapshot(&after);
+        dropped = after.droppedThreads - before.droppedThreads;
+        ReportCheck("METRICS", 5U, (boolean)((ret == E_OK) && (dropped >= 2U) &&
+                                             ((after.calls[0][FIXEDPOINT_OP_ADD] - before.calls[0][FIXEDPOINT_OP_ADD]) ==
+                                              ((uint64)METRICS_TEST_CALLS * (METRICS_TEST_THREADS - dropped)))),
+                    "threads beyond the pool are not counted, only their number", passCount, failCount);
+    }
+}
+#endif
+
+/*********************************************************************************************************************/
+/*! @brief     Execute all predefined test vectors and print a summary.
+ *
+ *  The test set covers:
+ *  - Typical operations in 16-bit and 8-bit
+ *  - Positive and negative boundary and saturation behaviour
+ *  - Rounding and precision loss near resolution limits
+ *  - Division by zero handling
+ *  - Module checks of the array based interfaces
+ */
+static void RunAllTests(void)
+{
+    unsigned int passCount = 0u;
+    unsigned int failCount = 0u;
+    unsigned int i;
+
+    /* Test vector definition.
+     * The expected values are approximate and tolerances are defined according to the fixed-point resolution.
+     */
+    static const TestVector_t tests[] =
+    {
+        /* 16-bit : Typical arithmetic (calibrated for default Q7.8) */
+        {  100.5f,  20.22f, 120.72f,  TEST_EPSILON_16, "16-bit add: typical range",          TEST_OP_ADD, TEST_WIDTH_16, E_OK },
+        {  10.0f,   3.0f,   7.0f,    TEST_EPSILON_16, "16-bit sub: typical range",          TEST_OP_SUB, TEST_WIDTH_16, E_OK },
+        {   2.0f,   (-1.55f),   (-3.1f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
+        {   2.0f,   (1.55f),   (3.1f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
+        {   13.50f,   (8.50f),   (114.75f),    TEST_EPSILON_16, "16-bit mul: typical range",          TEST_OP_MUL, TEST_WIDTH_16, E_OK},
+        {  11.2f,   (-7.0f),   (-1.6f),    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
+        {  8.0f,   (3.0f),   (2.666f),    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
+        {  1.99f,   (5.373f), (0.3704f)  ,    TEST_EPSILON_16, "16-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_16, E_OK },
+        
+
+        /* 16-bit Saturation Cases (Configuration aware)*/
+        {  20000.0f, 20000.0f,   FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: positive saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
+        { (-20000.0f),(-20000.0f), FIX16_REAL_MIN ,  TEST_EPSILON_16, "16-bit add: negative saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
+        { 20000.0f, 2.0f, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit mul: positive saturation", TEST_OP_MUL, TEST_WIDTH_16, E_NOT_OK },
+        { (-20000.0f), 2.0f, FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit mul: negative saturation", TEST_OP_MUL, TEST_WIDTH_16, E_NOT_OK },
+
+        /* 16-bit Boundary Cases (Configuration aware)*/        
+        /* Exact boundary representability */
+        { FIX16_REAL_MAX, 0.0f, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: exact MAX boundary", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
+        { FIX16_REAL_MIN, 0.0f, FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit add: exact MIN boundary", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
+        /* Just over boundary saturation (1 LSB above MAX and below MIN)*/
+        { FIX16_REAL_MAX, FIX16_RESOLUTION, FIX16_REAL_MAX, TEST_EPSILON_16, "16-bit add: MAX + 1 LSB -> saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK },
+        { FIX16_REAL_MIN, (-FIX16_RESOLUTION), FIX16_REAL_MIN, TEST_EPSILON_16, "16-bit add: MIN - 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_16, E_NOT_OK},
+
+        /*16-bit: Rounding midpoint (tie) behaviour (ties away from zero)  (Configuration aware)*/
+       { (0.5f * FIX16_RESOLUTION), 0.0f, FIX16_RESOLUTION, TEST_EPSILON_16, "16-bit add: +0.5 LSB rounds to +1 LSB", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
+       { (-0.5f * FIX16_RESOLUTION), 0.0f, (-FIX16_RESOLUTION), TEST_EPSILON_16, "16-bit add: -0.5 LSB rounds to -1 LSB", TEST_OP_ADD, TEST_WIDTH_16, E_OK },
+ 
+        /* 16-bit :  Precision underflow (values below half of resolution, Configuration aware) */
+        {   FIX16_BELOW_RES,  FIX16_BELOW_RES,  0.0f ,  TEST_EPSILON_16,  "16-bit add: below resolution",         TEST_OP_ADD, TEST_WIDTH_16,  E_OK },
+
+        /* 16-bit : Division by zero */
+        {  10.0f,   0.0f,   0.0f,  TEST_EPSILON_16, "16-bit div: division by zero",        TEST_OP_DIV, TEST_WIDTH_16, E_NOT_OK },
+
+        /* 8-bit : Typical arithmetic within range (calibrated for default Q3.4) */
+        {   2.0f,   3.5f,   5.5f,  TEST_EPSILON_8,  "8-bit add: typical range",            TEST_OP_ADD, TEST_WIDTH_8,  E_OK },
+        {   4.0f,   6.0f,  (-2.0f),  TEST_EPSILON_8,  "8-bit sub: typical range",            TEST_OP_SUB, TEST_WIDTH_8,  E_OK },
+        {   2.0f,   -3.12f,   -6.24f,  TEST_EPSILON_8,  "8-bit mul: typical range",            TEST_OP_MUL, TEST_WIDTH_8,  E_OK },
+        {   2.0f,   3.12f,   6.24f,  TEST_EPSILON_8,  "8-bit mul: typical range",            TEST_OP_MUL, TEST_WIDTH_8,  E_OK },
+        {   5.0f,   2.0f,   2.5f,  TEST_EPSILON_8,  "8-bit div: typical range",            TEST_OP_DIV, TEST_WIDTH_8,  E_OK },
+        {   5.0f,   (-2.0f),   (-2.5f),  TEST_EPSILON_8,  "8-bit div: typical range",            TEST_OP_DIV, TEST_WIDTH_8,  E_OK},
+         {  7.9f,   (2.0f),   (3.95f),    TEST_EPSILON_8, "8-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_8, E_OK },
+        {  1.99f,   (5.373f), (0.3704f)  ,    TEST_EPSILON_8, "8-bit div: typical range",          TEST_OP_DIV, TEST_WIDTH_8, E_OK },
+        
+        
+
+
+        /* 8-bit: Saturation cases (Configuration aware) */
+        {   250.0f,   310.0f,   FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: positive saturation",      TEST_OP_ADD, TEST_WIDTH_8,  E_NOT_OK },
+        {  (-250.0f),  (-310.0f),  FIX8_REAL_MIN,  TEST_EPSILON_8,  "8-bit add: negative saturation",      TEST_OP_ADD, TEST_WIDTH_8,  E_NOT_OK },
+        { 300.0f, 2.0f, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit mul: positive saturation ", TEST_OP_MUL, TEST_WIDTH_8, E_NOT_OK },
+        { (-300.0f), 2.0f, FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit mul: negative saturation", TEST_OP_MUL, TEST_WIDTH_8, E_NOT_OK },
+
+
+        /* 8-bit Boundary Cases (Configuration aware)*/
+        /* Exact boundary representability */
+        { FIX8_REAL_MAX, 0.0f, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: exact MAX boundary", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
+        { FIX8_REAL_MIN, 0.0f, FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit add: exact MIN boundary", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
+        /* Just over boundary saturation (1 LSB above MAX and below MIN)*/
+        { FIX8_REAL_MAX, FIX8_RESOLUTION, FIX8_REAL_MAX, TEST_EPSILON_8, "8-bit add: MAX + 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_8, E_NOT_OK },
+        { FIX8_REAL_MIN, (-FIX8_RESOLUTION), FIX8_REAL_MIN, TEST_EPSILON_8, "8-bit add: MIN - 1 LSB ->  saturation", TEST_OP_ADD, TEST_WIDTH_8, E_NOT_OK},
+
+        /*8-bit: Rounding midpoint (tie) behaviour (ties away from zero)  (Configuration aware)*/
+       { (0.5f * FIX8_RESOLUTION), 0.0f, FIX8_RESOLUTION, TEST_EPSILON_8, "8-bit add: +0.5 LSB rounds to +1 LSB", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
+       { (-0.5f * FIX8_RESOLUTION), 0.0f, (-FIX8_RESOLUTION), TEST_EPSILON_8, "8-bit add: -0.5 LSB rounds to -1 LSB", TEST_OP_ADD, TEST_WIDTH_8, E_OK },
+
+
+        /* 8-bit Precision underflow (values below half of resolution, Configuration aware) */
+        {   FIX8_BELOW_RES,  FIX8_BELOW_RES,  0.0f ,  TEST_EPSILON_8,  "8-bit add: below resolution",         TEST_OP_ADD, TEST_WIDTH_8,  E_OK },
+       
+
+        /* 8-bit : Division by zero */
+        {   5.0f,   0.0f,   0.0f,  TEST_EPSILON_8,  "8-bit div: division by zero",         TEST_OP_DIV, TEST_WIDTH_8,  E_NOT_OK }
+    };
+
+    const unsigned int numTests = (unsigned int)(sizeof(tests) / sizeof(tests[0]));
+
+    printf("--- FIXED POINT ARITHMETIC TEST REPORT ---\n\n");
+
+    for (i = 0u; i < numTests; i++)
+    {
+        /* Run each test case */
+        RunSingleTest(&tests[i], i + 1u, &passCount, &failCount);
+    }
+
+    RunTensorTests(&passCount, &failCount);
+    RunGraphTests(&passCount, &failCount);
+    RunJobTests(&passCount, &failCount);
+    RunStreamTests(&passCount, &failCount);
+    RunServiceTests(&passCount, &failCount);
+    RunTableTests(&passCount, &failCount);
+    RunTuneTests(&passCount, &failCount);
+    RunLayoutTests(&passCount, &failCount);
+    RunConvTests(&passCount, &failCount);
+    RunCorrTests(&passCount, &failCount);
+    RunLmsTests(&passCount, &failCount);
+    RunInterpTests(&passCount, &failCount);
+    RunCtrlTests(&passCount, &failCount);
+    RunDspTests(&passCount, &failCount);
+    RunSimTests(&passCount, &failCount);
+    RunIntegTests(&passCount, &failCount);
+#if (FIXEDPOINT_RESULT_CACHE_ENABLE == 1U)
+    RunCacheTests(&passCount, &failCount);
+#endif
+#if (FIXEDPOINT_TRACE_ENABLE == 1U)
+    RunTraceTests(&passCount, &failCount);
+#endif
+#if (FIXEDPOINT_SATLOG_ENABLE == 1U)
+    RunSatLogTests(&passCount, &failCount);
+#endif
+#if (FIXEDPOINT_SHADOW_ENABLE == 1U)
+    RunShadowTests(&passCount, &failCount);
+#endif
+#if (FIXEDPOINT_METRICS_ENABLE == 1U)
+    RunMetricsTests(&passCount, &failCount);
+#endif
+
+    printf("\n--- SUMMARY ---\n");
+    printf("Total tests : %u\n", passCount + failCount);
+    printf("Passed      : %u\n", passCount);
+    printf("Failed      : %u\n", failCount);
+}
+
+/***********************************************************************************************************************
+ GLOBAL FUNCTIONS
+ **********************************************************************************************************************/
+
+ /*********************************************************************************************************************/
+ /*! @brief        Main entry point for the FixedPoint test suite.
+  *
+  *  This function executes all predefined test vectors for both 16-bit and
+  *  8 bit fixed-point arithmetic. The test results are printed to the console
+  *  as PASS/FAIL. With the command line option --bench the benchmarks are
+  *  executed afterwards, with --build-tables <file> the table image of the
+  *  current configuration is written to a file and with --tune <file> the
+  *  tuning profile of this host is written to a file, with --roofline <file> the roofline
+  *  data of this host is written as CSV. Finally, the application waits for a key press
+  *  before terminating, so that output remains visible.
+  *
+  *  @param[in]    argc         Number of command line arguments.
+  *  @param[in]    argv         Command line arguments.
+  *
+  *  @return       int
+  *
+  *  @retval       0            Execution finished successfully.
+  */
+int main(int argc, char* argv[])
+{
+    int i;
+
+    RunAllTests();
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--bench") == 0)
+        {
+            RunBenchmarks();
+        }
+        else if ((strcmp(argv[i], "--build-tables") == 0) && ((i + 1) < argc))
+        {
+            i++;
+            (void)BuildTableFile(argv[i]);
+        }
+        else if ((strcmp(argv[i], "--tune") == 0) && ((i + 1) < argc))
+        {
+            i++;
+            (void)TuneToFile(argv[i]);
+        }
+        else if ((strcmp(argv[i], "--roofline") == 0) && ((i + 1) < argc))
+        {
+            i++;
+            (void)RunRoofline(argv[i]);
+        }
+    }
 
     printf("\nPress any key to close.....\n");
     while (!_kbhit())
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+Fixed Point Arithmetic - roofline plot
+
+Plots the CSV written by the test application with --roofline <file>: the compute roof (in-cache
+16-bit multiply-add), the memory roof (triad bandwidth) and the achieved throughput of every batch
+kernel per problem size. Small sizes run from cache and may lie above the memory roof.
+
+Usage:   python3 plot_roofline.py roofline.csv [roofline.png]
+Requires matplotlib.
+"""
+
+import csv
+import sys
+
+import matplotlib
+matplotlib.use("Agg")
+import matplotlib.pyplot as plt
+
+
+def main(argv):
+    if len(argv) < 2:
+        print(__doc__)
+        return 1
+
+    out = argv[2] if len(argv) > 2 else "roofline.png"
+    peak = None
+    bandwidth = {}
+    kernels = {}
+
+    with open(argv[1], newline="") as f:
+        for row in csv.DictReader(f):
+            if row["kind"] == "peak":
+                peak = float(row["gops"])
+            elif row["kind"] == "bandwidth":
+                bandwidth[row["name"]] = float(row["gbytes"])
+            else:
+                kernels.setdefault(row["name"], []).append(
+                    (int(row["elements"]), float(row["ops_per_byte"]), float(row["gops"])))
+
+    if peak is None or "triad" not in bandwidth:
+        print("incomplete roofline data in " + argv[1])
+        return 1
+
+    fig, ax = plt.subplots(figsize=(9, 6))
+    ridge = peak / bandwidth["triad"]
+    x = [ridge / 1000.0, ridge, ridge * 1000.0]
+    ax.plot(x, [min(peak, bandwidth["triad"] * i) for i in x], "k-", linewidth=2,
+            label="roof (triad %.1f GB/s, peak %.1f Gop/s)" % (bandwidth["triad"], peak))
+    if "copy" in bandwidth:
+        ax.plot(x, [min(peak, bandwidth["copy"] * i) for i in x], "k:", linewidth=1,
+                label="copy %.1f GB/s" % bandwidth["copy"])
+
+    for name, points in sorted(kernels.items()):
+        points.sort()
+        sc = ax.scatter([p[1] for p in points], [p[2] for p in points], s=[12 + 6 * i for i in range(len(points))],
+                        label=name, alpha=0.7)
+        # Label the largest size, which runs from memory
+        ax.annotate("%d" % points[-1][0], (points[-1][1], points[-1][2]), fontsize=7,
+                    color=sc.get_facecolor()[0], xytext=(4, -4), textcoords="offset points")
+
+    ax.set_xscale("log")
+    ax.set_yscale("log")
+    ax.set_xlabel("arithmetic intensity (operations per byte)")
+    ax.set_ylabel("throughput (Gop/s)")
+    ax.set_title("Fixed point kernels: roofline (marker size grows with problem size)")
+    ax.grid(True, which="both", linestyle=":", linewidth=0.5)
+    ax.legend(fontsize=8, loc="lower right")
+    fig.tight_layout()
+    fig.savefig(out, dpi=120)
+    print("written " + out)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))